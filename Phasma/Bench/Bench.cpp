@@ -0,0 +1,294 @@
+#include "Bench.h"
+#include "rapidjson/document.h"
+#include "rapidjson/istreamwrapper.h"
+#include "rapidjson/ostreamwrapper.h"
+#include "rapidjson/prettywriter.h"
+
+namespace pe::bench
+{
+    namespace
+    {
+        std::atomic<uint64_t> s_allocCount{0};
+        std::atomic<uint64_t> s_allocBytes{0};
+
+        using Clock = std::chrono::steady_clock;
+
+        double Median(std::vector<double> &samples)
+        {
+            if (samples.empty())
+                return 0.0;
+            const size_t mid = samples.size() / 2;
+            std::nth_element(samples.begin(), samples.begin() + mid, samples.end());
+            double median = samples[mid];
+            if ((samples.size() & 1) == 0)
+                median = (median + *std::max_element(samples.begin(), samples.begin() + mid)) * 0.5;
+            return median;
+        }
+
+        const char *BuildConfig()
+        {
+#if defined(PE_DEBUG)
+            return "Debug";
+#elif defined(PE_RELWITHDEBINFO)
+            return "RelWithDebInfo";
+#elif defined(PE_MINSIZEREL)
+            return "MinSizeRel";
+#else
+            return "Release";
+#endif
+        }
+    } // namespace
+
+    bool AllocCounters::Available()
+    {
+#if defined(PE_MEMORY_TAG_NEW)
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    AllocCounters AllocCounters::Now()
+    {
+        return {s_allocCount.load(std::memory_order_relaxed), s_allocBytes.load(std::memory_order_relaxed)};
+    }
+
+    std::vector<Suite> &Suites()
+    {
+        static std::vector<Suite> s_suites;
+        return s_suites;
+    }
+
+    bool Context::Enabled(const std::string &name) const
+    {
+        return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+    }
+
+    Result *Context::MeasureImpl(const std::string &name, uint64_t itemsPerIteration, void (*fn)(void *), void *ctx)
+    {
+        fn(ctx); // warm-up: first-touch pages, lazy statics, caches
+
+        std::vector<double> samples;
+        samples.reserve(64);
+        double totalNs = 0.0;
+        uint64_t allocCount = 0;
+        uint64_t allocBytes = 0;
+
+        while (samples.size() < m_options.maxIterations &&
+               (samples.size() < m_options.minIterations || totalNs < m_options.minTimeMs * 1e6))
+        {
+            // Counted per iteration so the harness's own bookkeeping stays out of the figures
+            const AllocCounters allocsBefore = AllocCounters::Now();
+            const Clock::time_point start = Clock::now();
+            fn(ctx);
+            const Clock::time_point end = Clock::now();
+            const AllocCounters allocsAfter = AllocCounters::Now();
+
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            samples.push_back(ns);
+            totalNs += ns;
+            allocCount += allocsAfter.count - allocsBefore.count;
+            allocBytes += allocsAfter.bytes - allocsBefore.bytes;
+        }
+
+        Result result;
+        result.name = name;
+        result.iterations = samples.size();
+        result.itemsPerIteration = itemsPerIteration;
+        result.meanNs = totalNs / static_cast<double>(samples.size());
+        result.minNs = *std::min_element(samples.begin(), samples.end());
+        result.maxNs = *std::max_element(samples.begin(), samples.end());
+        result.medianNs = Median(samples);
+        result.allocsPerIteration = static_cast<double>(allocCount) / static_cast<double>(result.iterations);
+        result.allocBytesPerIteration = static_cast<double>(allocBytes) / static_cast<double>(result.iterations);
+
+        std::printf("%-48s %10llu it %12.1f us  %10.1f allocs/it",
+                    name.c_str(),
+                    static_cast<unsigned long long>(result.iterations),
+                    result.medianNs / 1000.0,
+                    result.allocsPerIteration);
+        if (itemsPerIteration)
+            std::printf("  %12.3f M items/s", static_cast<double>(itemsPerIteration) / result.medianNs * 1000.0);
+        std::printf("\n");
+        std::fflush(stdout);
+
+        m_results.push_back(std::move(result));
+        return &m_results.back();
+    }
+
+    bool WriteJson(const std::filesystem::path &file, const std::vector<Result> &results, const Options &options)
+    {
+        rapidjson::Document d;
+        d.SetObject();
+        auto &allocator = d.GetAllocator();
+
+        rapidjson::Value build(rapidjson::kObjectType);
+        build.AddMember("config", rapidjson::StringRef(BuildConfig()), allocator);
+#if defined(_MSC_VER)
+        build.AddMember("compiler", "msvc", allocator);
+#elif defined(__clang__)
+        build.AddMember("compiler", "clang", allocator);
+#else
+        build.AddMember("compiler", "gcc", allocator);
+#endif
+        build.AddMember("alloc_counting", AllocCounters::Available(), allocator);
+
+        rapidjson::Value machine(rapidjson::kObjectType);
+        machine.AddMember("hardware_threads", std::thread::hardware_concurrency(), allocator);
+        machine.AddMember("job_workers", JobSystem::Get().GetWorkerCount(), allocator);
+
+        rapidjson::Value settings(rapidjson::kObjectType);
+        settings.AddMember("min_time_ms", options.minTimeMs, allocator);
+        settings.AddMember("min_iterations", options.minIterations, allocator);
+        settings.AddMember("filter", rapidjson::Value(options.filter.c_str(), allocator), allocator);
+
+        rapidjson::Value benchmarks(rapidjson::kArrayType);
+        for (const Result &result : results)
+        {
+            rapidjson::Value b(rapidjson::kObjectType);
+            b.AddMember("name", rapidjson::Value(result.name.c_str(), allocator), allocator);
+            b.AddMember("iterations", result.iterations, allocator);
+            b.AddMember("median_ns", result.medianNs, allocator);
+            b.AddMember("mean_ns", result.meanNs, allocator);
+            b.AddMember("min_ns", result.minNs, allocator);
+            b.AddMember("max_ns", result.maxNs, allocator);
+            b.AddMember("allocs_per_iter", result.allocsPerIteration, allocator);
+            b.AddMember("alloc_bytes_per_iter", result.allocBytesPerIteration, allocator);
+            if (result.itemsPerIteration)
+            {
+                b.AddMember("items_per_iter", result.itemsPerIteration, allocator);
+                b.AddMember("items_per_second", static_cast<double>(result.itemsPerIteration) / result.medianNs * 1e9, allocator);
+            }
+            if (!result.counters.empty())
+            {
+                rapidjson::Value counters(rapidjson::kObjectType);
+                for (const auto &[key, value] : result.counters)
+                {
+                    rapidjson::Value counterName(key.c_str(), allocator);
+                    counters.AddMember(counterName, value, allocator);
+                }
+                b.AddMember("counters", counters.Move(), allocator);
+            }
+            benchmarks.PushBack(b.Move(), allocator);
+        }
+
+        d.AddMember("schema", 1, allocator);
+        d.AddMember("suite", "PhasmaBench", allocator);
+        d.AddMember("build", build.Move(), allocator);
+        d.AddMember("machine", machine.Move(), allocator);
+        d.AddMember("settings", settings.Move(), allocator);
+        d.AddMember("benchmarks", benchmarks.Move(), allocator);
+
+        std::ofstream ofs(file);
+        if (!ofs.is_open())
+        {
+            PE_WARN("[Bench] Failed to open %s for writing", file.string().c_str());
+            return false;
+        }
+
+        rapidjson::OStreamWrapper osw(ofs);
+        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(osw);
+        writer.SetMaxDecimalPlaces(3);
+        return d.Accept(writer) && !ofs.bad();
+    }
+
+    int CompareBaseline(const std::filesystem::path &file, const std::vector<Result> &results, double thresholdPercent)
+    {
+        std::ifstream ifs(file);
+        if (!ifs.is_open())
+        {
+            PE_WARN("[Bench] Baseline %s not found; nothing to compare", file.string().c_str());
+            return 0;
+        }
+
+        rapidjson::IStreamWrapper isw(ifs);
+        rapidjson::Document d;
+        d.ParseStream(isw);
+        if (d.HasParseError() || !d.IsObject() || !d.HasMember("benchmarks") || !d["benchmarks"].IsArray())
+        {
+            PE_WARN("[Bench] Baseline %s is not a PhasmaBench report", file.string().c_str());
+            return 0;
+        }
+
+        std::unordered_map<std::string, const rapidjson::Value *> baseline;
+        for (const rapidjson::Value &b : d["benchmarks"].GetArray())
+        {
+            if (b.IsObject() && b.HasMember("name") && b["name"].IsString())
+                baseline[b["name"].GetString()] = &b;
+        }
+
+        const double limit = 1.0 + thresholdPercent / 100.0;
+        int regressions = 0;
+        for (const Result &result : results)
+        {
+            auto it = baseline.find(result.name);
+            if (it == baseline.end())
+                continue;
+
+            const rapidjson::Value &b = *it->second;
+            const double baseMedian = b.HasMember("median_ns") && b["median_ns"].IsNumber() ? b["median_ns"].GetDouble() : 0.0;
+            const double baseAllocs = b.HasMember("allocs_per_iter") && b["allocs_per_iter"].IsNumber() ? b["allocs_per_iter"].GetDouble() : 0.0;
+
+            if (baseMedian > 0.0 && result.medianNs > baseMedian * limit)
+            {
+                std::printf("REGRESSION %s: median %.1f us -> %.1f us (%+.1f%%)\n",
+                            result.name.c_str(), baseMedian / 1000.0, result.medianNs / 1000.0,
+                            (result.medianNs / baseMedian - 1.0) * 100.0);
+                regressions++;
+            }
+            // Allocation counts are deterministic, so any growth past rounding is real. +0.5 keeps a
+            // zero-allocation baseline from flagging a single amortized vector growth.
+            if (AllocCounters::Available() && result.allocsPerIteration > baseAllocs * limit + 0.5)
+            {
+                std::printf("REGRESSION %s: allocs/it %.1f -> %.1f\n",
+                            result.name.c_str(), baseAllocs, result.allocsPerIteration);
+                regressions++;
+            }
+        }
+        return regressions;
+    }
+} // namespace pe::bench
+
+#if !defined(PE_MEMORY_TAG_NEW)
+// Counting-only replacement. Aligned new/delete keep the runtime's implementation and stay uncounted.
+// ponytail: on Windows PhasmaCore is a DLL with its own CRT operator new, so only allocations made
+// from this executable and the static PhasmaRuntime are counted there.
+namespace
+{
+    void *CountedAlloc(size_t size)
+    {
+        pe::bench::s_allocCount.fetch_add(1, std::memory_order_relaxed);
+        pe::bench::s_allocBytes.fetch_add(size, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+} // namespace
+
+void *operator new(size_t size)
+{
+    if (void *p = CountedAlloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+void operator delete[](void *p, size_t) noexcept { std::free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { std::free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { std::free(p); }
+#endif
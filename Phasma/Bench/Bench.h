@@ -0,0 +1,103 @@
+#pragma once
+
+namespace pe::bench
+{
+    // Global heap counters fed by PhasmaBench's operator new (every thread). Without the replacement
+    // (PE_MEMORY_TAG_NEW builds own the global operator new) they stay at zero and Available() is false.
+    struct AllocCounters
+    {
+        uint64_t count = 0;
+        uint64_t bytes = 0;
+
+        static bool Available();
+        static AllocCounters Now();
+    };
+
+    struct Result
+    {
+        std::string name;
+        uint64_t iterations = 0;
+        double minNs = 0.0;
+        double medianNs = 0.0;
+        double meanNs = 0.0;
+        double maxNs = 0.0;
+        double allocsPerIteration = 0.0;
+        double allocBytesPerIteration = 0.0;
+        uint64_t itemsPerIteration = 0; // 0 = no throughput figure
+        std::map<std::string, double> counters;
+    };
+
+    struct Options
+    {
+        std::string filter;         // substring match on the full benchmark name
+        double minTimeMs = 250.0;   // keep iterating until this much measured time has passed...
+        uint64_t minIterations = 5; // ...and at least this many iterations ran
+        uint64_t maxIterations = 1000000;
+    };
+
+    // Handed to every suite. Setup happens in the suite body; only the callables passed to Measure are
+    // timed, each iteration on its own so the median is robust against the odd preempted run.
+    class Context
+    {
+    public:
+        Context(const Options &options, std::vector<Result> &results) : m_options{options}, m_results{results} {}
+
+        bool Enabled(const std::string &name) const;
+
+        // Runs one untimed warm-up, then `body` until the time/iteration budget is met
+        template <class F>
+        Result *Measure(const std::string &name, F &&body, uint64_t itemsPerIteration = 0)
+        {
+            if (!Enabled(name))
+                return nullptr;
+            return MeasureImpl(name, itemsPerIteration, [](void *ctx)
+                               { (*static_cast<std::remove_reference_t<F> *>(ctx))(); },
+                               const_cast<void *>(static_cast<const void *>(&body)));
+        }
+
+    private:
+        Result *MeasureImpl(const std::string &name, uint64_t itemsPerIteration, void (*fn)(void *), void *ctx);
+
+        const Options &m_options;
+        std::vector<Result> &m_results;
+    };
+
+    using SuiteFn = void (*)(Context &ctx);
+
+    struct Suite
+    {
+        const char *name;
+        SuiteFn fn;
+        bool needsRhi; // brings up the null RHI before the suite runs
+    };
+
+    std::vector<Suite> &Suites();
+
+    struct SuiteRegistrar
+    {
+        SuiteRegistrar(const char *name, SuiteFn fn, bool needsRhi) { Suites().push_back({name, fn, needsRhi}); }
+    };
+
+    // Keeps the optimizer from discarding a result the benchmark only computes for its cost
+    template <class T>
+    inline void DoNotOptimize(const T &value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile const void *s_sink;
+        s_sink = &value;
+#else
+        asm volatile("" : : "g"(&value) : "memory");
+#endif
+    }
+
+    bool WriteJson(const std::filesystem::path &file, const std::vector<Result> &results, const Options &options);
+
+    // Compares against a previous WriteJson output: a benchmark regresses when its median time or its
+    // allocations per iteration grew by more than thresholdPercent. Returns the number of regressions.
+    int CompareBaseline(const std::filesystem::path &file, const std::vector<Result> &results, double thresholdPercent);
+} // namespace pe::bench
+
+#define PE_BENCH_SUITE(name, needsRhi)                                                           \
+    static void PE_CONCAT(BenchSuite_, name)(pe::bench::Context & ctx);                          \
+    static pe::bench::SuiteRegistrar PE_CONCAT(s_benchSuite_, name)(#name, &PE_CONCAT(BenchSuite_, name), needsRhi); \
+    static void PE_CONCAT(BenchSuite_, name)(pe::bench::Context & ctx)
@@ -0,0 +1,29 @@
+#include "Bench.h"
+#include "Corpus.h"
+#include "Animation/AnimationEvaluator.h"
+
+namespace pe::bench
+{
+    PE_BENCH_SUITE(Animation, false)
+    {
+        for (int boneCount : {64, 256})
+        {
+            Skeleton skeleton;
+            AnimationClip clip;
+            MakeSkeletonAndClip(boneCount, 4.0f, skeleton, clip);
+
+            // 32 characters per iteration at staggered times, like one crowd update
+            constexpr int kInstances = 32;
+            std::vector<mat4> matrices;
+            ctx.Measure("Animation/EvaluatePose/" + std::to_string(boneCount) + "bones", [&]()
+                        {
+                            for (int i = 0; i < kInstances; ++i)
+                            {
+                                const float time = std::fmod(static_cast<float>(i) * 3.7f, clip.duration);
+                                AnimationEvaluator::EvaluatePose(clip, skeleton, time, matrices);
+                                DoNotOptimize(matrices.data());
+                            } },
+                        static_cast<uint64_t>(kInstances) * boneCount);
+        }
+    }
+} // namespace pe::bench
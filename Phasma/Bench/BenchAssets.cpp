@@ -0,0 +1,89 @@
+#include "Bench.h"
+#include "Corpus.h"
+#include "Scene/ModelAsset.h"
+#include "Scene/ModelAssetCooked.h"
+#include "Scene/Primitives.h"
+#include "Scene/Scene.h"
+
+namespace pe::bench
+{
+    // Runs on the null RHI: uploads and submits are real calls that just do no GPU work, so these
+    // measure the CPU side of loading and (de)serialising.
+    PE_BENCH_SUITE(Assets, true)
+    {
+        const std::filesystem::path scratch = MakeScratchDir("assets");
+
+        if (ctx.Enabled("Assets/ModelAssetCooked::Load"))
+        {
+            const std::filesystem::path file = scratch / "torus.pemesh";
+            ModelAsset *source = Primitives::CreateTorus(1.0f, 0.25f, 256, 64);
+            const bool written = ModelAssetCooked::WriteToFile(source, file);
+            delete source;
+
+            if (written)
+            {
+                std::error_code ec;
+                const uint64_t bytes = std::filesystem::file_size(file, ec);
+                Result *result = ctx.Measure("Assets/ModelAssetCooked::Load/torus", [&]()
+                                             {
+                                                 ModelAsset *model = ModelAssetCooked::Load(file);
+                                                 DoNotOptimize(model);
+                                                 delete model; });
+                if (result)
+                    result->counters["file_bytes"] = static_cast<double>(bytes);
+            }
+            else
+            {
+                PE_WARN("PhasmaBench: failed to write %s", file.string().c_str());
+            }
+        }
+
+        if (ctx.Enabled("Assets/Scene"))
+        {
+            // A wide, three-level hierarchy, roughly the node count of a dressed level
+            constexpr int kRoots = 40;
+            constexpr int kChildren = 10;
+            constexpr int kGrandChildren = 4;
+
+            Scene scene;
+            Rng rng(kCorpusSeed ^ 0x5CE7Eull);
+            auto randomMatrix = [&rng]()
+            {
+                mat4 m = translate(mat4(1.0f), vec3(rng.Range(-500.0f, 500.0f), rng.Range(0.0f, 50.0f), rng.Range(-500.0f, 500.0f)));
+                return rotate(m, rng.Range(0.0f, 6.28f), vec3(0.0f, 1.0f, 0.0f));
+            };
+            for (int r = 0; r < kRoots; ++r)
+            {
+                NodeId *root = scene.CreateNode("Root_" + std::to_string(r));
+                scene.SetLocalMatrix(root, randomMatrix());
+                for (int c = 0; c < kChildren; ++c)
+                {
+                    NodeId *child = scene.CreateNode("Child_" + std::to_string(c), root);
+                    scene.SetLocalMatrix(child, randomMatrix());
+                    for (int g = 0; g < kGrandChildren; ++g)
+                        scene.SetLocalMatrix(scene.CreateNode("Leaf_" + std::to_string(g), child), randomMatrix());
+                }
+            }
+
+            constexpr uint64_t kNodes = kRoots * (1 + kChildren * (1 + kGrandChildren));
+            const std::string snapshot = scene.TakeSnapshot();
+
+            Result *take = ctx.Measure("Assets/Scene::TakeSnapshot/2k", [&]()
+                                       {
+                                           std::string json = scene.TakeSnapshot();
+                                           DoNotOptimize(json.data()); },
+                                       kNodes);
+            if (take)
+                take->counters["json_bytes"] = static_cast<double>(snapshot.size());
+
+            ctx.Measure("Assets/Scene::RestoreSnapshot/2k", [&]()
+                        {
+                            const bool restored = scene.RestoreSnapshot(snapshot);
+                            DoNotOptimize(restored); },
+                        kNodes);
+        }
+
+        std::error_code ec;
+        std::filesystem::remove_all(scratch, ec);
+    }
+} // namespace pe::bench
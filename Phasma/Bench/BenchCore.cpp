@@ -0,0 +1,542 @@
+#include "Bench.h"
+#include "Corpus.h"
+#include "Base/BlockCompress.h"
+#include "Base/Lz4.h"
+#include "Base/PeTracker.h"
+#include "Base/ProfilerFlightRecorder.h"
+#include "Base/ProfilerSnapshot.h"
+#include "Base/ProfilerWire.h"
+
+namespace pe::bench
+{
+    namespace
+    {
+        struct TrackedSample
+        {
+            uint64_t value = 0;
+        };
+
+        // A busy frame as the profiler sees it: 3000 scopes over 8 threads from a few hundred names
+        ProfilerSnapshot MakeProfilerSnapshot()
+        {
+            static std::vector<std::string> s_names;
+            static std::vector<std::string> s_threadNames;
+            if (s_names.empty())
+            {
+                for (int i = 0; i < 300; ++i)
+                    s_names.push_back("System::Update_" + std::to_string(i));
+                for (int i = 0; i < 8; ++i)
+                    s_threadNames.push_back(i == 0 ? "Main" : "Worker " + std::to_string(i));
+            }
+
+            Rng rng(kCorpusSeed ^ 0x9F0Full);
+            ProfilerSnapshot snapshot;
+            snapshot.fps = 144.0f;
+            snapshot.frameMs = 6.9f;
+            snapshot.cpuTotalMs = 5.1f;
+            for (uint32_t t = 0; t < s_threadNames.size(); ++t)
+                snapshot.cpuThreads.push_back({s_threadNames[t].c_str(), 1000u + t});
+            for (int i = 0; i < 3000; ++i)
+            {
+                Profiler::Entry entry;
+                entry.name = s_names[rng.Below(static_cast<uint32_t>(s_names.size()))].c_str();
+                entry.startOffsetMs = rng.Range(0.0f, 6.0f);
+                entry.timeMs = rng.Range(0.001f, 0.5f);
+                entry.depth = rng.Below(6);
+                entry.thread = rng.Below(static_cast<uint32_t>(s_threadNames.size()));
+                snapshot.cpuEntries.push_back(entry);
+            }
+            for (int i = 0; i < 64; ++i)
+                snapshot.gpuSamples.push_back({s_names[i], rng.Below(3), rng.Range(0.01f, 1.0f), rng.Range(0.0f, 6.0f)});
+            for (int i = 0; i < 16; ++i)
+                snapshot.counters.push_back({s_names[i].c_str(), rng.Next() >> 44});
+            for (int i = 0; i < 120; ++i)
+                snapshot.frameHistory.push_back({rng.Range(6.0f, 8.0f), 5.0f, 3.0f, 2.0f, 6.0f});
+            ProfilerSnapshot::GatherMemoryTags(snapshot.memoryTags);
+            return snapshot;
+        }
+    } // namespace
+
+    PE_BENCH_SUITE(Core, false)
+    {
+        {
+            // 4096 tiny jobs, the overhead-dominated case the job system was built for
+            constexpr uint32_t kJobs = 4096;
+            std::vector<uint64_t> out(kJobs);
+            auto work = [&out](uint32_t i)
+            {
+                uint64_t h = i;
+                for (int k = 0; k < 64; ++k)
+                    h = h * 6364136223846793005ull + 1442695040888963407ull;
+                out[i] = h;
+            };
+
+            ctx.Measure("Core/ThreadPool::Enqueue/4k", [&]()
+                        {
+                            std::vector<std::shared_future<void>> futures;
+                            futures.reserve(kJobs);
+                            for (uint32_t i = 0; i < kJobs; ++i)
+                                futures.push_back(ThreadPool::General.Enqueue([&work, i]()
+                                                                              { work(i); }));
+                            for (auto &future : futures)
+                                future.wait(); },
+                        kJobs);
+
+            ctx.Measure("Core/JobSystem::ParallelFor/4k", [&]()
+                        { ParallelFor(kJobs, 16, work); },
+                        kJobs);
+
+            // Frame-shaped graph: 8 independent chains of 16 tasks
+            TaskGraph graph;
+            ctx.Measure("Core/TaskGraph/8x16", [&]()
+                        {
+                            graph.Reset();
+                            for (uint32_t chain = 0; chain < 8; ++chain)
+                            {
+                                TaskGraph::Task *task = graph.Add([&work, chain]()
+                                                                  { work(chain * 16); });
+                                for (uint32_t i = 1; i < 16; ++i)
+                                    task = graph.Then(task, [&work, chain, i]()
+                                                      { work(chain * 16 + i); });
+                            }
+                            graph.Run();
+                            graph.Wait(); },
+                        8 * 16);
+        }
+
+        if (ctx.Enabled("Core/ResourceManager"))
+        {
+            // Lookups from every worker at once, as material and texture resolution does during a
+            // parallel scene load; a load in flight must not stall lookups of other ids
+            struct BenchResource : Resource
+            {
+            };
+            constexpr uint32_t kIds = 1024;
+            constexpr uint32_t kLookups = 16384;
+            std::vector<std::string> ids;
+            std::vector<ResourceHandle<BenchResource>> held;
+            for (uint32_t i = 0; i < kIds; ++i)
+            {
+                ids.push_back("Bench/Resource_" + std::to_string(i));
+                held.push_back(ResourceManager::Get().Load<BenchResource>(ids.back()));
+            }
+
+            ctx.Measure("Core/ResourceManager::Find/16k", [&]()
+                        { ParallelFor(kLookups, 256, [&](uint32_t i)
+                                      { DoNotOptimize(ResourceManager::Get().Find<BenchResource>(ids[(i * 7919u) % kIds]).get()); }); },
+                        kLookups);
+        }
+
+        if (ctx.Enabled("Core/Profiler"))
+        {
+            const ProfilerSnapshot snapshot = MakeProfilerSnapshot();
+
+            ProfilerWireEncoder encoder;
+            std::string wire;
+            encoder.Encode(snapshot, wire); // the first frame carries the string table
+            Result *binary = ctx.Measure("Core/Profiler/WireEncode/3k", [&]()
+                                         {
+                                             encoder.Encode(snapshot, wire);
+                                             DoNotOptimize(wire.data()); },
+                                         snapshot.cpuEntries.size());
+            if (binary)
+                binary->counters["bytes"] = static_cast<double>(wire.size());
+
+            size_t jsonBytes = 0;
+            Result *json = ctx.Measure("Core/Profiler/ToJson/3k", [&]()
+                                       {
+                                           std::string text = snapshot.ToJson();
+                                           jsonBytes = text.size(); },
+                                       snapshot.cpuEntries.size());
+            if (json)
+                json->counters["bytes"] = static_cast<double>(jsonBytes);
+        }
+
+        if (ctx.Enabled("Core/Profiler/FlightRecorder"))
+        {
+            // A 3k-scope frame through the Profiler, then the same frame with the flight recorder ticking
+            // after it; tickNs is the difference, what the always-on recorder costs the Player each frame
+            const ProfilerSnapshot snapshot = MakeProfilerSnapshot();
+            const size_t scopes = snapshot.cpuEntries.size();
+            auto frame = [&]()
+            {
+                Profiler::BeginFrame();
+                for (size_t i = 0; i + 2 < scopes; i += 3)
+                {
+                    CpuProfileScope outer(snapshot.cpuEntries[i].name);
+                    {
+                        CpuProfileScope first(snapshot.cpuEntries[i + 1].name);
+                    }
+                    {
+                        CpuProfileScope second(snapshot.cpuEntries[i + 2].name);
+                    }
+                }
+                Profiler::EndFrame();
+            };
+
+            // Results live in a vector that the next Measure may grow, so keep the number, not the pointer
+            const Result *base = ctx.Measure("Core/Profiler/FlightRecorder/Frame/3k", frame, scopes);
+            const double baseNs = base ? base->medianNs : -1.0;
+
+            ProfilerFlightRecorder recorder;
+            ProfilerFlightRecorder::Config config;
+            config.hitchBudgetMs = 1e9f; // never dumps
+            config.chromeTrace = false;
+            recorder.Start(config, std::filesystem::temp_directory_path().string() + "/");
+            Result *tick = ctx.Measure("Core/Profiler/FlightRecorder/Tick/3k", [&]()
+                                       {
+                                           frame();
+                                           recorder.Tick(); },
+                                       scopes);
+            recorder.Stop();
+            if (tick && baseNs >= 0.0)
+                tick->counters["tickNs"] = tick->medianNs - baseNs;
+        }
+
+        {
+            // 8 threads logging at once, end to end through Flush. Every message is distinct (thread and
+            // iteration) so each one reaches the sinks; the Repeat case measures the suppression path.
+            constexpr int kThreads = 8;
+            constexpr int kPerThread = 2000;
+            std::vector<std::vector<std::string>> messages(kThreads);
+            for (int t = 0; t < kThreads; ++t)
+            {
+                messages[t].reserve(kPerThread);
+                for (int i = 0; i < kPerThread; ++i)
+                    messages[t].push_back("PhasmaBench log throughput thread " + std::to_string(t) + " message " + std::to_string(i));
+            }
+
+            ctx.Measure("Core/Log::Info/8threads", [&]()
+                        {
+                            std::vector<std::thread> threads;
+                            threads.reserve(kThreads);
+                            for (int t = 0; t < kThreads; ++t)
+                                threads.emplace_back([&messages, t]()
+                                                     {
+                                                         for (const std::string &message : messages[t])
+                                                             Log::Info(message); });
+                            for (std::thread &thread : threads)
+                                thread.join();
+                            Log::Flush(); },
+                        kThreads * kPerThread);
+
+            ctx.Measure("Core/Log::Info/8threads/Repeat", [&]()
+                        {
+                            std::vector<std::thread> threads;
+                            threads.reserve(kThreads);
+                            for (int t = 0; t < kThreads; ++t)
+                                threads.emplace_back([]()
+                                                     {
+                                                         const std::string message = "PhasmaBench log throughput";
+                                                         for (int i = 0; i < kPerThread; ++i)
+                                                             Log::Info(message); });
+                            for (std::thread &thread : threads)
+                                thread.join();
+                            Log::Flush(); },
+                        kThreads * kPerThread);
+        }
+
+        {
+            constexpr int kObjects = 100000;
+            std::vector<TrackedSample> objects(kObjects);
+            std::vector<PeTrackerHandle> handles(kObjects);
+            ctx.Measure("Core/PeTracker/TrackUntrack/100k", [&]()
+                        {
+                            for (int i = 0; i < kObjects; ++i)
+                                handles[i] = PeTracker::Track(typeid(TrackedSample), &objects[i]);
+                            for (int i = kObjects - 1; i >= 0; --i)
+                                PeTracker::Untrack(typeid(TrackedSample), handles[i]); },
+                        kObjects);
+
+            // The same churn split over 8 threads on one type, as when loaders create buffers and images
+            constexpr int kThreads = 8;
+            constexpr int kPerThread = kObjects / kThreads;
+            ctx.Measure("Core/PeTracker/TrackUntrack/100k/8threads", [&]()
+                        {
+                            std::vector<std::thread> threads;
+                            threads.reserve(kThreads);
+                            for (int t = 0; t < kThreads; ++t)
+                                threads.emplace_back([&objects, &handles, t]()
+                                                     {
+                                                         const int begin = t * kPerThread;
+                                                         for (int i = begin; i < begin + kPerThread; ++i)
+                                                             handles[i] = PeTracker::Track(typeid(TrackedSample), &objects[i]);
+                                                         for (int i = begin + kPerThread - 1; i >= begin; --i)
+                                                             PeTracker::Untrack(typeid(TrackedSample), handles[i]); });
+                            for (std::thread &thread : threads)
+                                thread.join(); },
+                        kObjects);
+        }
+
+        {
+            constexpr int kOps = 100000;
+            ctx.Measure("Core/MemoryTracker/AddRemoveCpu/100k", [&]()
+                        {
+                            for (int i = 0; i < kOps; ++i)
+                            {
+                                const MemoryTag tag = static_cast<MemoryTag>(1 + (i & 7));
+                                MemoryTracker::AddCpu(tag, 64 + (i & 1023));
+                                MemoryTracker::RemoveCpu(tag, 64 + (i & 1023));
+                            } },
+                        kOps);
+        }
+
+        if (ctx.Enabled("Core/Hash"))
+        {
+            // Pack integrity hashing: byte-at-a-time FNV-1a against four-lane XXH64
+            constexpr size_t kBytes = 16u << 20;
+            std::string blob(kBytes, '\0');
+            Rng rng(kCorpusSeed ^ 0x4A54ull);
+            for (char &c : blob)
+                c = static_cast<char>(rng.Next());
+
+            ctx.Measure("Core/Hash/Fnv1a64/16MB", [&]()
+                        { DoNotOptimize(Fnv1a64(blob)); },
+                        kBytes);
+            ctx.Measure("Core/Hash/XxHash64/16MB", [&]()
+                        { DoNotOptimize(XxHash64(blob.data(), blob.size())); },
+                        kBytes);
+        }
+
+        if (ctx.Enabled("Core/Lz4"))
+        {
+            // One pack block of each kind the pack builder meets: script text and vertex floats
+            constexpr size_t kBlock = 128 * 1024;
+            const std::vector<GamePackBuildEntry> samples = MakePackEntries(256);
+            for (const bool text : {true, false})
+            {
+                // Distinct files back to back, never one file repeated (that would compress too well)
+                std::vector<uint8_t> input;
+                for (const GamePackBuildEntry &entry : samples)
+                {
+                    if (input.size() < kBlock && entry.path.ends_with(".lua") == text)
+                        input.insert(input.end(), entry.data.begin(), entry.data.end());
+                }
+                if (input.size() < kBlock)
+                    continue;
+                input.resize(kBlock);
+
+                std::vector<uint8_t> compressed(Lz4CompressBound(input.size()));
+                size_t compressedSize = 0;
+                const std::string kind = text ? "text" : "floats";
+                Result *encode = ctx.Measure("Core/Lz4/Compress/" + kind, [&]()
+                                             { compressedSize = Lz4Compress(input.data(), input.size(), compressed.data(), compressed.size()); },
+                                             input.size());
+                compressedSize = Lz4Compress(input.data(), input.size(), compressed.data(), compressed.size());
+                if (encode)
+                    encode->counters["ratio"] = static_cast<double>(input.size()) / static_cast<double>(compressedSize);
+
+                // items are bytes, so M items/s reads as decode MB/s
+                std::vector<uint8_t> output(input.size());
+                ctx.Measure("Core/Lz4/Decompress/" + kind, [&]()
+                            {
+                                const bool decoded = Lz4Decompress(compressed.data(), compressedSize, output.data(), output.size());
+                                DoNotOptimize(decoded); },
+                            input.size());
+            }
+        }
+
+        if (ctx.Enabled("Core/BlockCompress"))
+        {
+            // Cook-time texture encoders on a smooth gradient with noise, 256x256 texels per pass
+            constexpr uint32_t kBlocks = 64 * 64;
+            std::vector<uint8_t> texels(size_t(kBlocks) * 64);
+            Rng rng(kCorpusSeed ^ 0xB7C7ull);
+            for (size_t i = 0; i < texels.size(); ++i)
+                texels[i] = static_cast<uint8_t>((i / 4 % 16) * 12 + (i & 3) * 20 + (rng.Next() & 7));
+            std::vector<uint8_t> blocks(size_t(kBlocks) * 16);
+
+            const auto measure = [&](const char *name, void (*encode)(const uint8_t *, uint8_t *))
+            {
+                ctx.Measure(std::string("Core/BlockCompress/") + name + "/4k", [&]()
+                            {
+                                for (uint32_t b = 0; b < kBlocks; ++b)
+                                    encode(texels.data() + size_t(b) * 64, blocks.data() + size_t(b) * 16);
+                                DoNotOptimize(blocks.data()); },
+                            kBlocks);
+            };
+            measure("BC4", [](const uint8_t *in, uint8_t *out) { EncodeBc4Block(in, out); });
+            measure("BC5", EncodeBc5Block);
+            measure("BC7", EncodeBc7Block);
+            measure("ASTC4x4", EncodeAstc4x4Block);
+        }
+
+        if (ctx.Enabled("Core/FileRead"))
+        {
+            // Whole-file reads that touch every byte (hashing stands in for a decoder): FileSystem
+            // copies pack data into a stream and out again, FileView maps loose files and slices raw
+            // pack entries, FileChunkReader holds one chunk at a time
+            constexpr size_t kBytes = 16u << 20;
+            const std::filesystem::path scratch = MakeScratchDir("fileread");
+            GamePackBuildEntry raw{"Bench/raw.png", std::vector<uint8_t>(kBytes)}; // .png: stored raw
+            Rng rng(kCorpusSeed ^ 0xF11Eull);
+            for (uint8_t &b : raw.data)
+                b = static_cast<uint8_t>(rng.Next() & 0x0F); // compresses, so the .bin copy is stored Lz4
+            GamePackBuildEntry lz4{"Bench/lz4.bin", raw.data};
+            std::ofstream(scratch / "loose.bin", std::ios::binary)
+                .write(reinterpret_cast<const char *>(raw.data.data()), static_cast<std::streamsize>(kBytes));
+
+            std::string error;
+            const std::filesystem::path pack = scratch / "read.pepak";
+            if (!WriteGamePack(pack, {raw, lz4}, &error) || !OpenGamePack(pack, &error))
+                PE_ERROR("PhasmaBench: %s", error.c_str());
+
+            const std::pair<const char *, std::string> files[] = {
+                {"loose", (scratch / "loose.bin").generic_string()}, {"pack_raw", raw.path}, {"pack_lz4", lz4.path}};
+            for (const auto &[label, file] : files)
+            {
+                ctx.Measure(std::string("Core/FileRead/FileSystem/") + label, [&]()
+                            {
+                                FileSystem in(file, std::ios::in | std::ios::binary);
+                                const std::vector<uint8_t> bytes = in.ReadAllBytes();
+                                DoNotOptimize(XxHash64(bytes.data(), bytes.size())); },
+                            kBytes);
+                ctx.Measure(std::string("Core/FileRead/FileView/") + label, [&]()
+                            {
+                                const FileView view(file);
+                                DoNotOptimize(XxHash64(view.Data(), view.Size())); },
+                            kBytes);
+                ctx.Measure(std::string("Core/FileRead/FileChunkReader/") + label, [&]()
+                            {
+                                FileChunkReader reader(file);
+                                uint64_t hash = 0;
+                                for (std::span<const uint8_t> chunk = reader.Next(); !chunk.empty(); chunk = reader.Next())
+                                    hash ^= XxHash64(chunk.data(), chunk.size());
+                                DoNotOptimize(hash); },
+                            kBytes);
+            }
+            CloseGamePack();
+
+            std::error_code ec;
+            std::filesystem::remove_all(scratch, ec);
+        }
+
+        if (ctx.Enabled("Core/Io"))
+        {
+            // Many small files, as a streaming burst issues them: one blocking read after another
+            // against the whole set queued on the IoService at once
+            constexpr int kFiles = 256;
+            constexpr size_t kFileBytes = 64u << 10;
+            const std::filesystem::path scratch = MakeScratchDir("io");
+            std::vector<std::string> files;
+            std::vector<uint8_t> data(kFileBytes);
+            Rng rng(kCorpusSeed ^ 0x10ull);
+            for (int i = 0; i < kFiles; ++i)
+            {
+                for (uint8_t &b : data)
+                    b = static_cast<uint8_t>(rng.Next());
+                files.push_back((scratch / ("file_" + std::to_string(i) + ".bin")).generic_string());
+                std::ofstream(files.back(), std::ios::binary)
+                    .write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(kFileBytes));
+            }
+
+            ctx.Measure("Core/Io/Serial/256", [&]()
+                        {
+                            for (const std::string &file : files)
+                            {
+                                const FileView view(file);
+                                DoNotOptimize(XxHash64(view.Data(), view.Size()));
+                            } },
+                        kFiles);
+            ctx.Measure("Core/Io/ReadBatch/256", [&]()
+                        {
+                            std::vector<IoRead> reads;
+                            for (const std::string &file : files)
+                                reads.push_back({file});
+                            const std::vector<IoHandle> requests = IoService::Get().ReadBatch(
+                                std::move(reads), IoPriority::High, [](IoRequest &done)
+                                { DoNotOptimize(XxHash64(done.Bytes().data(), done.Bytes().size())); });
+                            for (const IoHandle &request : requests)
+                                request->Wait(); },
+                        kFiles);
+
+            std::error_code ec;
+            std::filesystem::remove_all(scratch, ec);
+        }
+
+        if (ctx.Enabled("Core/GamePack"))
+        {
+            const std::filesystem::path scratch = MakeScratchDir("pack");
+            const std::filesystem::path pack = scratch / "bench.pepak";
+            const std::vector<GamePackBuildEntry> entries = MakePackEntries(512);
+            uint64_t payload = 0;
+            for (const GamePackBuildEntry &entry : entries)
+                payload += entry.data.size();
+
+            std::string error;
+            Result *write = ctx.Measure("Core/GamePack/Write/512", [&]()
+                                        {
+                                            if (!WriteGamePack(pack, entries, &error))
+                                                PE_ERROR("PhasmaBench: %s", error.c_str()); },
+                                        entries.size());
+            if (write)
+            {
+                std::error_code ec;
+                write->counters["payload_bytes"] = static_cast<double>(payload);
+                write->counters["pack_bytes"] = static_cast<double>(std::filesystem::file_size(pack, ec));
+            }
+
+            // The read benchmarks still need a pack when the filter skipped the write one
+            if (!std::filesystem::exists(pack) && !WriteGamePack(pack, entries, &error))
+                PE_ERROR("PhasmaBench: %s", error.c_str());
+
+            // Re-export after a one-file edit: the other 511 entries are copied from the previous pack
+            // as stored instead of being compressed again
+            std::vector<GamePackBuildEntry> edited = entries;
+            edited[edited.size() / 2].data.push_back('\n');
+            const std::filesystem::path rebuilt = scratch / "rebuilt.pepak";
+            Result *incremental = ctx.Measure("Core/GamePack/WriteIncremental/512", [&]()
+                                              {
+                                                  GamePackWriter writer(pack);
+                                                  for (const GamePackBuildEntry &entry : edited)
+                                                      writer.AddView(entry.path, entry.data);
+                                                  if (!writer.Write(rebuilt, &error))
+                                                      PE_ERROR("PhasmaBench: %s", error.c_str()); },
+                                              edited.size());
+            if (incremental)
+                incremental->counters["payload_bytes"] = static_cast<double>(payload);
+
+            // Startup cost: lazy open (toc only) against hashing every entry up front before the first
+            // read, which is what opening cost before entries were verified on first access
+            ctx.Measure("Core/GamePack/Open/512", [&]()
+                        {
+                            if (!OpenGamePack(pack, &error))
+                                PE_ERROR("PhasmaBench: %s", error.c_str()); },
+                        entries.size());
+            ctx.Measure("Core/GamePack/OpenVerifyAll/512", [&]()
+                        {
+                            if (!OpenGamePack(pack, &error) || !VerifyGamePack(&error))
+                                PE_ERROR("PhasmaBench: %s", error.c_str()); },
+                        entries.size());
+
+            if (OpenGamePack(pack, &error) && VerifyGamePack(&error))
+            {
+                const std::vector<std::string> paths = ListGamePackAssets({});
+                ctx.Measure("Core/GamePack/ReadAll/512", [&]()
+                            {
+                                for (const std::string &path : paths)
+                                {
+                                    std::optional<std::string> data = ReadGamePackAsset(path);
+                                    DoNotOptimize(data);
+                                } },
+                            paths.size());
+                // Most entries are Lz4, which ViewGamePackAsset refuses, so go through FileView: raw
+                // entries are sliced from the mapping and compressed ones decoded into the view
+                ctx.Measure("Core/GamePack/ViewAll/512", [&]()
+                            {
+                                for (const std::string &path : paths)
+                                {
+                                    const FileView view(path);
+                                    if (!view.IsOpen())
+                                        PE_ERROR("PhasmaBench: failed to view %s", path.c_str());
+                                    DoNotOptimize(view.Data());
+                                } },
+                            paths.size());
+            }
+            CloseGamePack();
+
+            std::error_code ec;
+            std::filesystem::remove_all(scratch, ec);
+        }
+    }
+} // namespace pe::bench
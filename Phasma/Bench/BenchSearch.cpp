@@ -0,0 +1,42 @@
+#include "Bench.h"
+#include "Corpus.h"
+
+#if PE_PMCP_CODEBASE_ENABLED
+#include "Phasma/MCP/Codebase/BM25Index.h"
+
+namespace pe::bench
+{
+    PE_BENCH_SUITE(Search, false)
+    {
+        constexpr int kDocuments = 5000;
+
+        std::vector<std::pair<std::string, std::string>> documents = MakeSearchDocuments(kDocuments);
+        const std::vector<std::string> queries = MakeSearchQueries(64);
+
+        pmcp::BM25Index index;
+        index.Rebuild(documents);
+
+        ctx.Measure("Search/BM25Index::Rebuild/5k", [&]()
+                    {
+                        pmcp::BM25Index rebuilt;
+                        rebuilt.Rebuild(documents);
+                        DoNotOptimize(rebuilt.Size()); },
+                    kDocuments);
+
+        ctx.Measure("Search/BM25Index::Search/5k", [&]()
+                    {
+                        for (const std::string &query : queries)
+                        {
+                            std::vector<pmcp::BM25Index::Result> results = index.Search(query, 10);
+                            DoNotOptimize(results.data());
+                        } },
+                    queries.size());
+
+        ctx.Measure("Search/BM25Index::SearchMulti/5k", [&]()
+                    {
+                        std::vector<pmcp::BM25Index::Result> results = index.SearchMulti(queries, 10);
+                        DoNotOptimize(results.data()); },
+                    queries.size());
+    }
+} // namespace pe::bench
+#endif
@@ -0,0 +1,99 @@
+#include "Bench.h"
+#include "Corpus.h"
+#include "Voxel/ChunkColumn.h"
+#include "Voxel/FreeListAllocator.h"
+#include "Voxel/GreedyMesher.h"
+#include "Voxel/NoiseGen.h"
+#include "Voxel/SurfaceNets.h"
+
+namespace pe::bench
+{
+    PE_BENCH_SUITE(Voxel, false)
+    {
+        using namespace voxel;
+
+        const BlockRegistry registry = MakeBlockRegistry();
+        std::vector<VoxelSectionSample> sections;
+        if (ctx.Enabled("Voxel/GreedyMesher"))
+            sections = MakeVoxelSections();
+
+        for (int lod = 0; lod <= 2; ++lod)
+        {
+            uint64_t faces = 0;
+            Result *result = ctx.Measure("Voxel/GreedyMesher/lod" + std::to_string(lod), [&]()
+                                         {
+                                             GreedyMesher mesher;
+                                             faces = 0;
+                                             for (VoxelSectionSample &section : sections)
+                                             {
+                                                 MeshData mesh = mesher.Mesh(&VoxelSectionSample::Sample, &section, registry, lod);
+                                                 faces += (mesh.indices.size() + mesh.transparentIndices.size()) / 6;
+                                             } },
+                                         sections.size());
+            if (result)
+                result->counters["quads"] = static_cast<double>(faces);
+        }
+
+        if (ctx.Enabled("Voxel/SurfaceNetsTile"))
+        {
+            const SurfaceNetsField tile = MakeSurfaceNetsField();
+            size_t triangles = 0;
+            Result *result = ctx.Measure("Voxel/SurfaceNetsTile/32x56x32", [&]()
+                                         {
+                                             SmoothMeshData mesh = SurfaceNetsTile(tile.field, tile.gridMin, tile.cells, tile.apron, tile.cellSize);
+                                             triangles = mesh.indices.size() / 3; },
+                                         static_cast<uint64_t>(tile.cells.x) * tile.cells.y * tile.cells.z);
+            if (result)
+                result->counters["triangles"] = static_cast<double>(triangles);
+        }
+
+        {
+            NoiseParams params;
+            params.seed = 7;
+            NoiseGen generator(params);
+            for (int lod = 0; lod <= 2; lod += 2)
+            {
+                // Walk distinct columns so the noise never sees the same domain twice in a row
+                int next = 0;
+                ctx.Measure("Voxel/NoiseGen::Generate/lod" + std::to_string(lod), [&]()
+                            {
+                                ChunkColumn column(ColumnCoord{next++ & 63, 0});
+                                generator.Generate(column, lod);
+                                DoNotOptimize(column); },
+                            kSectionDim * kSectionDim);
+            }
+        }
+
+        {
+            // Arena churn shaped like voxel section meshes: 256 B .. 48 KB, random frees and re-allocs
+            constexpr uint32_t kCapacity = 64u << 20;
+            constexpr int kLive = 4096;
+            constexpr int kOps = 20000;
+
+            Rng rng(kCorpusSeed ^ 0xF11Eull);
+            std::vector<uint32_t> sizes(kOps);
+            std::vector<uint32_t> victims(kOps);
+            for (int i = 0; i < kOps; ++i)
+            {
+                sizes[i] = (256u + rng.Below(48u * 1024u)) & ~255u;
+                victims[i] = rng.Below(kLive);
+            }
+
+            ctx.Measure("Voxel/FreeListAllocator/churn", [&]()
+                        {
+                            FreeListAllocator allocator(kCapacity);
+                            std::vector<std::pair<uint32_t, uint32_t>> live(kLive, {FreeListAllocator::kInvalid, 0});
+                            for (int i = 0; i < kLive; ++i)
+                                live[i] = {allocator.Alloc(sizes[i]), sizes[i]};
+                            for (int i = 0; i < kOps; ++i)
+                            {
+                                auto &slot = live[victims[i]];
+                                if (slot.first != FreeListAllocator::kInvalid)
+                                    allocator.Free(slot.first, slot.second);
+                                slot = {allocator.Alloc(sizes[i]), sizes[i]};
+                            }
+                            DoNotOptimize(allocator.Used()); },
+                        kLive + kOps);
+        }
+    }
+} // namespace pe::bench
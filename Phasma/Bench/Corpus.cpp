@@ -0,0 +1,295 @@
+#include "Corpus.h"
+#include "Voxel/ChunkColumn.h"
+#include "Voxel/NoiseGen.h"
+
+namespace pe::bench
+{
+    namespace
+    {
+        // Same ids NoiseGen writes (see VoxelWorld::RegisterDefaultBlocks)
+        constexpr voxel::BlockId kStoneBlock = 1;
+        constexpr voxel::BlockId kDirtBlock = 2;
+        constexpr voxel::BlockId kGrassBlock = 3;
+        constexpr voxel::BlockId kWaterBlock = 4;
+
+        constexpr int kPatchColumns = 4;
+
+        voxel::NoiseParams CorpusNoiseParams()
+        {
+            voxel::NoiseParams params;
+            params.seed = static_cast<int>(kCorpusSeed & 0xFFFF);
+            params.amplitude = 40.0f;
+            params.featureScale = 48.0f; // busier than the default look: more faces per section
+            params.overhangs = 0.6f;
+            return params;
+        }
+
+        constexpr const char *kWords[] = {
+            "render", "pass", "buffer", "image", "view", "sampler", "pipeline", "descriptor", "layout",
+            "command", "queue", "submit", "barrier", "fence", "semaphore", "swapchain", "frame", "scene",
+            "node", "mesh", "material", "texture", "shader", "compile", "cache", "reflect", "bind",
+            "draw", "dispatch", "indirect", "cull", "light", "shadow", "cascade", "voxel", "chunk",
+            "section", "column", "terrain", "tile", "noise", "height", "density", "physics", "body",
+            "collider", "script", "lua", "binding", "animation", "skeleton", "bone", "clip", "pose",
+            "profiler", "scope", "counter", "memory", "tag", "allocator", "arena", "pack", "asset",
+            "load", "cook", "stream", "upload", "staging", "job", "worker", "task", "graph", "handle"};
+        constexpr uint32_t kWordCount = static_cast<uint32_t>(std::size(kWords));
+
+        std::string Identifier(Rng &rng)
+        {
+            const uint32_t parts = 1 + rng.Below(3);
+            std::string id;
+            const bool snake = rng.Below(4) == 0;
+            for (uint32_t i = 0; i < parts; ++i)
+            {
+                std::string word = kWords[rng.Below(kWordCount)];
+                if (snake)
+                {
+                    if (i)
+                        id += '_';
+                }
+                else if (i || rng.Below(2))
+                {
+                    word[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(word[0])));
+                }
+                id += word;
+            }
+            return id;
+        }
+    } // namespace
+
+    voxel::BlockId VoxelSectionSample::Sample(void *ctx, int x, int y, int z)
+    {
+        const auto *section = static_cast<const VoxelSectionSample *>(ctx);
+        return section->blocks[static_cast<size_t>(x + 1) + kDim * (static_cast<size_t>(z + 1) + kDim * static_cast<size_t>(y + 1))];
+    }
+
+    voxel::BlockRegistry MakeBlockRegistry()
+    {
+        using namespace voxel;
+        BlockRegistry registry;
+        registry.Register({kStoneBlock, "stone", true, true, VoxelRenderClass::Opaque, {2, 2, 2, 2, 2, 2}});
+        registry.Register({kDirtBlock, "dirt", true, true, VoxelRenderClass::Opaque, {1, 1, 1, 1, 1, 1}});
+        registry.Register({kGrassBlock, "grass", true, true, VoxelRenderClass::Opaque, {1, 1, 0, 1, 1, 1}});
+        registry.Register({kWaterBlock, "water", false, false, VoxelRenderClass::Transparent, {3, 3, 3, 3, 3, 3}});
+        return registry;
+    }
+
+    std::vector<VoxelSectionSample> MakeVoxelSections()
+    {
+        using namespace voxel;
+        NoiseGen generator(CorpusNoiseParams());
+
+        // Columns (-1..kPatchColumns) so every inner column has all eight neighbours
+        const int span = kPatchColumns + 2;
+        std::vector<std::unique_ptr<ChunkColumn>> columns;
+        columns.reserve(static_cast<size_t>(span) * span);
+        for (int cz = -1; cz <= kPatchColumns; ++cz)
+            for (int cx = -1; cx <= kPatchColumns; ++cx)
+            {
+                columns.push_back(std::make_unique<ChunkColumn>(ColumnCoord{cx, cz}));
+                generator.Generate(*columns.back(), 0);
+            }
+
+        auto blockAt = [&](int wx, int wy, int wz) -> BlockId
+        {
+            const ColumnCoord c = WorldToColumn(wx, wz);
+            const ChunkColumn &col = *columns[static_cast<size_t>(c.cx + 1) + span * static_cast<size_t>(c.cz + 1)];
+            return col.GetLocal(LocalX(wx), wy, LocalZ(wz));
+        };
+
+        std::vector<VoxelSectionSample> sections;
+        const int dim = VoxelSectionSample::kDim;
+        for (int cz = 0; cz < kPatchColumns; ++cz)
+            for (int cx = 0; cx < kPatchColumns; ++cx)
+                for (int si = 0; si < kSectionCount; ++si)
+                {
+                    VoxelSectionSample section;
+                    section.blocks.resize(static_cast<size_t>(dim) * dim * dim);
+                    bool anyAir = false;
+                    bool anySolid = false;
+                    for (int y = 0; y < dim; ++y)
+                        for (int z = 0; z < dim; ++z)
+                            for (int x = 0; x < dim; ++x)
+                            {
+                                const BlockId id = blockAt(cx * kSectionDim + x - 1, si * kSectionDim + y - 1, cz * kSectionDim + z - 1);
+                                section.blocks[static_cast<size_t>(x) + dim * (static_cast<size_t>(z) + dim * static_cast<size_t>(y))] = id;
+                                anyAir |= id == kAir;
+                                anySolid |= id != kAir;
+                            }
+
+                    // Uniform sections mesh to nothing; only keep the ones a world actually pays for
+                    if (anyAir && anySolid)
+                        sections.push_back(std::move(section));
+                }
+        return sections;
+    }
+
+    SurfaceNetsField MakeSurfaceNetsField()
+    {
+        voxel::NoiseParams params = CorpusNoiseParams();
+        params.heightMin = -24.0f;
+        params.heightMax = 24.0f;
+        voxel::NoiseGen generator(params);
+
+        SurfaceNetsField out;
+        out.cellSize = 1.0f;
+        out.cells = ivec3(32, 56, 32);
+        out.gridMin = ivec3(0, -28, 0);
+        out.apron = ivec3(1, 0, 1);
+
+        const int fnx = out.cells.x + 3, fny = out.cells.y + 3, fnz = out.cells.z + 3;
+        out.field.resize(static_cast<size_t>(fnx) * fny * fnz);
+        for (int k = 0; k < fnz; ++k)
+            for (int i = 0; i < fnx; ++i)
+            {
+                const float wx = static_cast<float>(out.gridMin.x + i - 1) * out.cellSize;
+                const float wz = static_cast<float>(out.gridMin.z + k - 1) * out.cellSize;
+                const float h = generator.SurfaceHeight(wx, wz);
+                for (int j = 0; j < fny; ++j)
+                {
+                    const float wy = static_cast<float>(out.gridMin.y + j - 1) * out.cellSize;
+                    out.field[static_cast<size_t>(i) + static_cast<size_t>(fnx) * (j + static_cast<size_t>(fny) * k)] =
+                        generator.DensityAtHeight(wx, wy, wz, h);
+                }
+            }
+        return out;
+    }
+
+    void MakeSkeletonAndClip(int boneCount, float durationSec, Skeleton &skeleton, AnimationClip &clip)
+    {
+        Rng rng(kCorpusSeed ^ 0xA11Eull);
+
+        skeleton = {};
+        skeleton.bones.resize(boneCount);
+        for (int i = 0; i < boneCount; ++i)
+        {
+            BoneInfo &bone = skeleton.bones[i];
+            bone.name = "bone_" + std::to_string(i);
+            // Parents always precede children, with branching like spine -> limbs -> fingers
+            bone.parentIndex = i == 0 ? -1 : static_cast<int>(rng.Below(static_cast<uint32_t>(std::min(i, 8)))) + std::max(0, i - 8);
+            bone.localBindTransform = translate(mat4(1.f), vec3(0.0f, rng.Range(0.05f, 0.3f), 0.0f));
+            bone.offsetMatrix = inverse(bone.localBindTransform);
+            skeleton.boneNameToIndex[bone.name] = i;
+        }
+
+        constexpr float kTicksPerSecond = 30.0f;
+        const int keyCount = static_cast<int>(durationSec * kTicksPerSecond) + 1;
+
+        clip = {};
+        clip.name = "bench_clip";
+        clip.ticksPerSecond = kTicksPerSecond;
+        clip.duration = static_cast<float>(keyCount - 1);
+        clip.channels.resize(boneCount);
+        for (int i = 0; i < boneCount; ++i)
+        {
+            AnimationChannel &channel = clip.channels[i];
+            channel.boneIndex = i;
+            channel.positionKeys.resize(keyCount);
+            channel.rotationKeys.resize(keyCount);
+            channel.scaleKeys.resize(keyCount);
+
+            const vec3 axis = normalize(vec3(rng.Range(-1.0f, 1.0f), rng.Range(-1.0f, 1.0f), rng.Range(0.1f, 1.0f)));
+            const float phase = rng.Range(0.0f, 6.2831853f);
+            for (int k = 0; k < keyCount; ++k)
+            {
+                const float t = static_cast<float>(k);
+                const float wave = std::sin(t * 0.21f + phase);
+                channel.positionKeys[k] = {t, vec3(0.0f, 0.15f + 0.02f * wave, 0.0f)};
+                channel.rotationKeys[k] = {t, angleAxis(0.6f * wave, axis)};
+                channel.scaleKeys[k] = {t, vec3(1.0f)};
+            }
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> MakeSearchDocuments(int count)
+    {
+        Rng rng(kCorpusSeed ^ 0xB325ull);
+        std::vector<std::pair<std::string, std::string>> docs;
+        docs.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            const std::string file = "Code/" + Identifier(rng) + "/" + Identifier(rng) + ".cpp";
+            std::string content;
+            const uint32_t lines = 8 + rng.Below(24);
+            for (uint32_t l = 0; l < lines; ++l)
+            {
+                content += "    ";
+                content += Identifier(rng);
+                content += rng.Below(2) ? " = " : "->";
+                content += Identifier(rng);
+                content += "(";
+                content += Identifier(rng);
+                content += ");\n";
+            }
+            docs.emplace_back(file + ":" + std::to_string(i * 40 + 1), std::move(content));
+        }
+        return docs;
+    }
+
+    std::vector<std::string> MakeSearchQueries(int count)
+    {
+        Rng rng(kCorpusSeed ^ 0x9E7ull);
+        std::vector<std::string> queries;
+        queries.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            std::string query;
+            const uint32_t words = 1 + rng.Below(4);
+            for (uint32_t w = 0; w < words; ++w)
+            {
+                if (w)
+                    query += ' ';
+                query += kWords[rng.Below(kWordCount)];
+            }
+            queries.push_back(std::move(query));
+        }
+        return queries;
+    }
+
+    std::vector<GamePackBuildEntry> MakePackEntries(int count)
+    {
+        Rng rng(kCorpusSeed ^ 0x9ACCull);
+        std::vector<GamePackBuildEntry> entries;
+        entries.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            GamePackBuildEntry entry;
+            const bool text = rng.Below(3) != 0;
+            entry.path = std::string(text ? "Assets/Scripts/" : "Assets/Models/") + Identifier(rng) + "_" +
+                         std::to_string(i) + (text ? ".lua" : ".pemesh");
+            if (text)
+            {
+                // Repetitive source text, the kind block compression does well on
+                std::string body;
+                const uint32_t lines = 20 + rng.Below(200);
+                for (uint32_t l = 0; l < lines; ++l)
+                    body += "local " + Identifier(rng) + " = " + Identifier(rng) + "(" + std::to_string(rng.Below(100)) + ")\n";
+                entry.data.assign(body.begin(), body.end());
+            }
+            else
+            {
+                // Vertex-stream-like floats: smooth values with noisy low bits
+                const uint32_t floats = 4096 + rng.Below(65536);
+                entry.data.resize(static_cast<size_t>(floats) * sizeof(float));
+                float *values = reinterpret_cast<float *>(entry.data.data());
+                for (uint32_t f = 0; f < floats; ++f)
+                    values[f] = std::sin(static_cast<float>(f) * 0.01f) * 10.0f + rng.Range(-0.01f, 0.01f);
+            }
+            entries.push_back(std::move(entry));
+        }
+        return entries;
+    }
+
+    std::filesystem::path MakeScratchDir(const char *name)
+    {
+        std::error_code ec;
+        std::filesystem::path dir = std::filesystem::temp_directory_path(ec);
+        if (ec)
+            dir = std::filesystem::current_path();
+        dir /= std::string("PhasmaBench_") + name + "_" + std::to_string(static_cast<uint64_t>(
+                                                                     std::chrono::steady_clock::now().time_since_epoch().count()));
+        std::filesystem::create_directories(dir, ec);
+        return dir;
+    }
+} // namespace pe::bench
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Animation/AnimationTypes.h"
+#include "Voxel/BlockRegistry.h"
+
+// Generated benchmark inputs. Everything derives from fixed seeds through Rng (never std::
+// distributions, whose output differs between standard libraries), so every machine and compiler
+// benchmarks the same bytes.
+namespace pe::bench
+{
+    inline constexpr uint64_t kCorpusSeed = 0x5048415345ull; // "PHASE"
+
+    // splitmix64
+    class Rng
+    {
+    public:
+        explicit Rng(uint64_t seed) : m_state{seed} {}
+
+        uint64_t Next()
+        {
+            uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        // [0, 1)
+        float Float() { return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f); }
+        float Range(float lo, float hi) { return lo + (hi - lo) * Float(); }
+        // [0, n)
+        uint32_t Below(uint32_t n) { return static_cast<uint32_t>((Next() >> 32) * n >> 32); }
+
+    private:
+        uint64_t m_state;
+    };
+
+    // One 16^3 section plus its one-block neighbour shell, cut out of NoiseGen terrain, so the mesher
+    // samples -1..16 without any column lookups.
+    struct VoxelSectionSample
+    {
+        static constexpr int kDim = voxel::kSectionDim + 2;
+        std::vector<voxel::BlockId> blocks; // kDim^3, x fastest, then z, then y (section order)
+
+        static voxel::BlockId Sample(void *ctx, int x, int y, int z);
+    };
+
+    voxel::BlockRegistry MakeBlockRegistry();
+
+    // Surface-crossing sections (the expensive ones to mesh) from a 4x4 column patch
+    std::vector<VoxelSectionSample> MakeVoxelSections();
+
+    struct SurfaceNetsField
+    {
+        std::vector<float> field;
+        ivec3 gridMin{};
+        ivec3 cells{};
+        ivec3 apron{};
+        float cellSize = 1.0f;
+    };
+
+    // One 32x32 terrain tile with overhangs, sampled the way TerrainWorld feeds SurfaceNetsTile
+    SurfaceNetsField MakeSurfaceNetsField();
+
+    // A humanoid-sized bone tree with every channel keyed at 30 Hz
+    void MakeSkeletonAndClip(int boneCount, float durationSec, Skeleton &skeleton, AnimationClip &clip);
+
+    // Code-like documents (camelCase/snake_case identifiers over a fixed vocabulary) and queries
+    std::vector<std::pair<std::string, std::string>> MakeSearchDocuments(int count);
+    std::vector<std::string> MakeSearchQueries(int count);
+
+    // Asset-like blobs for the game pack: a mix of small text files and larger binary payloads
+    std::vector<GamePackBuildEntry> MakePackEntries(int count);
+
+    // Per-run scratch directory under the system temp dir, removed by the caller
+    std::filesystem::path MakeScratchDir(const char *name);
+} // namespace pe::bench
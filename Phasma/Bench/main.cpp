@@ -0,0 +1,183 @@
+// PhasmaBench — microbenchmarks for the engine's hot CPU paths (voxel meshing and generation,
+// animation, search, job system, profiler wire, logging, asset loading, game packs, async I/O).
+//
+// Inputs are generated from fixed seeds (Corpus.h) so every run measures the same work. Suites that
+// touch GPU-facing code run on the null RHI, so no window and no GPU are needed and the tool runs on
+// build machines and CI.
+//
+//   PhasmaBench                                  run everything, print a table
+//   PhasmaBench --filter Voxel/                  only benchmarks whose name contains the text
+//   PhasmaBench --json out.json                  also write the results as JSON
+//   PhasmaBench --baseline old.json [--threshold 10]
+//                                                exit 1 when a median or allocs/iteration regressed
+//                                                (a suite that throws also exits 1)
+//   PhasmaBench --list                           print the suite names
+
+#include "Bench.h"
+#include "API/RHI.h"
+#include "Base/Log.h"
+#include "Base/Path.h"
+#include "Runtime/RuntimeHost.h"
+#include "Scene/ModelAsset.h"
+
+#include <cstring>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::printf("usage: PhasmaBench [--filter <text>] [--json <file>] [--baseline <file>] [--threshold <pct>]\n"
+                    "                   [--min-time <ms>] [--min-iterations <n>] [--list]\n");
+    }
+
+    bool SuiteSelected(const pe::bench::Suite &suite, const std::string &filter)
+    {
+        // Benchmark names start with "<Suite>/", so a filter naming a suite or a benchmark inside it
+        // selects the suite; anything else is resolved per benchmark by Context::Enabled.
+        const std::string prefix = std::string(suite.name) + "/";
+        return filter.empty() || filter.find('/') == std::string::npos ||
+               filter.starts_with(prefix) || prefix.starts_with(filter);
+    }
+
+    // The null RHI, brought up only when a selected suite needs it
+    class BenchRhiSession
+    {
+    public:
+        BenchRhiSession()
+        {
+            m_rhi = std::make_unique<pe::RuntimeRhiSession>(nullptr, PE_GRAPHICS_API_NULL, true);
+        }
+
+        ~BenchRhiSession()
+        {
+            // Free default GPU resources before the RHI session (m_rhi) tears the device down.
+            pe::ModelAsset::DestroyDefaults();
+        }
+
+        BenchRhiSession(const BenchRhiSession &) = delete;
+        BenchRhiSession &operator=(const BenchRhiSession &) = delete;
+
+    private:
+        pe::RuntimeSdlSession m_sdl{SDL_INIT_EVENTS}; // SDL_Init; destroyed last
+        std::unique_ptr<pe::RuntimeRhiSession> m_rhi;
+    };
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    pe::bench::Options options;
+    std::filesystem::path jsonFile;
+    std::filesystem::path baselineFile;
+    double thresholdPercent = 10.0;
+    bool list = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--list") == 0)
+            list = true;
+        else if (std::strcmp(arg, "--filter") == 0 && hasValue)
+            options.filter = argv[++i];
+        else if (std::strcmp(arg, "--json") == 0 && hasValue)
+            jsonFile = std::filesystem::path(reinterpret_cast<const char8_t *>(argv[++i]));
+        else if (std::strcmp(arg, "--baseline") == 0 && hasValue)
+            baselineFile = std::filesystem::path(reinterpret_cast<const char8_t *>(argv[++i]));
+        else if (std::strcmp(arg, "--threshold") == 0 && hasValue)
+            thresholdPercent = std::atof(argv[++i]);
+        else if (std::strcmp(arg, "--min-time") == 0 && hasValue)
+            options.minTimeMs = std::atof(argv[++i]);
+        else if (std::strcmp(arg, "--min-iterations") == 0 && hasValue)
+            options.minIterations = std::max<uint64_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        else
+        {
+            PrintUsage();
+            return std::strcmp(arg, "--help") == 0 ? 0 : 2;
+        }
+    }
+
+    std::vector<pe::bench::Suite> suites = pe::bench::Suites();
+    std::sort(suites.begin(), suites.end(), [](const pe::bench::Suite &a, const pe::bench::Suite &b)
+              { return std::strcmp(a.name, b.name) < 0; });
+
+    if (list)
+    {
+        for (const pe::bench::Suite &suite : suites)
+            std::printf("%s%s\n", suite.name, suite.needsRhi ? " (null RHI)" : "");
+        return 0;
+    }
+
+    pe::Path::Init();
+    pe::Log::Init();
+
+    bool needsRhi = false;
+    for (const pe::bench::Suite &suite : suites)
+        needsRhi |= suite.needsRhi && SuiteSelected(suite, options.filter);
+
+    std::printf("PhasmaBench: %s allocation counting, %u hardware threads\n\n",
+                pe::bench::AllocCounters::Available() ? "with" : "without",
+                std::thread::hardware_concurrency());
+
+    std::vector<pe::bench::Result> results;
+    std::vector<const char *> failedSuites;
+    pe::EventSystem::Init(); // the flight recorder and the RHI register engine event callbacks
+    {
+        std::unique_ptr<BenchRhiSession> rhi;
+        if (needsRhi)
+            rhi = std::make_unique<BenchRhiSession>();
+
+        pe::bench::Context ctx(options, results);
+        for (const pe::bench::Suite &suite : suites)
+        {
+            if (!SuiteSelected(suite, options.filter))
+                continue;
+            try
+            {
+                suite.fn(ctx);
+            }
+            catch (const std::exception &e)
+            {
+                // PE_ERROR throws; one broken suite should not hide the others' numbers
+                std::printf("Suite %s failed: %s\n", suite.name, e.what());
+                failedSuites.push_back(suite.name);
+            }
+        }
+    }
+    pe::EventSystem::Destroy();
+    pe::Log::Flush();
+
+    if (results.empty() && failedSuites.empty())
+    {
+        std::printf("No benchmark matched '%s'\n", options.filter.c_str());
+        return 2;
+    }
+
+    if (!jsonFile.empty() && !pe::bench::WriteJson(jsonFile, results, options))
+        return 2;
+
+    int exitCode = 0;
+    if (!baselineFile.empty())
+    {
+        const int regressions = pe::bench::CompareBaseline(baselineFile, results, thresholdPercent);
+        if (regressions > 0)
+        {
+            std::printf("\n%d benchmark(s) regressed by more than %.1f%%\n", regressions, thresholdPercent);
+            exitCode = 1;
+        }
+        else
+        {
+            std::printf("\nNo regressions against %s\n", baselineFile.string().c_str());
+        }
+    }
+
+    // A broken suite must fail the run, or nightly jobs keep passing on the suites that still work
+    if (!failedSuites.empty())
+    {
+        std::printf("\n%zu suite(s) failed:", failedSuites.size());
+        for (const char *name : failedSuites)
+            std::printf(" %s", name);
+        std::printf("\n");
+        exitCode = 1;
+    }
+    return exitCode;
+}
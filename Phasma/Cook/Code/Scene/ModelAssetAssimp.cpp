@@ -163,6 +163,8 @@ namespace pe
         class PhasmaIOSystem : public Assimp::IOSystem
         {
         public:
+            explicit PhasmaIOSystem(std::vector<std::filesystem::path> &opened) : m_opened(opened) {}
+
             bool Exists(const char *pFile) const override
             {
                 std::filesystem::path path(reinterpret_cast<const char8_t *>(pFile));
@@ -187,6 +189,8 @@ namespace pe
                     delete stream;
                     return nullptr;
                 }
+                if (std::find(m_opened.begin(), m_opened.end(), path) == m_opened.end())
+                    m_opened.push_back(path);
                 return stream;
             }
 
@@ -194,6 +198,9 @@ namespace pe
             {
                 delete pFile;
             }
+
+        private:
+            std::vector<std::filesystem::path> &m_opened;
         };
     } // namespace
 
@@ -238,6 +245,41 @@ namespace pe
         return modelAssimp;
     }
 
+    ModelAsset *ModelAssetAssimp::LoadForCook(const std::filesystem::path &file)
+    {
+        ModelAsset *model = LoadCpuOnly(file);
+        if (!model)
+            return nullptr;
+
+        ModelAssetAssimp &modelAssimp = *static_cast<ModelAssetAssimp *>(model);
+        modelAssimp.m_cookOnly = true;
+        modelAssimp.BuildMeshes();
+        modelAssimp.SetupNodes();
+        modelAssimp.ExtractAnimations();
+        return model;
+    }
+
+    uint32_t ModelAssetAssimp::GetImportFlags()
+    {
+        uint32_t flags = 0;
+        flags |= aiProcess_ValidateDataStructure;
+        flags |= aiProcess_Triangulate;
+        flags |= aiProcess_SortByPType;
+        flags |= aiProcess_CalcTangentSpace;
+        flags |= aiProcess_GenSmoothNormals;
+        flags |= aiProcess_GenUVCoords;
+        flags |= aiProcess_RemoveRedundantMaterials;
+        flags |= aiProcess_FindDegenerates;
+        flags |= aiProcess_FindInvalidData;
+        // flags |= aiProcess_PreTransformVertices;
+        // flags |= aiProcess_OptimizeMeshes;
+        // flags |= aiProcess_FindInstances;
+        // flags |= aiProcess_MakeLeftHanded;
+        flags |= aiProcess_FlipUVs;
+        // flags |= aiProcess_FlipWindingOrder;
+        return flags;
+    }
+
     void ModelAssetAssimp::UploadGpu()
     {
         Queue *queue = RHII.GetMainQueue();
@@ -265,28 +307,13 @@ namespace pe
         m_importer.SetProgressHandler(new CustomAssimpProgressHandler());
         m_filePath = file;
 
-        uint32_t flags = 0;
-        flags |= aiProcess_ValidateDataStructure;
-        flags |= aiProcess_Triangulate;
-        flags |= aiProcess_SortByPType;
-        flags |= aiProcess_CalcTangentSpace;
-        flags |= aiProcess_GenSmoothNormals;
-        flags |= aiProcess_GenUVCoords;
-        flags |= aiProcess_RemoveRedundantMaterials;
-        flags |= aiProcess_FindDegenerates;
-        flags |= aiProcess_FindInvalidData;
-        // flags |= aiProcess_PreTransformVertices;
-        // flags |= aiProcess_OptimizeMeshes;
-        // flags |= aiProcess_FindInstances;
-        // flags |= aiProcess_MakeLeftHanded;
-        flags |= aiProcess_FlipUVs;
-        // flags |= aiProcess_FlipWindingOrder;
+        const uint32_t flags = GetImportFlags();
 
         auto fileU8 = file.u8string();
         std::string fileStr(reinterpret_cast<const char *>(fileU8.c_str()));
 
         // Use custom IOSystem to handle unicode paths on Windows
-        m_importer.SetIOHandler(new PhasmaIOSystem());
+        m_importer.SetIOHandler(new PhasmaIOSystem(m_sourceFiles));
 
         m_scene = m_importer.ReadFile(fileStr, flags);
 
@@ -675,11 +702,9 @@ namespace pe
             m_verticesCount += vertex_count; // Global stats
             m_indicesCount += remappedIndices.size();
 
-            // aabb vertices (8 corners)
-            mi.aabbColor = static_cast<uint32_t>(rand(0, 255) << 24) |
-                           static_cast<uint32_t>(rand(0, 255) << 16) |
-                           static_cast<uint32_t>(rand(0, 255) << 8) |
-                           static_cast<uint32_t>(255);
+            // aabb vertices (8 corners). The colour is hashed from the mesh index, not drawn from the
+            // shared rand() engine: cook imports run concurrently and should be byte-reproducible.
+            mi.aabbColor = (static_cast<uint32_t>(XxHash64(&i, sizeof(i))) & 0xFFFFFF00u) | 255u;
 
             const vec3 &mn = mi.boundingBox.min;
             const vec3 &mx = mi.boundingBox.max;
@@ -894,6 +919,18 @@ namespace pe
             if (texPath.empty())
                 continue;
 
+            if (m_cookOnly)
+            {
+                // GetTexturePath only returns files that exist; embedded ids still need a scene entry
+                const auto texPathU8 = texPath.u8string();
+                std::string source(reinterpret_cast<const char *>(texPathU8.c_str()), texPathU8.size());
+                if (source[0] == '*' && static_cast<unsigned int>(std::atoi(source.c_str() + 1)) >= m_scene->mNumTextures)
+                    continue;
+                m_textureSources[&mat][static_cast<int>(type)] = std::move(source);
+                mat.textureMask |= TextureBit(type);
+                return;
+            }
+
             ResourceHandle<Image> loaded = ResourceManager::Get().Find<Image>(texPath.string());
             if (loaded)
             {
@@ -904,6 +941,17 @@ namespace pe
         }
     }
 
+    std::string ModelAssetAssimp::GetTextureSource(const Material &material, int slot) const
+    {
+        if (!m_cookOnly)
+            return ModelAsset::GetTextureSource(material, slot);
+
+        auto it = m_textureSources.find(&material);
+        if (it == m_textureSources.end() || (material.textureMask & TextureBit(static_cast<TextureType>(slot))) == 0)
+            return {};
+        return it->second[slot];
+    }
+
     void ModelAssetAssimp::ComputeMaterialData(Material &mat, aiMaterial *material) const
     {
         if (!material)
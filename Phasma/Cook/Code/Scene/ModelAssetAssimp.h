@@ -19,6 +19,14 @@ namespace pe
         static ModelAsset *LoadCpuOnly(const std::filesystem::path &file);
         void UploadGpu();
 
+        // GPU-free import for the cook: meshes, nodes and animations are built on the calling thread
+        // and texture slots record their source paths instead of uploading images. Safe to run for
+        // several models at once; the result is only fit for ModelAssetCooked::WriteToFile.
+        static ModelAsset *LoadForCook(const std::filesystem::path &file);
+
+        // Post-process flags every import runs with; the cook cache folds them into its keys
+        static uint32_t GetImportFlags();
+
         ModelAssetAssimp();
         ~ModelAssetAssimp() override = default;
 
@@ -26,6 +34,10 @@ namespace pe
         bool GetEmbeddedTextureBytes(const std::string &textureName,
                                      std::vector<uint8_t> &outBytes,
                                      std::string &outExtension) const override;
+        std::string GetTextureSource(const Material &material, int slot) const override;
+
+        // Every file Assimp opened for the import: the model plus its buffers, material libraries, ...
+        const std::vector<std::filesystem::path> &GetSourceFiles() const { return m_sourceFiles; }
 
     private:
         bool LoadFile(const std::filesystem::path &file);
@@ -48,5 +60,9 @@ namespace pe
 
         Assimp::Importer m_importer;
         const aiScene *m_scene = nullptr;
+
+        bool m_cookOnly = false; // LoadForCook: AssignTexture records paths, no images exist
+        std::unordered_map<const Material *, std::array<std::string, 5>> m_textureSources;
+        std::vector<std::filesystem::path> m_sourceFiles;
     };
 } // namespace pe
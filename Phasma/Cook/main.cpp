@@ -1,15 +1,18 @@
 // PhasmaCook — desktop mesh-cook tool. The ONLY engine target that links Assimp.
 //
 // Imports source models (glTF/FBX/OBJ/...) through Assimp and writes portable, GPU-ready,
-// Assimp-free cooked meshes (".pemesh"). A Vulkan device is brought up because the importer's
-// UploadGpu() builds the cooked CPU streams (and uploads textures) through the engine's GPU path;
-// cooking reads that CPU-side data back out into the ".pemesh". The window is created HIDDEN so the
-// tool never flashes a black surface when invoked headlessly (editor import, cook_model.py).
+// Assimp-free cooked meshes (".pemesh"). The one-shot cook goes through the importer's UploadGpu(),
+// which builds the cooked CPU streams (and uploads textures) through the engine's GPU path, so an RHI
+// is brought up — the null backend, since cooking only reads that CPU-side data back out into the
+// ".pemesh". The batch cook skips the RHI: ModelAssetAssimp::LoadForCook records texture paths instead
+// of images, so imports and writes run on every worker at once. No window and no GPU are needed, so
+// the tool runs on build machines and CI (editor import, cook_model.py).
 //
 // Modes (dispatched in main):
 //   PhasmaCook <source> <output.pemesh>   one-shot cook (editor single import / cook_model.py)
-//   PhasmaCook --batch <manifest>         cook many models in ONE process (one device bring-up);
-//                                         manifest is UTF-8 text, one "<src>\t<out>" per line
+//   PhasmaCook --batch <manifest>         cook many models in ONE process, in parallel, skipping the
+//                                         ones CookCache has seen unchanged; manifest is UTF-8 text,
+//                                         one "<src>\t<out>" per line
 //   PhasmaCook                            open the interactive cook window (CookUI.cpp)
 //
 // Everything that needs to cook shells out to this exe, so Assimp stays out of the runtime, editor,
@@ -17,16 +20,22 @@
 
 #include "API/RHI.h"
 #include "Base/EventSystem.h"
+#include "Base/FileSystem.h"
+#include "Base/JobSystem.h"
 #include "Base/Log.h"
 #include "Base/Path.h"
 #include "Runtime/RuntimeHost.h"
+#include "Scene/Material.h"
 #include "Scene/ModelAsset.h"
 #include "Scene/ModelAssetAssimp.h"
 #include "Scene/ModelAssetCooked.h"
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -59,25 +68,16 @@ namespace
         return std::filesystem::path(reinterpret_cast<const char8_t *>(s.c_str()));
     }
 
-    // Brings up a HIDDEN Vulkan device once; CookOne() imports a source model and writes a ".pemesh".
+    // Brings up a headless null RHI once; CookOne() imports a source model and writes a ".pemesh".
     // Reused for both the single cook and the batch cook so a whole folder pays one device bring-up.
     class CookSession
     {
     public:
         CookSession()
         {
-            pe::RuntimeWindowDesc desc;
-            desc.title = "PhasmaCook";
-            desc.api = PE_GRAPHICS_API_VULKAN;
-            desc.flags = SDL_WINDOW_HIDDEN; // no visible surface — cooking never presents a frame
-            desc.showAfterCreate = false;
-            desc.maximizeAfterCreate = false;
-            desc.pumpEventsAfterCreate = false;
-            m_window = std::make_unique<pe::RuntimeWindow>(desc);
             // initializeSwapchain stays true: the engine sizes deletion queues (and more) from the
-            // swapchain image count, so device bring-up is monolithic — dropping the swapchain
-            // crashes the texture-upload path. A truly headless cook needs an engine-side change.
-            m_rhi = std::make_unique<pe::RuntimeRhiSession>(m_window->Get(), PE_GRAPHICS_API_VULKAN, true);
+            // swapchain image count. The null swapchain is a couple of plain images, no window.
+            m_rhi = std::make_unique<pe::RuntimeRhiSession>(nullptr, PE_GRAPHICS_API_NULL, true);
         }
 
         ~CookSession()
@@ -127,8 +127,7 @@ namespace
         }
 
     private:
-        pe::RuntimeSdlSession m_sdl; // SDL_Init; destroyed last
-        std::unique_ptr<pe::RuntimeWindow> m_window;
+        pe::RuntimeSdlSession m_sdl{SDL_INIT_EVENTS}; // SDL_Init; destroyed last
         std::unique_ptr<pe::RuntimeRhiSession> m_rhi;
     };
 
@@ -157,13 +156,217 @@ namespace
         return result;
     }
 
-    // Cook many models in one device bring-up. Manifest is UTF-8 text, one "<src>\t<out>" per line.
+    // Bump when the importer or writer changes cooked output without a .pemesh format bump, so every
+    // cache entry written by an older tool misses
+    constexpr uint32_t kCookVersion = 2;
+
+    using Clock = std::chrono::steady_clock;
+
+    double MsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    bool HashFile(const std::filesystem::path &file, uint64_t &hash)
+    {
+        pe::FileView view(PathUtf8(file));
+        if (!view.IsOpen())
+            return false;
+        hash = pe::XxHash64(view.Data(), view.Size());
+        return true;
+    }
+
+    // Content-addressed record of finished batch cooks, one file per key under <Root>/CookCache/. The
+    // key hashes the source model's bytes, the import flags and the cook/format versions; the entry
+    // names the output it produced, every other file the cook read (Assimp buffers and material
+    // libraries, textures) and every cooked texture it wrote or referenced, each with its content
+    // hash, so editing any input, or deleting or changing any output, misses too.
+    class CookCache
+    {
+    public:
+        CookCache() : m_dir(std::filesystem::path(pe::Path::Root) / "CookCache") {}
+
+        bool Key(const std::filesystem::path &src, uint64_t &key) const
+        {
+            uint64_t sourceHash = 0;
+            if (!HashFile(src, sourceHash))
+                return false;
+            const uint32_t settings[3] = {pe::ModelAssetAssimp::GetImportFlags(), pe::ModelAssetCooked::GetFormatVersion(), kCookVersion};
+            key = pe::XxHash64(settings, sizeof(settings), sourceHash);
+            return true;
+        }
+
+        // The entry for `key` produced `out`, `out` still exists and no recorded input or cooked texture
+        // changed or went missing
+        bool IsFresh(uint64_t key, const std::filesystem::path &out) const
+        {
+            std::ifstream in(EntryPath(key), std::ios::binary);
+            std::string line;
+            if (!in || !std::getline(in, line) || line != "out\t" + PathUtf8(out))
+                return false;
+
+            std::error_code ec;
+            if (!std::filesystem::is_regular_file(out, ec))
+                return false;
+
+            while (std::getline(in, line))
+            {
+                // "dep\t<hash hex>\t<path>" for inputs, "tex\t<hash hex>\t<path>" for cooked textures
+                const size_t tab = line.find('\t', 4);
+                if ((line.rfind("dep\t", 0) != 0 && line.rfind("tex\t", 0) != 0) || tab == std::string::npos)
+                    return false;
+                uint64_t hash = 0;
+                if (!HashFile(PathFromUtf8(line.substr(tab + 1)), hash) ||
+                    std::strtoull(line.substr(4, tab - 4).c_str(), nullptr, 16) != hash)
+                    return false;
+            }
+            return true;
+        }
+
+        void Store(uint64_t key, const std::filesystem::path &out, const std::vector<std::filesystem::path> &deps,
+                   const std::vector<std::filesystem::path> &textures)
+        {
+            std::string entry = "out\t" + PathUtf8(out) + "\n";
+            auto append = [&entry](const char *kind, const std::filesystem::path &file)
+            {
+                uint64_t hash = 0;
+                if (!HashFile(file, hash))
+                    return false;
+                char hex[17];
+                std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+                entry += kind + std::string(hex) + "\t" + PathUtf8(file) + "\n";
+                return true;
+            };
+            // A file that vanished mid-cook leaves the job uncached
+            for (const auto &dep : deps)
+            {
+                if (!append("dep\t", dep))
+                    return;
+            }
+            for (const auto &texture : textures)
+            {
+                if (!append("tex\t", texture))
+                    return;
+            }
+
+            // Two manifest lines may share a source (same key); entries are whole-file rewrites
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::error_code ec;
+            std::filesystem::create_directories(m_dir, ec);
+            std::ofstream file(EntryPath(key), std::ios::binary | std::ios::trunc);
+            file << entry;
+        }
+
+    private:
+        std::filesystem::path EntryPath(uint64_t key) const
+        {
+            char name[17];
+            std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+            return m_dir / name;
+        }
+
+        std::filesystem::path m_dir;
+        std::mutex m_mutex;
+    };
+
+    struct BatchJob
+    {
+        std::filesystem::path src;
+        std::filesystem::path out;
+        std::string error; // empty on success
+        bool cached = false;
+        double importMs = 0.0;
+        double writeMs = 0.0;
+    };
+
+    // Every file besides the source that the cooked output depends on
+    std::vector<std::filesystem::path> CookDependencies(const pe::ModelAsset &model, const std::filesystem::path &src)
+    {
+        const auto &assimp = static_cast<const pe::ModelAssetAssimp &>(model);
+        std::vector<std::filesystem::path> deps;
+        for (const auto &file : assimp.GetSourceFiles())
+            if (file != src)
+                deps.push_back(file);
+        for (const auto &material : model.GetOwnedMaterials())
+        {
+            if (!material)
+                continue;
+            for (int slot = 0; slot < static_cast<int>(std::size(material->textures)); ++slot)
+            {
+                const std::string source = model.GetTextureSource(*material, slot);
+                if (source.empty() || source[0] == '*') // embedded: hashed with the source bytes
+                    continue;
+                const std::filesystem::path path = PathFromUtf8(source);
+                if (std::find(deps.begin(), deps.end(), path) == deps.end())
+                    deps.push_back(path);
+            }
+        }
+        return deps;
+    }
+
+    // Runs on a JobSystem worker. Like CookSession::CookOne it MUST NOT let anything escape: one model
+    // Assimp rejects is reported, the rest of the batch carries on.
+    void CookBatchJob(BatchJob &job, CookCache &cache)
+    {
+        uint64_t key = 0;
+        const bool keyed = cache.Key(job.src, key);
+        if (keyed && cache.IsFresh(key, job.out))
+        {
+            // The editor and CookUI track progress by output mtimes, so a skipped job still touches it
+            std::error_code ec;
+            std::filesystem::last_write_time(job.out, std::filesystem::file_time_type::clock::now(), ec);
+            job.cached = true;
+            return;
+        }
+
+        try
+        {
+            const Clock::time_point importStart = Clock::now();
+            std::unique_ptr<pe::ModelAsset> model(pe::ModelAssetAssimp::LoadForCook(job.src));
+            job.importMs = MsSince(importStart);
+            if (!model)
+            {
+                PE_WARN("[Cook] Failed to import source model: %s", PathUtf8(job.src).c_str());
+                job.error = "import failed (model rejected or unreadable)";
+                return;
+            }
+
+            const Clock::time_point writeStart = Clock::now();
+            std::error_code ec;
+            std::filesystem::create_directories(job.out.parent_path(), ec);
+            std::vector<std::filesystem::path> textures;
+            const bool ok = pe::ModelAssetCooked::WriteToFile(model.get(), job.out, &textures);
+            job.writeMs = MsSince(writeStart);
+            if (!ok)
+            {
+                PE_WARN("[Cook] Failed to write cooked mesh: %s", PathUtf8(job.out).c_str());
+                job.error = "failed to write .pemesh";
+                return;
+            }
+
+            if (keyed)
+                cache.Store(key, job.out, CookDependencies(*model, job.src), textures);
+        }
+        catch (const std::exception &e)
+        {
+            PE_WARN("[Cook] Exception cooking '%s': %s", PathUtf8(job.src).c_str(), e.what());
+            job.error = e.what();
+        }
+        catch (...)
+        {
+            PE_WARN("[Cook] Unknown exception cooking '%s'", PathUtf8(job.src).c_str());
+            job.error = "unknown exception";
+        }
+    }
+
+    // Cook many models across the JobSystem workers, GPU-free. Manifest is UTF-8 text, one
+    // "<src>\t<out>" per line.
     int RunBatch(const std::filesystem::path &manifestPath)
     {
         pe::Path::Init();
         pe::Log::Init();
 
-        std::vector<std::pair<std::filesystem::path, std::filesystem::path>> jobs;
+        std::vector<BatchJob> jobs;
         {
             std::ifstream in(manifestPath, std::ios::binary);
             if (!in)
@@ -183,7 +386,9 @@ namespace
                 std::string o = line.substr(tab + 1);
                 if (s.empty() || o.empty())
                     continue;
-                jobs.emplace_back(PathFromUtf8(s), PathFromUtf8(o));
+                BatchJob &job = jobs.emplace_back();
+                job.src = PathFromUtf8(s);
+                job.out = PathFromUtf8(o);
             }
         }
         if (jobs.empty())
@@ -192,43 +397,45 @@ namespace
             return 0;
         }
 
-        PE_INFO("[Cook] Batch cooking %zu model(s)", jobs.size());
+        PE_INFO("[Cook] Batch cooking %zu model(s) on %u worker(s)", jobs.size(), pe::JobSystem::Get().GetWorkerCount() + 1);
         pe::EventSystem::Init();
-        std::vector<std::pair<std::filesystem::path, std::string>> failures; // (src, reason)
-        // `processed` is visible to the catch so a session that cannot start (e.g. device/window
-        // init throws) marks every not-yet-attempted job failed — never silently "all ok".
-        size_t processed = 0;
-        try
-        {
-            CookSession session;
-            for (; processed < jobs.size(); ++processed)
+        const Clock::time_point batchStart = Clock::now();
+        CookCache cache;
+        std::atomic<size_t> finished{0};
+        pe::ParallelFor(
+            static_cast<uint32_t>(jobs.size()), 1,
+            [&](uint32_t i)
             {
-                const auto &job = jobs[processed];
-                const std::string err = session.CookOne(job.first, job.second);
-                if (err.empty())
-                    PE_INFO("[Cook] (%zu/%zu) ok: %s", processed + 1, jobs.size(), PathUtf8(job.second).c_str());
-                else
-                    failures.emplace_back(job.first, err);
-            }
-        }
-        catch (const std::exception &e)
-        {
-            PE_WARN("[Cook] Cook session error: %s", e.what());
-            for (size_t i = processed; i < jobs.size(); ++i)
-                failures.emplace_back(jobs[i].first, std::string("cook session error: ") + e.what());
-        }
-        catch (...)
-        {
-            PE_WARN("[Cook] Unknown cook session error");
-            for (size_t i = processed; i < jobs.size(); ++i)
-                failures.emplace_back(jobs[i].first, "unknown cook session error");
-        }
+                BatchJob &job = jobs[i];
+                CookBatchJob(job, cache);
+                const size_t n = finished.fetch_add(1) + 1;
+                if (job.cached)
+                    PE_INFO("[Cook] (%zu/%zu) unchanged: %s", n, jobs.size(), PathUtf8(job.out).c_str());
+                else if (job.error.empty())
+                    PE_INFO("[Cook] (%zu/%zu) ok in %.0f ms (import %.0f ms, write %.0f ms): %s", n, jobs.size(),
+                            job.importMs + job.writeMs, job.importMs, job.writeMs, PathUtf8(job.out).c_str());
+            },
+            pe::JobPriority::Normal);
+        const double batchMs = MsSince(batchStart);
         pe::EventSystem::Destroy();
 
         // Sidecar "<manifest>.failed": one "<src>\t<reason>" per failure, so the editor/UI can show
         // exactly which models failed and why. Removed when there are no failures.
         std::filesystem::path failedPath = manifestPath;
         failedPath += ".failed";
+        size_t failed = 0, cached = 0;
+        double cookMs = 0.0;
+        std::string failures;
+        for (const BatchJob &job : jobs)
+        {
+            cached += job.cached ? 1 : 0;
+            cookMs += job.importMs + job.writeMs;
+            if (!job.error.empty())
+            {
+                failures += PathUtf8(job.src) + '\t' + job.error + '\n';
+                ++failed;
+            }
+        }
         std::error_code ec;
         if (failures.empty())
         {
@@ -237,12 +444,12 @@ namespace
         else
         {
             std::ofstream out(failedPath, std::ios::binary | std::ios::trunc);
-            for (const auto &f : failures)
-                out << PathUtf8(f.first) << '\t' << f.second << '\n';
+            out << failures;
         }
 
-        PE_INFO("[Cook] Batch done: %zu ok, %zu failed", jobs.size() - failures.size(), failures.size());
-        return failures.empty() ? 0 : 1;
+        PE_INFO("[Cook] Batch done in %.1f s (%.1f s of cook work): %zu ok (%zu unchanged), %zu failed",
+                batchMs / 1000.0, cookMs / 1000.0, jobs.size() - failed, cached, failed);
+        return failed == 0 ? 0 : 1;
     }
 } // namespace
 
@@ -1,5 +1,7 @@
 #include "API/Buffer_Internal.h"
 #include "API/Command.h"
+#include "API/Null/NullCommandBufferImpl.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/StagingManager.h"
 #include "API/Vulkan/VulkanBufferImpl.h"
@@ -16,6 +18,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanBufferImpl(owner, desc);
+        case PE_GRAPHICS_API_NULL:
+            return new NullBufferImpl(owner, desc);
 #if defined(PE_WIN32)
         case PE_GRAPHICS_API_DX12:
             return new Dx12BufferImpl(owner, desc);
@@ -28,6 +32,12 @@ namespace pe
 
     void Buffer_Barrier_Backend(CommandBuffer *cmd, const BufferBarrierInfo &info)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+        {
+            PE_ERROR_IF(!cmd, "Buffer::Barrier: no command buffer specified");
+            NullCommandBufferImpl::From(cmd)->BufferBarrier(info);
+            return;
+        }
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
@@ -41,6 +51,12 @@ namespace pe
 
     void Buffer_Barriers_Backend(CommandBuffer *cmd, const std::vector<BufferBarrierInfo> &infos)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+        {
+            PE_ERROR_IF(!cmd, "Buffer::Barriers: no command buffer specified");
+            NullCommandBufferImpl::From(cmd)->BufferBarriers(infos);
+            return;
+        }
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
@@ -55,8 +71,10 @@ namespace pe
     Buffer *Buffer::Create(const BufferDesc &desc)
     {
         Buffer *buf = new Buffer(desc);
+        buf->m_memoryTag = MemoryTracker::GetCurrentTag();
+        MemoryTracker::AddGpu(buf->m_memoryTag, buf->m_size);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Buffer), reinterpret_cast<void *>(buf));
+        PeTracker::Track(buf);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Buffer created (Handle: %p)", reinterpret_cast<void *>(buf));
 #endif
@@ -71,10 +89,11 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object Buffer destroyed (Handle: %p)", reinterpret_cast<void *>(buf));
 #endif
-            delete buf;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Buffer), reinterpret_cast<void *>(buf));
+            PeTracker::Untrack(buf);
 #endif
+            MemoryTracker::RemoveGpu(buf->m_memoryTag, buf->m_size);
+            delete buf;
             buf = nullptr;
         }
     }
@@ -82,12 +101,7 @@ namespace pe
     std::vector<Buffer *> Buffer::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Buffer));
-        std::vector<Buffer *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Buffer *>(p));
-        return out;
+        return PeTracker::GetHandles<Buffer>();
 #else
         return {};
 #endif
@@ -123,7 +137,7 @@ namespace pe
         if (!m_size)
             m_size = 16;
 
-        m_impl = CreateBufferImpl(this, BufferDesc{m_size, m_usage, m_memoryUsage, m_name});
+        m_impl = CreateBufferImpl(this, BufferDesc{m_size, m_usage, m_memoryUsage, m_name, desc.concurrentQueues});
     }
 
     Buffer::~Buffer()
@@ -203,9 +217,9 @@ namespace pe
 
         StagingAllocation alloc = RHII.GetStagingManager()->Allocate(size);
         std::memcpy(alloc.data, data, size);
-        alloc.buffer->Flush(size, 0);
+        alloc.buffer->Flush(size, alloc.offset);
 
-        CopyBuffer(cmd, alloc.buffer, size, 0, dstOffset);
+        CopyBuffer(cmd, alloc.buffer, size, alloc.offset, dstOffset);
 
         cmd->AddAfterWaitCallback([alloc = std::move(alloc)]()
                                   { RHII.GetStagingManager()->SetUnused(alloc); });
@@ -17,6 +17,9 @@ namespace pe
         PeBufferUsageFlags usage = PE_BUFFER_USAGE_NONE;
         PeMemoryUsage memoryUsage = PE_MEMORY_USAGE_GPU_ONLY;
         std::string name;
+        // Shared by every queue family without ownership transfers (written on the transfer queue,
+        // read on graphics). Only Vulkan distinguishes; exclusive is faster where the driver cares.
+        bool concurrentQueues = false;
     };
 
     class Buffer;
@@ -33,7 +36,7 @@ namespace pe
     };
     using BufferTrackInfo = BufferBarrierInfo;
 
-    class Buffer : public NoCopy
+    class Buffer : public NoCopy, public PeTracked
     {
     public:
         struct Impl; // forward — defined in Buffer_Internal.h, body is engine-private
@@ -61,6 +64,8 @@ namespace pe
         friend struct VulkanBufferImpl;
         friend struct Dx12CommandBufferImpl;
         friend struct Dx12BufferImpl;
+        friend struct NullCommandBufferImpl;
+        friend struct NullBufferImpl;
 
         Buffer(const BufferDesc &desc);
         ~Buffer();
@@ -79,5 +84,6 @@ namespace pe
         PeMemoryUsage m_memoryUsage;
         std::string m_name;
         BufferTrackInfo m_trackInfo{};
+        MemoryTag m_memoryTag = MemoryTag::Untagged; // tag current when created
     };
 } // namespace pe
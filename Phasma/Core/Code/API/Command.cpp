@@ -4,6 +4,7 @@
 #include "API/Event.h"
 #include "API/Framebuffer.h"
 #include "API/Image.h"
+#include "API/Null/NullCommandBufferImpl.h"
 #include "API/Pipeline.h"
 #include "API/Queue.h"
 #include "API/RHI.h"
@@ -30,6 +31,98 @@ namespace pe
             }
             return normalized;
         }
+
+        size_t PipelineKey(RenderPass *renderPass, const PassInfo &passInfo)
+        {
+            Hash hash;
+            if (renderPass)
+                hash.Combine(reinterpret_cast<std::intptr_t>(renderPass));
+            hash.Combine(passInfo.GetHash());
+            return hash;
+        }
+
+        // Vulkan pipelines that bind outside a legacy render pass (compute, and graphics under dynamic
+        // rendering) have a key known before recording, so they can be built ahead of the first draw.
+        // Ray tracing uploads its SBT through the queue, so it stays on the lazy path.
+        bool IsPrewarmable(const PassInfo &passInfo)
+        {
+            if (RHII.GetApi() != PE_GRAPHICS_API_VULKAN || passInfo.acceleration.rayGen)
+                return false;
+            if (passInfo.pCompShader)
+                return true;
+            return (passInfo.pVertShader || passInfo.pFragShader) &&
+                   RHII.GetCaps().dynamicRendering && Settings::Get<SceneSettings>().dynamic_rendering;
+        }
+
+        // PipelineCache/passes.list: names of the PassInfos whose pipelines were bound in earlier sessions.
+        // PassInfo hashes fold in descriptor-layout pointers, so they do not survive a restart; the names do.
+        // ponytail: the list only grows, and PassInfos sharing a name are pre-warmed together.
+        class RecordedPipelines
+        {
+        public:
+            static RecordedPipelines &Get()
+            {
+                static RecordedPipelines s_recorded;
+                return s_recorded;
+            }
+
+            bool Contains(const std::string &name)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                LoadLocked();
+                return m_names.contains(name);
+            }
+
+            void Record(const std::string &name)
+            {
+                if (name.empty() || name.find('\n') != std::string::npos)
+                    return;
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                LoadLocked();
+                if (!m_names.insert(name).second)
+                    return;
+
+                const std::string path = ListPath();
+                std::error_code ec;
+                std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+                FileSystem file(path, std::ios::out | std::ios::app | std::ios::binary);
+                if (file.IsOpen())
+                    file.Write(name + '\n');
+            }
+
+        private:
+            static std::string ListPath()
+            {
+                return Path::Root + "PipelineCache/passes.list";
+            }
+
+            void LoadLocked()
+            {
+                if (m_loaded)
+                    return;
+                m_loaded = true;
+
+                const FileView file(ListPath());
+                if (!file.IsOpen())
+                    return;
+
+                const std::string_view text = file.Text();
+                for (size_t lineStart = 0; lineStart < text.size();)
+                {
+                    size_t lineEnd = text.find('\n', lineStart);
+                    if (lineEnd == std::string_view::npos)
+                        lineEnd = text.size();
+                    if (lineEnd > lineStart)
+                        m_names.emplace(text.substr(lineStart, lineEnd - lineStart));
+                    lineStart = lineEnd + 1;
+                }
+            }
+
+            std::mutex m_mutex;
+            bool m_loaded = false;
+            std::unordered_set<std::string> m_names;
+        };
     } // namespace
 
     CommandBuffer::CommandBuffer(CommandPool *commandPool, const std::string &name)
@@ -223,12 +316,7 @@ namespace pe
     Pipeline *CommandBuffer::GetPipeline(RenderPass *renderPass, PassInfo &passInfo)
     {
         PE_PROFILE_SCOPE("Cmd GetPipeline");
-        Hash hash;
-
-        if (renderPass)
-            hash.Combine(reinterpret_cast<std::intptr_t>(renderPass));
-
-        hash.Combine(passInfo.GetHash());
+        const size_t hash = PipelineKey(renderPass, passInfo);
 
         auto it = s_pipelines.find(hash);
         if (it != s_pipelines.end())
@@ -240,11 +328,63 @@ namespace pe
             PE_PROFILE_SCOPE("Cmd CreatePipeline");
             Pipeline *newPipeline = Pipeline::Create(renderPass, passInfo);
             s_pipelines[hash] = newPipeline;
+            if (!renderPass && IsPrewarmable(passInfo))
+                RecordedPipelines::Get().Record(passInfo.name);
 
             return newPipeline;
         }
     }
 
+    void CommandBuffer::PrewarmPipelines(const std::vector<PassInfo *> &passInfos)
+    {
+        PE_PROFILE_SCOPE("Cmd PrewarmPipelines");
+
+        std::vector<PassInfo *> pending;
+        std::unordered_set<size_t> pendingKeys;
+        for (PassInfo *passInfo : passInfos)
+        {
+            if (!passInfo || !IsPrewarmable(*passInfo))
+                continue;
+
+            const size_t hash = PipelineKey(nullptr, *passInfo);
+            if (s_pipelines.contains(hash) || !RecordedPipelines::Get().Contains(passInfo->name))
+                continue;
+            if (pendingKeys.insert(hash).second)
+                pending.push_back(passInfo);
+        }
+        if (pending.empty())
+            return;
+
+        // Each worker builds into its own driver pipeline cache; the map is only touched here, after the join
+        Timer timer;
+        std::vector<Pipeline *> created(pending.size(), nullptr);
+        ParallelFor(static_cast<uint32_t>(pending.size()), 1, [&](uint32_t i)
+                    {
+                        try
+                        {
+                            created[i] = Pipeline::Create(nullptr, *pending[i]);
+                        }
+                        catch (const std::exception &e)
+                        {
+                            // GetPipeline retries on first bind and reports the error there
+                            PE_WARN("[Pipeline] Pre-warm failed for '%s': %s", pending[i]->name.c_str(), e.what());
+                        } });
+
+        uint32_t prewarmed = 0;
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            if (!created[i])
+                continue;
+            s_pipelines[PipelineKey(nullptr, *pending[i])] = created[i];
+            prewarmed++;
+        }
+
+        const double ms = MILLI(timer.Count());
+        PE_PROFILE_COUNTER("Pipelines.Prewarmed", prewarmed);
+        PE_PROFILE_COUNTER("Pipelines.PrewarmUs", static_cast<uint64_t>(ms * 1000.0));
+        PE_INFO("[Pipeline] Pre-warmed %u pipelines in %.1f ms", prewarmed, ms);
+    }
+
     void CommandBuffer::ClearFramebufferCache()
     {
         for (auto &[hash, framebuffer] : s_framebuffers)
@@ -651,6 +791,9 @@ namespace pe
 
     CommandBuffer::Impl *CreateCommandBufferImpl(CommandBuffer *owner, CommandPool *commandPool, const std::string &name)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+            return new NullCommandBufferImpl(owner, commandPool, name);
+
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
 #if defined(PE_WIN32)
@@ -187,6 +187,9 @@ namespace pe
         static RenderPass *GetRenderPass(uint32_t count, Attachment *attachments);
         static Framebuffer *GetFramebuffer(RenderPass *renderPass, uint32_t count, Attachment *attachments);
         static Pipeline *GetPipeline(RenderPass *renderPass, PassInfo &info);
+        // Builds, in parallel on the job workers, the pipelines of passInfos that were bound in earlier
+        // sessions and whose key does not depend on a render pass, so the first frame finds them cached
+        static void PrewarmPipelines(const std::vector<PassInfo *> &passInfos);
         static void ClearFramebufferCache();
         static void ClearCache();
 
@@ -194,6 +197,7 @@ namespace pe
         friend class Queue;
         friend struct VulkanCommandBufferImpl;
         friend struct Dx12CommandBufferImpl;
+        friend struct NullCommandBufferImpl;
 
         // Resources
         inline static std::unordered_map<size_t, RenderPass *> s_renderPasses{};
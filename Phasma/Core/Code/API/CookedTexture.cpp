@@ -0,0 +1,393 @@
+#include "API/CookedTexture.h"
+#include "API/Image.h"
+#include "API/RHI.h"
+#include "Base/BlockCompress.h"
+
+namespace pe
+{
+    namespace
+    {
+        // ".petex" layout, little-endian: Header, then one MipRecord per level, then the block data.
+        constexpr char kMagic[4] = {'P', 'E', 'T', 'X'};
+        constexpr uint32_t kVersion = 1;
+
+#pragma pack(push, 1)
+        struct Header
+        {
+            char magic[4];
+            uint32_t version;
+            uint32_t format; // PeFormat
+            uint32_t usage;  // TextureUsage
+            uint32_t width;
+            uint32_t height;
+            uint32_t mipLevels;
+            uint32_t reserved;
+        };
+
+        struct MipRecord
+        {
+            uint64_t offset; // from the start of the file
+            uint64_t size;
+        };
+#pragma pack(pop)
+
+        const char *UsageName(TextureUsage usage)
+        {
+            switch (usage)
+            {
+            case TextureUsage::Linear:
+                return "linear";
+            case TextureUsage::Normal:
+                return "normal";
+            case TextureUsage::Mask:
+                return "mask";
+            default:
+                return "color";
+            }
+        }
+
+        // Colour textures stay UNORM: they are sampled like the RGBA8 uploads they replace, so being
+        // sRGB-aware is the mip filter's job, not the view format's.
+        ::PeFormat PickFormat(TextureUsage usage, TextureTarget target)
+        {
+            if (target == TextureTarget::ASTC)
+                return PE_FORMAT_ASTC_4x4_UNORM;
+
+            switch (usage)
+            {
+            case TextureUsage::Normal:
+                return PE_FORMAT_BC5_UNORM;
+            case TextureUsage::Mask:
+                return PE_FORMAT_BC4_UNORM;
+            default:
+                return PE_FORMAT_BC7_UNORM;
+            }
+        }
+
+        bool IsCookedFormat(uint32_t format)
+        {
+            switch (format)
+            {
+            case PE_FORMAT_BC4_UNORM:
+            case PE_FORMAT_BC5_UNORM:
+            case PE_FORMAT_BC7_UNORM:
+            case PE_FORMAT_BC7_SRGB:
+            case PE_FORMAT_ASTC_4x4_UNORM:
+            case PE_FORMAT_ASTC_4x4_SRGB:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        size_t MipBytes(::PeFormat format, uint32_t width, uint32_t height)
+        {
+            return size_t{(width + 3u) / 4u} * ((height + 3u) / 4u) * PeFormatBlockSize(format);
+        }
+
+        float SrgbToLinear(float c)
+        {
+            return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float LinearToSrgb(float c)
+        {
+            return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+        }
+
+        // One mip level in filtering space: linear light for colour, [-1, 1] vectors for normals
+        struct MipImage
+        {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<float> texels; // RGBA
+        };
+
+        void NormalizeXyz(float *n)
+        {
+            const float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            if (length > 1e-6f)
+            {
+                n[0] /= length;
+                n[1] /= length;
+                n[2] /= length;
+            }
+            else
+            {
+                n[0] = n[1] = 0.0f;
+                n[2] = 1.0f;
+            }
+        }
+
+        MipImage ToFilterSpace(const DecodedPixels &decoded, TextureUsage usage)
+        {
+            std::array<float, 256> toLinear;
+            for (int i = 0; i < 256; i++)
+                toLinear[i] = usage == TextureUsage::Color ? SrgbToLinear(i / 255.0f) : i / 255.0f;
+
+            MipImage mip;
+            mip.width = decoded.width;
+            mip.height = decoded.height;
+            mip.texels.resize(size_t{mip.width} * mip.height * 4);
+            const uint8_t *src = decoded.pixels.get();
+            for (size_t i = 0; i < size_t{mip.width} * mip.height; i++)
+            {
+                float *t = &mip.texels[i * 4];
+                for (int c = 0; c < 3; c++)
+                    t[c] = toLinear[src[i * 4 + c]];
+                t[3] = src[i * 4 + 3] / 255.0f;
+                if (usage == TextureUsage::Normal)
+                {
+                    for (int c = 0; c < 3; c++)
+                        t[c] = t[c] * 2.0f - 1.0f;
+                    NormalizeXyz(t);
+                }
+            }
+            return mip;
+        }
+
+        // 2x2 box filter; odd edges reuse their last row/column
+        MipImage Downsample(const MipImage &src, TextureUsage usage)
+        {
+            MipImage dst;
+            dst.width = std::max(1u, src.width / 2);
+            dst.height = std::max(1u, src.height / 2);
+            dst.texels.resize(size_t{dst.width} * dst.height * 4);
+            for (uint32_t y = 0; y < dst.height; y++)
+            {
+                const uint32_t y0 = std::min(y * 2, src.height - 1);
+                const uint32_t y1 = std::min(y * 2 + 1, src.height - 1);
+                for (uint32_t x = 0; x < dst.width; x++)
+                {
+                    const uint32_t x0 = std::min(x * 2, src.width - 1);
+                    const uint32_t x1 = std::min(x * 2 + 1, src.width - 1);
+                    float *t = &dst.texels[(size_t{y} * dst.width + x) * 4];
+                    for (int c = 0; c < 4; c++)
+                    {
+                        t[c] = 0.25f * (src.texels[(size_t{y0} * src.width + x0) * 4 + c] +
+                                        src.texels[(size_t{y0} * src.width + x1) * 4 + c] +
+                                        src.texels[(size_t{y1} * src.width + x0) * 4 + c] +
+                                        src.texels[(size_t{y1} * src.width + x1) * 4 + c]);
+                    }
+                    if (usage == TextureUsage::Normal)
+                        NormalizeXyz(t);
+                }
+            }
+            return dst;
+        }
+
+        uint8_t ToUnorm8(float v)
+        {
+            return static_cast<uint8_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        // Back to the stored RGBA8 the block encoders read
+        std::vector<uint8_t> ToStorage(const MipImage &mip, TextureUsage usage)
+        {
+            std::vector<uint8_t> rgba(mip.texels.size());
+            for (size_t i = 0; i < mip.texels.size(); i += 4)
+            {
+                const float *t = &mip.texels[i];
+                switch (usage)
+                {
+                case TextureUsage::Color:
+                    for (int c = 0; c < 3; c++)
+                        rgba[i + c] = ToUnorm8(LinearToSrgb(t[c]));
+                    break;
+                case TextureUsage::Normal:
+                    // Z carries nothing the shaders read; leaving it flat spends every bit on XY
+                    rgba[i + 0] = ToUnorm8(t[0] * 0.5f + 0.5f);
+                    rgba[i + 1] = ToUnorm8(t[1] * 0.5f + 0.5f);
+                    rgba[i + 2] = 0;
+                    break;
+                case TextureUsage::Mask:
+                    // Grey, so the three-channel ASTC encoder follows R like BC4 does
+                    rgba[i + 0] = rgba[i + 1] = rgba[i + 2] = ToUnorm8(t[0]);
+                    break;
+                default:
+                    for (int c = 0; c < 3; c++)
+                        rgba[i + c] = ToUnorm8(t[c]);
+                    break;
+                }
+                rgba[i + 3] = usage == TextureUsage::Color || usage == TextureUsage::Linear ? ToUnorm8(t[3]) : 255;
+            }
+            return rgba;
+        }
+
+        void CompressMip(const std::vector<uint8_t> &rgba, uint32_t width, uint32_t height, ::PeFormat format, uint8_t *out)
+        {
+            const uint32_t blocksX = (width + 3) / 4;
+            const uint32_t blocksY = (height + 3) / 4;
+            const uint32_t blockBytes = PeFormatBlockSize(format);
+            ParallelFor(blocksY, 1, [&](uint32_t by)
+                        {
+                            uint8_t texels[64];
+                            for (uint32_t bx = 0; bx < blocksX; bx++)
+                            {
+                                // Blocks hanging off a small mip repeat its edge texels
+                                for (uint32_t y = 0; y < 4; y++)
+                                {
+                                    const uint32_t sy = std::min(by * 4 + y, height - 1);
+                                    for (uint32_t x = 0; x < 4; x++)
+                                    {
+                                        const uint32_t sx = std::min(bx * 4 + x, width - 1);
+                                        std::memcpy(texels + (y * 4 + x) * 4, &rgba[(size_t{sy} * width + sx) * 4], 4);
+                                    }
+                                }
+
+                                uint8_t *block = out + (size_t{by} * blocksX + bx) * blockBytes;
+                                switch (format)
+                                {
+                                case PE_FORMAT_BC4_UNORM:
+                                    EncodeBc4Block(texels, block);
+                                    break;
+                                case PE_FORMAT_BC5_UNORM:
+                                    EncodeBc5Block(texels, block);
+                                    break;
+                                case PE_FORMAT_ASTC_4x4_UNORM:
+                                    EncodeAstc4x4Block(texels, block);
+                                    break;
+                                default:
+                                    EncodeBc7Block(texels, block);
+                                    break;
+                                }
+                            } }, JobPriority::Normal);
+        }
+    } // namespace
+
+    bool CookedTexture::Encode(std::span<const uint8_t> sourceFile, TextureUsage usage, TextureTarget target,
+                               std::vector<uint8_t> &out, std::string &reason)
+    {
+        const DecodedPixels decoded = Image::DecodeRGBA8(sourceFile);
+        if (!decoded.pixels)
+        {
+            reason = "source image could not be decoded";
+            return false;
+        }
+
+        const ::PeFormat format = PickFormat(usage, target);
+        const uint32_t mipLevels = Image::CalculateMips(decoded.width, decoded.height);
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, 4);
+        header.version = kVersion;
+        header.format = static_cast<uint32_t>(format);
+        header.usage = static_cast<uint32_t>(usage);
+        header.width = decoded.width;
+        header.height = decoded.height;
+        header.mipLevels = mipLevels;
+
+        std::vector<MipRecord> records(mipLevels);
+        uint64_t offset = sizeof(Header) + sizeof(MipRecord) * mipLevels;
+        for (uint32_t mip = 0; mip < mipLevels; mip++)
+        {
+            records[mip].offset = offset;
+            records[mip].size = MipBytes(format, std::max(1u, header.width >> mip), std::max(1u, header.height >> mip));
+            offset += records[mip].size;
+        }
+
+        out.assign(offset, 0);
+        std::memcpy(out.data(), &header, sizeof(header));
+        std::memcpy(out.data() + sizeof(header), records.data(), sizeof(MipRecord) * mipLevels);
+
+        // Every level is filtered from the float level above it, never from re-quantized bytes
+        MipImage level = ToFilterSpace(decoded, usage);
+        for (uint32_t mip = 0; mip < mipLevels; mip++)
+        {
+            if (mip > 0)
+                level = Downsample(level, usage);
+            CompressMip(ToStorage(level, usage), level.width, level.height, format, out.data() + records[mip].offset);
+        }
+        return true;
+    }
+
+    bool CookedTexture::IsCookedTexture(std::span<const uint8_t> fileData)
+    {
+        return fileData.size() >= sizeof(Header) && std::memcmp(fileData.data(), kMagic, 4) == 0;
+    }
+
+    bool CookedTexture::Parse(std::span<const uint8_t> fileData, CookedTextureInfo &info, std::string &reason)
+    {
+        if (!IsCookedTexture(fileData))
+        {
+            reason = "not a .petex file";
+            return false;
+        }
+
+        Header header;
+        std::memcpy(&header, fileData.data(), sizeof(header));
+        if (header.version != kVersion)
+        {
+            reason = "unsupported .petex version " + std::to_string(header.version);
+            return false;
+        }
+        if (!IsCookedFormat(header.format))
+        {
+            reason = "unsupported block format " + std::to_string(header.format);
+            return false;
+        }
+        if (header.width == 0 || header.height == 0 || header.mipLevels == 0 ||
+            header.mipLevels > Image::CalculateMips(header.width, header.height))
+        {
+            reason = "invalid texture dimensions";
+            return false;
+        }
+
+        const size_t tableEnd = sizeof(Header) + sizeof(MipRecord) * header.mipLevels;
+        if (fileData.size() < tableEnd)
+        {
+            reason = "mip table is incomplete";
+            return false;
+        }
+
+        info.format = static_cast<::PeFormat>(header.format);
+        info.width = header.width;
+        info.height = header.height;
+        info.usage = static_cast<TextureUsage>(header.usage);
+        info.mips.clear();
+        for (uint32_t mip = 0; mip < header.mipLevels; mip++)
+        {
+            MipRecord record;
+            std::memcpy(&record, fileData.data() + sizeof(Header) + sizeof(MipRecord) * mip, sizeof(record));
+            const size_t expected = MipBytes(info.format, std::max(1u, info.width >> mip), std::max(1u, info.height >> mip));
+            if (record.size != expected || record.offset < tableEnd ||
+                record.offset > fileData.size() || record.size > fileData.size() - record.offset)
+            {
+                reason = "mip " + std::to_string(mip) + " is out of bounds";
+                return false;
+            }
+            info.mips.push_back(fileData.subspan(static_cast<size_t>(record.offset), static_cast<size_t>(record.size)));
+        }
+        return true;
+    }
+
+    std::filesystem::path CookedTexture::CookedPath(const std::filesystem::path &source, TextureUsage usage)
+    {
+        std::filesystem::path path = source;
+        path.replace_extension(std::string(".") + UsageName(usage) + Extension);
+        return path;
+    }
+
+    std::filesystem::path CookedTexture::AstcPath(const std::filesystem::path &path)
+    {
+        std::filesystem::path astc = path;
+        astc.replace_extension(AstcExtension);
+        return astc;
+    }
+
+    std::filesystem::path CookedTexture::ResolveVariant(const std::filesystem::path &path)
+    {
+        const std::string name = path.filename().string();
+        if (path.extension() != Extension || name.ends_with(AstcExtension))
+            return path;
+
+        const GpuFeatureSupport &features = RHII.GetGpuFeatureSupport();
+#if defined(PE_ANDROID)
+        // APKs stage only the ASTC variants (Player/android/app/build.gradle.kts)
+        const bool astc = features.textureCompressionASTC;
+#else
+        const bool astc = features.textureCompressionASTC && !features.textureCompressionBC;
+#endif
+        return astc ? AstcPath(path) : path;
+    }
+} // namespace pe
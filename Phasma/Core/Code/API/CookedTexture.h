@@ -0,0 +1,57 @@
+#pragma once
+
+#include "API/RHITypes.h"
+
+namespace pe
+{
+    // What a texture slot holds; picks the block format and how the mip chain is filtered
+    enum class TextureUsage : uint32_t
+    {
+        Color,  // sRGB-encoded colour (base colour, emissive): mips averaged in linear light
+        Linear, // linear data (metallic-roughness)
+        Normal, // tangent-space normal: XY only, the shaders rebuild Z; mips renormalized
+        Mask,   // one channel in R (occlusion)
+    };
+
+    // GPU block family a cook targets
+    enum class TextureTarget : uint32_t
+    {
+        BC,   // desktop: BC7 colour/linear, BC5 normals, BC4 masks
+        ASTC, // Android: ASTC 4x4
+    };
+
+    struct CookedTextureInfo
+    {
+        ::PeFormat format = PE_FORMAT_UNDEFINED;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        TextureUsage usage = TextureUsage::Color;
+        std::vector<std::span<const uint8_t>> mips; // block data per level, largest first
+    };
+
+    // ".petex": a cooked texture holding its whole mip chain as GPU blocks, uploaded as stored with
+    // no decode and no GPU mip generation. PhasmaCook writes one per texture file next to the
+    // .pemesh (BC), plus an ".astc.petex" sibling that GPUs without BC load instead.
+    class CookedTexture
+    {
+    public:
+        static constexpr const char *Extension = ".petex";
+        static constexpr const char *AstcExtension = ".astc.petex";
+
+        // Decodes an encoded image (PNG/JPG/TGA/...), builds the mip chain and block-compresses it
+        static bool Encode(std::span<const uint8_t> sourceFile, TextureUsage usage, TextureTarget target,
+                           std::vector<uint8_t> &out, std::string &reason);
+
+        static bool IsCookedTexture(std::span<const uint8_t> fileData);
+        // Validates the header and mip table; the mip spans point into fileData
+        static bool Parse(std::span<const uint8_t> fileData, CookedTextureInfo &info, std::string &reason);
+
+        // "wood.png" cooked for `usage` -> "wood.color.petex"
+        static std::filesystem::path CookedPath(const std::filesystem::path &source, TextureUsage usage);
+        // "wood.color.petex" -> "wood.color.astc.petex"
+        static std::filesystem::path AstcPath(const std::filesystem::path &path);
+        // The file this GPU should load for a cooked path: the ASTC sibling on Android and on GPUs with
+        // ASTC but no BC, the path itself otherwise (and for anything that is not a .petex)
+        static std::filesystem::path ResolveVariant(const std::filesystem::path &path);
+    };
+} // namespace pe
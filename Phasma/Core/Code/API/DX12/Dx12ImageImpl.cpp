@@ -497,7 +497,7 @@ namespace pe
                                       rowCounts.data(),
                                       rowSizes.data(),
                                       layers);
-        alloc.buffer->Flush(static_cast<size_t>(nextOffset), 0);
+        alloc.buffer->Flush(static_cast<size_t>(nextOffset), alloc.offset);
 
         TransitionForCopy(cmd, image, PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
@@ -508,6 +508,7 @@ namespace pe
             source.pResource = Dx12BufferImpl::From(alloc.buffer)->GetResource();
             source.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
             source.PlacedFootprint = layouts[i];
+            source.PlacedFootprint.Offset += alloc.offset;
 
             D3D12_TEXTURE_COPY_LOCATION dest{};
             dest.pResource = m_resource.Get();
@@ -589,6 +590,13 @@ namespace pe
         }
     }
 
+    ImageMemoryRequirements Dx12ImageImpl::GetMemoryRequirements() const
+    {
+        const D3D12_RESOURCE_DESC desc = m_resource->GetDesc();
+        const D3D12_RESOURCE_ALLOCATION_INFO info = GetDx12Device()->GetResourceAllocationInfo(0, 1, &desc);
+        return {info.SizeInBytes, info.Alignment, ~0u};
+    }
+
     void Dx12ImageImpl::CreateUAV(PeImageViewType type, uint32_t mip)
     {
         Image *image = m_owner;
@@ -30,6 +30,7 @@ namespace pe
         void CreateRTV() override;
         void CreateSRV(PeImageViewType type, int mip) override;
         void CreateUAV(PeImageViewType type, uint32_t mip) override;
+        ImageMemoryRequirements GetMemoryRequirements() const override;
 
         static Dx12ImageImpl *From(Image *image) { return static_cast<Dx12ImageImpl *>(image->m_impl); }
         static const Dx12ImageImpl *From(const Image *image) { return static_cast<const Dx12ImageImpl *>(image->m_impl); }
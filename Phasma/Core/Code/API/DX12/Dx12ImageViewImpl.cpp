@@ -386,7 +386,7 @@ namespace pe
         ImageView *view = new ImageView(parent, desc, name, true);
         view->m_impl = new Dx12ImageViewImpl(view, desc, kind);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(ImageView), reinterpret_cast<void *>(view));
+        PeTracker::Track(view);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object ImageView created (Handle: %p)", reinterpret_cast<void *>(view));
 #endif
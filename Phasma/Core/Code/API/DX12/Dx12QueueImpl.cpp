@@ -35,12 +35,18 @@ namespace pe
                                Semaphore *wait,
                                Semaphore *signal,
                                Semaphore *submissionsSemaphore,
-                               uint64_t submissionValue)
+                               uint64_t submissionValue,
+                               const std::vector<QueueWait> &queueWaits)
     {
         std::lock_guard<std::mutex> lock(s_submitMutex);
 
         if (auto *waitImpl = GetSemaphoreImpl(wait))
             waitImpl->QueueWait(m_queue, waitImpl->CurrentQueueSignalValue());
+        for (const QueueWait &queueWait : queueWaits)
+        {
+            if (auto *waitImpl = GetSemaphoreImpl(queueWait.semaphore))
+                waitImpl->QueueWait(m_queue, queueWait.value);
+        }
 
         std::vector<ID3D12CommandList *> lists;
         lists.reserve(commandBuffersCount);
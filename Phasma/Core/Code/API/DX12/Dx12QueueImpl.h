@@ -21,7 +21,8 @@ namespace pe
                     Semaphore *wait,
                     Semaphore *signal,
                     Semaphore *submissionsSemaphore,
-                    uint64_t submissionValue) override;
+                    uint64_t submissionValue,
+                    const std::vector<QueueWait> &queueWaits) override;
         void Present(Swapchain *swapchain, uint32_t imageIndex, Semaphore *wait) override;
         void WaitIdle() override;
 
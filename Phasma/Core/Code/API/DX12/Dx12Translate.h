@@ -86,6 +86,8 @@ namespace pe_dx12
         /* PE_FORMAT_A2B10G10R10_UINT_PACK32  */ DXGI_FORMAT_R10G10B10A2_UINT,
         /* PE_FORMAT_E5B9G9R9_UFLOAT_PACK32   */ DXGI_FORMAT_R9G9B9E5_SHAREDEXP,
         /* PE_FORMAT_D16_UNORM                */ DXGI_FORMAT_D16_UNORM,
+        /* PE_FORMAT_ASTC_4x4_UNORM           */ DXGI_FORMAT_UNKNOWN, // no ASTC on D3D12
+        /* PE_FORMAT_ASTC_4x4_SRGB            */ DXGI_FORMAT_UNKNOWN,
     };
 
     inline DXGI_FORMAT Format(PeFormat f)
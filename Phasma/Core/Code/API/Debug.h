@@ -60,6 +60,7 @@ namespace pe
         friend class Queue;
         friend struct VulkanCommandBufferImpl;
         friend struct Dx12CommandBufferImpl;
+        friend struct NullCommandBufferImpl;
 
         static void SetObjectNameRaw(uint32_t objectType, uint64_t objectHandle, const char *name);
         static void BeginQueueRegion(Queue *queue, const std::string &name);
@@ -109,6 +110,7 @@ namespace pe
         friend class Queue;
         friend struct VulkanCommandBufferImpl;
         friend struct Dx12CommandBufferImpl;
+        friend struct NullCommandBufferImpl;
 
         static void SetObjectNameRaw(uint32_t, uint64_t, const char *) {}
         static void BeginQueueRegion(Queue *queue, const std::string &name) {}
@@ -1,4 +1,5 @@
 #include "API/Descriptor_Internal.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanDescriptorImpl.h"
 #if defined(PE_WIN32)
@@ -13,6 +14,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanDescriptorPoolImpl(owner, desc);
+        case PE_GRAPHICS_API_NULL:
+            return new NullDescriptorPoolImpl();
 #if defined(PE_WIN32)
         case PE_GRAPHICS_API_DX12:
             return new Dx12DescriptorPoolImpl(owner, desc);
@@ -29,6 +32,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanDescriptorLayoutImpl(owner);
+        case PE_GRAPHICS_API_NULL:
+            return new NullDescriptorLayoutImpl();
 #if defined(PE_WIN32)
         case PE_GRAPHICS_API_DX12:
             return new Dx12DescriptorLayoutImpl(owner);
@@ -45,6 +50,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanDescriptorImpl(owner);
+        case PE_GRAPHICS_API_NULL:
+            return new NullDescriptorImpl();
 #if defined(PE_WIN32)
         case PE_GRAPHICS_API_DX12:
             return new Dx12DescriptorImpl(owner);
@@ -107,7 +114,7 @@ namespace pe
     {
         DescriptorPool *pool = new DescriptorPool(desc, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(DescriptorPool), reinterpret_cast<void *>(pool));
+        PeTracker::Track(pool);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object DescriptorPool created (Handle: %p)", reinterpret_cast<void *>(pool));
 #endif
@@ -134,10 +141,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object DescriptorPool destroyed (Handle: %p)", reinterpret_cast<void *>(pool));
 #endif
-            delete pool;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(DescriptorPool), reinterpret_cast<void *>(pool));
+            PeTracker::Untrack(pool);
 #endif
+            delete pool;
             pool = nullptr;
         }
     }
@@ -145,12 +152,7 @@ namespace pe
     std::vector<DescriptorPool *> DescriptorPool::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(DescriptorPool));
-        std::vector<DescriptorPool *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<DescriptorPool *>(p));
-        return out;
+        return PeTracker::GetHandles<DescriptorPool>();
 #else
         return {};
 #endif
@@ -174,7 +176,7 @@ namespace pe
     {
         DescriptorLayout *layout = new DescriptorLayout(bindingInfos, stage, name, pushDescriptor);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(DescriptorLayout), reinterpret_cast<void *>(layout));
+        PeTracker::Track(layout);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object DescriptorLayout created (Handle: %p)", reinterpret_cast<void *>(layout));
 #endif
@@ -189,10 +191,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object DescriptorLayout destroyed (Handle: %p)", reinterpret_cast<void *>(layout));
 #endif
-            delete layout;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(DescriptorLayout), reinterpret_cast<void *>(layout));
+            PeTracker::Untrack(layout);
 #endif
+            delete layout;
             layout = nullptr;
         }
     }
@@ -200,12 +202,7 @@ namespace pe
     std::vector<DescriptorLayout *> DescriptorLayout::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(DescriptorLayout));
-        std::vector<DescriptorLayout *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<DescriptorLayout *>(p));
-        return out;
+        return PeTracker::GetHandles<DescriptorLayout>();
 #else
         return {};
 #endif
@@ -300,7 +297,7 @@ namespace pe
     {
         Descriptor *descriptor = new Descriptor(bindingInfos, stage, pushDescriptor, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Descriptor), reinterpret_cast<void *>(descriptor));
+        PeTracker::Track(descriptor);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Descriptor created (Handle: %p)", reinterpret_cast<void *>(descriptor));
 #endif
@@ -315,10 +312,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object Descriptor destroyed (Handle: %p)", reinterpret_cast<void *>(descriptor));
 #endif
-            delete descriptor;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Descriptor), reinterpret_cast<void *>(descriptor));
+            PeTracker::Untrack(descriptor);
 #endif
+            delete descriptor;
             descriptor = nullptr;
         }
     }
@@ -326,12 +323,7 @@ namespace pe
     std::vector<Descriptor *> Descriptor::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Descriptor));
-        std::vector<Descriptor *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Descriptor *>(p));
-        return out;
+        return PeTracker::GetHandles<Descriptor>();
 #else
         return {};
 #endif
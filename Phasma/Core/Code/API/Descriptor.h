@@ -22,7 +22,7 @@ namespace pe
         bool updateAfterBind = true;
     };
 
-    class DescriptorPool : public NoCopy
+    class DescriptorPool : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -74,7 +74,7 @@ namespace pe
         std::vector<AccelerationStructure *> accelerationStructures{};
     };
 
-    class DescriptorLayout : public NoCopy
+    class DescriptorLayout : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -115,12 +115,14 @@ namespace pe
             return hash;
         }
 
+        // Locked: pipeline prewarm creates pipelines, and through them layouts, on job workers
         inline static DescriptorLayout *GetOrCreate(const std::vector<DescriptorBindingInfo> &bindingInfos,
                                                     PeShaderStageFlags stage,
                                                     bool pushDescriptor = false)
         {
             static size_t count = 0;
             size_t hash = DescriptorLayout::CalculateHash(bindingInfos, stage, pushDescriptor);
+            std::lock_guard<std::mutex> lock(s_descriptorLayoutsMutex);
             auto it = DescriptorLayout::s_descriptorLayouts.find(hash);
             if (it == DescriptorLayout::s_descriptorLayouts.end())
             {
@@ -136,6 +138,7 @@ namespace pe
 
         inline static void ClearCache()
         {
+            std::lock_guard<std::mutex> lock(s_descriptorLayoutsMutex);
             for (auto &[hash, layout] : s_descriptorLayouts)
                 DescriptorLayout::Destroy(layout);
             s_descriptorLayouts.clear();
@@ -152,6 +155,7 @@ namespace pe
         ~DescriptorLayout();
 
         inline static std::unordered_map<size_t, DescriptorLayout *> s_descriptorLayouts{};
+        inline static std::mutex s_descriptorLayoutsMutex{};
 
         Impl *m_impl{};
         std::vector<DescriptorBindingInfo> m_bindingInfos{};
@@ -185,7 +189,7 @@ namespace pe
         std::string m_name = "Descriptor_layout";
     };
 
-    class Descriptor : public NoCopy
+    class Descriptor : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
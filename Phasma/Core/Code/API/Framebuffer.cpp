@@ -1,4 +1,5 @@
 #include "API/Framebuffer_Internal.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanFramebufferImpl.h"
 #if defined(PE_WIN32)
@@ -19,6 +20,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanFramebufferImpl(owner, width, height, views, renderPass, name);
+        case PE_GRAPHICS_API_NULL:
+            return new NullFramebufferImpl();
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12FramebufferImpl(owner, width, height, views, renderPass, name);
@@ -40,7 +43,7 @@ namespace pe
     {
         Framebuffer *fb = new Framebuffer(width, height, views, renderPass, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Framebuffer), reinterpret_cast<void *>(fb));
+        PeTracker::Track(fb);
 #endif
         return fb;
     }
@@ -50,7 +53,7 @@ namespace pe
         if (fb)
         {
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Framebuffer), reinterpret_cast<void *>(fb));
+            PeTracker::Untrack(fb);
 #endif
             delete fb;
             fb = nullptr;
@@ -60,12 +63,7 @@ namespace pe
     std::vector<Framebuffer *> Framebuffer::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Framebuffer));
-        std::vector<Framebuffer *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Framebuffer *>(p));
-        return out;
+        return PeTracker::GetHandles<Framebuffer>();
 #else
         return {};
 #endif
@@ -5,7 +5,7 @@ namespace pe
     class RenderPass;
     class ImageView;
 
-    class Framebuffer : public NoCopy
+    class Framebuffer : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -40,6 +40,8 @@ namespace pe
 #else
                 return false;
 #endif
+            case PE_GRAPHICS_API_NULL:
+                return true;
             default:
                 return false;
             }
@@ -58,7 +60,7 @@ namespace pe
 
         std::string ExpectedApiList()
         {
-            return "vulkan, dx12";
+            return "vulkan, dx12, null";
         }
 
         std::string InvalidApiMessage(const std::string &label, const std::string &value)
@@ -220,6 +222,12 @@ namespace pe
             return true;
         }
 
+        if (value == "null" || value == "headless")
+        {
+            api = PE_GRAPHICS_API_NULL;
+            return true;
+        }
+
         return false;
     }
 
@@ -231,6 +239,8 @@ namespace pe
             return "vulkan";
         case PE_GRAPHICS_API_DX12:
             return "dx12";
+        case PE_GRAPHICS_API_NULL:
+            return "null";
         default:
             return "unknown";
         }
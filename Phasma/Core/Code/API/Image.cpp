@@ -1,7 +1,10 @@
 #include "API/Image_Internal.h"
 #include "API/Buffer.h"
 #include "API/Command.h"
+#include "API/CookedTexture.h"
 #include "API/Downsampler/Downsampler.h"
+#include "API/Null/NullCommandBufferImpl.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanImageImpl.h"
 #if defined(PE_WIN32)
@@ -16,6 +19,8 @@ namespace pe
 {
     Image::Impl *CreateImageImpl(Image *owner, const ImageDesc &desc)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+            return new NullImageImpl(owner, desc);
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
             return new Dx12ImageImpl(owner, desc);
@@ -23,8 +28,23 @@ namespace pe
         return new VulkanImageImpl(owner, desc);
     }
 
+    ImageHeap::Impl *CreateImageHeapImpl(ImageHeap *owner, const ImageMemoryRequirements &requirements)
+    {
+        // DX12 placed resources also need aliasing barriers and a Discard on first use; until the
+        // DX12 barrier path records those, its images stay committed.
+        if (RHII.GetApi() != PE_GRAPHICS_API_VULKAN)
+            return nullptr;
+        return new VulkanImageHeapImpl(owner, requirements);
+    }
+
     void Image_Barrier_Backend(CommandBuffer *cmd, const ImageBarrierInfo &info)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+        {
+            PE_ERROR_IF(!cmd, "Image::Barrier: no command buffer specified");
+            NullCommandBufferImpl::From(cmd)->ImageBarrier(info);
+            return;
+        }
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
@@ -38,6 +58,12 @@ namespace pe
 
     void Image_Barriers_Backend(CommandBuffer *cmd, const std::vector<ImageBarrierInfo> &infos)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+        {
+            PE_ERROR_IF(!cmd, "Image::Barriers: no command buffer specified");
+            NullCommandBufferImpl::From(cmd)->ImageBarriers(infos);
+            return;
+        }
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
@@ -181,7 +207,7 @@ namespace pe
             }
         }
 
-        bool ParseDdsInfo(const std::vector<uint8_t> &fileData, DdsInfo &outInfo, std::string &reason)
+        bool ParseDdsInfo(std::span<const uint8_t> fileData, DdsInfo &outInfo, std::string &reason)
         {
             constexpr size_t kMagicSize = 4;
             constexpr size_t kHeaderSize = 124;
@@ -278,24 +304,21 @@ namespace pe
             return true;
         }
 
-        Image *LoadDdsCompressed(CommandBuffer *cmd, const std::string &path, const std::vector<uint8_t> &fileData)
+        // Creates a sampled image and uploads a block-compressed mip chain as stored (DDS, .petex)
+        Image *UploadCompressedMips(CommandBuffer *cmd, const std::string &path, ::PeFormat format,
+                                    uint32_t width, uint32_t height, std::span<const std::span<const uint8_t>> mips)
         {
-            DdsInfo dds{};
-            std::string reason;
-            if (!ParseDdsInfo(fileData, dds, reason))
-            {
-                PE_WARN("[Image] Failed to parse DDS '%s': %s", path.c_str(), reason.c_str());
-                return nullptr;
-            }
+            const uint32_t mipLevels = static_cast<uint32_t>(mips.size());
 
             ImageDesc desc{};
-            desc.format = dds.format;
-            desc.width = dds.width;
-            desc.height = dds.height;
-            desc.mipLevels = dds.mipLevels;
+            desc.format = format;
+            desc.width = width;
+            desc.height = height;
+            desc.mipLevels = mipLevels;
             desc.usage = PE_IMAGE_USAGE_TRANSFER_DST | PE_IMAGE_USAGE_SAMPLED;
             desc.initialLayout = PE_IMAGE_LAYOUT_UNDEFINED;
             desc.name = path;
+            desc.concurrentQueues = true; // pure copies, so the caller may record them on the transfer queue
 
             Image *image = Image::Create(desc);
             image->SetClearColor(Color::Transparent);
@@ -303,28 +326,19 @@ namespace pe
 
             SamplerDesc samplerInfo = Sampler::CreateInfoInit();
             samplerInfo.mipLodBias = log2(Settings::Get<SceneSettings>().render_scale) - 1.0f;
-            samplerInfo.maxLod = static_cast<float>(dds.mipLevels);
+            samplerInfo.maxLod = static_cast<float>(mipLevels);
             samplerInfo.borderColor = PE_SAMPLER_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
             image->SetSampler(Sampler::Create(samplerInfo));
 
-            size_t offset = 0;
-            for (uint32_t mip = 0; mip < dds.mipLevels; ++mip)
+            for (uint32_t mip = 0; mip < mipLevels; ++mip)
             {
-                const uint32_t mipWidth = std::max(1u, dds.width >> mip);
-                const uint32_t mipHeight = std::max(1u, dds.height >> mip);
-                const size_t blockWidth = (mipWidth + 3u) / 4u;
-                const size_t blockHeight = (mipHeight + 3u) / 4u;
-                const size_t mipSize = blockWidth * blockHeight * dds.blockBytes;
-
                 cmd->CopyDataToImageStaged(image,
-                                           const_cast<uint8_t *>(fileData.data() + dds.dataOffset + offset),
-                                           mipSize,
+                                           const_cast<uint8_t *>(mips[mip].data()),
+                                           mips[mip].size(),
                                            0,
                                            1,
                                            mip);
-                offset += mipSize;
             }
-            PE_ERROR_IF(offset != dds.dataSize, "DDS upload byte count mismatch for '%s'", path.c_str());
 
             ImageBarrierInfo toRead{};
             toRead.image = image;
@@ -334,12 +348,52 @@ namespace pe
                                 PE_STAGE_RAY_TRACING_SHADER_KHR;
             toRead.accessMask = PE_ACCESS_SHADER_SAMPLED_READ;
             toRead.baseMipLevel = 0;
-            toRead.mipLevels = dds.mipLevels;
+            toRead.mipLevels = mipLevels;
             cmd->ImageBarrier(toRead);
 
             return image;
         }
 
+        Image *LoadDdsCompressed(CommandBuffer *cmd, const std::string &path, std::span<const uint8_t> fileData)
+        {
+            DdsInfo dds{};
+            std::string reason;
+            if (!ParseDdsInfo(fileData, dds, reason))
+            {
+                PE_WARN("[Image] Failed to parse DDS '%s': %s", path.c_str(), reason.c_str());
+                return nullptr;
+            }
+
+            std::vector<std::span<const uint8_t>> mips;
+            size_t offset = 0;
+            for (uint32_t mip = 0; mip < dds.mipLevels; ++mip)
+            {
+                const uint32_t mipWidth = std::max(1u, dds.width >> mip);
+                const uint32_t mipHeight = std::max(1u, dds.height >> mip);
+                const size_t blockWidth = (mipWidth + 3u) / 4u;
+                const size_t blockHeight = (mipHeight + 3u) / 4u;
+                const size_t mipSize = blockWidth * blockHeight * dds.blockBytes;
+                mips.push_back(fileData.subspan(dds.dataOffset + offset, mipSize));
+                offset += mipSize;
+            }
+            PE_ERROR_IF(offset != dds.dataSize, "DDS upload byte count mismatch for '%s'", path.c_str());
+
+            return UploadCompressedMips(cmd, path, dds.format, dds.width, dds.height, mips);
+        }
+
+        Image *LoadCookedTexture(CommandBuffer *cmd, const std::string &path, std::span<const uint8_t> fileData)
+        {
+            CookedTextureInfo info;
+            std::string reason;
+            if (!CookedTexture::Parse(fileData, info, reason))
+            {
+                PE_WARN("[Image] Failed to parse cooked texture '%s': %s", path.c_str(), reason.c_str());
+                return nullptr;
+            }
+
+            return UploadCompressedMips(cmd, path, info.format, info.width, info.height, info.mips);
+        }
+
         Image *CreateImageAndUpload(CommandBuffer *cmd,
                                     const std::string &name,
                                     void *data,
@@ -379,13 +433,44 @@ namespace pe
 
             return image;
         }
+
+        size_t EstimateImageBytes(const ImageDesc &desc)
+        {
+            const bool blocks = PeFormatIsBlockCompressed(desc.format);
+            size_t bytes = 0;
+            for (uint32_t mip = 0; mip < desc.mipLevels; mip++)
+            {
+                size_t w = std::max(desc.width >> mip, 1u);
+                size_t h = std::max(desc.height >> mip, 1u);
+                const size_t d = std::max(desc.depth >> mip, 1u);
+                if (blocks)
+                {
+                    w = (w + 3) / 4;
+                    h = (h + 3) / 4;
+                }
+                bytes += w * h * d;
+            }
+            return bytes * PeFormatBlockSize(desc.format) * desc.arrayLayers * (size_t{1} << desc.samples);
+        }
     } // namespace
 
     Image *Image::Create(const ImageDesc &desc)
     {
         Image *image = new Image(desc);
+
+        // Charged to the current tag; untagged images are split by whether they get rendered to
+        MemoryTag tag = MemoryTracker::GetCurrentTag();
+        if (tag == MemoryTag::Untagged)
+        {
+            constexpr PeImageUsageFlags attachment = PE_IMAGE_USAGE_COLOR_ATTACHMENT | PE_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT;
+            tag = (desc.usage & attachment) ? MemoryTag::RenderTargets : MemoryTag::Textures;
+        }
+        image->m_memoryTag = tag;
+        image->m_memoryBytes = EstimateImageBytes(desc);
+        MemoryTracker::AddGpu(tag, image->m_memoryBytes);
+
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Image), reinterpret_cast<void *>(image));
+        PeTracker::Track(image);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Image created (Handle: %p)", reinterpret_cast<void *>(image));
 #endif
@@ -400,10 +485,12 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object Image destroyed (Handle: %p)", reinterpret_cast<void *>(image));
 #endif
-            delete image;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Image), reinterpret_cast<void *>(image));
+            PeTracker::Untrack(image);
 #endif
+            if (!image->m_heap)
+                MemoryTracker::RemoveGpu(image->m_memoryTag, image->m_memoryBytes);
+            delete image;
             image = nullptr;
         }
     }
@@ -411,12 +498,7 @@ namespace pe
     std::vector<Image *> Image::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Image));
-        std::vector<Image *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Image *>(p));
-        return out;
+        return PeTracker::GetHandles<Image>();
 #else
         return {};
 #endif
@@ -485,6 +567,12 @@ namespace pe
 
         delete m_impl;
         m_impl = nullptr;
+
+        if (m_heap)
+        {
+            m_heap->RemovePlaced();
+            m_heap = nullptr;
+        }
     }
 
     void Image::SetCurrentInfoAll(const ImageTrackInfo &info)
@@ -494,6 +582,118 @@ namespace pe
                 m_trackInfos[i][j] = info;
     }
 
+    ImageMemoryRequirements Image::GetMemoryRequirements() const
+    {
+        return m_impl->GetMemoryRequirements();
+    }
+
+    bool Image::PlaceInHeap(ImageHeap *heap, uint64_t offset)
+    {
+        if (heap == m_heap && (!heap || offset == m_heapOffset))
+            return true;
+
+        if (heap)
+        {
+            const ImageMemoryRequirements requirements = GetMemoryRequirements();
+            if (!(requirements.memoryTypeBits & heap->GetMemoryTypeBits()) ||
+                offset % requirements.alignment != 0 ||
+                offset + requirements.size > heap->GetSize())
+                return false;
+        }
+
+        // Views reference the native image: destroy them first and rebuild them with the same descs
+        struct ViewSlot
+        {
+            ImageView **slot;
+            ImageViewDesc desc;
+            std::string name;
+        };
+        std::vector<ViewSlot> views;
+        auto collect = [&views](ImageView *&view)
+        {
+            if (view)
+                views.push_back({&view, view->GetDesc(), view->GetName()});
+        };
+        collect(m_rtv);
+        collect(m_srv);
+        for (auto &view : m_srvs)
+            collect(view);
+        for (auto &view : m_uavs)
+            collect(view);
+
+        CommandBuffer::ClearFramebufferCache();
+        for (ViewSlot &view : views)
+            ImageView::Destroy(*view.slot);
+
+        const bool placed = m_impl->Place(heap, offset);
+        for (ViewSlot &view : views)
+            *view.slot = ImageView::Create(this, view.desc, view.name);
+        if (!placed)
+            return false;
+
+        if (heap)
+            heap->AddPlaced();
+        else
+            MemoryTracker::AddGpu(m_memoryTag, m_memoryBytes);
+        if (m_heap)
+            m_heap->RemovePlaced();
+        else
+            MemoryTracker::RemoveGpu(m_memoryTag, m_memoryBytes);
+        m_heap = heap;
+        m_heapOffset = heap ? offset : 0;
+
+        // New memory holds no defined contents; the next barrier transitions from UNDEFINED
+        ImageTrackInfo info{};
+        info.image = this;
+        SetCurrentInfoAll(info);
+        return true;
+    }
+
+    ImageHeap *ImageHeap::Create(const ImageMemoryRequirements &requirements, const std::string &name)
+    {
+        ImageHeap *heap = new ImageHeap();
+        heap->m_name = name;
+        heap->m_impl = CreateImageHeapImpl(heap, requirements);
+        if (!heap->m_impl)
+        {
+            delete heap;
+            return nullptr;
+        }
+
+        heap->m_size = requirements.size;
+        MemoryTracker::AddGpu(MemoryTag::RenderTargets, heap->m_size);
+        return heap;
+    }
+
+    void ImageHeap::Destroy(ImageHeap *&heap)
+    {
+        if (!heap)
+            return;
+
+        heap->m_released = true;
+        if (heap->m_placedCount == 0)
+            delete heap;
+        heap = nullptr;
+    }
+
+    ImageHeap::~ImageHeap()
+    {
+        MemoryTracker::RemoveGpu(MemoryTag::RenderTargets, m_size);
+        delete m_impl;
+    }
+
+    void ImageHeap::AddPlaced()
+    {
+        m_placedCount++;
+    }
+
+    void ImageHeap::RemovePlaced()
+    {
+        PE_ERROR_IF(m_placedCount == 0, "ImageHeap::RemovePlaced: no image is placed in '%s'", m_name.c_str());
+        if (--m_placedCount == 0 && m_released)
+            delete this;
+    }
+
     void Image::CreateRTV()
     {
         m_impl->CreateRTV();
@@ -563,17 +763,17 @@ namespace pe
 
     Image *Image::LoadRGBA(CommandBuffer *cmd, const std::string &path, ::PeFormat format, bool isFloat)
     {
-        std::vector<uint8_t> fileData;
+        FileView file(path);
+        if (!file.IsOpen())
         {
-            FileSystem file(path, std::ios::in | std::ios::binary);
-            if (!file.IsOpen())
-            {
-                PE_WARN("[Image] Failed to open image file: %s", path.c_str());
-                return nullptr;
-            }
-            fileData = file.ReadAllBytes();
+            PE_WARN("[Image] Failed to open image file: %s", path.c_str());
+            return nullptr;
         }
+        return LoadRGBA(cmd, path, file.Bytes(), format, isFloat);
+    }
 
+    Image *Image::LoadRGBA(CommandBuffer *cmd, const std::string &path, std::span<const uint8_t> fileData, ::PeFormat format, bool isFloat)
+    {
         if (fileData.size() >= 4 && std::memcmp(fileData.data(), "DDS ", 4) == 0)
         {
             if (isFloat)
@@ -583,6 +783,15 @@ namespace pe
             }
             return LoadDdsCompressed(cmd, path, fileData);
         }
+        if (CookedTexture::IsCookedTexture(fileData))
+        {
+            if (isFloat)
+            {
+                PE_WARN("[Image] Cooked texture float decode is not supported for '%s'", path.c_str());
+                return nullptr;
+            }
+            return LoadCookedTexture(cmd, path, fileData);
+        }
 
         int texWidth, texHeight, texChannels;
         void *pixels = nullptr;
@@ -616,6 +825,31 @@ namespace pe
         return image;
     }
 
+    bool Image::IsStoredCompressed(std::span<const uint8_t> fileData)
+    {
+        if (fileData.size() >= 4 && std::memcmp(fileData.data(), "DDS ", 4) == 0)
+            return true;
+        return CookedTexture::IsCookedTexture(fileData);
+    }
+
+    DecodedPixels Image::DecodeRGBA8(std::span<const uint8_t> fileData)
+    {
+        DecodedPixels decoded;
+        if (IsStoredCompressed(fileData))
+            return decoded;
+
+        int texWidth, texHeight, texChannels;
+        stbi_uc *pixels = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+        if (!pixels)
+            return decoded;
+
+        decoded.pixels = std::shared_ptr<uint8_t>(pixels, [](uint8_t *p)
+                                                  { stbi_image_free(p); });
+        decoded.width = static_cast<uint32_t>(texWidth);
+        decoded.height = static_cast<uint32_t>(texHeight);
+        return decoded;
+    }
+
     Image *Image::LoadRGBAFromMemory(CommandBuffer *cmd, void *data, int size, ::PeFormat format, bool isFloat)
     {
         int texWidth, texHeight, texChannels;
@@ -683,19 +917,15 @@ namespace pe
 
     Image *Image::LoadWhitenedRGBA8(CommandBuffer *cmd, const std::string &path, float amount)
     {
-        std::vector<uint8_t> fileData;
+        FileView file(path);
+        if (!file.IsOpen())
         {
-            FileSystem file(path, std::ios::in | std::ios::binary);
-            if (!file.IsOpen())
-            {
-                PE_WARN("[Image] Failed to open image file: %s", path.c_str());
-                return nullptr;
-            }
-            fileData = file.ReadAllBytes();
+            PE_WARN("[Image] Failed to open image file: %s", path.c_str());
+            return nullptr;
         }
 
         int texWidth = 0, texHeight = 0, texChannels = 0;
-        stbi_uc *pixels = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()),
+        stbi_uc *pixels = stbi_load_from_memory(file.Data(), static_cast<int>(file.Size()),
                                                 &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
         if (!pixels)
         {
@@ -737,19 +967,15 @@ namespace pe
 
     Image *Image::LoadColorizeMaskRGBA8(CommandBuffer *cmd, const std::string &path)
     {
-        std::vector<uint8_t> fileData;
+        FileView file(path);
+        if (!file.IsOpen())
         {
-            FileSystem file(path, std::ios::in | std::ios::binary);
-            if (!file.IsOpen())
-            {
-                PE_WARN("[Image] Failed to open image file: %s", path.c_str());
-                return nullptr;
-            }
-            fileData = file.ReadAllBytes();
+            PE_WARN("[Image] Failed to open image file: %s", path.c_str());
+            return nullptr;
         }
 
         int texWidth = 0, texHeight = 0, texChannels = 0;
-        stbi_uc *pixels = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()),
+        stbi_uc *pixels = stbi_load_from_memory(file.Data(), static_cast<int>(file.Size()),
                                                 &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
         if (!pixels)
         {
@@ -795,12 +1021,8 @@ namespace pe
 
     Image *Image::LoadRaw(CommandBuffer *cmd, const std::string &path, const LoadRawParams &params)
     {
-        std::vector<uint8_t> bytes;
-        {
-            FileSystem f(path, std::ios::in | std::ios::binary);
-            PE_ERROR_IF(!f.IsOpen(), ("Failed to open raw image file: " + path).c_str());
-            bytes = f.ReadAllBytes();
-        }
+        FileView file(path);
+        PE_ERROR_IF(!file.IsOpen(), ("Failed to open raw image file: " + path).c_str());
 
         uint32_t bytesPerPixel = 0;
         switch (params.format)
@@ -822,7 +1044,7 @@ namespace pe
         }
 
         const size_t expectedSize = params.width * params.height * bytesPerPixel;
-        PE_ERROR_IF(bytes.size() != expectedSize, ("Raw image size mismatch. Expected " + std::to_string(expectedSize) + " bytes, got " + std::to_string(bytes.size())).c_str());
+        PE_ERROR_IF(file.Size() != expectedSize, ("Raw image size mismatch. Expected " + std::to_string(expectedSize) + " bytes, got " + std::to_string(file.Size())).c_str());
 
         uint32_t mipLevels = params.generateMips ? Image::CalculateMips(params.width, params.height) : 1;
         PeImageUsageFlags usage = PE_IMAGE_USAGE_TRANSFER_DST | PE_IMAGE_USAGE_SAMPLED;
@@ -843,6 +1065,6 @@ namespace pe
         samplerInfo.minLod = 0.0f;
         samplerInfo.maxLod = params.generateMips ? static_cast<float>(mipLevels) : 0.0f;
 
-        return CreateImageAndUpload(cmd, path, bytes.data(), bytes.size(), params.width, params.height, params.format, mipLevels, usage, samplerInfo);
+        return CreateImageAndUpload(cmd, path, const_cast<uint8_t *>(file.Data()), file.Size(), params.width, params.height, params.format, mipLevels, usage, samplerInfo);
     }
 } // namespace pe
@@ -30,6 +30,8 @@ namespace pe
         vec4 clearColor = vec4(0.0f, 0.0f, 0.0f, 1.0f);
         bool useOptimizedClearValue = true;
         std::string name;
+        // Like BufferDesc::concurrentQueues: uploaded on the transfer queue, sampled on graphics
+        bool concurrentQueues = false;
     };
 
     struct ImageBarrierInfo
@@ -59,7 +61,59 @@ namespace pe
     };
     using ImageTrackInfo = ImageBarrierInfo;
 
-    class Image : public Resource
+    // CPU half of an RGBA8 image load, for loaders that decode on worker threads (see Image::DecodeRGBA8)
+    struct DecodedPixels
+    {
+        std::shared_ptr<uint8_t> pixels; // width * height RGBA8 texels; null when not decoded
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    struct ImageMemoryRequirements
+    {
+        uint64_t size = 0;
+        uint64_t alignment = 1;
+        uint32_t memoryTypeBits = ~0u; // backends without memory types report every bit
+    };
+
+    // Device memory that images are placed into at chosen offsets, so images whose uses never overlap
+    // in time share the same bytes (RenderGraph transient aliasing). Destroy() drops the creator's
+    // reference; the memory is freed once no image is placed in it any more.
+    class ImageHeap : public NoCopy
+    {
+    public:
+        struct Impl; // forward — defined in Image_Internal.h
+
+        // nullptr when the active backend cannot place images
+        static ImageHeap *Create(const ImageMemoryRequirements &requirements, const std::string &name);
+        static void Destroy(ImageHeap *&heap);
+
+        uint64_t GetSize() const { return m_size; }
+        // Memory type bits an image has to allow to be placed here
+        uint32_t GetMemoryTypeBits() const { return m_memoryTypeBits; }
+        uint32_t GetPlacedCount() const { return m_placedCount; }
+        // Destroyed by its creator, alive only for the images still placed in it
+        bool IsReleased() const { return m_released; }
+        const std::string &GetName() const { return m_name; }
+
+    private:
+        friend class Image;
+        friend struct VulkanImageHeapImpl;
+
+        ImageHeap() = default;
+        ~ImageHeap();
+        void AddPlaced();
+        void RemovePlaced();
+
+        Impl *m_impl{};
+        uint64_t m_size{};
+        uint32_t m_memoryTypeBits{};
+        uint32_t m_placedCount{};
+        bool m_released = false;
+        std::string m_name;
+    };
+
+    class Image : public Resource, public PeTracked
     {
     public:
         struct Impl; // forward — defined in Image_Internal.h, body engine-private
@@ -104,6 +158,15 @@ namespace pe
         vec4 GetClearColor() { return m_clearColor; }
         void SetClearColor(const vec4 &color) { m_clearColor = color; }
 
+        ImageMemoryRequirements GetMemoryRequirements() const;
+        // Moves the image into `heap` at `offset`, or back to memory of its own when heap is nullptr.
+        // The native image and its views are recreated and the tracked state drops to UNDEFINED, so
+        // the GPU must be idle and descriptor sets and framebuffers using the old views refreshed.
+        // Returns false, leaving the image where it was, if the backend or the heap cannot take it.
+        bool PlaceInHeap(ImageHeap *heap, uint64_t offset);
+        ImageHeap *GetHeap() const { return m_heap; }
+        uint64_t GetHeapOffset() const { return m_heapOffset; }
+
         void SetAspectMaskOverride(PeImageAspectFlags m) { m_aspectMaskOverride = m; }
         PeImageAspectFlags GetAspectMaskOverride() const { return m_aspectMaskOverride; }
 
@@ -113,6 +176,13 @@ namespace pe
         // internally; the format param flows into ImageDesc.format.
         static Image *LoadRGBA(CommandBuffer *cmd, const std::string &path, ::PeFormat format, bool isFloat = false);
         static Image *LoadRGBA8(CommandBuffer *cmd, const std::string &path);
+        // Same as LoadRGBA for a file already read into memory (e.g. by the IoService); `path` only names it
+        static Image *LoadRGBA(CommandBuffer *cmd, const std::string &path, std::span<const uint8_t> fileData, ::PeFormat format, bool isFloat = false);
+        // Thread-safe stb decode of an encoded file to RGBA8; upload the result with LoadRawFromMemory.
+        // DDS and .petex files (uploaded as stored) and undecodable data come back empty: load those with LoadRGBA.
+        static DecodedPixels DecodeRGBA8(std::span<const uint8_t> fileData);
+        // DDS or .petex: LoadRGBA only records copies for these, so any queue can take the upload
+        static bool IsStoredCompressed(std::span<const uint8_t> fileData);
         // Lift light pixels toward white while preserving dark line art and source alpha.
         static Image *LoadWhitenedRGBA8(CommandBuffer *cmd, const std::string &path, float amount);
         // White RGB + source alpha — multiply tint then yields a pure flat color silhouette.
@@ -142,6 +212,8 @@ namespace pe
         friend struct Dx12CommandBufferImpl;
         friend struct Dx12ImageImpl;
         friend class Dx12SwapchainImpl;
+        friend struct NullCommandBufferImpl;
+        friend struct NullImageImpl;
 
         Image(const ImageDesc &desc);
         static void Barrier(CommandBuffer *cmd, const ImageBarrierInfo &info);
@@ -180,5 +252,9 @@ namespace pe
         vec4 m_clearColor = vec4(0.0f, 0.0f, 0.0f, 1.0f);
         PeImageAspectFlags m_aspectMaskOverride{PE_IMAGE_ASPECT_NONE};
         std::string m_name;
+        MemoryTag m_memoryTag{MemoryTag::Untagged};
+        size_t m_memoryBytes{}; // estimated from the desc, charged to m_memoryTag
+        ImageHeap *m_heap{};    // placed images are charged to their heap instead
+        uint64_t m_heapOffset{};
     };
 } // namespace pe
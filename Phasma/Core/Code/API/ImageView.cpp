@@ -1,4 +1,5 @@
 #include "API/ImageView_Internal.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanImageViewImpl.h"
 #if defined(PE_WIN32)
@@ -9,6 +10,8 @@ namespace pe
 {
     ImageView::Impl *CreateImageViewImpl(ImageView *owner, const ImageViewDesc &desc)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+            return new NullImageViewImpl();
 #if defined(PE_WIN32)
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
             return new Dx12ImageViewImpl(owner, desc, Dx12ImageViewKind::Srv);
@@ -20,7 +23,7 @@ namespace pe
     {
         ImageView *view = new ImageView(parent, desc, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(ImageView), reinterpret_cast<void *>(view));
+        PeTracker::Track(view);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object ImageView created (Handle: %p)", reinterpret_cast<void *>(view));
 #endif
@@ -35,10 +38,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object ImageView destroyed (Handle: %p)", reinterpret_cast<void *>(view));
 #endif
-            delete view;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(ImageView), reinterpret_cast<void *>(view));
+            PeTracker::Untrack(view);
 #endif
+            delete view;
             view = nullptr;
         }
     }
@@ -46,12 +49,7 @@ namespace pe
     std::vector<ImageView *> ImageView::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(ImageView));
-        std::vector<ImageView *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<ImageView *>(p));
-        return out;
+        return PeTracker::GetHandles<ImageView>();
 #else
         return {};
 #endif
@@ -21,7 +21,7 @@ namespace pe
         PeComponentSwizzle swizzleA = PE_COMPONENT_SWIZZLE_IDENTITY;
     };
 
-    class ImageView : public NoCopy
+    class ImageView : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
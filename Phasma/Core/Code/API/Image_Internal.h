@@ -21,6 +21,15 @@ namespace pe
         virtual void CreateRTV() = 0;
         virtual void CreateSRV(PeImageViewType type, int mip) = 0;
         virtual void CreateUAV(PeImageViewType type, uint32_t mip) = 0;
+        virtual ImageMemoryRequirements GetMemoryRequirements() const = 0;
+        // Recreates the native image in `heap` at `offset`, or in a dedicated allocation when heap is
+        // nullptr. Views are the caller's. Backends that cannot alias images keep the default.
+        virtual bool Place(ImageHeap *heap, uint64_t offset) { return false; }
+    };
+
+    struct ImageHeap::Impl : public NoCopy
+    {
+        virtual ~Impl() = default;
     };
 
     // Phase 0 backend factory + free-function dispatch. In Phase 0 these route
@@ -28,6 +37,8 @@ namespace pe
     // active RHI backend selected at RHI::Init(). Defined in the active backend's
     // translation unit (currently Vulkan/VulkanImageImpl.cpp).
     Image::Impl *CreateImageImpl(Image *owner, const ImageDesc &desc);
+    // nullptr on backends that cannot place images in shared memory.
+    ImageHeap::Impl *CreateImageHeapImpl(ImageHeap *owner, const ImageMemoryRequirements &requirements);
     // Native swapchain image wrapping is backend-private.
     void Image_Barrier_Backend(CommandBuffer *cmd, const ImageBarrierInfo &info);
     void Image_Barriers_Backend(CommandBuffer *cmd, const std::vector<ImageBarrierInfo> &infos);
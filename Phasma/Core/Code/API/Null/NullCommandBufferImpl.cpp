@@ -0,0 +1,756 @@
+#include "API/Null/NullCommandBufferImpl.h"
+#include "API/Buffer.h"
+#include "API/Debug.h"
+#include "API/Image.h"
+#include "API/Null/NullRhiImpl.h"
+#include "API/Null/NullResourceImpl.h"
+#include "API/Null/NullSyncImpl.h"
+#include "API/Pipeline.h"
+#include "API/QueryPool.h"
+#include "API/RHI.h"
+#include "API/Semaphore.h"
+#include "API/Swapchain.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr const char *kCommandTypeNames[] = {
+            "BeginPass",
+            "EndPass",
+            "BindPipeline",
+            "BindVertexBuffer",
+            "BindIndexBuffer",
+            "BindDescriptors",
+            "PushDescriptor",
+            "PushConstants",
+            "SetState",
+            "Draw",
+            "DrawIndexed",
+            "DrawIndirect",
+            "DrawIndexedIndirect",
+            "DrawIndexedIndirectCount",
+            "Dispatch",
+            "TraceRays",
+            "FillBuffer",
+            "CopyBuffer",
+            "CopyBufferToImage",
+            "CopyImage",
+            "CopyImageToBuffer",
+            "BlitImage",
+            "ClearColor",
+            "ClearDepthStencil",
+            "GenerateMipMaps",
+            "Barrier",
+            "Query",
+            "ResolveQueryPool",
+            "SetEvent",
+            "BeginDebugRegion",
+            "InsertDebugLabel",
+            "EndDebugRegion",
+        };
+        static_assert(std::size(kCommandTypeNames) == static_cast<size_t>(NullCommandType::EndDebugRegion) + 1);
+
+        uint8_t *BufferMemory(void *buffer)
+        {
+            return NullBufferImpl::From(static_cast<Buffer *>(buffer))->m_memory;
+        }
+
+        void TrackImageBarrier(const ImageBarrierInfo &info)
+        {
+            PE_ERROR_IF(!info.image, "Image::Barrier: no image specified.");
+            Image &image = *info.image;
+
+            const uint32_t mipLevels = info.mipLevels ? info.mipLevels : image.GetMipLevels();
+            const uint32_t arrayLayers = info.arrayLayers ? info.arrayLayers : image.GetArrayLayers();
+            const ImageTrackInfo &oldInfo = image.GetCurrentInfo(info.baseArrayLayer, info.baseMipLevel);
+
+            const bool requestRead = IsReadOnlyAccess(info.accessMask);
+            const bool previousRead = IsReadOnlyAccess(oldInfo.accessMask);
+            const bool sameState = oldInfo.layout == info.layout &&
+                                   oldInfo.stageFlags == info.stageFlags &&
+                                   oldInfo.accessMask == info.accessMask &&
+                                   oldInfo.queueFamilyId == info.queueFamilyId;
+            if (requestRead && previousRead && sameState)
+                return;
+
+            for (uint32_t i = 0; i < arrayLayers; i++)
+                for (uint32_t j = 0; j < mipLevels; j++)
+                    image.SetCurrentInfo(info, info.baseArrayLayer + i, info.baseMipLevel + j);
+        }
+
+        bool TrackBufferBarrier(const BufferBarrierInfo &info)
+        {
+            PE_ERROR_IF(!info.buffer, "Buffer::Barrier: no buffer specified");
+
+            BufferTrackInfo &trackInfo = info.buffer->GetTrackInfo();
+            const bool requestRead = IsReadOnlyAccess(info.accessMask);
+            const bool previousRead = IsReadOnlyAccess(trackInfo.accessMask);
+            const bool sameState = trackInfo.stageMask == info.stageMask &&
+                                   trackInfo.accessMask == info.accessMask &&
+                                   trackInfo.queueFamilyIndex == info.queueFamilyIndex;
+            if (requestRead && previousRead && sameState)
+                return false;
+
+            trackInfo.stageMask = info.stageMask;
+            trackInfo.accessMask = info.accessMask;
+            trackInfo.queueFamilyIndex = info.queueFamilyIndex;
+            return true;
+        }
+    } // namespace
+
+    const char *NullCommandTypeName(NullCommandType type)
+    {
+        const size_t index = static_cast<size_t>(type);
+        return index < std::size(kCommandTypeNames) ? kCommandTypeNames[index] : "Invalid";
+    }
+
+    NullCommandBufferImpl::NullCommandBufferImpl(CommandBuffer *owner, CommandPool *, const std::string &)
+        : m_owner{owner}
+    {
+    }
+
+    NullCommand &NullCommandBufferImpl::Record(NullCommandType type, void *target, void *source)
+    {
+        NullCommand &command = m_commands.emplace_back();
+        command.type = type;
+        command.target = target;
+        command.source = source;
+        return command;
+    }
+
+    void NullCommandBufferImpl::Begin()
+    {
+        PE_ERROR_IF(m_owner->m_recording, "CommandBuffer::Begin: CommandBuffer is already recording!");
+        PE_ERROR_IF(m_owner->m_threadId != std::this_thread::get_id(), "CommandBuffer::Begin: CommandBuffer is used in a different thread!");
+
+        Reset();
+        m_commands.clear();
+        m_owner->m_recording = true;
+    }
+
+    void NullCommandBufferImpl::End()
+    {
+        PE_ERROR_IF(!m_owner->m_recording, "CommandBuffer::End: CommandBuffer is not in recording state!");
+        PE_ERROR_IF(m_owner->m_threadId != std::this_thread::get_id(), "CommandBuffer::End: CommandBuffer is used in a different thread!");
+
+        m_owner->m_recording = false;
+    }
+
+    void NullCommandBufferImpl::Reset()
+    {
+        m_owner->m_attachmentCount = 0;
+        m_owner->m_attachments = nullptr;
+        m_owner->m_renderPass = nullptr;
+        m_owner->m_framebuffer = nullptr;
+        m_owner->m_dynamicPass = false;
+        m_owner->m_boundPipeline = nullptr;
+        m_owner->m_boundVertexBuffer = nullptr;
+        m_owner->m_boundVertexBufferOffset = -1;
+        m_owner->m_boundVertexBufferFirstBinding = UINT32_MAX;
+        m_owner->m_boundVertexBufferBindingCount = UINT32_MAX;
+        m_owner->m_boundIndexBuffer = nullptr;
+        m_owner->m_boundIndexBufferOffset = -1;
+        m_owner->m_boundIndexBufferType = PE_INDEX_TYPE_UINT32;
+
+        if (!m_owner->m_afterWaitCallbacks.IsEmpty())
+        {
+            m_owner->m_afterWaitCallbacks.ReverseInvoke();
+            m_owner->m_afterWaitCallbacks.Clear();
+        }
+
+#if PE_DEBUG_MODE
+        m_owner->m_gpuTimerInfosCount = 0;
+        while (!m_owner->m_gpuTimerIdsStack.empty())
+            m_owner->m_gpuTimerIdsStack.pop();
+        for (auto &info : m_owner->m_gpuTimerInfos)
+            if (info.timer)
+                info.timer->ResetState();
+#endif
+    }
+
+    void NullCommandBufferImpl::BlitImage(Image *src, Image *dst, const ImageBlit &region, PeFilter filter)
+    {
+        PE_ERROR_IF(!dst, "NullCommandBufferImpl::BlitImage: null destination image");
+        dst->Blit(m_owner, src, region, filter);
+    }
+
+    void NullCommandBufferImpl::ClearColors(std::vector<Image *> images)
+    {
+        std::vector<ImageBarrierInfo> barriers(images.size());
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            PE_ERROR_IF(!images[i], "NullCommandBufferImpl::ClearColors: image %zu is null", i);
+            barriers[i].image = images[i];
+            barriers[i].layout = PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barriers[i].stageFlags = PE_STAGE_CLEAR;
+            barriers[i].accessMask = PE_ACCESS_TRANSFER_WRITE;
+        }
+        ImageBarriers(barriers);
+
+        for (Image *image : images)
+            Record(NullCommandType::ClearColor, image);
+    }
+
+    void NullCommandBufferImpl::ClearDepthStencils(std::vector<Image *> images)
+    {
+        std::vector<ImageBarrierInfo> barriers(images.size());
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            PE_ERROR_IF(!images[i], "NullCommandBufferImpl::ClearDepthStencils: image %zu is null", i);
+            barriers[i].image = images[i];
+            barriers[i].layout = PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barriers[i].stageFlags = PE_STAGE_CLEAR;
+            barriers[i].accessMask = PE_ACCESS_TRANSFER_WRITE;
+        }
+        ImageBarriers(barriers);
+
+        for (Image *image : images)
+            Record(NullCommandType::ClearDepthStencil, image);
+    }
+
+    void NullCommandBufferImpl::BeginPass(uint32_t count, Attachment *attachments, const std::string &name, bool)
+    {
+        PE_ERROR_IF(count > 0 && !attachments, "NullCommandBufferImpl::BeginPass: null attachments");
+
+        BeginDebugRegion(name + "_pass");
+
+        std::vector<ImageBarrierInfo> attachmentBarriers(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Attachment &att = attachments[i];
+            PE_ERROR_IF(!att.image, "NullCommandBufferImpl::BeginPass: attachment %u has null image", i);
+
+            ImageBarrierInfo &barrier = attachmentBarriers[i];
+            barrier.image = att.image;
+            if (PeFormatHasDepthOrStencil(att.image->GetFormat()))
+            {
+                barrier.layout = PE_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+                barrier.stageFlags = PE_STAGE_EARLY_FRAGMENT_TESTS | PE_STAGE_LATE_FRAGMENT_TESTS;
+                barrier.accessMask = att.loadOp == PE_LOAD_OP_LOAD
+                                         ? PE_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ
+                                         : PE_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE;
+            }
+            else
+            {
+                barrier.layout = PE_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL;
+                barrier.stageFlags = PE_STAGE_COLOR_ATTACHMENT_OUTPUT;
+                barrier.accessMask = att.loadOp == PE_LOAD_OP_LOAD
+                                         ? PE_ACCESS_COLOR_ATTACHMENT_READ
+                                         : PE_ACCESS_COLOR_ATTACHMENT_WRITE;
+            }
+        }
+        ImageBarriers(attachmentBarriers);
+
+        m_owner->m_dynamicPass = true;
+        m_owner->m_attachmentCount = count;
+        m_owner->m_attachments = attachments;
+
+        NullCommand &command = Record(NullCommandType::BeginPass);
+        command.args[0] = count;
+        command.label = name;
+    }
+
+    void NullCommandBufferImpl::EndPass()
+    {
+        // Same tracker fix-up as the other backends: LOAD attachments entered with a read mask but
+        // the pass wrote them
+        for (uint32_t i = 0; i < m_owner->m_attachmentCount; ++i)
+        {
+            const Attachment &att = m_owner->m_attachments[i];
+            if (att.loadOp == PE_LOAD_OP_LOAD && att.image)
+            {
+                att.image->m_trackInfos[0][0].accessMask = PeFormatHasDepthOrStencil(att.image->GetFormat())
+                                                               ? PE_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE
+                                                               : PE_ACCESS_COLOR_ATTACHMENT_WRITE;
+            }
+        }
+
+        Record(NullCommandType::EndPass);
+        EndDebugRegion();
+
+        m_owner->m_attachmentCount = 0;
+        m_owner->m_attachments = nullptr;
+        m_owner->m_renderPass = nullptr;
+        m_owner->m_framebuffer = nullptr;
+        m_owner->m_dynamicPass = false;
+        m_owner->m_boundPipeline = nullptr;
+        m_owner->m_boundVertexBuffer = nullptr;
+        m_owner->m_boundVertexBufferOffset = -1;
+        m_owner->m_boundVertexBufferFirstBinding = UINT32_MAX;
+        m_owner->m_boundVertexBufferBindingCount = UINT32_MAX;
+        m_owner->m_boundIndexBuffer = nullptr;
+        m_owner->m_boundIndexBufferOffset = -1;
+        m_owner->m_boundIndexBufferType = PE_INDEX_TYPE_UINT32;
+    }
+
+    void NullCommandBufferImpl::BindPipeline(PassInfo &passInfo, bool bindDescriptors)
+    {
+        Pipeline *pipeline = CommandBuffer::GetPipeline(m_owner->m_renderPass, passInfo);
+        PE_ERROR_IF(!pipeline, "NullCommandBufferImpl::BindPipeline: pipeline creation failed");
+
+        if (pipeline != m_owner->m_boundPipeline)
+        {
+            m_owner->m_boundPipeline = pipeline;
+            Record(NullCommandType::BindPipeline, pipeline);
+        }
+
+        if (bindDescriptors)
+        {
+            const auto &descriptors = passInfo.GetDescriptors(RHII.GetFrameIndex());
+            BindDescriptors(static_cast<uint32_t>(descriptors.size()), descriptors.data());
+        }
+    }
+
+    void NullCommandBufferImpl::BindVertexBuffer(Buffer *buffer, size_t offset, uint32_t firstBinding, uint32_t bindingCount)
+    {
+        if (m_owner->m_boundVertexBuffer == buffer &&
+            m_owner->m_boundVertexBufferOffset == offset &&
+            m_owner->m_boundVertexBufferFirstBinding == firstBinding &&
+            m_owner->m_boundVertexBufferBindingCount == bindingCount)
+            return;
+
+        PE_ERROR_IF(!buffer, "NullCommandBufferImpl::BindVertexBuffer: null buffer");
+        PE_ERROR_IF(offset > buffer->Size(), "NullCommandBufferImpl::BindVertexBuffer: offset exceeds buffer size");
+
+        m_owner->m_boundVertexBuffer = buffer;
+        m_owner->m_boundVertexBufferOffset = offset;
+        m_owner->m_boundVertexBufferFirstBinding = firstBinding;
+        m_owner->m_boundVertexBufferBindingCount = bindingCount;
+
+        NullCommand &command = Record(NullCommandType::BindVertexBuffer, buffer);
+        command.args[0] = offset;
+        command.args[1] = firstBinding;
+        command.args[2] = bindingCount;
+    }
+
+    void NullCommandBufferImpl::BindIndexBuffer(Buffer *buffer, size_t offset, PeIndexType indexType)
+    {
+        if (m_owner->m_boundIndexBuffer == buffer && m_owner->m_boundIndexBufferOffset == offset &&
+            m_owner->m_boundIndexBufferType == indexType)
+            return;
+
+        PE_ERROR_IF(!buffer, "NullCommandBufferImpl::BindIndexBuffer: null buffer");
+        PE_ERROR_IF(offset > buffer->Size(), "NullCommandBufferImpl::BindIndexBuffer: offset exceeds buffer size");
+
+        m_owner->m_boundIndexBuffer = buffer;
+        m_owner->m_boundIndexBufferOffset = offset;
+        m_owner->m_boundIndexBufferType = indexType;
+
+        NullCommand &command = Record(NullCommandType::BindIndexBuffer, buffer);
+        command.args[0] = offset;
+        command.args[1] = static_cast<uint64_t>(indexType);
+    }
+
+    void NullCommandBufferImpl::BindDescriptors(uint32_t count, Descriptor *const *descriptors)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::BindDescriptors: No bound pipeline found!");
+        PE_ERROR_IF(count > 0 && !descriptors, "NullCommandBufferImpl::BindDescriptors: null descriptor array");
+
+        NullCommand &command = Record(NullCommandType::BindDescriptors, m_owner->m_boundPipeline);
+        command.args[0] = count;
+    }
+
+    void NullCommandBufferImpl::PushDescriptor(uint32_t set, const std::vector<PushDescriptorInfo> &info)
+    {
+        NullCommand &command = Record(NullCommandType::PushDescriptor, m_owner->m_boundPipeline);
+        command.args[0] = set;
+        command.args[1] = info.size();
+    }
+
+    void NullCommandBufferImpl::SetViewport(float, float, float, float, float, float)
+    {
+        Record(NullCommandType::SetState).label = "Viewport";
+    }
+
+    void NullCommandBufferImpl::SetScissor(int, int, uint32_t, uint32_t)
+    {
+        Record(NullCommandType::SetState).label = "Scissor";
+    }
+
+    void NullCommandBufferImpl::SetBlendConstants(const float *)
+    {
+        Record(NullCommandType::SetState).label = "BlendConstants";
+    }
+
+    void NullCommandBufferImpl::SetStencilReference(uint32_t)
+    {
+        Record(NullCommandType::SetState).label = "StencilReference";
+    }
+
+    void NullCommandBufferImpl::SetLineWidth(float)
+    {
+        Record(NullCommandType::SetState).label = "LineWidth";
+    }
+
+    void NullCommandBufferImpl::SetDepthBias(float, float, float)
+    {
+        Record(NullCommandType::SetState).label = "DepthBias";
+    }
+
+    void NullCommandBufferImpl::SetDepthTestEnable(uint32_t)
+    {
+        Record(NullCommandType::SetState).label = "DepthTestEnable";
+    }
+
+    void NullCommandBufferImpl::SetDepthWriteEnable(uint32_t)
+    {
+        Record(NullCommandType::SetState).label = "DepthWriteEnable";
+    }
+
+    void NullCommandBufferImpl::Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::Dispatch: No bound pipeline found!");
+        NullCommand &command = Record(NullCommandType::Dispatch, m_owner->m_boundPipeline);
+        command.args[0] = groupCountX;
+        command.args[1] = groupCountY;
+        command.args[2] = groupCountZ;
+    }
+
+    void NullCommandBufferImpl::PushConstants(const PushConstantsBlock<128> &constants)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::PushConstants: No bound pipeline found!");
+        Record(NullCommandType::PushConstants, m_owner->m_boundPipeline);
+    }
+
+    void NullCommandBufferImpl::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::Draw: No bound pipeline found!");
+        NullCommand &command = Record(NullCommandType::Draw, m_owner->m_boundPipeline);
+        command.args[0] = vertexCount;
+        command.args[1] = instanceCount;
+        command.args[2] = firstVertex;
+        command.args[3] = firstInstance;
+    }
+
+    void NullCommandBufferImpl::DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::DrawIndexed: No bound pipeline found!");
+        PE_ERROR_IF(!m_owner->m_boundIndexBuffer, "NullCommandBufferImpl::DrawIndexed: No bound index buffer found!");
+        NullCommand &command = Record(NullCommandType::DrawIndexed, m_owner->m_boundPipeline);
+        command.args[0] = indexCount;
+        command.args[1] = instanceCount;
+        command.args[2] = firstIndex;
+        command.args[3] = static_cast<uint64_t>(static_cast<int64_t>(vertexOffset));
+        command.args[4] = firstInstance;
+    }
+
+    void NullCommandBufferImpl::DrawIndirect(Buffer *indirectBuffer, size_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::DrawIndirect: No bound pipeline found!");
+        PE_ERROR_IF(!indirectBuffer, "NullCommandBufferImpl::DrawIndirect: null indirect buffer");
+        NullCommand &command = Record(NullCommandType::DrawIndirect, indirectBuffer, m_owner->m_boundPipeline);
+        command.args[0] = offset;
+        command.args[1] = drawCount;
+        command.args[2] = stride;
+    }
+
+    void NullCommandBufferImpl::DrawIndexedIndirect(Buffer *indirectBuffer, size_t offset, uint32_t drawCount, uint32_t stride)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::DrawIndexedIndirect: No bound pipeline found!");
+        PE_ERROR_IF(!indirectBuffer, "NullCommandBufferImpl::DrawIndexedIndirect: null indirect buffer");
+        NullCommand &command = Record(NullCommandType::DrawIndexedIndirect, indirectBuffer, m_owner->m_boundPipeline);
+        command.args[0] = offset;
+        command.args[1] = drawCount;
+        command.args[2] = stride;
+    }
+
+    void NullCommandBufferImpl::DrawIndexedIndirectCount(Buffer *indirectBuffer, size_t offset, Buffer *countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride)
+    {
+        PE_ERROR_IF(!m_owner->m_boundPipeline, "NullCommandBufferImpl::DrawIndexedIndirectCount: No bound pipeline found!");
+        PE_ERROR_IF(!indirectBuffer || !countBuffer, "NullCommandBufferImpl::DrawIndexedIndirectCount: null buffer");
+        NullCommand &command = Record(NullCommandType::DrawIndexedIndirectCount, indirectBuffer, countBuffer);
+        command.args[0] = offset;
+        command.args[1] = countBufferOffset;
+        command.args[2] = maxDrawCount;
+        command.args[3] = stride;
+    }
+
+    void NullCommandBufferImpl::FillBuffer(Buffer *buffer, size_t offset, size_t size, uint32_t data)
+    {
+        PE_ERROR_IF(!buffer, "NullCommandBufferImpl::FillBuffer: null buffer");
+        PE_ERROR_IF(offset + size > buffer->Size(), "NullCommandBufferImpl::FillBuffer: range overflow");
+        if (!size)
+            return;
+
+        NullCommand &command = Record(NullCommandType::FillBuffer, buffer);
+        command.args[0] = size;
+        command.args[1] = offset;
+        command.args[2] = data;
+
+        BufferTrackInfo &trackInfo = buffer->GetTrackInfo();
+        trackInfo.stageMask = PE_STAGE_CLEAR;
+        trackInfo.accessMask = PE_ACCESS_TRANSFER_WRITE;
+    }
+
+    void NullCommandBufferImpl::CopyBuffer(Buffer *src, Buffer *dst, size_t size, size_t srcOffset, size_t dstOffset)
+    {
+        PE_ERROR_IF(!src || !dst, "NullCommandBufferImpl::CopyBuffer: null buffer");
+        PE_ERROR_IF(srcOffset + size > src->Size(), "NullCommandBufferImpl::CopyBuffer: source range overflow");
+        PE_ERROR_IF(dstOffset + size > dst->Size(), "NullCommandBufferImpl::CopyBuffer: destination range overflow");
+        if (!size)
+            return;
+
+        NullCommand &command = Record(NullCommandType::CopyBuffer, dst, src);
+        command.args[0] = size;
+        command.args[1] = srcOffset;
+        command.args[2] = dstOffset;
+
+        BufferTrackInfo &trackInfo = dst->GetTrackInfo();
+        trackInfo.stageMask = PE_STAGE_TRANSFER;
+        trackInfo.accessMask = PE_ACCESS_TRANSFER_WRITE;
+    }
+
+    void NullCommandBufferImpl::CopyBufferStaged(Buffer *buffer, void *data, size_t size, size_t dstOffset)
+    {
+        PE_ERROR_IF(!buffer, "NullCommandBufferImpl::CopyBufferStaged: null buffer");
+        buffer->CopyBufferStaged(m_owner, data, size, dstOffset);
+    }
+
+    void NullCommandBufferImpl::CopyDataToImageStaged(Image *image, void *data, size_t size, uint32_t baseArrayLayer, uint32_t layerCount, uint32_t mipLevel)
+    {
+        PE_ERROR_IF(!image, "NullCommandBufferImpl::CopyDataToImageStaged: null image");
+        image->CopyDataToImageStaged(m_owner, data, size, baseArrayLayer, layerCount, mipLevel);
+    }
+
+    void NullCommandBufferImpl::CopyImage(Image *src, Image *dst)
+    {
+        PE_ERROR_IF(!src || !dst, "NullCommandBufferImpl::CopyImage: null image");
+        dst->CopyImage(m_owner, src);
+    }
+
+    void NullCommandBufferImpl::CopyImageToBuffer(Image *src, Buffer *dst, uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount)
+    {
+        PE_ERROR_IF(!src || !dst, "NullCommandBufferImpl::CopyImageToBuffer: null resource");
+        src->CopyToBuffer(m_owner, dst, mipLevel, baseArrayLayer, layerCount);
+    }
+
+    void NullCommandBufferImpl::GenerateMipMaps(Image *image)
+    {
+        PE_ERROR_IF(!image, "NullCommandBufferImpl::GenerateMipMaps: null image");
+        Record(NullCommandType::GenerateMipMaps, image);
+        image->GenerateMipMaps(m_owner);
+    }
+
+    void NullCommandBufferImpl::ResetQueryPool(QueryPool *pool, uint32_t firstQuery, uint32_t queryCount)
+    {
+        NullCommand &command = Record(NullCommandType::Query, pool);
+        command.args[0] = firstQuery;
+        command.args[1] = queryCount;
+        command.label = "Reset";
+    }
+
+    void NullCommandBufferImpl::BeginQuery(QueryPool *pool, uint32_t queryIndex, PeQueryControlFlags)
+    {
+        PE_ERROR_IF(pool->GetType() != PE_QUERY_TYPE_OCCLUSION, "BeginQuery: pool is not an occlusion query pool");
+        NullCommand &command = Record(NullCommandType::Query, pool);
+        command.args[0] = queryIndex;
+        command.label = "Begin";
+    }
+
+    void NullCommandBufferImpl::EndQuery(QueryPool *pool, uint32_t queryIndex)
+    {
+        PE_ERROR_IF(pool->GetType() != PE_QUERY_TYPE_OCCLUSION, "EndQuery: pool is not an occlusion query pool");
+        NullCommand &command = Record(NullCommandType::Query, pool);
+        command.args[0] = queryIndex;
+        command.label = "End";
+    }
+
+    void NullCommandBufferImpl::WriteTimestamp(QueryPool *pool, uint32_t queryIndex)
+    {
+        PE_ERROR_IF(pool->GetType() != PE_QUERY_TYPE_TIMESTAMP, "WriteTimestamp: pool is not a timestamp query pool");
+        NullCommand &command = Record(NullCommandType::Query, pool);
+        command.args[0] = queryIndex;
+        command.label = "Timestamp";
+    }
+
+    void NullCommandBufferImpl::ResolveQueryPool(QueryPool *pool, uint32_t firstQuery, uint32_t queryCount,
+                                                 Buffer *dst, uint64_t dstOffset, uint64_t stride, PeQueryResultFlags flags)
+    {
+        PE_ERROR_IF(!pool || !dst, "NullCommandBufferImpl::ResolveQueryPool: null pool or buffer");
+        PE_ERROR_IF(firstQuery + queryCount > pool->GetCount(), "NullCommandBufferImpl::ResolveQueryPool: query range out of bounds");
+
+        const uint64_t word = (flags & PE_QUERY_RESULT_64_BIT) ? sizeof(uint64_t) : sizeof(uint32_t);
+        const uint64_t record = (flags & PE_QUERY_RESULT_WITH_AVAILABILITY) ? word * 2 : word;
+        PE_ERROR_IF(queryCount && dstOffset + (queryCount - 1) * stride + record > dst->Size(),
+                    "NullCommandBufferImpl::ResolveQueryPool: destination range overflow");
+
+        NullCommand &command = Record(NullCommandType::ResolveQueryPool, dst, pool);
+        command.args[0] = firstQuery;
+        command.args[1] = queryCount;
+        command.args[2] = dstOffset;
+        command.args[3] = stride;
+        command.args[4] = flags;
+    }
+
+    void NullCommandBufferImpl::TraceRays(uint32_t width, uint32_t height, uint32_t depth)
+    {
+        PE_ERROR("NullCommandBufferImpl::TraceRays: ray tracing is not supported by the null backend");
+    }
+
+    void NullCommandBufferImpl::BufferBarrier(const BufferBarrierInfo &info)
+    {
+        if (TrackBufferBarrier(info))
+            Record(NullCommandType::Barrier, info.buffer);
+    }
+
+    void NullCommandBufferImpl::BufferBarriers(const std::vector<BufferBarrierInfo> &infos)
+    {
+        for (const auto &info : infos)
+            BufferBarrier(info);
+    }
+
+    void NullCommandBufferImpl::ImageBarrier(const ImageBarrierInfo &info)
+    {
+        if (!info.image)
+            return;
+        TrackImageBarrier(info);
+        Record(NullCommandType::Barrier, info.image).args[0] = static_cast<uint64_t>(info.layout);
+    }
+
+    void NullCommandBufferImpl::ImageBarriers(const std::vector<ImageBarrierInfo> &infos)
+    {
+        for (const auto &info : infos)
+            ImageBarrier(info);
+    }
+
+    void NullCommandBufferImpl::MemoryBarrier(const MemoryBarrierInfo &)
+    {
+        Record(NullCommandType::Barrier);
+    }
+
+    void NullCommandBufferImpl::MemoryBarriers(const std::vector<MemoryBarrierInfo> &infos)
+    {
+        if (!infos.empty())
+            Record(NullCommandType::Barrier);
+    }
+
+    void NullCommandBufferImpl::SetEvent(Event *event, Image *image,
+                                         PeImageLayout, PeImageLayout dstLayout,
+                                         PeBarrierSync, PeBarrierSync dstStage,
+                                         PeBarrierAccess, PeBarrierAccess dstAccess)
+    {
+        // Nothing runs out of order here, so the event collapses into the barrier it guards
+        if (image)
+        {
+            ImageBarrierInfo info{};
+            info.image = image;
+            info.layout = dstLayout;
+            info.stageFlags = dstStage;
+            info.accessMask = dstAccess;
+            TrackImageBarrier(info);
+        }
+        Record(NullCommandType::SetEvent, image, event);
+    }
+
+    void NullCommandBufferImpl::BeginDebugRegion(const std::string &name)
+    {
+        Debug::BeginCmdRegion(m_owner, name);
+        Record(NullCommandType::BeginDebugRegion).label = name;
+    }
+
+    void NullCommandBufferImpl::InsertDebugLabel(const std::string &name)
+    {
+        Debug::InsertCmdLabel(m_owner, name);
+        Record(NullCommandType::InsertDebugLabel).label = name;
+    }
+
+    void NullCommandBufferImpl::EndDebugRegion()
+    {
+        Record(NullCommandType::EndDebugRegion);
+        Debug::EndCmdRegion(m_owner);
+    }
+
+    void NullCommandBufferImpl::Execute() const
+    {
+        for (const NullCommand &command : m_commands)
+        {
+            switch (command.type)
+            {
+            case NullCommandType::FillBuffer:
+            {
+                uint8_t *dst = BufferMemory(command.target) + command.args[1];
+                const uint32_t data = static_cast<uint32_t>(command.args[2]);
+                const size_t size = static_cast<size_t>(command.args[0]);
+                for (size_t i = 0; i < size; i += sizeof(uint32_t))
+                    std::memcpy(dst + i, &data, std::min(sizeof(uint32_t), size - i));
+                break;
+            }
+            case NullCommandType::CopyBuffer:
+                std::memmove(BufferMemory(command.target) + command.args[2],
+                             BufferMemory(command.source) + command.args[1],
+                             static_cast<size_t>(command.args[0]));
+                break;
+            case NullCommandType::ResolveQueryPool:
+            {
+                // Every sample passes and every timestamp reads zero; results are always available
+                const QueryPool *pool = static_cast<const QueryPool *>(command.source);
+                const uint64_t value = pool->GetType() == PE_QUERY_TYPE_OCCLUSION ? 1 : 0;
+                const PeQueryResultFlags flags = static_cast<PeQueryResultFlags>(command.args[4]);
+                const bool is64 = flags & PE_QUERY_RESULT_64_BIT;
+                const size_t word = is64 ? sizeof(uint64_t) : sizeof(uint32_t);
+
+                uint8_t *dst = BufferMemory(command.target) + command.args[2];
+                for (uint64_t i = 0; i < command.args[1]; ++i, dst += command.args[3])
+                {
+                    const uint64_t value64 = value;
+                    const uint32_t value32 = static_cast<uint32_t>(value);
+                    std::memcpy(dst, is64 ? static_cast<const void *>(&value64) : &value32, word);
+                    if (flags & PE_QUERY_RESULT_WITH_AVAILABILITY)
+                    {
+                        const uint64_t one64 = 1;
+                        const uint32_t one32 = 1;
+                        std::memcpy(dst + word, is64 ? static_cast<const void *>(&one64) : &one32, word);
+                    }
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    void NullQueueImpl::Submit(uint32_t commandBuffersCount,
+                               CommandBuffer *const *commandBuffers,
+                               Semaphore *wait,
+                               Semaphore *signal,
+                               Semaphore *submissionsSemaphore,
+                               uint64_t submissionValue,
+                               const std::vector<QueueWait> &queueWaits)
+    {
+        // Submission is execution: `wait` was signalled by an earlier submit or acquire, so it is
+        // already satisfied, and everything below completes before this call returns. The same holds
+        // for waits on other queues' timelines.
+        (void)wait;
+        (void)queueWaits;
+
+        NullRhiImpl *rhi = NullRhiImpl::Get();
+        if (rhi)
+            rhi->CountSubmit();
+
+        for (uint32_t i = 0; i < commandBuffersCount; ++i)
+        {
+            CommandBuffer *cmd = commandBuffers[i];
+            if (!cmd)
+                continue;
+
+            NullCommandBufferImpl *impl = NullCommandBufferImpl::From(cmd);
+            impl->Execute();
+            if (rhi)
+                rhi->OnSubmit(cmd, impl->GetCommands());
+            cmd->SetSubmission(submissionValue);
+        }
+
+        if (signal)
+            NullSemaphoreImpl::From(signal)->Bump();
+        if (submissionsSemaphore)
+            submissionsSemaphore->Signal(submissionValue);
+    }
+
+    void NullQueueImpl::Present(Swapchain *swapchain, uint32_t, Semaphore *)
+    {
+        PE_ERROR_IF(!swapchain, "NullQueueImpl::Present: null swapchain");
+        swapchain->Present();
+    }
+} // namespace pe
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "API/Command.h"
+#include "API/CommandBuffer_Internal.h"
+#include "API/CommandPool_Internal.h"
+#include "API/Queue.h"
+#include "API/Queue_Internal.h"
+
+namespace pe
+{
+    enum class NullCommandType : uint8_t
+    {
+        BeginPass,
+        EndPass,
+        BindPipeline,
+        BindVertexBuffer,
+        BindIndexBuffer,
+        BindDescriptors,
+        PushDescriptor,
+        PushConstants,
+        SetState, // viewport, scissor and the other dynamic state
+        Draw,
+        DrawIndexed,
+        DrawIndirect,
+        DrawIndexedIndirect,
+        DrawIndexedIndirectCount,
+        Dispatch,
+        TraceRays,
+        FillBuffer,
+        CopyBuffer,
+        CopyBufferToImage,
+        CopyImage,
+        CopyImageToBuffer,
+        BlitImage,
+        ClearColor,
+        ClearDepthStencil,
+        GenerateMipMaps,
+        Barrier,
+        Query,
+        ResolveQueryPool,
+        SetEvent,
+        BeginDebugRegion,
+        InsertDebugLabel,
+        EndDebugRegion,
+    };
+
+    // One recorded command. `target`/`source` point at the engine objects involved (Buffer, Image,
+    // Pipeline, QueryPool...), `args` hold counts/offsets/sizes in the order of the CommandBuffer
+    // call, and `label` carries pass and debug-region names.
+    struct NullCommand
+    {
+        NullCommandType type = NullCommandType::SetState;
+        void *target = nullptr;
+        void *source = nullptr;
+        uint64_t args[6]{};
+        std::string label;
+    };
+
+    const char *NullCommandTypeName(NullCommandType type);
+
+    struct NullCommandBufferImpl final : public CommandBuffer::Impl
+    {
+        NullCommandBufferImpl(CommandBuffer *owner, CommandPool *commandPool, const std::string &name);
+
+        static NullCommandBufferImpl *From(CommandBuffer *cmd) { return static_cast<NullCommandBufferImpl *>(cmd->m_impl); }
+
+        void Begin() override;
+        void End() override;
+        void Reset() override;
+
+        void BlitImage(Image *src, Image *dst, const ImageBlit &region, PeFilter filter) override;
+        void ClearColors(std::vector<Image *> images) override;
+        void ClearDepthStencils(std::vector<Image *> images) override;
+
+        void BeginPass(uint32_t count, Attachment *attachments, const std::string &name, bool skipDynamicPass) override;
+        void EndPass() override;
+
+        void BindPipeline(PassInfo &passInfo, bool bindDescriptors) override;
+        void BindVertexBuffer(Buffer *buffer, size_t offset, uint32_t firstBinding, uint32_t bindingCount) override;
+        void BindIndexBuffer(Buffer *buffer, size_t offset, PeIndexType indexType) override;
+        void BindDescriptors(uint32_t count, Descriptor *const *descriptors) override;
+        void PushDescriptor(uint32_t set, const std::vector<PushDescriptorInfo> &info) override;
+
+        void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) override;
+        void SetScissor(int x, int y, uint32_t width, uint32_t height) override;
+        void SetBlendConstants(const float constants[4]) override;
+        void SetStencilReference(uint32_t reference) override;
+        void SetLineWidth(float width) override;
+        void SetDepthBias(float constantFactor, float clamp, float slopeFactor) override;
+        void SetDepthTestEnable(uint32_t enable) override;
+        void SetDepthWriteEnable(uint32_t enable) override;
+
+        void Dispatch(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) override;
+        void PushConstants(const PushConstantsBlock<128> &constants) override;
+
+        void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) override;
+        void DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) override;
+        void DrawIndirect(Buffer *indirectBuffer, size_t offset, uint32_t drawCount, uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer *indirectBuffer, size_t offset, uint32_t drawCount, uint32_t stride) override;
+        void DrawIndexedIndirectCount(Buffer *indirectBuffer, size_t offset, Buffer *countBuffer, size_t countBufferOffset, uint32_t maxDrawCount, uint32_t stride) override;
+
+        void FillBuffer(Buffer *buffer, size_t offset, size_t size, uint32_t data) override;
+        void CopyBuffer(Buffer *src, Buffer *dst, size_t size, size_t srcOffset, size_t dstOffset) override;
+        void CopyBufferStaged(Buffer *buffer, void *data, size_t size, size_t dstOffset) override;
+        void CopyDataToImageStaged(Image *image, void *data, size_t size, uint32_t baseArrayLayer, uint32_t layerCount, uint32_t mipLevel) override;
+        void CopyImage(Image *src, Image *dst) override;
+        void CopyImageToBuffer(Image *src, Buffer *dst, uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount) override;
+        void GenerateMipMaps(Image *image) override;
+
+        void ResetQueryPool(QueryPool *pool, uint32_t firstQuery, uint32_t queryCount) override;
+        void BeginQuery(QueryPool *pool, uint32_t queryIndex, PeQueryControlFlags flags) override;
+        void EndQuery(QueryPool *pool, uint32_t queryIndex) override;
+        void WriteTimestamp(QueryPool *pool, uint32_t queryIndex) override;
+        void ResolveQueryPool(QueryPool *pool, uint32_t firstQuery, uint32_t queryCount,
+                              Buffer *dst, uint64_t dstOffset, uint64_t stride, PeQueryResultFlags flags) override;
+
+        void TraceRays(uint32_t width, uint32_t height, uint32_t depth) override;
+
+        void BufferBarrier(const BufferBarrierInfo &info) override;
+        void BufferBarriers(const std::vector<BufferBarrierInfo> &infos) override;
+        void ImageBarrier(const ImageBarrierInfo &info) override;
+        void ImageBarriers(const std::vector<ImageBarrierInfo> &infos) override;
+        void MemoryBarrier(const MemoryBarrierInfo &info) override;
+        void MemoryBarriers(const std::vector<MemoryBarrierInfo> &infos) override;
+
+        void SetEvent(Event *event, Image *image,
+                      PeImageLayout srcLayout, PeImageLayout dstLayout,
+                      PeBarrierSync srcStage, PeBarrierSync dstStage,
+                      PeBarrierAccess srcAccess, PeBarrierAccess dstAccess) override;
+
+        void BeginDebugRegion(const std::string &name) override;
+        void InsertDebugLabel(const std::string &name) override;
+        void EndDebugRegion() override;
+
+        // Runs the recorded transfers against buffer memory; called by the queue at submit
+        void Execute() const;
+        const std::vector<NullCommand> &GetCommands() const { return m_commands; }
+
+        NullCommand &Record(NullCommandType type, void *target = nullptr, void *source = nullptr);
+
+        CommandBuffer *m_owner{};
+        std::vector<NullCommand> m_commands;
+    };
+
+    struct NullCommandPoolImpl final : public CommandPool::Impl
+    {
+        void Reset() override {}
+    };
+
+    struct NullQueueImpl final : public Queue::Impl
+    {
+        void Submit(uint32_t commandBuffersCount,
+                    CommandBuffer *const *commandBuffers,
+                    Semaphore *wait,
+                    Semaphore *signal,
+                    Semaphore *submissionsSemaphore,
+                    uint64_t submissionValue,
+                    const std::vector<QueueWait> &queueWaits) override;
+        void Present(Swapchain *swapchain, uint32_t imageIndex, Semaphore *wait) override;
+        void WaitIdle() override {}
+    };
+} // namespace pe
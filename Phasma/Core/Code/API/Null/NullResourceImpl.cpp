@@ -0,0 +1,205 @@
+#include "API/Null/NullResourceImpl.h"
+#include "API/Command.h"
+#include "API/ImageView.h"
+#include "API/Null/NullCommandBufferImpl.h"
+#include "API/Null/NullRhiImpl.h"
+#include "API/RHI.h"
+#include "API/StagingManager.h"
+
+namespace pe
+{
+    NullBufferImpl::NullBufferImpl(Buffer *owner, const BufferDesc &desc)
+        : m_owner{owner}, m_size{owner->Size()}
+    {
+        // Zeroed like freshly allocated device memory usually is, so readbacks of never-written
+        // ranges are deterministic
+        m_memory = static_cast<uint8_t *>(std::calloc(m_size ? m_size : 1, 1));
+        PE_ERROR_IF(!m_memory, "NullBufferImpl: failed to allocate %zu bytes for '%s'", m_size, desc.name.c_str());
+
+        if (NullRhiImpl *rhi = NullRhiImpl::Get())
+            rhi->AddAllocatedBytes(static_cast<int64_t>(m_size));
+    }
+
+    NullBufferImpl::~NullBufferImpl()
+    {
+        if (NullRhiImpl *rhi = NullRhiImpl::Get())
+            rhi->AddAllocatedBytes(-static_cast<int64_t>(m_size));
+        std::free(m_memory);
+    }
+
+    void NullBufferImpl::CopyBuffer(CommandBuffer *cmd, Buffer *src, size_t size, size_t srcOffset, size_t dstOffset)
+    {
+        NullCommandBufferImpl::From(cmd)->CopyBuffer(src, m_owner, size, srcOffset, dstOffset);
+    }
+
+    void NullImageImpl::CopyImage(CommandBuffer *cmd, Image *src)
+    {
+        PE_ERROR_IF(src->GetWidth() != m_owner->GetWidth() || src->GetHeight() != m_owner->GetHeight(),
+                    "Image::CopyImage: Image sizes are different");
+
+        std::vector<ImageBarrierInfo> barriers(2);
+        barriers[0].image = src;
+        barriers[0].layout = PE_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[0].stageFlags = PE_STAGE_TRANSFER;
+        barriers[0].accessMask = PE_ACCESS_TRANSFER_READ;
+        barriers[1].image = m_owner;
+        barriers[1].layout = PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[1].stageFlags = PE_STAGE_TRANSFER;
+        barriers[1].accessMask = PE_ACCESS_TRANSFER_WRITE;
+        Image::Barriers(cmd, barriers);
+
+        NullCommandBufferImpl::From(cmd)->Record(NullCommandType::CopyImage, m_owner, src);
+    }
+
+    void NullImageImpl::CopyToBuffer(CommandBuffer *cmd, Buffer *dst, uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount)
+    {
+        Image *src = m_owner;
+        PE_ERROR_IF(!dst, "NullImageImpl::CopyToBuffer: null destination buffer");
+        PE_ERROR_IF(mipLevel >= src->GetMipLevels(), "NullImageImpl::CopyToBuffer: mip level out of bounds");
+        PE_ERROR_IF(baseArrayLayer + layerCount > src->GetArrayLayers(), "NullImageImpl::CopyToBuffer: layer range out of bounds");
+
+        ImageBarrierInfo barrier{};
+        barrier.image = src;
+        barrier.stageFlags = PE_STAGE_TRANSFER;
+        barrier.accessMask = PE_ACCESS_TRANSFER_READ;
+        barrier.layout = PE_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.baseMipLevel = mipLevel;
+        barrier.mipLevels = 1;
+        barrier.baseArrayLayer = baseArrayLayer;
+        barrier.arrayLayers = layerCount;
+        Image::Barrier(cmd, barrier);
+
+        BufferBarrierInfo bufBarrier{};
+        bufBarrier.buffer = dst;
+        bufBarrier.stageMask = PE_STAGE_TRANSFER;
+        bufBarrier.accessMask = PE_ACCESS_TRANSFER_WRITE;
+        cmd->BufferBarrier(bufBarrier);
+
+        NullCommand &command = NullCommandBufferImpl::From(cmd)->Record(NullCommandType::CopyImageToBuffer, dst, src);
+        command.args[0] = mipLevel;
+        command.args[1] = baseArrayLayer;
+        command.args[2] = layerCount;
+    }
+
+    void NullImageImpl::Blit(CommandBuffer *cmd, Image *src, const ImageBlit &region, PeFilter filter)
+    {
+        std::vector<ImageBarrierInfo> barriers(2);
+        barriers[0].image = src;
+        barriers[0].layout = PE_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barriers[0].stageFlags = PE_STAGE_TRANSFER;
+        barriers[0].accessMask = PE_ACCESS_TRANSFER_READ;
+        barriers[1].image = m_owner;
+        barriers[1].layout = PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barriers[1].stageFlags = PE_STAGE_TRANSFER;
+        barriers[1].accessMask = PE_ACCESS_TRANSFER_WRITE;
+        Image::Barriers(cmd, barriers);
+
+        NullCommand &command = NullCommandBufferImpl::From(cmd)->Record(NullCommandType::BlitImage, m_owner, src);
+        command.args[0] = static_cast<uint64_t>(filter);
+    }
+
+    void NullImageImpl::CopyDataToImageStaged(CommandBuffer *cmd,
+                                              void *data,
+                                              size_t size,
+                                              uint32_t baseArrayLayer,
+                                              uint32_t layerCount,
+                                              uint32_t mipLevel)
+    {
+        Image *image = m_owner;
+        PE_ERROR_IF(!cmd, "Image::CopyDataToImageStaged(): no command buffer specified.");
+
+        // Go through the staging ring like the real backends so uploads cost what they cost on
+        // the CPU side; the texels then stop at the staging buffer.
+        StagingAllocation alloc = RHII.GetStagingManager()->Allocate(size);
+        std::memcpy(alloc.data, data, size);
+        alloc.buffer->Flush(size, alloc.offset);
+
+        ImageBarrierInfo barrier{};
+        barrier.image = image;
+        barrier.stageFlags = PE_STAGE_TRANSFER;
+        barrier.accessMask = PE_ACCESS_TRANSFER_WRITE;
+        barrier.layout = PE_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.baseArrayLayer = baseArrayLayer;
+        barrier.arrayLayers = layerCount ? layerCount : image->GetArrayLayers();
+        barrier.baseMipLevel = mipLevel;
+        barrier.mipLevels = mipLevel == 0 ? image->GetMipLevels() : 1;
+        Image::Barrier(cmd, barrier);
+
+        NullCommand &command = NullCommandBufferImpl::From(cmd)->Record(NullCommandType::CopyBufferToImage, image, alloc.buffer);
+        command.args[0] = size;
+        command.args[1] = baseArrayLayer;
+        command.args[2] = barrier.arrayLayers;
+        command.args[3] = mipLevel;
+
+        cmd->AddAfterWaitCallback([alloc = std::move(alloc)]()
+                                  { RHII.GetStagingManager()->SetUnused(alloc); });
+    }
+
+    ImageMemoryRequirements NullImageImpl::GetMemoryRequirements() const
+    {
+        // The desc estimate at the common 64 KiB placement alignment
+        constexpr uint64_t kAlignment = 64 * 1024;
+        return {(m_owner->m_memoryBytes + kAlignment - 1) & ~(kAlignment - 1), kAlignment, ~0u};
+    }
+
+    void NullImageImpl::CreateRTV()
+    {
+        Image *image = m_owner;
+        PE_ERROR_IF(!(image->GetUsage() & PE_IMAGE_USAGE_COLOR_ATTACHMENT ||
+                      image->GetUsage() & PE_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT),
+                    "Image was not created with ColorAttachment or DepthStencilAttachment for RTV usage");
+
+        if (image->m_rtv)
+        {
+            CommandBuffer::ClearFramebufferCache();
+            ImageView::Destroy(image->m_rtv);
+        }
+
+        ImageViewDesc viewInfo{};
+        viewInfo.viewType = PE_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = image->GetFormat();
+        viewInfo.aspectMask = PeFormatAspectMask(image->GetFormat());
+        viewInfo.baseMipLevel = 0;
+        viewInfo.levelCount = image->GetMipLevels();
+        viewInfo.baseArrayLayer = 0;
+        viewInfo.layerCount = image->GetArrayLayers();
+        image->m_rtv = ImageView::Create(image, viewInfo, image->GetName() + "_RTV");
+    }
+
+    void NullImageImpl::CreateSRV(PeImageViewType type, int mip)
+    {
+        Image *image = m_owner;
+        PE_ERROR_IF(!(image->GetUsage() & PE_IMAGE_USAGE_SAMPLED), "Image was not created with Sampled usage for SRV");
+
+        ImageViewDesc viewInfo{};
+        viewInfo.viewType = type;
+        viewInfo.format = image->GetFormat();
+        viewInfo.aspectMask = PeFormatAspectMask(image->GetFormat());
+        viewInfo.baseMipLevel = mip == -1 ? 0 : mip;
+        viewInfo.levelCount = mip == -1 ? image->GetMipLevels() : 1;
+        viewInfo.baseArrayLayer = 0;
+        viewInfo.layerCount = image->GetArrayLayers();
+        ImageView *view = ImageView::Create(image, viewInfo, image->GetName() + "_SRV");
+
+        ImageView *&slot = mip == -1 ? image->m_srv : image->m_srvs[mip];
+        ImageView::Destroy(slot);
+        slot = view;
+    }
+
+    void NullImageImpl::CreateUAV(PeImageViewType type, uint32_t mip)
+    {
+        Image *image = m_owner;
+        PE_ERROR_IF(!(image->GetUsage() & PE_IMAGE_USAGE_STORAGE), "Image was not created with Storage usage for UAV");
+        ImageView::Destroy(image->m_uavs[mip]);
+
+        ImageViewDesc viewInfo{};
+        viewInfo.viewType = type;
+        viewInfo.format = image->GetFormat();
+        viewInfo.aspectMask = PeFormatAspectMask(image->GetFormat());
+        viewInfo.baseMipLevel = mip;
+        viewInfo.levelCount = 1;
+        viewInfo.baseArrayLayer = 0;
+        viewInfo.layerCount = image->GetArrayLayers();
+        image->m_uavs[mip] = ImageView::Create(image, viewInfo, image->GetName() + "_UAV");
+    }
+} // namespace pe
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "API/Buffer_Internal.h"
+#include "API/Descriptor_Internal.h"
+#include "API/Framebuffer_Internal.h"
+#include "API/ImageView_Internal.h"
+#include "API/Image_Internal.h"
+#include "API/Pipeline_Internal.h"
+#include "API/QueryPool_Internal.h"
+#include "API/RenderPass_Internal.h"
+#include "API/Sampler_Internal.h"
+#include "Base/Timer_Internal.h"
+
+namespace pe
+{
+    // Host memory standing in for device memory. Always mapped; the device address is the pointer.
+    struct NullBufferImpl final : public Buffer::Impl
+    {
+        NullBufferImpl(Buffer *owner, const BufferDesc &desc);
+        ~NullBufferImpl() override;
+
+        static NullBufferImpl *From(Buffer *b) { return static_cast<NullBufferImpl *>(b->m_impl); }
+
+        void *Map() override { return m_memory; }
+        void Unmap() override {}
+        void Flush(size_t, size_t) const override {}
+        uint64_t GetDeviceAddress() const override { return reinterpret_cast<uint64_t>(m_memory); }
+        void CopyBuffer(CommandBuffer *cmd, Buffer *src, size_t size, size_t srcOffset, size_t dstOffset) override;
+
+        Buffer *m_owner{};
+        uint8_t *m_memory{};
+        size_t m_size{};
+    };
+
+    // Images carry no texels, only the layout/access tracking the frontend relies on.
+    // ponytail: copies and blits into images are recorded and counted but not simulated.
+    struct NullImageImpl final : public Image::Impl
+    {
+        NullImageImpl(Image *owner, const ImageDesc &desc) : m_owner{owner} {}
+
+        void CopyImage(CommandBuffer *cmd, Image *src) override;
+        void CopyToBuffer(CommandBuffer *cmd, Buffer *dst, uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount) override;
+        void Blit(CommandBuffer *cmd, Image *src, const ImageBlit &region, PeFilter filter) override;
+        void CopyDataToImageStaged(CommandBuffer *cmd,
+                                   void *data,
+                                   size_t size,
+                                   uint32_t baseArrayLayer,
+                                   uint32_t layerCount,
+                                   uint32_t mipLevel) override;
+        void CreateRTV() override;
+        void CreateSRV(PeImageViewType type, int mip) override;
+        void CreateUAV(PeImageViewType type, uint32_t mip) override;
+        ImageMemoryRequirements GetMemoryRequirements() const override;
+
+        Image *m_owner{};
+    };
+
+    struct NullImageViewImpl final : public ImageView::Impl
+    {
+    };
+
+    struct NullSamplerImpl final : public Sampler::Impl
+    {
+    };
+
+    struct NullPipelineImpl final : public Pipeline::Impl
+    {
+    };
+
+    struct NullRenderPassImpl final : public RenderPass::Impl
+    {
+    };
+
+    struct NullFramebufferImpl final : public Framebuffer::Impl
+    {
+    };
+
+    struct NullDescriptorPoolImpl final : public DescriptorPool::Impl
+    {
+    };
+
+    struct NullDescriptorLayoutImpl final : public DescriptorLayout::Impl
+    {
+    };
+
+    struct NullDescriptorImpl final : public Descriptor::Impl
+    {
+        void Update(const std::vector<DescriptorBindingInfo> &, const std::vector<DescriptorUpdateInfo> &) override {}
+    };
+
+    // Query results are synthesized at resolve time (see NullCommandBufferImpl::Execute)
+    class NullQueryPool final : public QueryPool::Impl
+    {
+    };
+
+    class NullGpuTimerImpl final : public GpuTimer::Impl
+    {
+    public:
+        void Start(CommandBuffer *cmd) override { m_cmd = cmd; }
+        void End() override {}
+        float GetTime() override { return 0.0f; }
+        double GetStartTimeMs() const override { return 0.0; }
+        CommandBuffer *GetCommandBuffer() const override { return m_cmd; }
+        void ResetState() override { m_cmd = nullptr; }
+
+    private:
+        CommandBuffer *m_cmd = nullptr;
+    };
+} // namespace pe
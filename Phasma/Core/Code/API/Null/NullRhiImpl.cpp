@@ -0,0 +1,124 @@
+#include "API/Null/NullRhiImpl.h"
+#include "API/Null/NullCommandBufferImpl.h"
+
+#include "vulkan/vulkan_core.h" // VK_API_VERSION_1_3 only; shaders are still compiled to SPIR-V for reflection
+
+namespace pe
+{
+    NullRhiImpl *NullRhiImpl::Get()
+    {
+        if (RHII.GetApi() != PE_GRAPHICS_API_NULL)
+            return nullptr;
+        return static_cast<NullRhiImpl *>(RHII.GetImpl());
+    }
+
+    bool NullRhiImpl::Init(SDL_Window *)
+    {
+        // Advertise the features whose absence would push callers onto legacy paths that only exist
+        // for old drivers; everything that needs real GPU work (ray tracing, mesh shaders, BDA) is off.
+        m_caps = {};
+        m_caps.dynamicRendering = true;
+        m_caps.sync2 = true;
+        m_caps.copyCommands2 = true;
+        m_caps.extendedDynamicState = true;
+        m_caps.indirectCount = true;
+        m_caps.spirvTargetVulkanVersion = VK_API_VERSION_1_3;
+        m_caps.maxPushConstantsBytes = 128;
+        m_caps.maxBindlessTextures = 4096;
+
+        ResetStats();
+        m_allocatedBytes.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    void NullRhiImpl::Shutdown()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_submitHook = nullptr;
+    }
+
+    GpuMemorySnapshot NullRhiImpl::GetGpuMemorySnapshot()
+    {
+        const uint64_t bytes = static_cast<uint64_t>(std::max<int64_t>(m_allocatedBytes.load(std::memory_order_relaxed), 0));
+
+        GpuMemorySnapshot snap{};
+        snap.vram.used = bytes;
+        snap.vram.app = bytes;
+        snap.vram.heaps = 1;
+        return snap;
+    }
+
+    NullRhiImpl::Stats NullRhiImpl::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Stats stats = m_stats;
+        stats.presents = m_presents.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void NullRhiImpl::ResetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats = {};
+        m_presents.store(0, std::memory_order_relaxed);
+    }
+
+    void NullRhiImpl::SetSubmitHook(SubmitHook hook)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_submitHook = std::move(hook);
+    }
+
+    void NullRhiImpl::OnSubmit(const CommandBuffer *cmd, const std::vector<NullCommand> &commands)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stats.commandBuffers++;
+        m_stats.commands += commands.size();
+        for (const NullCommand &command : commands)
+        {
+            switch (command.type)
+            {
+            case NullCommandType::BeginPass:
+                m_stats.passes++;
+                break;
+            case NullCommandType::Draw:
+            case NullCommandType::DrawIndexed:
+            case NullCommandType::DrawIndirect:
+            case NullCommandType::DrawIndexedIndirect:
+            case NullCommandType::DrawIndexedIndirectCount:
+                m_stats.draws++;
+                break;
+            case NullCommandType::Dispatch:
+            case NullCommandType::TraceRays:
+                m_stats.dispatches++;
+                break;
+            case NullCommandType::FillBuffer:
+            case NullCommandType::CopyBuffer:
+                m_stats.copies++;
+                m_stats.copyBytes += command.args[0];
+                break;
+            case NullCommandType::CopyBufferToImage:
+            case NullCommandType::CopyImage:
+            case NullCommandType::CopyImageToBuffer:
+            case NullCommandType::BlitImage:
+                m_stats.copies++;
+                break;
+            case NullCommandType::Barrier:
+                m_stats.barriers++;
+                break;
+            default:
+                break;
+            }
+        }
+
+        if (m_submitHook)
+            m_submitHook(cmd, commands);
+    }
+
+    void NullRhiImpl::CountSubmit()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.submits++;
+    }
+} // namespace pe
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "API/RHI.h"
+#include "API/RHI_Internal.h"
+
+namespace pe
+{
+    class CommandBuffer;
+    struct NullCommand;
+
+    // Headless backend: no device, no window required. Buffers are plain host memory, every other
+    // resource is an empty stand-in, and command buffers record a stream of NullCommand that the
+    // queue "executes" at submit (transfers and query resolves touch buffer memory, the rest is
+    // counted and dropped). Fences complete at submit, so CPU-side systems run unchanged.
+    class NullRhiImpl final : public RHI::Impl
+    {
+    public:
+        struct Stats
+        {
+            uint64_t submits = 0;
+            uint64_t commandBuffers = 0;
+            uint64_t commands = 0;
+            uint64_t passes = 0;
+            uint64_t draws = 0;
+            uint64_t dispatches = 0;
+            uint64_t copies = 0;
+            uint64_t copyBytes = 0;
+            uint64_t barriers = 0;
+            uint64_t presents = 0;
+        };
+
+        // Called on the submitting thread for every submitted command buffer, before its fence
+        // signals. Lets tests and tools inspect what a frame would have sent to a GPU.
+        using SubmitHook = std::function<void(const CommandBuffer *cmd, const std::vector<NullCommand> &commands)>;
+
+        // nullptr unless the active API is PE_GRAPHICS_API_NULL
+        static NullRhiImpl *Get();
+
+        bool Init(SDL_Window *window) override;
+        void Shutdown() override;
+        void WaitDeviceIdle() override {}
+        void NextFrame() override {}
+        GpuMemorySnapshot GetGpuMemorySnapshot() override;
+
+        const RHI::Caps &GetCaps() const { return m_caps; }
+        Stats GetStats() const;
+        void ResetStats();
+        void SetSubmitHook(SubmitHook hook);
+
+        // Backend-internal
+        void CountSubmit();
+        void OnSubmit(const CommandBuffer *cmd, const std::vector<NullCommand> &commands);
+        void OnPresent() { m_presents.fetch_add(1, std::memory_order_relaxed); }
+        void AddAllocatedBytes(int64_t bytes) { m_allocatedBytes.fetch_add(bytes, std::memory_order_relaxed); }
+
+    private:
+        RHI::Caps m_caps{};
+        std::atomic<int64_t> m_allocatedBytes{0};
+        std::atomic<uint64_t> m_presents{0};
+
+        mutable std::mutex m_mutex; // stats and hook; submits are already serialized per queue
+        Stats m_stats{};
+        SubmitHook m_submitHook;
+    };
+} // namespace pe
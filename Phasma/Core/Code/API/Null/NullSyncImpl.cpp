@@ -0,0 +1,135 @@
+#include "API/Null/NullSyncImpl.h"
+#include "API/Image.h"
+#include "API/Null/NullRhiImpl.h"
+#include "API/Surface.h"
+#include "API/Swapchain.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr uint32_t kHeadlessWidth = 1280;
+        constexpr uint32_t kHeadlessHeight = 720;
+    } // namespace
+
+    void NullSemaphoreImpl::Wait(uint64_t value)
+    {
+        PE_ERROR_IF(!m_timeline, "Semaphore::Wait() called on non-timeline semaphore!");
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&]()
+                  { return m_value >= value; });
+    }
+
+    bool NullSemaphoreImpl::WaitTimeout(uint64_t value, uint64_t timeoutNS)
+    {
+        PE_ERROR_IF(!m_timeline, "Semaphore::WaitTimeout() called on non-timeline semaphore!");
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (timeoutNS == UINT64_MAX)
+        {
+            m_cv.wait(lock, [&]()
+                      { return m_value >= value; });
+            return true;
+        }
+        return m_cv.wait_for(lock, std::chrono::nanoseconds(timeoutNS), [&]()
+                             { return m_value >= value; });
+    }
+
+    void NullSemaphoreImpl::Signal(uint64_t value)
+    {
+        PE_ERROR_IF(!m_timeline, "Semaphore::Signal() called on non-timeline semaphore!");
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_value = std::max(m_value, value);
+        }
+        m_cv.notify_all();
+    }
+
+    uint64_t NullSemaphoreImpl::GetValue()
+    {
+        PE_ERROR_IF(!m_timeline, "Semaphore::GetValue() called on non-timeline semaphore!");
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_value;
+    }
+
+    void NullSemaphoreImpl::Bump()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_value++;
+        }
+        m_cv.notify_all();
+    }
+
+    NullSurfaceImpl::NullSurfaceImpl(Surface *owner, SDL_Window *window)
+        : m_owner{owner}
+    {
+        int w = static_cast<int>(kHeadlessWidth);
+        int h = static_cast<int>(kHeadlessHeight);
+        if (window)
+            SDL_GetWindowSize(window, &w, &h);
+
+        m_owner->m_actualExtent = Rect2Du{0, 0, static_cast<uint32_t>(w), static_cast<uint32_t>(h)};
+        m_owner->m_format = PE_FORMAT_R8G8B8A8_UNORM;
+    }
+
+    std::vector<PePresentMode> NullSurfaceImpl::GetSupportedPresentModes() const
+    {
+        return {PE_PRESENT_MODE_FIFO, PE_PRESENT_MODE_MAILBOX, PE_PRESENT_MODE_IMMEDIATE};
+    }
+
+    NullSwapchainImpl::NullSwapchainImpl(Swapchain *owner, const SwapchainDesc &desc)
+        : m_owner{owner}
+    {
+        uint32_t width = desc.width;
+        uint32_t height = desc.height;
+        if ((!width || !height) && desc.surface)
+        {
+            width = desc.surface->GetActualExtent().width;
+            height = desc.surface->GetActualExtent().height;
+        }
+        if (!width || !height)
+        {
+            width = kHeadlessWidth;
+            height = kHeadlessHeight;
+        }
+
+        const uint32_t count = desc.backbufferCount < 2 ? 2 : desc.backbufferCount;
+        m_owner->m_width = width;
+        m_owner->m_height = height;
+        m_owner->m_images.resize(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            ImageDesc info{};
+            info.width = width;
+            info.height = height;
+            info.format = desc.surface ? desc.surface->GetFormat() : PE_FORMAT_R8G8B8A8_UNORM;
+            info.usage = PE_IMAGE_USAGE_COLOR_ATTACHMENT | PE_IMAGE_USAGE_TRANSFER_SRC |
+                         PE_IMAGE_USAGE_TRANSFER_DST | PE_IMAGE_USAGE_SAMPLED;
+            info.initialLayout = PE_IMAGE_LAYOUT_PRESENT_SRC;
+            info.name = "Swapchain_image_" + std::to_string(i);
+
+            Image *image = Image::Create(info);
+            image->CreateRTV();
+            m_owner->m_images[i] = image;
+        }
+    }
+
+    uint32_t NullSwapchainImpl::AquireNextImage(Semaphore *semaphore)
+    {
+        const uint32_t index = m_next;
+        m_next = (m_next + 1) % static_cast<uint32_t>(m_owner->m_images.size());
+        if (semaphore)
+            NullSemaphoreImpl::From(semaphore)->Bump();
+        return index;
+    }
+
+    void NullSwapchainImpl::Present()
+    {
+        if (NullRhiImpl *rhi = NullRhiImpl::Get())
+            rhi->OnPresent();
+    }
+} // namespace pe
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "API/Semaphore_Internal.h"
+#include "API/Surface_Internal.h"
+#include "API/Swapchain_Internal.h"
+
+namespace pe
+{
+    // A plain counter. Binary semaphores use the same counter; the queue bumps it on signal.
+    struct NullSemaphoreImpl final : public Semaphore::Impl
+    {
+        NullSemaphoreImpl(Semaphore *owner, bool timeline) : m_owner{owner}, m_timeline{timeline} {}
+
+        static NullSemaphoreImpl *From(Semaphore *s) { return static_cast<NullSemaphoreImpl *>(s->m_impl); }
+
+        void Wait(uint64_t value) override;
+        bool WaitTimeout(uint64_t value, uint64_t timeoutNS) override;
+        void Signal(uint64_t value) override;
+        uint64_t GetValue() override;
+        void Bump();
+
+        Semaphore *m_owner{};
+        bool m_timeline{false};
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        uint64_t m_value{0};
+    };
+
+    // Window-sized when there is a window, 1280x720 otherwise
+    struct NullSurfaceImpl final : public Surface::Impl
+    {
+        NullSurfaceImpl(Surface *owner, SDL_Window *window);
+
+        std::vector<PePresentMode> GetSupportedPresentModes() const override;
+        bool IsPresentable() const override { return true; }
+
+        Surface *m_owner{};
+    };
+
+    // Plain images that are handed out round-robin; presenting only counts the frame
+    struct NullSwapchainImpl final : public Swapchain::Impl
+    {
+        NullSwapchainImpl(Swapchain *owner, const SwapchainDesc &desc);
+
+        uint32_t AquireNextImage(Semaphore *semaphore) override;
+        void Present() override;
+
+        Swapchain *m_owner{};
+        uint32_t m_next{0};
+    };
+} // namespace pe
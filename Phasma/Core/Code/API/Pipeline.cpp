@@ -2,6 +2,7 @@
 #include "API/Buffer.h"
 #include "API/Command.h"
 #include "API/Descriptor.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Pipeline_Internal.h"
 #include "API/Vulkan/VulkanPipelineImpl.h"
@@ -500,7 +501,7 @@ namespace pe
     {
         Pipeline *pipeline = new Pipeline(renderPass, info);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Pipeline), reinterpret_cast<void *>(pipeline));
+        PeTracker::Track(pipeline);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Pipeline created (Handle: %p)", reinterpret_cast<void *>(pipeline));
 #endif
@@ -516,22 +517,17 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Pipeline destroyed (Handle: %p)", reinterpret_cast<void *>(pipeline));
 #endif
-        delete pipeline;
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Untrack(typeid(Pipeline), reinterpret_cast<void *>(pipeline));
+        PeTracker::Untrack(pipeline);
 #endif
+        delete pipeline;
         pipeline = nullptr;
     }
 
     std::vector<Pipeline *> Pipeline::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Pipeline));
-        std::vector<Pipeline *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Pipeline *>(p));
-        return out;
+        return PeTracker::GetHandles<Pipeline>();
 #else
         return {};
 #endif
@@ -539,6 +535,9 @@ namespace pe
 
     Pipeline::Impl *CreatePipelineImpl(Pipeline *owner, RenderPass *renderPass, PassInfo &info)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+            return new NullPipelineImpl();
+
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
 #if defined(PE_WIN32)
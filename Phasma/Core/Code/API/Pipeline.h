@@ -148,7 +148,7 @@ namespace pe
         std::vector<std::vector<Descriptor *>> m_descriptorsPF;
     };
 
-    class Pipeline : public NoCopy
+    class Pipeline : public NoCopy, public PeTracked
     {
     public:
         enum class Type : uint8_t
@@ -1,5 +1,6 @@
 #include "API/QueryPool_Internal.h"
 
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanQueryPool.h"
 
@@ -15,6 +16,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return std::make_unique<VulkanQueryPool>(desc);
+        case PE_GRAPHICS_API_NULL:
+            return std::make_unique<NullQueryPool>();
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return std::make_unique<Dx12QueryPool>(desc);
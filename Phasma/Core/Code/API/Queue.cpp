@@ -1,6 +1,7 @@
 #include "API/Queue.h"
 #include "API/Command.h"
 #include "API/CommandPool_Internal.h"
+#include "API/Null/NullCommandBufferImpl.h"
 #include "API/Queue_Internal.h"
 #include "API/RHI.h"
 #include "API/Semaphore.h"
@@ -21,6 +22,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanCommandPoolImpl(owner, queue, flags, name);
+        case PE_GRAPHICS_API_NULL:
+            return new NullCommandPoolImpl();
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12CommandPoolImpl(owner, queue, flags, name);
@@ -41,6 +44,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanQueueImpl(owner, familyId, name);
+        case PE_GRAPHICS_API_NULL:
+            return new NullQueueImpl();
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12QueueImpl(owner, familyId, name);
@@ -106,8 +111,29 @@ namespace pe
         // Externally synchronize queue host-access; also keeps the assigned timeline value in lockstep
         // with the actual vkQueueSubmit order (a worker-thread cook/load submits to this same queue).
         std::lock_guard<std::mutex> lock(m_submitMutex);
+        std::erase_if(m_queueWaits, [](const QueueWait &queueWait)
+                      { return queueWait.semaphore->GetValue() >= queueWait.value; });
         const uint64_t value = ++m_submission;
-        m_impl->Submit(commandBuffersCount, commandBuffers, wait, signal, m_submissionsSemaphore, value);
+        m_impl->Submit(commandBuffersCount, commandBuffers, wait, signal, m_submissionsSemaphore, value, m_queueWaits);
+    }
+
+    void Queue::WaitForQueue(Queue *producer, uint64_t value, PeBarrierSync stageFlags)
+    {
+        if (!producer || producer == this || !value)
+            return;
+
+        Semaphore *semaphore = producer->GetSubmissionsSemaphore();
+        std::lock_guard<std::mutex> lock(m_submitMutex);
+        for (QueueWait &queueWait : m_queueWaits)
+        {
+            if (queueWait.semaphore == semaphore)
+            {
+                queueWait.value = std::max(queueWait.value, value);
+                queueWait.stageFlags |= stageFlags;
+                return;
+            }
+        }
+        m_queueWaits.push_back({semaphore, value, stageFlags});
     }
 
     void Queue::Present(Swapchain *swapchain, uint32_t imageIndex, Semaphore *wait)
@@ -32,6 +32,14 @@ namespace pe
         std::stack<CommandBuffer *> m_freeCmdStack{};
     };
 
+    // A GPU-side wait on another queue's submissions timeline
+    struct QueueWait
+    {
+        Semaphore *semaphore = nullptr;
+        uint64_t value = 0;
+        PeBarrierSync stageFlags = PE_STAGE_NONE;
+    };
+
     class Queue : public PeHandle<Queue, PeBackendHandle>
     {
     public:
@@ -52,6 +60,10 @@ namespace pe
         CommandBuffer *AcquireCommandBuffer(PeCommandPoolCreateFlags flags = PE_COMMAND_POOL_CREATE_TRANSIENT);
         void ReturnCommandBuffer(CommandBuffer *cmd);
         uint64_t GetSubmissionCount() const { return m_submission.load(std::memory_order_acquire); }
+        // Makes every batch this queue submits from now on wait, at `stageFlags`, until `producer` has
+        // completed its submission `value`. Registered on the queue rather than on one batch, so it holds
+        // whichever thread submits next; dropped once the producer's timeline passes `value`.
+        void WaitForQueue(Queue *producer, uint64_t value, PeBarrierSync stageFlags);
 
     private:
         friend struct VulkanQueueImpl;
@@ -64,6 +76,7 @@ namespace pe
         std::string m_name;
         std::atomic_uint64_t m_submission{0};
         Semaphore *m_submissionsSemaphore{nullptr};
+        std::vector<QueueWait> m_queueWaits{}; // guarded by m_submitMutex
         std::unordered_map<std::thread::id, std::vector<CommandPool *>> m_commandPools{};
         std::mutex m_cmdMutex{};
         // Vulkan/D3D12 require host access to a queue (submit/present/wait) to be externally
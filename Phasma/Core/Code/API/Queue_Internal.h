@@ -16,7 +16,8 @@ namespace pe
                             Semaphore *wait,
                             Semaphore *signal,
                             Semaphore *submissionsSemaphore,
-                            uint64_t submissionValue) = 0;
+                            uint64_t submissionValue,
+                            const std::vector<QueueWait> &queueWaits) = 0;
         virtual void Present(Swapchain *swapchain, uint32_t imageIndex, Semaphore *wait) = 0;
         virtual void WaitIdle() = 0;
     };
@@ -3,8 +3,10 @@
 #if defined(PE_WIN32)
 #include "API/DX12/Dx12RhiImpl.h"
 #endif
+#include "API/Null/NullRhiImpl.h"
 #include "API/Vulkan/VulkanCommandBufferImpl.h"
 #include "API/Vulkan/VulkanImageImpl.h"
+#include "API/Vulkan/VulkanPipelineCache.h"
 #include "API/Vulkan/VulkanQueueImpl.h"
 #include "API/Vulkan/VulkanRhiImpl.h"
 #include "API/Vulkan/VulkanSurfaceImpl.h"
@@ -1003,6 +1005,60 @@ namespace pe
             return;
 #endif
         }
+        if (api == PE_GRAPHICS_API_NULL)
+        {
+            auto *nul = new NullRhiImpl();
+            m_impl = nul;
+            m_impl->Init(window);
+            // Window is optional; without one the surface falls back to a fixed headless extent
+            m_surface = Surface::Create(m_window);
+            m_caps = nul->GetCaps();
+            SyncRayTracingSettingsToCaps(m_caps);
+            m_gpuName = "Null";
+            m_gpuAdapterInfo.type = GpuAdapterType::Cpu;
+
+            m_gpuFeatureSupport.drawIndirectFirstInstance = true;
+            m_gpuFeatureSupport.timestampQuery = true;
+            m_gpuFeatureSupport.occlusionQuery = true;
+            m_maxUniformBufferSize = 65536;
+            m_maxStorageBufferSize = std::numeric_limits<uint32_t>::max();
+            m_minUniformBufferOffsetAlignment = 256;
+            m_minStorageBufferOffsetAlignment = 16;
+            m_maxPushConstantsSize = m_caps.maxPushConstantsBytes;
+            m_maxDrawIndirectCount = std::numeric_limits<uint32_t>::max();
+            m_gpuLimits.maxTextureDimension1D = 16384;
+            m_gpuLimits.maxTextureDimension2D = 16384;
+            m_gpuLimits.maxTextureDimension3D = 2048;
+            m_gpuLimits.maxTextureArrayLayers = 2048;
+            m_gpuLimits.maxBindGroups = 4;
+            m_gpuLimits.maxDynamicUniformBuffersPerPipelineLayout = 8;
+            m_gpuLimits.maxDynamicStorageBuffersPerPipelineLayout = 4;
+            m_gpuLimits.maxSampledTexturesPerShaderStage = 128;
+            m_gpuLimits.maxSamplersPerShaderStage = 16;
+            m_gpuLimits.maxStorageBuffersPerShaderStage = 64;
+            m_gpuLimits.maxStorageTexturesPerShaderStage = 8;
+            m_gpuLimits.maxUniformBuffersPerShaderStage = 14;
+            m_gpuLimits.maxUniformBufferBindingSize = m_maxUniformBufferSize;
+            m_gpuLimits.maxStorageBufferBindingSize = m_maxStorageBufferSize;
+            m_gpuLimits.minUniformBufferOffsetAlignment = static_cast<uint32_t>(m_minUniformBufferOffsetAlignment);
+            m_gpuLimits.minStorageBufferOffsetAlignment = static_cast<uint32_t>(m_minStorageBufferOffsetAlignment);
+            m_gpuLimits.maxVertexBuffers = 16;
+            m_gpuLimits.maxBufferSize = m_maxStorageBufferSize;
+            m_gpuLimits.maxVertexAttributes = 16;
+            m_gpuLimits.maxVertexBufferArrayStride = 2048;
+            m_gpuLimits.maxInterStageShaderVariables = 16;
+            m_gpuLimits.maxColorAttachments = 8;
+            m_gpuLimits.maxComputeWorkgroupStorageSize = 32768;
+            m_gpuLimits.maxComputeInvocationsPerWorkgroup = 1024;
+            m_gpuLimits.maxComputeWorkgroupSizeX = 1024;
+            m_gpuLimits.maxComputeWorkgroupSizeY = 1024;
+            m_gpuLimits.maxComputeWorkgroupSizeZ = 64;
+            m_gpuLimits.maxComputeWorkgroupsPerDimension = 65535;
+            m_mainQueue = Queue::Create(0, "Main_queue");
+            m_stagingManager = new StagingManager();
+            CreateDescriptorPool(150);
+            return;
+        }
         PE_ERROR_IF(api != PE_GRAPHICS_API_VULKAN, "RHI::Init: unsupported graphics api enum %u", static_cast<uint32_t>(api));
         m_impl = new VulkanRhiImpl();
         auto *vk = static_cast<VulkanRhiImpl *>(m_impl);
@@ -1014,6 +1070,7 @@ namespace pe
         CreateDevice();
         SyncRayTracingSettingsToCaps(m_caps);
         CreateAllocator();
+        VulkanPipelineCache::Init();
         CreateDescriptorPool(150); // General purpose descriptor pool
 
         m_stagingManager = new StagingManager();
@@ -1043,7 +1100,7 @@ namespace pe
     {
         WaitDeviceIdle();
 
-        if (m_api == PE_GRAPHICS_API_DX12)
+        if (m_api == PE_GRAPHICS_API_DX12 || m_api == PE_GRAPHICS_API_NULL)
         {
             for (auto &queue : m_deletionQueues)
             {
@@ -1068,6 +1125,8 @@ namespace pe
                 Buffer::Destroy(m_dx12FillOne);
                 m_dx12FillOne = nullptr;
             }
+            if (m_api == PE_GRAPHICS_API_NULL)
+                Surface::Destroy(m_surface);
             Queue::Destroy(m_mainQueue);
             CommandBuffer::ClearCache();
             delete m_stagingManager;
@@ -1103,8 +1162,15 @@ namespace pe
         DescriptorLayout::ClearCache();
         Swapchain::Destroy(m_swapchain);
         Surface::Destroy(m_surface);
+        if (m_computeQueue)
+            Queue::Destroy(m_computeQueue);
+        if (m_transferQueue)
+            Queue::Destroy(m_transferQueue);
+        m_computeQueue = nullptr;
+        m_transferQueue = nullptr;
         Queue::Destroy(m_mainQueue);
         CommandBuffer::ClearCache();
+        VulkanPipelineCache::Shutdown();
         delete m_stagingManager;
         DescriptorPool::Destroy(m_descriptorPool);
 
@@ -1661,21 +1727,20 @@ namespace pe
         }
 #endif
 
-        auto queueFamilyProperties = vk->m_gpu.getQueueFamilyProperties();
+        GetGraphicsFamilyId();
+        GetTransferFamilyId();
+        GetComputeFamilyId();
+        PE_ERROR_IF(m_graphicsFamilyId == UINT32_MAX, "No graphics + compute + transfer queue family found");
+
         float priority = 1.f;
-        vk::DeviceQueueCreateInfo queueCreateInfo{};
-        for (uint32_t i = 0; i < queueFamilyProperties.size(); i++)
+        std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos{};
+        for (uint32_t family : m_queueFamilies)
         {
-            if (queueFamilyProperties[i].queueCount > 0 &&
-                queueFamilyProperties[i].queueFlags & vk::QueueFlagBits::eGraphics &&
-                queueFamilyProperties[i].queueFlags & vk::QueueFlagBits::eCompute &&
-                queueFamilyProperties[i].queueFlags & vk::QueueFlagBits::eTransfer)
-            {
-                queueCreateInfo.queueFamilyIndex = i;
-                queueCreateInfo.queueCount = 1;
-                queueCreateInfo.pQueuePriorities = &priority;
-                break;
-            }
+            vk::DeviceQueueCreateInfo queueCreateInfo{};
+            queueCreateInfo.queueFamilyIndex = family;
+            queueCreateInfo.queueCount = 1;
+            queueCreateInfo.pQueuePriorities = &priority;
+            queueCreateInfos.push_back(queueCreateInfo);
         }
 
         // Vulkan 1.1 features
@@ -1889,8 +1954,8 @@ namespace pe
                 m_caps.maintenance5 ? 1u : 0u);
 
         vk::DeviceCreateInfo deviceCreateInfo{};
-        deviceCreateInfo.queueCreateInfoCount = 1;
-        deviceCreateInfo.pQueueCreateInfos = &queueCreateInfo;
+        deviceCreateInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
+        deviceCreateInfo.pQueueCreateInfos = queueCreateInfos.data();
         deviceCreateInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
         deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
         deviceCreateInfo.pNext = &deviceFeatures2;
@@ -1903,7 +1968,96 @@ namespace pe
         Debug::SetObjectName(vk->m_gpu, "RHI_gpu");
         Debug::SetObjectName(vk->m_device, "RHI_device");
 
-        m_mainQueue = Queue::Create(queueCreateInfo.queueFamilyIndex, "Main_queue");
+        m_mainQueue = Queue::Create(m_graphicsFamilyId, "Main_queue");
+        // Command buffers on non-graphics families mask their barriers to the stages the family supports,
+        // which only the sync2 path does. Without it everything stays on the main queue.
+        if (!m_caps.sync2)
+        {
+            m_transferFamilyId = UINT32_MAX;
+            m_computeFamilyId = UINT32_MAX;
+            m_queueFamilies = {m_graphicsFamilyId};
+        }
+        if (m_transferFamilyId != UINT32_MAX)
+            m_transferQueue = Queue::Create(m_transferFamilyId, "Transfer_queue");
+        if (m_computeFamilyId != UINT32_MAX)
+            m_computeQueue = Queue::Create(m_computeFamilyId, "Compute_queue");
+
+        PE_INFO("[Vulkan] Queue families: graphics=%u, transfer=%d, compute=%d",
+                m_graphicsFamilyId,
+                m_transferQueue ? static_cast<int>(m_transferFamilyId) : -1,
+                m_computeQueue ? static_cast<int>(m_computeFamilyId) : -1);
+    }
+
+    void RHI::GetGraphicsFamilyId()
+    {
+        auto *vk = static_cast<VulkanRhiImpl *>(m_impl);
+        const auto properties = vk->m_gpu.getQueueFamilyProperties();
+
+        m_graphicsFamilyId = UINT32_MAX;
+        m_queueFamilies.clear();
+        for (uint32_t i = 0; i < properties.size(); i++)
+        {
+            const vk::QueueFlags flags = properties[i].queueFlags;
+            if (properties[i].queueCount > 0 &&
+                flags & vk::QueueFlagBits::eGraphics &&
+                flags & vk::QueueFlagBits::eCompute &&
+                flags & vk::QueueFlagBits::eTransfer)
+            {
+                m_graphicsFamilyId = i;
+                m_queueFamilies.push_back(i);
+                return;
+            }
+        }
+    }
+
+    void RHI::GetTransferFamilyId()
+    {
+        // A transfer-only family is the copy engine (DMA) and runs beside graphics without taking
+        // shader cores. Any other non-graphics family with transfer is the next best thing.
+        m_transferFamilyId = UINT32_MAX;
+        if (m_graphicsFamilyId == UINT32_MAX || IsEnvFlagDisabled("PE_ASYNC_QUEUES"))
+            return;
+
+        auto *vk = static_cast<VulkanRhiImpl *>(m_impl);
+        const auto properties = vk->m_gpu.getQueueFamilyProperties();
+        for (uint32_t i = 0; i < properties.size(); i++)
+        {
+            const vk::QueueFlags flags = properties[i].queueFlags;
+            if (properties[i].queueCount == 0 || !(flags & vk::QueueFlagBits::eTransfer) || (flags & vk::QueueFlagBits::eGraphics))
+                continue;
+
+            const bool transferOnly = !(flags & vk::QueueFlagBits::eCompute);
+            if (m_transferFamilyId == UINT32_MAX || transferOnly)
+                m_transferFamilyId = i;
+            if (transferOnly)
+                break;
+        }
+
+        if (m_transferFamilyId != UINT32_MAX)
+            m_queueFamilies.push_back(m_transferFamilyId);
+    }
+
+    void RHI::GetComputeFamilyId()
+    {
+        m_computeFamilyId = UINT32_MAX;
+        if (m_graphicsFamilyId == UINT32_MAX || IsEnvFlagDisabled("PE_ASYNC_QUEUES"))
+            return;
+
+        auto *vk = static_cast<VulkanRhiImpl *>(m_impl);
+        const auto properties = vk->m_gpu.getQueueFamilyProperties();
+        for (uint32_t i = 0; i < properties.size(); i++)
+        {
+            const vk::QueueFlags flags = properties[i].queueFlags;
+            if (properties[i].queueCount > 0 &&
+                flags & vk::QueueFlagBits::eCompute &&
+                !(flags & vk::QueueFlagBits::eGraphics) &&
+                i != m_transferFamilyId)
+            {
+                m_computeFamilyId = i;
+                m_queueFamilies.push_back(i);
+                return;
+            }
+        }
     }
 
     void RHI::CreateAllocator()
@@ -1968,7 +2122,7 @@ namespace pe
 
         PE_ERROR_IF(!m_surface, "RHI::InitSwapchain requires a surface");
 
-        if (m_api == PE_GRAPHICS_API_DX12)
+        if (m_api == PE_GRAPHICS_API_DX12 || (m_api == PE_GRAPHICS_API_NULL && m_window))
         {
             int sdlW = 0;
             int sdlH = 0;
@@ -2011,7 +2165,7 @@ namespace pe
     {
         // DX12 path: support a fixed widely-available depth format until a
         // backend-virtual depth-format query lands.
-        if (GetApi() == PE_GRAPHICS_API_DX12)
+        if (GetApi() == PE_GRAPHICS_API_DX12 || GetApi() == PE_GRAPHICS_API_NULL)
             return PE_FORMAT_D32_SFLOAT;
         return FromVkFormat(GetVulkanDepthFormat());
     }
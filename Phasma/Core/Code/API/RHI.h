@@ -238,6 +238,12 @@ namespace pe
         const std::string &GetGpuName() { return m_gpuName; }
         DescriptorPool *GetDescriptorPool() { return m_descriptorPool; }
         Queue *GetMainQueue() { return m_mainQueue; }
+        // Dedicated copy and async-compute queues. Fall back to the main queue when the device has no
+        // separate family for them, on DX12 and Null, or with PE_ASYNC_QUEUES=0.
+        Queue *GetTransferQueue() { return m_transferQueue ? m_transferQueue : m_mainQueue; }
+        Queue *GetComputeQueue() { return m_computeQueue ? m_computeQueue : m_mainQueue; }
+        // Every family a queue was created on, graphics first (sharing list for concurrent resources)
+        const std::vector<uint32_t> &GetQueueFamilies() const { return m_queueFamilies; }
         SDL_Window *GetWindow() { return m_window; }
         Surface *GetSurface() { return m_surface; }
         Swapchain *GetSwapchain() { return m_swapchain; }
@@ -268,6 +274,12 @@ namespace pe
         std::string m_gpuName;
         DescriptorPool *m_descriptorPool;
         Queue *m_mainQueue;
+        Queue *m_transferQueue = nullptr;
+        Queue *m_computeQueue = nullptr;
+        uint32_t m_graphicsFamilyId = UINT32_MAX;
+        uint32_t m_transferFamilyId = UINT32_MAX;
+        uint32_t m_computeFamilyId = UINT32_MAX;
+        std::vector<uint32_t> m_queueFamilies{};
         SDL_Window *m_window;
         Surface *m_surface;
         Swapchain *m_swapchain;
@@ -4,6 +4,7 @@ enum PeGraphicsApi : uint32_t
 {
     PE_GRAPHICS_API_VULKAN = 0,
     PE_GRAPHICS_API_DX12,
+    PE_GRAPHICS_API_NULL, // headless: CPU stand-ins, no device (CI, benchmarks, cooking)
     PE_GRAPHICS_API_COUNT
 };
 
@@ -17,6 +18,8 @@ constexpr const char *PeGraphicsApiName(PeGraphicsApi api)
         return "Vulkan";
     case PE_GRAPHICS_API_DX12:
         return "DX12";
+    case PE_GRAPHICS_API_NULL:
+        return "Null";
     default:
         return "Unknown";
     }
@@ -135,6 +138,10 @@ enum PeFormat : uint32_t
     PE_FORMAT_E5B9G9R9_UFLOAT_PACK32,
     PE_FORMAT_D16_UNORM,
 
+    // ASTC compressed (cooked textures for mobile GPUs without BC). Appended for the same reason.
+    PE_FORMAT_ASTC_4x4_UNORM,
+    PE_FORMAT_ASTC_4x4_SRGB,
+
     PE_FORMAT_COUNT
 };
 
@@ -280,6 +287,10 @@ constexpr const char *PeFormatName(::PeFormat format)
         return "E5B9G9R9_UFLOAT_PACK32";
     case PE_FORMAT_D16_UNORM:
         return "D16_UNORM";
+    case PE_FORMAT_ASTC_4x4_UNORM:
+        return "ASTC_4x4_UNORM";
+    case PE_FORMAT_ASTC_4x4_SRGB:
+        return "ASTC_4x4_SRGB";
     default:
         return "UNKNOWN";
     }
@@ -335,6 +346,80 @@ constexpr bool PeFormatHasDepthOrStencil(::PeFormat format)
     return PeFormatHasDepth(format) || PeFormatHasStencil(format);
 }
 
+constexpr bool PeFormatIsBlockCompressed(::PeFormat format)
+{
+    return (format >= PE_FORMAT_BC1_RGBA_UNORM && format <= PE_FORMAT_BC7_SRGB) ||
+           format == PE_FORMAT_ASTC_4x4_UNORM || format == PE_FORMAT_ASTC_4x4_SRGB;
+}
+
+// Bytes per texel, or per 4x4 block for BC and ASTC formats
+constexpr uint32_t PeFormatBlockSize(::PeFormat format)
+{
+    switch (format)
+    {
+    case PE_FORMAT_R8_UNORM:
+    case PE_FORMAT_R8_SNORM:
+    case PE_FORMAT_R8_SINT:
+    case PE_FORMAT_R8_UINT:
+    case PE_FORMAT_S8_UINT:
+        return 1;
+    case PE_FORMAT_R16_SFLOAT:
+    case PE_FORMAT_R16_UNORM:
+    case PE_FORMAT_R16_SNORM:
+    case PE_FORMAT_R16_SINT:
+    case PE_FORMAT_R16_UINT:
+    case PE_FORMAT_R8G8_UNORM:
+    case PE_FORMAT_R8G8_SNORM:
+    case PE_FORMAT_R8G8_UINT:
+    case PE_FORMAT_R8G8_SINT:
+    case PE_FORMAT_D16_UNORM:
+        return 2;
+    case PE_FORMAT_R16G16B16_SFLOAT:
+    case PE_FORMAT_R16G16B16_SINT:
+    case PE_FORMAT_R16G16B16_UINT:
+        return 6;
+    case PE_FORMAT_R32G32_SFLOAT:
+    case PE_FORMAT_R32G32_SINT:
+    case PE_FORMAT_R32G32_UINT:
+    case PE_FORMAT_R16G16B16A16_SFLOAT:
+    case PE_FORMAT_R16G16B16A16_UNORM:
+    case PE_FORMAT_R16G16B16A16_SNORM:
+    case PE_FORMAT_R16G16B16A16_UINT:
+    case PE_FORMAT_R16G16B16A16_SINT:
+    case PE_FORMAT_D32_SFLOAT_S8_UINT:
+    case PE_FORMAT_BC1_RGBA_UNORM:
+    case PE_FORMAT_BC1_RGBA_SRGB:
+    case PE_FORMAT_BC4_UNORM:
+    case PE_FORMAT_BC4_SNORM:
+        return 8;
+    case PE_FORMAT_R32G32B32_SFLOAT:
+    case PE_FORMAT_R32G32B32_SINT:
+    case PE_FORMAT_R32G32B32_UINT:
+        return 12;
+    case PE_FORMAT_R32G32B32A32_SFLOAT:
+    case PE_FORMAT_R32G32B32A32_SINT:
+    case PE_FORMAT_R32G32B32A32_UINT:
+    case PE_FORMAT_BC2_UNORM:
+    case PE_FORMAT_BC2_SRGB:
+    case PE_FORMAT_BC3_UNORM:
+    case PE_FORMAT_BC3_SRGB:
+    case PE_FORMAT_BC5_UNORM:
+    case PE_FORMAT_BC5_SNORM:
+    case PE_FORMAT_BC6H_UFLOAT:
+    case PE_FORMAT_BC6H_SFLOAT:
+    case PE_FORMAT_BC7_UNORM:
+    case PE_FORMAT_BC7_SRGB:
+    case PE_FORMAT_ASTC_4x4_UNORM:
+    case PE_FORMAT_ASTC_4x4_SRGB:
+        return 16;
+    case PE_FORMAT_UNDEFINED:
+    case PE_FORMAT_COUNT:
+        return 0;
+    default:
+        return 4;
+    }
+}
+
 enum PeImageLayout : uint32_t
 {
     PE_IMAGE_LAYOUT_UNDEFINED = 0,
@@ -18,6 +18,7 @@ namespace pe
             switch (api)
             {
             case PE_GRAPHICS_API_VULKAN:
+            case PE_GRAPHICS_API_NULL:
                 PopulateReflectionFromSpirv(reflection, shader);
                 return;
             case PE_GRAPHICS_API_DX12:
@@ -1,8 +1,22 @@
 #include "RenderGraph.h"
 #include "API/Command.h"
+#include "API/RHI.h"
 
 namespace pe
 {
+    namespace
+    {
+        uint64_t AlignUp(uint64_t value, uint64_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        double ToMB(uint64_t bytes)
+        {
+            return static_cast<double>(bytes) / (1024.0 * 1024.0);
+        }
+    } // namespace
+
     RGBuilder::RGBuilder()
     {
         m_inputs.reserve(16);
@@ -89,10 +103,17 @@ namespace pe
         m_outputs.push_back(info);
     }
 
+    void RGBuilder::Transient(Image *image)
+    {
+        if (image)
+            m_transients.push_back(image);
+    }
+
     void RGBuilder::Reset()
     {
         m_inputs.clear();
         m_outputs.clear();
+        m_transients.clear();
     }
 
     void RenderGraph::AddPass(PassID id, uint32_t order, std::string name, std::function<bool()> condition, IRenderPassComponent *component)
@@ -119,15 +140,33 @@ namespace pe
 
         m_passIO.assign(m_passes.size(), {});
         m_dependencies.assign(m_passes.size(), {});
+        m_compiledEnabled.assign(m_passes.size(), false);
+        m_lifetimeOrder.clear();
+        m_lifetimes.clear();
 
         std::unordered_map<Image *, size_t> lastWriter;
         std::unordered_set<Image *> seen;
 
+        auto touch = [this](Image *image, size_t pass, bool defines)
+        {
+            const uint32_t index = static_cast<uint32_t>(pass);
+            auto [it, inserted] = m_lifetimes.try_emplace(image, Lifetime{index, index, false, defines});
+            if (inserted)
+            {
+                m_lifetimeOrder.push_back(image);
+                return;
+            }
+            it->second.lastPass = index;
+            if (it->second.firstPass == index)
+                it->second.definedAtFirst |= defines;
+        };
+
         for (size_t i = 0; i < m_passes.size(); i++)
         {
             auto &pass = m_passes[i];
             if (!pass.component || !pass.condition())
                 continue;
+            m_compiledEnabled[i] = true;
 
             m_builderScratch.Reset();
             pass.component->DeclareInputs(m_builderScratch);
@@ -179,14 +218,273 @@ namespace pe
 
             for (auto *img : io.outputs)
                 lastWriter[img] = i;
+
+            for (auto &input : m_builderScratch.m_inputs)
+            {
+                if (input.image)
+                    touch(input.image, i, !IsReadOnlyAccess(input.accessMask));
+            }
+            for (auto &output : m_builderScratch.m_outputs)
+            {
+                if (output.image)
+                    touch(output.image, i, true);
+            }
+            for (Image *image : m_builderScratch.m_transients)
+            {
+                touch(image, i, true);
+                m_lifetimes[image].transient = true;
+            }
+        }
+
+        PlanAliasing();
+    }
+
+    void RenderGraph::PlanAliasing()
+    {
+        m_aliasing = {};
+        m_aliasingRequirements = {};
+        m_aliasStarts.clear();
+        m_aliasOverlaps.clear();
+
+        struct Candidate
+        {
+            Image *image;
+            ImageMemoryRequirements requirements;
+            const Lifetime *lifetime;
+        };
+        std::vector<Candidate> candidates;
+        for (Image *image : m_lifetimeOrder)
+        {
+            const Lifetime &lifetime = m_lifetimes[image];
+            if (!lifetime.transient)
+                continue;
+
+            // Whatever the first pass reads would be another transient's leftovers
+            if (!lifetime.definedAtFirst)
+            {
+                PE_WARN("[RenderGraph] transient '%s' is read before a pass of the graph writes it, not aliasing it", image->GetName().c_str());
+                continue;
+            }
+            // Another graph placed it, and that graph's plan relies on its offset
+            if (image->GetHeap() && image->GetHeap() != m_heap && !image->GetHeap()->IsReleased())
+                continue;
+
+            candidates.push_back({image, image->GetMemoryRequirements(), &lifetime});
+        }
+
+        // Largest first, first fit: each image takes the lowest offset not used by an image whose
+        // lifetime overlaps its own
+        std::stable_sort(candidates.begin(), candidates.end(),
+                         [](const Candidate &a, const Candidate &b)
+                         { return a.requirements.size > b.requirements.size; });
+
+        uint32_t memoryTypeBits = ~0u;
+        uint64_t alignment = 1;
+        std::vector<const AliasingEntry *> live;
+        for (const Candidate &candidate : candidates)
+        {
+            const ImageMemoryRequirements &req = candidate.requirements;
+            if (!(req.memoryTypeBits & memoryTypeBits))
+                continue;
+
+            live.clear();
+            for (const AliasingEntry &entry : m_aliasing.entries)
+            {
+                if (entry.firstPass <= candidate.lifetime->lastPass && candidate.lifetime->firstPass <= entry.lastPass)
+                    live.push_back(&entry);
+            }
+            std::sort(live.begin(), live.end(),
+                      [](const AliasingEntry *a, const AliasingEntry *b)
+                      { return a->offset < b->offset; });
+
+            uint64_t offset = 0;
+            for (const AliasingEntry *entry : live)
+            {
+                if (AlignUp(offset, req.alignment) + req.size <= entry->offset)
+                    break;
+                offset = std::max(offset, entry->offset + entry->size);
+            }
+            offset = AlignUp(offset, req.alignment);
+
+            m_aliasing.entries.push_back({candidate.image, offset, req.size, candidate.lifetime->firstPass, candidate.lifetime->lastPass});
+            m_aliasing.naiveBytes += req.size;
+            m_aliasing.peakBytes = std::max(m_aliasing.peakBytes, offset + req.size);
+            memoryTypeBits &= req.memoryTypeBits;
+            alignment = std::max(alignment, req.alignment);
+        }
+
+        m_aliasingRequirements = {m_aliasing.peakBytes, alignment, memoryTypeBits};
+        if (!m_aliasing.entries.empty())
+        {
+            PE_INFO("[RenderGraph] %zu transient images alias into %.1f MB instead of %.1f MB",
+                    m_aliasing.entries.size(), ToMB(m_aliasing.peakBytes), ToMB(m_aliasing.naiveBytes));
+        }
+    }
+
+    bool RenderGraph::ApplyAliasing()
+    {
+        // A cleared graph keeps its heap until a Compile plans it again
+        if (m_passes.empty())
+            return false;
+
+        // Only worth a heap when some images actually share bytes
+        const bool wantHeap = m_aliasing.peakBytes < m_aliasing.naiveBytes;
+        const bool heapFits = m_heap &&
+                              m_heap->GetSize() >= m_aliasingRequirements.size &&
+                              (m_heap->GetMemoryTypeBits() & m_aliasingRequirements.memoryTypeBits);
+
+        std::unordered_set<Image *> planned;
+        bool changed = wantHeap ? !heapFits : !!m_heap;
+        if (wantHeap)
+        {
+            for (const AliasingEntry &entry : m_aliasing.entries)
+            {
+                planned.insert(entry.image);
+                changed |= entry.image->GetHeap() != m_heap || entry.image->GetHeapOffset() != entry.offset;
+            }
+        }
+        for (Image *image : m_lifetimeOrder)
+            changed |= m_heap && image->GetHeap() == m_heap && !planned.count(image);
+
+        if (!changed)
+        {
+            BuildAliasingBarriers();
+            return false;
+        }
+
+        ImageHeap *heap = m_heap;
+        if (wantHeap && !heapFits)
+        {
+            heap = ImageHeap::Create(m_aliasingRequirements, "RenderGraphTransients");
+            // The backend cannot place images: the plan stays a report
+            if (!heap && !m_heap)
+                return false;
+        }
+        if (!wantHeap)
+            heap = nullptr;
+
+        RHII.WaitDeviceIdle();
+
+        // Images of the old heap that the plan no longer covers move to memory of their own. Images no
+        // enabled pass declared are left alone: they are unused and may already be destroyed.
+        for (Image *image : m_lifetimeOrder)
+        {
+            if (m_heap && image->GetHeap() == m_heap && (!heap || !planned.count(image)))
+                image->PlaceInHeap(nullptr, 0);
+        }
+
+        if (heap)
+        {
+            for (size_t i = 0; i < m_aliasing.entries.size();)
+            {
+                Image *image = m_aliasing.entries[i].image;
+                if (image->PlaceInHeap(heap, m_aliasing.entries[i].offset))
+                {
+                    ++i;
+                    continue;
+                }
+
+                PE_WARN("[RenderGraph] could not place transient '%s', it keeps its own memory", image->GetName().c_str());
+                image->PlaceInHeap(nullptr, 0);
+                m_aliasing.entries.erase(m_aliasing.entries.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+
+        if (heap != m_heap)
+        {
+            ImageHeap::Destroy(m_heap);
+            m_heap = heap;
+        }
+
+        BuildAliasingBarriers();
+        return true;
+    }
+
+    void RenderGraph::ReleaseAliasing()
+    {
+        ImageHeap::Destroy(m_heap);
+        m_aliasing = {};
+        m_aliasingRequirements = {};
+        m_lifetimeOrder.clear();
+        m_lifetimes.clear();
+        m_aliasStarts.clear();
+        m_aliasOverlaps.clear();
+    }
+
+    bool RenderGraph::PassStatesChanged() const
+    {
+        for (size_t i = 0; i < m_passes.size() && i < m_compiledEnabled.size(); i++)
+        {
+            const Pass &pass = m_passes[i];
+            if (pass.component && pass.condition() != m_compiledEnabled[i])
+                return true;
+        }
+        return false;
+    }
+
+    void RenderGraph::BuildAliasingBarriers()
+    {
+        m_aliasStarts.assign(m_passes.size(), {});
+        m_aliasOverlaps.assign(m_aliasing.entries.size(), {});
+        if (!m_heap)
+            return;
+
+        const std::vector<AliasingEntry> &entries = m_aliasing.entries;
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            if (entries[i].image->GetHeap() != m_heap)
+                continue;
+
+            for (size_t j = 0; j < entries.size(); j++)
+            {
+                if (i != j &&
+                    entries[j].image->GetHeap() == m_heap &&
+                    entries[i].offset < entries[j].offset + entries[j].size &&
+                    entries[j].offset < entries[i].offset + entries[i].size)
+                    m_aliasOverlaps[i].push_back(j);
+            }
+            if (!m_aliasOverlaps[i].empty())
+                m_aliasStarts[entries[i].firstPass].push_back(i);
         }
     }
 
-    void RenderGraph::ExecuteSinglePass(CommandBuffer *cmd, Pass &pass, RGBuilder &builder)
+    void RenderGraph::DiscardAliases(size_t passIndex)
     {
+        // The image takes over bytes its aliases used earlier in the frame (or late in the last one).
+        // Tracking it as UNDEFINED with their last stages and accesses makes the pass's first barrier
+        // on it discard the old contents and wait for those uses to finish.
+        for (size_t index : m_aliasStarts[passIndex])
+        {
+            Image *image = m_aliasing.entries[index].image;
+            ImageTrackInfo info{};
+            info.image = image;
+            info.layout = PE_IMAGE_LAYOUT_UNDEFINED;
+            for (size_t overlap : m_aliasOverlaps[index])
+            {
+                Image *alias = m_aliasing.entries[overlap].image;
+                for (uint32_t layer = 0; layer < alias->GetArrayLayers(); layer++)
+                {
+                    for (uint32_t mip = 0; mip < alias->GetMipLevels(); mip++)
+                    {
+                        const ImageTrackInfo &aliasInfo = alias->GetCurrentInfo(layer, mip);
+                        info.stageFlags |= aliasInfo.stageFlags;
+                        info.accessMask |= aliasInfo.accessMask;
+                    }
+                }
+            }
+            image->SetCurrentInfoAll(info);
+        }
+    }
+
+    void RenderGraph::ExecuteSinglePass(CommandBuffer *cmd, size_t passIndex, RGBuilder &builder)
+    {
+        Pass &pass = m_passes[passIndex];
         if (!pass.condition())
             return;
 
+        if (passIndex < m_aliasStarts.size() && !m_aliasStarts[passIndex].empty())
+            DiscardAliases(passIndex);
+
         // RAII scopes: both our profiler and Tracy end automatically on early returns
         CpuProfileScope peScope(pass.name.c_str());
 #ifdef PE_TRACY
@@ -253,8 +551,14 @@ namespace pe
 
     void RenderGraph::Execute(CommandBuffer *cmd)
     {
-        for (auto &pass : m_passes)
-            ExecuteSinglePass(cmd, pass, m_builderScratch);
+        for (size_t i = 0; i < m_passes.size(); i++)
+            ExecuteSinglePass(cmd, i, m_builderScratch);
+
+        if (!m_aliasing.entries.empty())
+        {
+            PE_PROFILE_COUNTER("RG Transient Naive Bytes", m_aliasing.naiveBytes);
+            PE_PROFILE_COUNTER("RG Transient Heap Bytes", m_heap ? m_heap->GetSize() : 0);
+        }
     }
 
     size_t RenderGraph::FindPassIndex(PassID passID) const
@@ -274,5 +578,11 @@ namespace pe
         m_passIndex.clear();
         m_passIO.clear();
         m_dependencies.clear();
+        m_compiledEnabled.clear();
+        m_lifetimeOrder.clear();
+        m_lifetimes.clear();
+        m_aliasing = {};
+        m_aliasStarts.clear();
+        m_aliasOverlaps.clear();
     }
 } // namespace pe
@@ -37,6 +37,10 @@ namespace pe
         void OutputDepth(Image *image);
         void OutputCustom(Image *image, PeImageLayout layout, PeBarrierSync stage, PeBarrierAccess access);
 
+        // The image's contents never need to outlive the passes of this graph that use it, so its
+        // memory can be shared with transients used at other times. Records no barrier.
+        void Transient(Image *image);
+
         void Reset();
 
     private:
@@ -44,6 +48,7 @@ namespace pe
 
         std::vector<InputInfo> m_inputs;
         std::vector<OutputInfo> m_outputs;
+        std::vector<Image *> m_transients;
     };
 
     class RenderGraph
@@ -68,21 +73,70 @@ namespace pe
             std::vector<Image *> outputs;
         };
 
+        struct AliasingEntry
+        {
+            Image *image;
+            uint64_t offset; // into the shared heap
+            uint64_t size;
+            uint32_t firstPass; // lifetime, as indices into the compiled pass order
+            uint32_t lastPass;
+        };
+
+        struct AliasingReport
+        {
+            uint64_t naiveBytes = 0; // every transient in memory of its own
+            uint64_t peakBytes = 0;  // the shared heap the plan needs
+            std::vector<AliasingEntry> entries;
+        };
+
         void AddPass(PassID id, uint32_t order, std::string name, std::function<bool()> condition, IRenderPassComponent *component);
         void AddPass(PassID id, uint32_t order, std::string name, std::function<bool()> condition, PassCallback callback);
         void Compile();
         void Execute(CommandBuffer *cmd);
         bool ContainsPass(PassID passID) const;
+        // Keeps the transient heap, the next Compile and ApplyAliasing decide what stays in it
         void Clear();
 
+        // Places the transients Compile planned in a shared heap. When anything has to move, it idles
+        // the device first and returns true: the transients' views were recreated, so descriptor sets
+        // holding them must be updated. Backends that cannot place images keep the plan as a report.
+        bool ApplyAliasing();
+        // Drops the graph's heap and the plan. Images still placed in it keep the memory until they are
+        // destroyed. Call before passes destroy or recreate their images: the plan points at them, so
+        // the graph must be compiled again before the next Execute.
+        void ReleaseAliasing();
+        // Whether a pass condition flipped since Compile, which leaves the planned lifetimes stale
+        bool PassStatesChanged() const;
+        const AliasingReport &GetAliasingReport() const { return m_aliasing; }
+
     private:
         size_t FindPassIndex(PassID passID) const;
-        void ExecuteSinglePass(CommandBuffer *cmd, Pass &pass, RGBuilder &builder);
+        void ExecuteSinglePass(CommandBuffer *cmd, size_t passIndex, RGBuilder &builder);
+        void PlanAliasing();
+        void BuildAliasingBarriers();
+        void DiscardAliases(size_t passIndex);
 
         std::vector<Pass> m_passes;
         std::unordered_map<PassID, size_t> m_passIndex;
         std::vector<PassIO> m_passIO;
         std::vector<std::vector<size_t>> m_dependencies;
         RGBuilder m_builderScratch;
+
+        struct Lifetime
+        {
+            uint32_t firstPass;
+            uint32_t lastPass;
+            bool transient;
+            bool definedAtFirst; // written or declared transient by its first pass
+        };
+
+        std::vector<bool> m_compiledEnabled;              // condition() of each pass when compiled
+        std::vector<Image *> m_lifetimeOrder;             // images of enabled passes, by first use
+        std::unordered_map<Image *, Lifetime> m_lifetimes;
+        AliasingReport m_aliasing;
+        ImageMemoryRequirements m_aliasingRequirements{}; // what the heap for the plan must satisfy
+        ImageHeap *m_heap = nullptr;
+        std::vector<std::vector<size_t>> m_aliasStarts;   // per pass: entries whose memory another entry used before
+        std::vector<std::vector<size_t>> m_aliasOverlaps; // per entry: entries sharing some of its bytes
     };
 } // namespace pe
@@ -1,5 +1,6 @@
 #include "API/RenderPass_Internal.h"
 #include "API/Command.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanRenderPassImpl.h"
 #if defined(PE_WIN32)
@@ -15,6 +16,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanRenderPassImpl(owner, count, attachments, name);
+        case PE_GRAPHICS_API_NULL:
+            return new NullRenderPassImpl();
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12RenderPassImpl(owner, count, attachments, name);
@@ -32,7 +35,7 @@ namespace pe
     {
         RenderPass *rp = new RenderPass(count, attachments, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(RenderPass), reinterpret_cast<void *>(rp));
+        PeTracker::Track(rp);
 #endif
         return rp;
     }
@@ -42,7 +45,7 @@ namespace pe
         if (rp)
         {
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(RenderPass), reinterpret_cast<void *>(rp));
+            PeTracker::Untrack(rp);
 #endif
             delete rp;
             rp = nullptr;
@@ -52,12 +55,7 @@ namespace pe
     std::vector<RenderPass *> RenderPass::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(RenderPass));
-        std::vector<RenderPass *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<RenderPass *>(p));
-        return out;
+        return PeTracker::GetHandles<RenderPass>();
 #else
         return {};
 #endif
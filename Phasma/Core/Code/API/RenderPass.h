@@ -5,7 +5,7 @@ namespace pe
     class Image;
     struct Attachment;
 
-    class RenderPass : public NoCopy
+    class RenderPass : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
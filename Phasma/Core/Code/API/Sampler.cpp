@@ -1,4 +1,5 @@
 #include "API/Sampler_Internal.h"
+#include "API/Null/NullResourceImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanSamplerImpl.h"
 #if defined(PE_WIN32)
@@ -13,6 +14,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanSamplerImpl(owner, desc);
+        case PE_GRAPHICS_API_NULL:
+            return new NullSamplerImpl();
 #if defined(PE_WIN32)
         case PE_GRAPHICS_API_DX12:
             return new Dx12SamplerImpl(owner, desc);
@@ -27,7 +30,7 @@ namespace pe
     {
         Sampler *sampler = new Sampler(desc, name);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Sampler), reinterpret_cast<void *>(sampler));
+        PeTracker::Track(sampler);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Sampler created (Handle: %p)", reinterpret_cast<void *>(sampler));
 #endif
@@ -42,10 +45,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object Sampler destroyed (Handle: %p)", reinterpret_cast<void *>(sampler));
 #endif
-            delete sampler;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Sampler), reinterpret_cast<void *>(sampler));
+            PeTracker::Untrack(sampler);
 #endif
+            delete sampler;
             sampler = nullptr;
         }
     }
@@ -53,12 +56,7 @@ namespace pe
     std::vector<Sampler *> Sampler::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Sampler));
-        std::vector<Sampler *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Sampler *>(p));
-        return out;
+        return PeTracker::GetHandles<Sampler>();
 #else
         return {};
 #endif
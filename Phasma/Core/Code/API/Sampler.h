@@ -23,7 +23,7 @@ namespace pe
         bool unnormalizedCoordinates = false;
     };
 
-    class Sampler : public NoCopy
+    class Sampler : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -1,4 +1,5 @@
 #include "API/Semaphore_Internal.h"
+#include "API/Null/NullSyncImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanSemaphoreImpl.h"
 #if defined(PE_WIN32)
@@ -9,6 +10,9 @@ namespace pe
 {
     Semaphore::Impl *CreateSemaphoreImpl(Semaphore *owner, bool timeline, const std::string &name)
     {
+        if (RHII.GetApi() == PE_GRAPHICS_API_NULL)
+            return new NullSemaphoreImpl(owner, timeline);
+
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
         {
 #if defined(PE_WIN32)
@@ -21,6 +21,7 @@ namespace pe
 
     private:
         friend struct VulkanSemaphoreImpl;
+        friend struct NullSemaphoreImpl;
 #if defined(PE_WIN32)
         friend struct Dx12SemaphoreImpl;
 #endif
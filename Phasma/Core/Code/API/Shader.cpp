@@ -7,6 +7,7 @@
 #if defined(PE_WIN32)
 #include "API/DX12/Dx12ShaderImpl.h"
 #endif
+#include <charconv>
 
 namespace pe
 {
@@ -84,6 +85,161 @@ namespace pe
         {
             PE_ERROR_IF(shader->GetShaderStage() != expectedStage, "Invalid shader stage");
         }
+
+        std::string CanonicalShaderPath(const std::string &sourcePath)
+        {
+            std::error_code ec;
+            return std::filesystem::weakly_canonical(sourcePath, ec).generic_string();
+        }
+
+        size_t HashDefines(const std::vector<Define> &globalDefines, const ShaderDesc &desc)
+        {
+            Hash definesHash;
+            for (const Define &def : globalDefines)
+            {
+                definesHash.CombineString(def.name);
+                definesHash.CombineString(def.value);
+            }
+            for (const Define &def : desc.defines)
+            {
+                definesHash.CombineString(def.name);
+                definesHash.CombineString(def.value);
+            }
+            definesHash.CombineValue(static_cast<uint32_t>(desc.stage));
+            return definesHash;
+        }
+
+        void PushCompileShadersEvent(size_t fileEvent)
+        {
+            EventSystem::PushEvent(EventType::CompileShaders, fileEvent);
+        }
+
+        // ShaderCache/shaders.list: one line per distinct ShaderDesc ever created,
+        // "stage<TAB>type<TAB>entry<TAB>path[<TAB>name=value]*". The next startup compiles the cache
+        // misses among them in parallel before the passes create their shaders one by one.
+        // ponytail: the list only grows; entries whose source is gone are skipped, never pruned.
+        class RecordedShaders
+        {
+        public:
+            static RecordedShaders &Get()
+            {
+                static RecordedShaders s_recorded;
+                return s_recorded;
+            }
+
+            std::vector<ShaderDesc> Load()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                LoadLocked();
+
+                std::vector<ShaderDesc> descs;
+                descs.reserve(m_lines.size());
+                for (const std::string &line : m_lines)
+                {
+                    ShaderDesc desc;
+                    if (Parse(line, desc))
+                        descs.push_back(std::move(desc));
+                }
+                return descs;
+            }
+
+            void Record(const ShaderDesc &desc, const std::string &canonicalPath)
+            {
+                std::string line = std::to_string(desc.stage);
+                line += '\t';
+                line += std::to_string(static_cast<uint32_t>(desc.type));
+                line += '\t';
+                line += desc.entryPoint;
+                line += '\t';
+                line += canonicalPath;
+                for (const Define &def : desc.defines)
+                {
+                    line += '\t';
+                    line += def.name;
+                    line += '=';
+                    line += def.value;
+                }
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                LoadLocked();
+                if (!m_lines.insert(line).second)
+                    return;
+
+                const std::string path = ListPath();
+                std::error_code ec;
+                std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+                FileSystem file(path, std::ios::out | std::ios::app | std::ios::binary);
+                if (file.IsOpen())
+                    file.Write(line + '\n');
+            }
+
+        private:
+            static std::string ListPath()
+            {
+                return Path::Root + "ShaderCache/shaders.list";
+            }
+
+            void LoadLocked()
+            {
+                if (m_loaded)
+                    return;
+                m_loaded = true;
+
+                const FileView file(ListPath());
+                if (!file.IsOpen())
+                    return;
+
+                const std::string_view text = file.Text();
+                for (size_t lineStart = 0; lineStart < text.size();)
+                {
+                    size_t lineEnd = text.find('\n', lineStart);
+                    if (lineEnd == std::string_view::npos)
+                        lineEnd = text.size();
+                    if (lineEnd > lineStart)
+                        m_lines.emplace(text.substr(lineStart, lineEnd - lineStart));
+                    lineStart = lineEnd + 1;
+                }
+            }
+
+            static bool Parse(std::string_view line, ShaderDesc &desc)
+            {
+                std::vector<std::string_view> fields;
+                for (size_t start = 0; start <= line.size();)
+                {
+                    size_t end = line.find('\t', start);
+                    if (end == std::string_view::npos)
+                        end = line.size();
+                    fields.push_back(line.substr(start, end - start));
+                    start = end + 1;
+                }
+                if (fields.size() < 4 || fields[2].empty() || fields[3].empty())
+                    return false;
+
+                uint32_t stage = 0;
+                uint32_t type = 0;
+                if (std::from_chars(fields[0].data(), fields[0].data() + fields[0].size(), stage).ec != std::errc() ||
+                    std::from_chars(fields[1].data(), fields[1].data() + fields[1].size(), type).ec != std::errc() ||
+                    type > static_cast<uint32_t>(ShaderCodeType::GLSL))
+                    return false;
+
+                desc.stage = static_cast<PeShaderStageFlags>(stage);
+                desc.type = static_cast<ShaderCodeType>(type);
+                desc.entryPoint = std::string(fields[2]);
+                desc.sourcePath = std::string(fields[3]);
+                for (size_t i = 4; i < fields.size(); ++i)
+                {
+                    const size_t eq = fields[i].find('=');
+                    if (eq == std::string_view::npos)
+                        return false;
+                    desc.defines.push_back({std::string(fields[i].substr(0, eq)), std::string(fields[i].substr(eq + 1))});
+                }
+                return true;
+            }
+
+            std::mutex m_mutex;
+            bool m_loaded = false;
+            std::unordered_set<std::string> m_lines;
+        };
     } // namespace
 
     Shader::Impl *CreateShaderImpl(Shader *owner, const ShaderDesc &desc, bool needsCompile)
@@ -118,37 +274,29 @@ namespace pe
 
     Shader *Shader::Create(const ShaderDesc &desc)
     {
+        PE_PROFILE_SCOPE("Shader::Create");
+        Timer timer;
+
         Shader *shader = new Shader();
         shader->m_entryName = desc.entryPoint;
         shader->m_stage = desc.stage;
         shader->m_localDefines = desc.defines;
         shader->m_type = desc.type;
 
-        std::error_code ec;
-        const std::string path = std::filesystem::weakly_canonical(desc.sourcePath, ec).generic_string();
+        const std::string path = CanonicalShaderPath(desc.sourcePath);
 
         PE_ERROR_IF(!AssetFileExists(path), "[Shader] Source file does not exist: %s", desc.sourcePath.c_str());
-        if (!FileWatcher::Get(path))
-        {
-            FileWatcher::Add(path, [](size_t fileEvent)
-                             { EventSystem::PushEvent(EventType::CompileShaders, fileEvent); });
-        }
         shader->m_pathID = StringHash(path);
 
-        Hash definesHash;
-        for (const Define &def : m_globalDefines)
+        shader->m_cache.Init(path, shader->m_entryName, HashDefines(m_globalDefines, desc));
+        // Watch the includes too, so an edit to a shared header reloads every shader built from it
+        for (const std::string &file : shader->m_cache.GetFiles())
         {
-            definesHash.CombineString(def.name);
-            definesHash.CombineString(def.value);
+            if (!FileWatcher::Get(file))
+                FileWatcher::Add(file, PushCompileShadersEvent);
         }
-        for (const Define &def : desc.defines)
-        {
-            definesHash.CombineString(def.name);
-            definesHash.CombineString(def.value);
-        }
-        definesHash.CombineValue(static_cast<uint32_t>(desc.stage));
+        RecordedShaders::Get().Record(desc, path);
 
-        shader->m_cache.Init(path, shader->m_entryName, definesHash);
         const bool needsCompile = shader->m_cache.ShaderNeedsCompile();
         if (needsCompile)
         {
@@ -162,9 +310,63 @@ namespace pe
         shader->m_reflection.Init(shader);
 
         TrackedShaders().push_back(shader);
+
+        if (needsCompile)
+            PE_PROFILE_COUNTER("Shaders.Compiled", 1);
+        else
+            PE_PROFILE_COUNTER("Shaders.CacheHits", 1);
+        PE_PROFILE_COUNTER("Shaders.CreateUs", static_cast<uint64_t>(MICRO(timer.Count())));
         return shader;
     }
 
+    void Shader::PrecompileRecorded()
+    {
+        PE_PROFILE_SCOPE("Shader::PrecompileRecorded");
+        Timer timer;
+
+        const std::vector<ShaderDesc> descs = RecordedShaders::Get().Load();
+        if (descs.empty())
+            return;
+
+        // Each miss compiles on its own worker with its own DXC/shaderc instance; the cache file it
+        // writes is what the serial Shader::Create calls during pass init then read
+        std::atomic<uint32_t> compiled{0};
+        std::atomic<uint32_t> failed{0};
+        ParallelFor(static_cast<uint32_t>(descs.size()), 1, [&](uint32_t i)
+                    {
+                        const ShaderDesc &desc = descs[i];
+                        if (!AssetFileExists(desc.sourcePath))
+                            return;
+
+                        try
+                        {
+                            Shader shader;
+                            shader.m_entryName = desc.entryPoint;
+                            shader.m_stage = desc.stage;
+                            shader.m_localDefines = desc.defines;
+                            shader.m_type = desc.type;
+                            shader.m_cache.Init(desc.sourcePath, desc.entryPoint, HashDefines(m_globalDefines, desc));
+                            if (!shader.m_cache.ShaderNeedsCompile())
+                                return;
+
+                            shader.m_impl = CreateShaderImpl(&shader, desc, true);
+                            compiled.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        catch (const std::exception &e)
+                        {
+                            // Create() hits the same error again and reports it where the pass needs the shader
+                            failed.fetch_add(1, std::memory_order_relaxed);
+                            PE_WARN("[Shader] Precompile failed for '%s': %s", desc.sourcePath.c_str(), e.what());
+                        } });
+
+        const double ms = MILLI(timer.Count());
+        PE_PROFILE_COUNTER("Shaders.Precompiled", compiled.load());
+        PE_PROFILE_COUNTER("Shaders.PrecompileUs", static_cast<uint64_t>(ms * 1000.0));
+        PE_INFO("[Shader] Precompile (%s start): %zu recorded, %u compiled, %u failed in %.1f ms on %u workers",
+                compiled.load() > 0 ? "cold" : "warm", descs.size(), compiled.load(), failed.load(), ms,
+                JobSystem::Get().GetWorkerCount());
+    }
+
     Shader *Shader::CreateFromBytecode(const ShaderBytecodeDesc &desc)
     {
         Shader *shader = new Shader();
@@ -222,6 +424,11 @@ namespace pe
         return TrackedShaders();
     }
 
+    bool Shader::DependsOn(size_t fileHash) const
+    {
+        return m_pathID == fileHash || m_cache.DependsOn(fileHash);
+    }
+
     void Shader::AddGlobalDefine(const std::string &name, const std::string &value)
     {
         for (auto &def : m_globalDefines)
@@ -46,6 +46,9 @@ namespace pe
         static Shader *CreateFromBytecode(const ShaderBytecodeDesc &desc);
         static void Destroy(Shader *&shader);
         static std::vector<Shader *> GetHandles();
+        // Compiles, in parallel on the job workers, every shader earlier runs created whose bytecode is
+        // not in the cache, so startup pays the slowest compile rather than the sum of them
+        static void PrecompileRecorded();
 
         static void AddGlobalDefine(const std::string &name, const std::string &value);
         static std::vector<Descriptor *> ReflectPassDescriptors(const PassInfo &passInfo);
@@ -56,6 +59,8 @@ namespace pe
         const Reflection &GetReflection() const { return m_reflection; }
         ShaderCache &GetCache() { return m_cache; }
         size_t GetPathID() const { return m_pathID; }
+        // Whether the file behind a FileWatcher event is this shader's source or one of its includes
+        bool DependsOn(size_t fileHash) const;
         const PushConstantDesc &GetPushConstantDesc() const { return m_reflection.GetPushConstantDesc(); }
         std::vector<Define> &GetLocalDefines() { return m_localDefines; }
         const std::string &GetReflectionSource() const { return m_reflectionSource; }
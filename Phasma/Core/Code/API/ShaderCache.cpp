@@ -3,62 +3,198 @@
 
 namespace pe
 {
-    // Parse includes recursively and return the full code
-    std::string ShaderCache::ParseShader(const std::string &sourcePath)
+    // One file of the process-wide include graph: read and hashed once, shared by every shader including it
+    struct ShaderSourceFile
     {
-        PE_ERROR_IF(!AssetFileExists(sourcePath), std::string("file does not exist: " + sourcePath).c_str());
+        struct Include
+        {
+            size_t lineBegin; // the directive's line in `text`, without its '\n'
+            size_t lineEnd;
+            std::string path; // canonical
+        };
+
+        std::string path;
+        size_t pathHash = 0; // StringHash(path), the FileWatcher event for this file
+        std::string text;
+        uint64_t contentHash = 0;
+        std::vector<Include> includes; // source order
+    };
+
+    namespace
+    {
+        std::string CanonicalPath(const std::filesystem::path &path)
+        {
+            std::error_code ec;
+            return std::filesystem::weakly_canonical(path, ec).generic_string();
+        }
+
+        bool IsSpace(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        // `#include "file"`, optionally followed by a // comment; other include forms are left to the compiler
+        bool ParseIncludeDirective(std::string_view line, std::string_view &file)
+        {
+            const size_t comment = line.find("//");
+            if (comment != std::string_view::npos)
+                line = line.substr(0, comment);
+            while (!line.empty() && IsSpace(line.front()))
+                line.remove_prefix(1);
+            while (!line.empty() && IsSpace(line.back()))
+                line.remove_suffix(1);
+
+            constexpr std::string_view directive = "#include";
+            if (!line.starts_with(directive))
+                return false;
+            line.remove_prefix(directive.size());
+            while (!line.empty() && IsSpace(line.front()))
+                line.remove_prefix(1);
+
+            if (line.size() < 3 || line.front() != '"' || line.back() != '"')
+                return false;
+            file = line.substr(1, line.size() - 2);
+            return file.find('"') == std::string_view::npos;
+        }
+
+        std::shared_ptr<ShaderSourceFile> ReadSourceFile(const std::string &path, size_t pathHash)
+        {
+            PE_ERROR_IF(!AssetFileExists(path), "file does not exist: %s", path.c_str());
+            const FileView view(path);
+            PE_ERROR_IF(!view.IsOpen(), "file could not be opened: %s", path.c_str());
+
+            auto file = std::make_shared<ShaderSourceFile>();
+            file->path = path;
+            file->pathHash = pathHash;
+            file->text = std::string(view.Text());
+            file->contentHash = XxHash64(file->text.data(), file->text.size());
 
-        std::filesystem::path path(sourcePath);
-        FileSystem file(path.string(), std::ios::in | std::ios::ate);
-        PE_ERROR_IF(!file.IsOpen(), "file could not be opened!");
+            // Includes resolve against the including file's directory
+            const std::filesystem::path dir = std::filesystem::path(path).parent_path();
+            const std::string_view text = file->text;
+            for (size_t lineStart = 0; lineStart < text.size();)
+            {
+                size_t lineEnd = text.find('\n', lineStart);
+                if (lineEnd == std::string_view::npos)
+                    lineEnd = text.size();
+
+                std::string_view include;
+                if (ParseIncludeDirective(text.substr(lineStart, lineEnd - lineStart), include))
+                    file->includes.push_back({lineStart, lineEnd, CanonicalPath(dir / std::string(include))});
+                lineStart = lineEnd + 1;
+            }
+
+            return file;
+        }
 
-        std::string code = file.ReadAll();
-        file.SetReadCursor(0);
-        std::string line;
-        while (!file.EndOfFile())
+        class IncludeGraph
         {
-            line = file.ReadLine();
-            if (line.empty())
-                continue;
-
-            size_t commentPos = line.find("//");
-            if (commentPos != std::string::npos)
-                line = line.substr(0, commentPos);
-
-            // Use regex to extract include filename
-            std::smatch match;
-            static const std::regex includeRegex(R"(^\s*#include\s*\"([^\"]+)\"\s*$)");
-            if (std::regex_search(line, match, includeRegex))
+        public:
+            static IncludeGraph &Get()
+            {
+                static IncludeGraph s_graph;
+                return s_graph;
+            }
+
+            // Merkle key of `path`: its content hash folded with its includes' keys in order, so an edit
+            // anywhere below changes the key. Appends every file reached to `closure` once.
+            uint64_t Key(const std::string &path, std::vector<std::shared_ptr<const ShaderSourceFile>> &closure)
+            {
+                std::vector<size_t> stack;
+                return Key(path, closure, stack);
+            }
+
+            void Invalidate(size_t pathHash)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_files.erase(pathHash);
+            }
+
+            void Clear()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_files.clear();
+            }
+
+        private:
+            std::shared_ptr<const ShaderSourceFile> Load(const std::string &path, size_t pathHash)
             {
-                std::string includeFile = match[1].str();
-                std::filesystem::path includePath = path;
-                includePath.remove_filename();
-                std::string includeFileFull = (includePath / includeFile).string();
-                size_t posStart = code.find(line);
-                if (posStart != std::string::npos)
                 {
-                    size_t posEnd = code.find("\n", posStart);
-                    if (posEnd == std::string::npos)
-                        posEnd = code.length();
-                    code.erase(posStart, posEnd - posStart);
-                    code.insert(posStart, ParseShader(includeFileFull));
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    auto it = m_files.find(pathHash);
+                    if (it != m_files.end())
+                        return it->second;
                 }
+
+                // Read outside the lock; two workers racing on one file both read it and the first insert wins
+                std::shared_ptr<const ShaderSourceFile> file = ReadSourceFile(path, pathHash);
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_files.try_emplace(pathHash, std::move(file)).first->second;
             }
-        }
 
-        return code;
-    }
+            uint64_t Key(const std::string &path,
+                         std::vector<std::shared_ptr<const ShaderSourceFile>> &closure,
+                         std::vector<size_t> &stack)
+            {
+                const size_t pathHash = StringHash(path);
+                PE_ERROR_IF(std::find(stack.begin(), stack.end(), pathHash) != stack.end(),
+                            "[Shader] Include cycle through %s", path.c_str());
+
+                std::shared_ptr<const ShaderSourceFile> file = Load(path, pathHash);
+                const auto seen = [pathHash](const auto &source)
+                { return source->pathHash == pathHash; };
+                if (std::none_of(closure.begin(), closure.end(), seen))
+                    closure.push_back(file);
+
+                Hash key(static_cast<size_t>(file->contentHash));
+                stack.push_back(pathHash);
+                for (const ShaderSourceFile::Include &include : file->includes)
+                    key.Combine(static_cast<size_t>(Key(include.path, closure, stack)));
+                stack.pop_back();
+                return key;
+            }
+
+            std::mutex m_mutex;
+            std::unordered_map<size_t, std::shared_ptr<const ShaderSourceFile>> m_files;
+        };
+
+        // Inlines the includes from the closure captured at Init, so the text always matches the cache key
+        void ExpandSource(const ShaderSourceFile &file,
+                          const std::vector<std::shared_ptr<const ShaderSourceFile>> &closure,
+                          std::string &code)
+        {
+            size_t copied = 0;
+            for (const ShaderSourceFile::Include &include : file.includes)
+            {
+                code.append(file.text, copied, include.lineBegin - copied);
+                const size_t includeHash = StringHash(include.path);
+                for (const auto &source : closure)
+                {
+                    if (source->pathHash == includeHash)
+                    {
+                        ExpandSource(*source, closure, code);
+                        break;
+                    }
+                }
+                copied = include.lineEnd;
+            }
+            code.append(file.text, copied, std::string::npos);
+        }
+    } // namespace
 
     void ShaderCache::Init(const std::string &sourcePath, const std::string &entryPoint, size_t definesHash)
     {
         m_sourcePath = sourcePath;
-        m_code = ParseShader(m_sourcePath);
+        m_code.clear();
+        m_sources.clear();
 
-        m_hash = StringHash(m_code);
+        m_hash = Hash(static_cast<size_t>(IncludeGraph::Get().Key(m_sourcePath, m_sources)));
         m_hash.CombineString(entryPoint);
         m_hash.Combine(definesHash);
-        m_hash.CombineValue(static_cast<uint32_t>(RHII.GetApi()));
-        if (RHII.GetApi() == PE_GRAPHICS_API_VULKAN)
+        // The null backend consumes SPIR-V too, so it shares the Vulkan cache entries
+        const PeGraphicsApi bytecodeApi = RHII.GetApi() == PE_GRAPHICS_API_NULL ? PE_GRAPHICS_API_VULKAN : RHII.GetApi();
+        m_hash.CombineValue(static_cast<uint32_t>(bytecodeApi));
+        if (bytecodeApi == PE_GRAPHICS_API_VULKAN)
             m_hash.CombineValue(RHII.GetCaps().spirvTargetVulkanVersion);
         if (RHII.GetApi() == PE_GRAPHICS_API_DX12)
             m_hash.CombineValue(12u); // DX12 cache embeds readable source in a private DXIL container part.
@@ -69,6 +205,40 @@ namespace pe
         m_tempFilePath += std::to_string(m_hash);
     }
 
+    const std::string &ShaderCache::GetShaderCode()
+    {
+        if (m_code.empty() && !m_sources.empty())
+            ExpandSource(*m_sources.front(), m_sources, m_code);
+        return m_code;
+    }
+
+    std::vector<std::string> ShaderCache::GetFiles() const
+    {
+        std::vector<std::string> files;
+        files.reserve(m_sources.size());
+        for (const auto &source : m_sources)
+            files.push_back(source->path);
+        return files;
+    }
+
+    bool ShaderCache::DependsOn(size_t fileHash) const
+    {
+        for (const auto &source : m_sources)
+            if (source->pathHash == fileHash)
+                return true;
+        return false;
+    }
+
+    void ShaderCache::InvalidateFile(size_t fileHash)
+    {
+        IncludeGraph::Get().Invalidate(fileHash);
+    }
+
+    void ShaderCache::InvalidateAll()
+    {
+        IncludeGraph::Get().Clear();
+    }
+
     bool ShaderCache::ShaderNeedsCompile()
     {
         return !std::filesystem::exists(m_tempFilePath);
@@ -76,16 +246,10 @@ namespace pe
 
     std::vector<uint8_t> ShaderCache::ReadBytecodeFile()
     {
-        FileSystem file(m_tempFilePath, std::ios::in | std::ios::ate | std::ios::binary);
+        const FileView file(m_tempFilePath);
         PE_ERROR_IF(!file.IsOpen(), "failed to open file!");
 
-        std::string buffer = file.ReadAll();
-
-        std::vector<uint8_t> bytecode;
-        bytecode.resize(file.Size());
-        if (!bytecode.empty())
-            memcpy(bytecode.data(), buffer.data(), file.Size());
-        return bytecode;
+        return std::vector<uint8_t>(file.Bytes().begin(), file.Bytes().end());
     }
 
     void ShaderCache::WriteBytecodeToFile(const std::vector<uint8_t> &bytecode)
@@ -103,12 +267,13 @@ namespace pe
 
     std::vector<uint32_t> ShaderCache::ReadSpvFile()
     {
-        std::vector<uint8_t> buffer = ReadBytecodeFile();
+        const FileView file(m_tempFilePath);
+        PE_ERROR_IF(!file.IsOpen(), "failed to open file!");
 
         std::vector<uint32_t> spirv;
-        spirv.resize(buffer.size() / sizeof(uint32_t));
+        spirv.resize(file.Size() / sizeof(uint32_t));
         if (!spirv.empty())
-            memcpy(spirv.data(), buffer.data(), spirv.size() * sizeof(uint32_t));
+            memcpy(spirv.data(), file.Data(), spirv.size() * sizeof(uint32_t));
 
         return spirv;
     }
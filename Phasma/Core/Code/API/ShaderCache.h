@@ -2,29 +2,43 @@
 
 namespace pe
 {
+    struct ShaderSourceFile;
+
     class ShaderCache
     {
     public:
-        // Init() resolves #include directives in `sourcePath` and keys the on-disk cache on a hash of
-        // the resolved-source content combined with `entryPoint` and `definesHash`. The key is therefore
-        // backend-agnostic — same HLSL source produces the same key whether compiled to SPIR-V or DXIL.
+        // Init() keys the on-disk cache on the Merkle hash of `sourcePath`'s include graph (each file's
+        // content hash folded with the keys of the files it includes, in order) combined with `entryPoint`
+        // and `definesHash`. Files are read and hashed once per process and shared by every shader that
+        // includes them, so a cache hit never expands the source. The key is backend-agnostic — same HLSL
+        // source produces the same key whether compiled to SPIR-V or DXIL.
         // Callers are responsible for folding any other compile-time inputs that affect output bytecode
         // (such as shader stage) into `definesHash` before calling Init — `Shader::Create` does so for stage.
         void Init(const std::string &sourcePath, const std::string &entryPoint, size_t definesHash = 0);
         bool ShaderNeedsCompile();
         inline const std::string &GetSourcePath() { return m_sourcePath; }
-        inline const std::string &GetShaderCode() { return m_code; }
+        // Source with every #include inlined, expanded on first use (compiles and DX12 reflection)
+        const std::string &GetShaderCode();
         size_t GetHash() { return m_hash; }
+        // Canonical paths of the source and of every file it includes, transitively
+        std::vector<std::string> GetFiles() const;
+        // Whether the file with this FileWatcher event hash is the source or one of its includes
+        bool DependsOn(size_t fileHash) const;
         std::vector<uint8_t> ReadBytecodeFile();
         void WriteBytecodeToFile(const std::vector<uint8_t> &bytecode);
         std::vector<uint32_t> ReadSpvFile();
-        std::string ParseShader(const std::string &sourcePath);
         void WriteSpvToFile(const std::vector<uint32_t> &spirv);
 
+        // Drops a changed file from the include graph; `fileHash` is the FileWatcher event (StringHash of
+        // the canonical path). Shaders pick the new content up on their next Init.
+        static void InvalidateFile(size_t fileHash);
+        static void InvalidateAll();
+
     private:
         std::string m_sourcePath;
         std::string m_code;
-        StringHash m_hash;
+        Hash m_hash;
         std::string m_tempFilePath;
+        std::vector<std::shared_ptr<const ShaderSourceFile>> m_sources; // include closure, source first
     };
 } // namespace pe
@@ -5,116 +5,208 @@
 
 namespace pe
 {
-    StagingManager::~StagingManager()
+    namespace
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto &alloc : m_allocations)
+        // Ring blocks are carved by bump allocation. 512 B covers D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+        // and every Vulkan bufferOffset rule for buffer->image copies (texel/block size, 4 B), so any
+        // allocation can feed any copy.
+        constexpr size_t kStagingBlockSize = 16ull * 1024 * 1024;
+        constexpr size_t kStagingAlignment = 512;
+        constexpr size_t kRetainBudget = 128ull * 1024 * 1024;
+
+        size_t AlignUp(size_t value, size_t alignment)
         {
-            if (alloc.buffer)
-            {
-                alloc.buffer->Unmap();
-                Buffer::Destroy(alloc.buffer);
-            }
+            return (value + alignment - 1) & ~(alignment - 1);
         }
-        m_allocations.clear();
+    } // namespace
+
+    struct StagingBlock
+    {
+        Buffer *buffer = nullptr;
+        uint8_t *data = nullptr;
+        size_t capacity = 0;
+        size_t head = 0;
+        uint32_t live = 0; // allocations not yet released by SetUnused
+        uint64_t retireSerial = 0;
+        bool dedicated = false;
+    };
+
+    StagingManager::~StagingManager()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (StagingBlock *block : m_ring)
+            DestroyBlock(block);
+        for (StagingBlock *block : m_retired)
+            DestroyBlock(block);
+        m_ring.clear();
+        m_retired.clear();
+    }
+
+    StagingBlock *StagingManager::CreateBlock(size_t size, bool dedicated)
+    {
+        PE_MEMORY_TAG(Staging);
+        Buffer *buffer = Buffer::Create({
+            .size = size,
+            .usage = PE_BUFFER_USAGE_TRANSFER_SRC,
+            .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU_PERSISTENT,
+            .name = dedicated ? "StagingBuffer_Dedicated" : "StagingBuffer_Ring",
+            .concurrentQueues = true,
+        });
+        PE_ERROR_IF(!buffer, "StagingManager::Allocate(): failed to create staging buffer.");
+        buffer->Map();
+
+        StagingBlock *block = new StagingBlock();
+        block->buffer = buffer;
+        block->data = static_cast<uint8_t *>(buffer->Data());
+        block->capacity = size;
+        block->dedicated = dedicated;
+
+        m_stats.reservedBytes += size;
+        if (dedicated)
+            m_stats.dedicatedBytes += size;
+        else
+            m_stats.blockCount++;
+        return block;
+    }
+
+    void StagingManager::DestroyBlock(StagingBlock *block)
+    {
+        m_stats.reservedBytes -= block->capacity;
+        if (!block->dedicated)
+            m_stats.blockCount--;
+
+        block->buffer->Unmap();
+        Buffer::Destroy(block->buffer);
+        delete block;
     }
 
     StagingAllocation StagingManager::Allocate(size_t size)
     {
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        // Bucket the request up to a power-of-two size class (256 B floor) so the many slightly-different
-        // voxel upload sizes (8.7 KB, 11.9 KB, …) collapse onto a few shared classes. Without this the
-        // free list fragments — best-fit can't reuse a buffer that's even one byte too small, so each
-        // streaming burst created fresh buffers (Buffer::Create == a DX12 CreateCommittedResource, slow),
-        // spiking the frame. Bucketing makes reuse converge after warmup; the slack capacity is never
-        // touched (CopyBufferStaged only ever copies the real request size).
-        size_t bucket = 256;
-        while (bucket < size)
-            bucket <<= 1;
-
-        StagingAllocation *best = nullptr;
-        for (auto &allocation : m_allocations)
-        {
-            if (allocation.used || allocation.size < bucket)
-                continue;
-            if (!best || allocation.size < best->size)
-                best = &allocation;
-        }
-        if (best)
+        // Uploads are bump-allocated from a ring of large persistently mapped blocks, so the common
+        // case is an align and an add. Buffer::Create (a DX12 CreateCommittedResource) only happens
+        // when the ring has to grow, or for uploads bigger than a whole block (large textures), which
+        // get a dedicated buffer that is released kDeleteDelay submissions after its copy retires.
+        const size_t request = std::max<size_t>(size, 1);
+        StagingAllocation allocation{};
+        allocation.size = size;
+        m_stats.liveBytes += size;
+
+        if (request > kStagingBlockSize)
         {
-            best->used = bucket;
-            return *best;
+            StagingBlock *block = CreateBlock(request, true);
+            block->live = 1;
+            allocation.block = block;
+            allocation.buffer = block->buffer;
+            allocation.data = block->data;
+            PE_PROFILE_COUNTER("Staging.Dedicated", 1);
+            return allocation;
         }
 
-        StagingAllocation allocation{};
-        allocation.size = bucket;
-        allocation.used = bucket;
+        if (m_ring.empty())
+            m_ring.push_back(CreateBlock(kStagingBlockSize, false));
 
-        allocation.buffer = Buffer::Create({
-            .size = bucket,
-            .usage = PE_BUFFER_USAGE_TRANSFER_SRC,
-            .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU_PERSISTENT,
-            .name = "StagingBuffer",
-        });
-        PE_ERROR_IF(!allocation.buffer, "StagingManager::Allocate(): failed to create staging buffer.");
+        StagingBlock *block = m_ring[m_current];
+        if (block->live == 0)
+            block->head = 0;
 
-        allocation.buffer->Map();
-        allocation.data = allocation.buffer->Data();
+        size_t offset = AlignUp(block->head, kStagingAlignment);
+        if (offset + request > block->capacity)
+        {
+            // Move to the oldest block. It is free once every copy carved from it has been waited on;
+            // otherwise the ring is still in flight and grows by one block at this position.
+            const size_t next = (m_current + 1) % m_ring.size();
+            if (m_ring[next] != block && m_ring[next]->live == 0)
+            {
+                m_current = next;
+            }
+            else
+            {
+                m_current++;
+                m_ring.insert(m_ring.begin() + static_cast<std::ptrdiff_t>(m_current), CreateBlock(kStagingBlockSize, false));
+            }
 
-        m_allocations.push_back(allocation);
+            block = m_ring[m_current];
+            block->head = 0;
+            offset = 0;
+        }
+
+        block->head = offset + request;
+        block->live++;
+
+        allocation.block = block;
+        allocation.buffer = block->buffer;
+        allocation.offset = offset;
+        allocation.data = block->data + offset;
+        PE_PROFILE_COUNTER("Staging.Allocations", 1);
         return allocation;
     }
 
     void StagingManager::RemoveUnused()
     {
-        // Retain freed staging buffers under a byte budget instead of destroying them every frame.
-        // On DX12 Buffer::Create == CreateCommittedResource (an expensive heap/kernel allocation); the
-        // old per-frame teardown meant every voxel-streaming burst re-created its whole working set of
-        // staging buffers (3 per section), spiking the frame. Vulkan hid this (cheap VMA sub-alloc).
-        // Keeping the pool alive lets the next burst reuse buffers (zero creates); the budget caps VRAM
-        // so one-off large uploads (textures) still get reclaimed.
-        constexpr size_t kRetainBudget = 128ull * 1024 * 1024;
-
         std::lock_guard<std::mutex> lock(m_mutex);
 
-        size_t total = 0;
-        for (auto &alloc : m_allocations)
-            total += alloc.size;
-        if (total <= kRetainBudget)
-            return;
-
-        size_t serial = RHII.GetMainQueue()->GetSubmissionCount();
-        for (auto it = m_allocations.begin(); it != m_allocations.end() && total > kRetainBudget;)
+        const uint64_t serial = RHII.GetMainQueue()->GetSubmissionCount();
+        for (size_t i = 0; i < m_retired.size();)
         {
-            if (serial <= it->delaySerial || it->used)
+            if (serial <= m_retired[i]->retireSerial)
             {
-                ++it;
+                ++i;
                 continue;
             }
+            DestroyBlock(m_retired[i]);
+            m_retired[i] = m_retired.back();
+            m_retired.pop_back();
+        }
 
-            total -= it->size;
-            if (it->buffer)
+        // An upload burst (level load, voxel streaming) can grow the ring well past its steady state.
+        // Keep up to kRetainBudget so the next burst reuses blocks, and retire idle blocks beyond that.
+        size_t ringBytes = m_ring.size() * kStagingBlockSize;
+        for (size_t i = 0; i < m_ring.size() && ringBytes > kRetainBudget;)
+        {
+            StagingBlock *block = m_ring[i];
+            if (i == m_current || block->live != 0 || serial <= block->retireSerial)
             {
-                it->buffer->Unmap();
-                Buffer::Destroy(it->buffer);
+                ++i;
+                continue;
             }
 
-            it = m_allocations.erase(it);
+            ringBytes -= kStagingBlockSize;
+            DestroyBlock(block);
+            m_ring.erase(m_ring.begin() + static_cast<std::ptrdiff_t>(i));
+            if (i < m_current)
+                m_current--;
         }
+
+        PE_PROFILE_COUNTER("Staging.ReservedBytes", m_stats.reservedBytes);
+        PE_PROFILE_COUNTER("Staging.LiveBytes", m_stats.liveBytes);
+        PE_PROFILE_COUNTER("Staging.DedicatedBytes", m_stats.dedicatedBytes);
+        PE_PROFILE_COUNTER("Staging.Blocks", m_stats.blockCount);
     }
 
     void StagingManager::SetUnused(const StagingAllocation &allocation)
     {
+        StagingBlock *block = allocation.block;
+        if (!block)
+            return;
+
         std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto &alloc : m_allocations)
+        m_stats.liveBytes -= allocation.size;
+        if (--block->live != 0)
+            return;
+
+        block->retireSerial = RHII.GetMainQueue()->GetSubmissionCount() + kDeleteDelay;
+        if (block->dedicated)
         {
-            if (alloc.buffer == allocation.buffer)
-            {
-                alloc.used = 0;
-                alloc.delaySerial = RHII.GetMainQueue()->GetSubmissionCount() + kDeleteDelay;
-                return;
-            }
+            m_stats.dedicatedBytes -= block->capacity;
+            m_retired.push_back(block);
         }
     }
+
+    StagingStats StagingManager::GetAllocations()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
 } // namespace pe
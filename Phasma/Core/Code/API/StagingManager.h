@@ -3,16 +3,27 @@
 namespace pe
 {
     class Buffer;
+    struct StagingBlock;
 
     constexpr uint8_t kDeleteDelay = 5;
 
+    // A sub-range of a persistently mapped upload buffer. Copies must read from `buffer` at `offset`;
+    // `data` already points at that offset.
     struct StagingAllocation
     {
         Buffer *buffer = nullptr;
         void *data = nullptr;
+        size_t offset = 0;
         size_t size = 0;
-        size_t used = 0;
-        size_t delaySerial = 0;
+        StagingBlock *block = nullptr;
+    };
+
+    struct StagingStats
+    {
+        size_t reservedBytes = 0;  // ring blocks plus live dedicated buffers
+        size_t liveBytes = 0;      // requested bytes not yet released by SetUnused
+        size_t dedicatedBytes = 0; // oversized uploads that bypassed the ring
+        uint32_t blockCount = 0;
     };
 
     class StagingManager
@@ -23,10 +34,16 @@ namespace pe
         StagingAllocation Allocate(size_t size);
         void RemoveUnused();
         void SetUnused(const StagingAllocation &allocation);
-        const std::deque<StagingAllocation> &GetAllocations() { return m_allocations; }
+        StagingStats GetAllocations();
 
     private:
-        std::deque<StagingAllocation> m_allocations{};
+        StagingBlock *CreateBlock(size_t size, bool dedicated);
+        void DestroyBlock(StagingBlock *block);
+
+        std::vector<StagingBlock *> m_ring{}; // in bump order, m_ring[m_current] is being filled
+        size_t m_current = 0;
+        std::vector<StagingBlock *> m_retired{}; // released dedicated and trimmed blocks waiting out kDeleteDelay
+        StagingStats m_stats{};
         std::mutex m_mutex{};
     };
 } // namespace pe
@@ -1,4 +1,5 @@
 #include "API/Surface_Internal.h"
+#include "API/Null/NullSyncImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanSurfaceImpl.h"
 #if defined(PE_WIN32)
@@ -14,6 +15,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanSurfaceImpl(owner, window);
+        case PE_GRAPHICS_API_NULL:
+            return new NullSurfaceImpl(owner, window);
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12SurfaceImpl(owner, window);
@@ -31,7 +34,7 @@ namespace pe
     {
         Surface *s = new Surface(window);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Surface), reinterpret_cast<void *>(s));
+        PeTracker::Track(s);
 #endif
         return s;
     }
@@ -41,7 +44,7 @@ namespace pe
         if (s)
         {
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Surface), reinterpret_cast<void *>(s));
+            PeTracker::Untrack(s);
 #endif
             delete s;
             s = nullptr;
@@ -51,12 +54,7 @@ namespace pe
     std::vector<Surface *> Surface::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Surface));
-        std::vector<Surface *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Surface *>(p));
-        return out;
+        return PeTracker::GetHandles<Surface>();
 #else
         return {};
 #endif
@@ -6,7 +6,7 @@ namespace pe
 {
     class Context;
 
-    class Surface : public NoCopy
+    class Surface : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -34,6 +34,7 @@ namespace pe
 
     private:
         friend struct VulkanSurfaceImpl;
+        friend struct NullSurfaceImpl;
 #if defined(PE_WIN32)
         friend class Dx12SwapchainImpl;
         friend struct Dx12SurfaceImpl;
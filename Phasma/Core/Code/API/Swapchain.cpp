@@ -1,5 +1,6 @@
 #include "API/Swapchain_Internal.h"
 #include "API/Image.h"
+#include "API/Null/NullSyncImpl.h"
 #include "API/RHI.h"
 #include "API/Vulkan/VulkanSwapchainImpl.h"
 #if defined(PE_WIN32)
@@ -15,6 +16,8 @@ namespace pe
         {
         case PE_GRAPHICS_API_VULKAN:
             return new VulkanSwapchainImpl(owner, desc);
+        case PE_GRAPHICS_API_NULL:
+            return new NullSwapchainImpl(owner, desc);
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
             return new Dx12SwapchainImpl(owner, desc);
@@ -32,7 +35,7 @@ namespace pe
     {
         Swapchain *sc = new Swapchain(desc);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(Swapchain), reinterpret_cast<void *>(sc));
+        PeTracker::Track(sc);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object Swapchain created (Handle: %p)", reinterpret_cast<void *>(sc));
 #endif
@@ -47,10 +50,10 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES) && !defined(PE_TRACK_RESOURCES_NOSPAM)
             PE_INFO("Object Swapchain destroyed (Handle: %p)", reinterpret_cast<void *>(sc));
 #endif
-            delete sc;
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Untrack(typeid(Swapchain), reinterpret_cast<void *>(sc));
+            PeTracker::Untrack(sc);
 #endif
+            delete sc;
             sc = nullptr;
         }
     }
@@ -58,12 +61,7 @@ namespace pe
     std::vector<Swapchain *> Swapchain::GetHandles()
     {
 #if defined(PE_TRACK_RESOURCES)
-        auto ptrs = PeTracker::GetHandles(typeid(Swapchain));
-        std::vector<Swapchain *> out;
-        out.reserve(ptrs.size());
-        for (void *p : ptrs)
-            out.push_back(static_cast<Swapchain *>(p));
-        return out;
+        return PeTracker::GetHandles<Swapchain>();
 #else
         return {};
 #endif
@@ -26,7 +26,7 @@ namespace pe
         std::string name;
     };
 
-    class Swapchain : public NoCopy
+    class Swapchain : public NoCopy, public PeTracked
     {
     public:
         struct Impl;
@@ -46,6 +46,7 @@ namespace pe
 
     private:
         friend struct VulkanSwapchainImpl;
+        friend struct NullSwapchainImpl;
 #if defined(PE_WIN32)
         friend class Dx12RhiImpl;
         friend class Dx12SwapchainImpl;
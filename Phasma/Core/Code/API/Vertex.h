@@ -29,6 +29,23 @@ namespace pe
         float weights[4];
     };
 
+    // Packed vertex (40 B) for cooked meshes, fetched by the depth, shadow and GBuffer VS in place of
+    // both Vertex and PositionUvVertex. Layout — MUST match Common/VertexFetch.hlsl decode:
+    //   position: float3, uv: half2, normal/tangent: octahedral snorm16x2 (bit 0 of tangent[1] is the
+    //   bitangent sign, 1 = -1), color: unorm8x4, joints: u8x4, weights: unorm16x4
+    // Positions stay float so physics, LOD simplification and ray tracing see the imported values.
+    struct PackedVertex
+    {
+        float position[3];
+        uint16_t uv[2];
+        int16_t normal[2];
+        int16_t tangent[2];
+        uint8_t color[4];
+        uint8_t joints[4];
+        uint16_t weights[4];
+    };
+    static_assert(sizeof(PackedVertex) == 40);
+
     // Packed voxel vertex (8 B). Reflection derives the input layout (2x R32_UINT, stride 8) from the
     // voxel VS input struct, so both the voxel GBuffer VS and the voxel shadow VS bind this directly.
     // Bit layout — MUST match VoxelGBufferVS.hlsl / VoxelShadowVS.hlsl unpack:
@@ -79,6 +79,13 @@ namespace pe
         bufferInfo.usage = vkUsage;
         bufferInfo.size = size;
         bufferInfo.sharingMode = vk::SharingMode::eExclusive;
+        const std::vector<uint32_t> &queueFamilies = RHII.GetQueueFamilies();
+        if (desc.concurrentQueues && queueFamilies.size() > 1)
+        {
+            bufferInfo.sharingMode = vk::SharingMode::eConcurrent;
+            bufferInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamilies.size());
+            bufferInfo.pQueueFamilyIndices = queueFamilies.data();
+        }
 
         VmaAllocationCreateInfo allocationCreateInfo{};
         allocationCreateInfo.usage = VMA_MEMORY_USAGE_AUTO;
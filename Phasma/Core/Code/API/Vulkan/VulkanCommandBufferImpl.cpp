@@ -25,6 +25,18 @@
 
 namespace pe
 {
+    namespace
+    {
+        template <class T>
+        void NarrowBarrier(T &barrier, vk::PipelineStageFlags2 stages, vk::AccessFlags2 access)
+        {
+            barrier.srcStageMask &= stages;
+            barrier.srcAccessMask = barrier.srcStageMask ? barrier.srcAccessMask & access : vk::AccessFlags2{};
+            barrier.dstStageMask &= stages;
+            barrier.dstAccessMask = barrier.dstStageMask ? barrier.dstAccessMask & access : vk::AccessFlags2{};
+        }
+    } // namespace
+
     VulkanCommandBufferImpl::VulkanCommandBufferImpl(CommandBuffer *owner, CommandPool *commandPool, const std::string &name)
         : m_owner{owner}
     {
@@ -37,6 +49,32 @@ namespace pe
         m_owner->m_apiHandle = detail::ToUintPtr(m_apiHandle);
 
         Debug::SetObjectName(m_apiHandle, name);
+
+        // The transfer and async-compute queues record the same barrier calls as the graphics queue
+        // (uploads, the culling pass), so drop the stages their family cannot execute. Cross-queue order
+        // comes from the queues' timeline waits, not from these barriers.
+        const uint32_t familyId = commandPool->GetQueue()->GetFamilyId();
+        const auto families = VulkanRhi::Gpu().getQueueFamilyProperties();
+        const vk::QueueFlags flags = familyId < families.size() ? families[familyId].queueFlags : vk::QueueFlags{};
+        if (!(flags & vk::QueueFlagBits::eGraphics))
+        {
+            using S = vk::PipelineStageFlagBits2;
+            using A = vk::AccessFlagBits2;
+            m_narrowBarriers = true;
+            m_barrierStages = S::eTopOfPipe | S::eBottomOfPipe | S::eAllCommands | S::eHost |
+                              S::eAllTransfer | S::eCopy | S::eClear;
+            m_barrierAccess = A::eTransferRead | A::eTransferWrite | A::eHostRead | A::eHostWrite |
+                              A::eMemoryRead | A::eMemoryWrite;
+            if (flags & vk::QueueFlagBits::eCompute)
+            {
+                m_barrierStages |= S::eComputeShader | S::eDrawIndirect | S::eAccelerationStructureBuildKHR |
+                                   S::eRayTracingShaderKHR;
+                m_barrierAccess |= A::eShaderRead | A::eShaderWrite | A::eShaderSampledRead |
+                                   A::eShaderStorageRead | A::eShaderStorageWrite | A::eUniformRead |
+                                   A::eIndirectCommandRead | A::eAccelerationStructureReadKHR |
+                                   A::eAccelerationStructureWriteKHR;
+            }
+        }
     }
 
     VulkanCommandBufferImpl::~VulkanCommandBufferImpl()
@@ -115,6 +153,15 @@ namespace pe
     {
         if (m_pendingBufferBarriers.empty() && m_pendingImageBarriers.empty() && m_pendingMemoryBarriers.empty())
             return;
+        if (m_narrowBarriers)
+        {
+            for (auto &barrier : m_pendingBufferBarriers)
+                NarrowBarrier(barrier, m_barrierStages, m_barrierAccess);
+            for (auto &barrier : m_pendingImageBarriers)
+                NarrowBarrier(barrier, m_barrierStages, m_barrierAccess);
+            for (auto &barrier : m_pendingMemoryBarriers)
+                NarrowBarrier(barrier, m_barrierStages, m_barrierAccess);
+        }
         vk::DependencyInfo dep{};
         dep.bufferMemoryBarrierCount = static_cast<uint32_t>(m_pendingBufferBarriers.size());
         dep.pBufferMemoryBarriers = m_pendingBufferBarriers.data();
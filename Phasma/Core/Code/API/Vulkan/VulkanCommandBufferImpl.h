@@ -89,6 +89,11 @@ namespace pe
 
         CommandBuffer *m_owner{};
         vk::CommandBuffer m_apiHandle{};
+        // Stages and accesses this queue family accepts in a barrier. A dedicated copy or compute queue
+        // rejects graphics stages, which a buffer's or image's tracked state may still name.
+        vk::PipelineStageFlags2 m_barrierStages{};
+        vk::AccessFlags2 m_barrierAccess{};
+        bool m_narrowBarriers = false;
         std::vector<vk::BufferMemoryBarrier2> m_pendingBufferBarriers;
         std::vector<vk::ImageMemoryBarrier2> m_pendingImageBarriers;
         std::vector<vk::MemoryBarrier2> m_pendingMemoryBarriers;
@@ -155,6 +155,10 @@ namespace pe
             return vk::Format::eBc7UnormBlock;
         case PE_FORMAT_BC7_SRGB:
             return vk::Format::eBc7SrgbBlock;
+        case PE_FORMAT_ASTC_4x4_UNORM:
+            return vk::Format::eAstc4x4UnormBlock;
+        case PE_FORMAT_ASTC_4x4_SRGB:
+            return vk::Format::eAstc4x4SrgbBlock;
         default:
             return vk::Format::eUndefined;
         }
@@ -302,6 +306,10 @@ namespace pe
             return PE_FORMAT_BC7_UNORM;
         case vk::Format::eBc7SrgbBlock:
             return PE_FORMAT_BC7_SRGB;
+        case vk::Format::eAstc4x4UnormBlock:
+            return PE_FORMAT_ASTC_4x4_UNORM;
+        case vk::Format::eAstc4x4SrgbBlock:
+            return PE_FORMAT_ASTC_4x4_SRGB;
         default:
             return PE_FORMAT_UNDEFINED;
         }
@@ -597,6 +605,13 @@ namespace pe
         info.tiling = tiling;
         info.usage = vkUsage;
         info.sharingMode = vk::SharingMode::eExclusive;
+        const std::vector<uint32_t> &queueFamilies = RHII.GetQueueFamilies();
+        if (desc.concurrentQueues && queueFamilies.size() > 1)
+        {
+            info.sharingMode = vk::SharingMode::eConcurrent;
+            info.queueFamilyIndexCount = static_cast<uint32_t>(queueFamilies.size());
+            info.pQueueFamilyIndices = queueFamilies.data();
+        }
         info.initialLayout = ToVkImageLayout(desc.initialLayout);
         if (desc.cubeCompatible)
             info.flags |= vk::ImageCreateFlagBits::eCubeCompatible;
@@ -605,6 +620,7 @@ namespace pe
         if (desc.mutableFormat)
             info.flags |= vk::ImageCreateFlagBits::eMutableFormat;
 
+        m_createInfo = info;
         VkImageCreateInfo ci = static_cast<VkImageCreateInfo>(info);
         VmaAllocationCreateInfo aci{};
         aci.usage = VMA_MEMORY_USAGE_AUTO;
@@ -628,8 +644,80 @@ namespace pe
     {
         if (m_externallyOwned)
             return;
-        if (m_image)
+        DestroyImage();
+    }
+
+    void VulkanImageImpl::DestroyImage()
+    {
+        if (!m_image)
+            return;
+
+        // Placed images do not own their memory, the heap does
+        if (m_allocation)
             vmaDestroyImage(VulkanRhi::Allocator(), m_image, m_allocation);
+        else
+            VulkanRhi::Device().destroyImage(m_image);
+        m_image = vk::Image{};
+        m_allocation = nullptr;
+    }
+
+    ImageMemoryRequirements VulkanImageImpl::GetMemoryRequirements() const
+    {
+        const vk::MemoryRequirements req = VulkanRhi::Device().getImageMemoryRequirements(m_image);
+        return {req.size, req.alignment, req.memoryTypeBits};
+    }
+
+    bool VulkanImageImpl::Place(ImageHeap *heap, uint64_t offset)
+    {
+        if (m_externallyOwned)
+            return false;
+
+        const VkImageCreateInfo ci = static_cast<VkImageCreateInfo>(m_createInfo);
+        VkImage imageVK = VK_NULL_HANDLE;
+        VmaAllocation allocation{};
+        if (heap)
+        {
+            if (vmaCreateAliasingImage2(VulkanRhi::Allocator(), VulkanImageHeapImpl::From(heap)->m_allocation, offset, &ci, &imageVK) != VK_SUCCESS)
+                return false;
+        }
+        else
+        {
+            VmaAllocationCreateInfo aci{};
+            aci.usage = VMA_MEMORY_USAGE_AUTO;
+            if (vmaCreateImage(VulkanRhi::Allocator(), &ci, &aci, &imageVK, &allocation, nullptr) != VK_SUCCESS)
+                return false;
+            vmaSetAllocationName(VulkanRhi::Allocator(), allocation, m_owner->m_name.c_str());
+        }
+
+        DestroyImage();
+        m_image = imageVK;
+        m_allocation = allocation;
+        Debug::SetObjectName(m_image, m_owner->m_name);
+        return true;
+    }
+
+    VulkanImageHeapImpl::VulkanImageHeapImpl(ImageHeap *owner, const ImageMemoryRequirements &requirements)
+    {
+        VkMemoryRequirements memReq{};
+        memReq.size = requirements.size;
+        memReq.alignment = requirements.alignment;
+        memReq.memoryTypeBits = requirements.memoryTypeBits;
+
+        VmaAllocationCreateInfo aci{};
+        aci.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+        aci.requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+        VmaAllocationInfo allocInfo{};
+        VkResult vr = vmaAllocateMemory(VulkanRhi::Allocator(), &memReq, &aci, &m_allocation, &allocInfo);
+        PE_CHECK(vr);
+        vmaSetAllocationName(VulkanRhi::Allocator(), m_allocation, owner->m_name.c_str());
+        owner->m_memoryTypeBits = 1u << allocInfo.memoryType;
+    }
+
+    VulkanImageHeapImpl::~VulkanImageHeapImpl()
+    {
+        if (m_allocation)
+            vmaFreeMemory(VulkanRhi::Allocator(), m_allocation);
     }
 
     void VulkanImageImpl::CopyImage(CommandBuffer *cmd, Image *src)
@@ -825,7 +913,7 @@ namespace pe
 
         StagingAllocation alloc = RHII.GetStagingManager()->Allocate(size);
         std::memcpy(alloc.data, data, size);
-        alloc.buffer->Flush(size, 0);
+        alloc.buffer->Flush(size, alloc.offset);
 
         ImageBarrierInfo barrier{};
         barrier.image = image;
@@ -846,7 +934,7 @@ namespace pe
         if (RHII.GetCaps().copyCommands2)
         {
             vk::BufferImageCopy2 region{};
-            region.bufferOffset = 0;
+            region.bufferOffset = alloc.offset;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
             region.imageSubresource.aspectMask = VulkanHelpers::GetAspectMask(m_vkFormat);
@@ -868,7 +956,7 @@ namespace pe
         else
         {
             vk::BufferImageCopy region{};
-            region.bufferOffset = 0;
+            region.bufferOffset = alloc.offset;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
             region.imageSubresource.aspectMask = VulkanHelpers::GetAspectMask(m_vkFormat);
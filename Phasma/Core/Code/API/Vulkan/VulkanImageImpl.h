@@ -27,6 +27,8 @@ namespace pe
         void CreateRTV() override;
         void CreateSRV(PeImageViewType type, int mip) override;
         void CreateUAV(PeImageViewType type, uint32_t mip) override;
+        ImageMemoryRequirements GetMemoryRequirements() const override;
+        bool Place(ImageHeap *heap, uint64_t offset) override;
 
         // Friend Image in Image.h grants access to Image's private m_impl.
         static VulkanImageImpl *From(Image *image) { return static_cast<VulkanImageImpl *>(image->m_impl); }
@@ -36,10 +38,24 @@ namespace pe
 
         Image *m_owner;
         vk::Image m_image;
-        VmaAllocation m_allocation{}; // null for swapchain-wrapped images
+        VmaAllocation m_allocation{}; // null for swapchain-wrapped images and images placed in a heap
+        vk::ImageCreateInfo m_createInfo{}; // kept to recreate the image when it is placed
         vk::Format m_vkFormat{vk::Format::eUndefined};
         PeImageType m_imageType{PE_IMAGE_TYPE_2D};
         bool m_externallyOwned{false};
+
+    private:
+        void DestroyImage();
+    };
+
+    struct VulkanImageHeapImpl final : public ImageHeap::Impl
+    {
+        VulkanImageHeapImpl(ImageHeap *owner, const ImageMemoryRequirements &requirements);
+        ~VulkanImageHeapImpl() override;
+
+        static VulkanImageHeapImpl *From(ImageHeap *heap) { return static_cast<VulkanImageHeapImpl *>(heap->m_impl); }
+
+        VmaAllocation m_allocation{};
     };
 
     // Engine-private Vulkan seam accessors for backend integration.
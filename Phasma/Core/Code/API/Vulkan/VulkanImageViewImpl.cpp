@@ -132,7 +132,7 @@ namespace pe
         ImageView *view = new ImageView(parent, desc, name, true);
         view->m_impl = new VulkanImageViewImpl(view, info);
 #if defined(PE_TRACK_RESOURCES)
-        PeTracker::Track(typeid(ImageView), reinterpret_cast<void *>(view));
+        PeTracker::Track(view);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
         PE_INFO("Object ImageView created (Handle: %p)", reinterpret_cast<void *>(view));
 #endif
@@ -0,0 +1,159 @@
+#include "API/Vulkan/VulkanPipelineCache.h"
+
+#include "API/Debug.h"
+#include "API/RHI.h"
+#include "API/Vulkan/RHI_Vulkan.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr uint32_t kPipelineCacheMagic = 0x43504550; // "PEPC"
+        constexpr uint32_t kPipelineCacheVersion = 1;
+
+        struct PipelineCacheFileHeader
+        {
+            uint32_t magic = kPipelineCacheMagic;
+            uint32_t version = kPipelineCacheVersion;
+            uint32_t vendorID = 0;
+            uint32_t deviceID = 0;
+            uint32_t driverVersion = 0;
+            uint8_t pipelineCacheUUID[VK_UUID_SIZE]{};
+            uint8_t driverUUID[VK_UUID_SIZE]{};
+            uint64_t dataSize = 0;
+            uint64_t dataHash = 0; // XxHash64 of the driver blob that follows
+        };
+
+        std::string PipelineCachePath()
+        {
+            return Path::Root + "PipelineCache/vulkan.bin";
+        }
+
+        PipelineCacheFileHeader DeviceHeader()
+        {
+            vk::PhysicalDeviceIDProperties idProps{};
+            vk::PhysicalDeviceProperties2 props2{};
+            props2.pNext = &idProps;
+            VulkanRhi::Gpu().getProperties2(&props2);
+
+            const vk::PhysicalDeviceProperties &props = props2.properties;
+            PipelineCacheFileHeader header{};
+            header.vendorID = props.vendorID;
+            header.deviceID = props.deviceID;
+            header.driverVersion = props.driverVersion;
+            memcpy(header.pipelineCacheUUID, props.pipelineCacheUUID.data(), VK_UUID_SIZE);
+            memcpy(header.driverUUID, idProps.driverUUID.data(), VK_UUID_SIZE);
+            return header;
+        }
+
+        bool SameDevice(const PipelineCacheFileHeader &a, const PipelineCacheFileHeader &b)
+        {
+            return a.magic == b.magic &&
+                   a.version == b.version &&
+                   a.vendorID == b.vendorID &&
+                   a.deviceID == b.deviceID &&
+                   a.driverVersion == b.driverVersion &&
+                   memcmp(a.pipelineCacheUUID, b.pipelineCacheUUID, VK_UUID_SIZE) == 0 &&
+                   memcmp(a.driverUUID, b.driverUUID, VK_UUID_SIZE) == 0;
+        }
+    } // namespace
+
+    void VulkanPipelineCache::Init()
+    {
+        const PipelineCacheFileHeader expected = DeviceHeader();
+
+        std::vector<uint8_t> initialData;
+        {
+            const FileView file(PipelineCachePath());
+            if (file.IsOpen() && file.Size() >= sizeof(PipelineCacheFileHeader))
+            {
+                PipelineCacheFileHeader header{};
+                memcpy(&header, file.Data(), sizeof(header));
+                const uint8_t *data = file.Bytes().data() + sizeof(header);
+                if (!SameDevice(header, expected))
+                    PE_INFO("[PipelineCache] Cache file is for another device or driver, starting empty");
+                else if (header.dataSize != file.Size() - sizeof(header) || header.dataHash != XxHash64(data, header.dataSize))
+                    PE_WARN("[PipelineCache] Cache file is truncated or corrupt, starting empty");
+                else
+                    initialData.assign(data, data + header.dataSize);
+            }
+        }
+
+        vk::PipelineCacheCreateInfo cacheInfo{};
+        cacheInfo.initialDataSize = initialData.size();
+        cacheInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+        s_cache = VulkanRhi::Device().createPipelineCache(cacheInfo);
+        Debug::SetObjectName(s_cache, "RHI_pipeline_cache");
+
+        s_workerCaches.assign(JobSystem::Get().GetWorkerCount(), vk::PipelineCache{});
+        PE_INFO("[PipelineCache] Loaded %zu bytes", initialData.size());
+    }
+
+    void VulkanPipelineCache::Shutdown()
+    {
+        if (!s_cache)
+            return;
+
+        std::vector<vk::PipelineCache> workerCaches;
+        for (vk::PipelineCache cache : s_workerCaches)
+        {
+            if (cache)
+                workerCaches.push_back(cache);
+        }
+        if (!workerCaches.empty())
+            VulkanRhi::Device().mergePipelineCaches(s_cache, workerCaches);
+
+        Save();
+
+        for (vk::PipelineCache cache : workerCaches)
+            VulkanRhi::Device().destroyPipelineCache(cache);
+        s_workerCaches.clear();
+        VulkanRhi::Device().destroyPipelineCache(s_cache);
+        s_cache = vk::PipelineCache{};
+    }
+
+    vk::PipelineCache VulkanPipelineCache::Get()
+    {
+        const uint32_t worker = JobSystem::GetWorkerIndex();
+        if (worker >= s_workerCaches.size())
+            return s_cache;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        vk::PipelineCache &cache = s_workerCaches[worker];
+        if (!cache)
+            cache = VulkanRhi::Device().createPipelineCache(vk::PipelineCacheCreateInfo{});
+        return cache;
+    }
+
+    void VulkanPipelineCache::Save()
+    {
+        const std::vector<uint8_t> data = VulkanRhi::Device().getPipelineCacheData(s_cache);
+        if (data.empty())
+            return;
+
+        PipelineCacheFileHeader header = DeviceHeader();
+        header.dataSize = data.size();
+        header.dataHash = XxHash64(data.data(), data.size());
+
+        // Write beside the file and rename over it, so a crash mid-write never leaves a torn cache
+        const std::string path = PipelineCachePath();
+        const std::string tempPath = path + ".tmp";
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+        {
+            FileSystem file(tempPath, std::ios::out | std::ios::trunc | std::ios::binary);
+            if (!file.IsOpen())
+            {
+                PE_WARN("[PipelineCache] Could not write %s", tempPath.c_str());
+                return;
+            }
+            file.Write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.Write(reinterpret_cast<const char *>(data.data()), data.size());
+        }
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec)
+            PE_WARN("[PipelineCache] Could not replace %s: %s", path.c_str(), ec.message().c_str());
+        else
+            PE_INFO("[PipelineCache] Saved %zu bytes", data.size());
+    }
+} // namespace pe
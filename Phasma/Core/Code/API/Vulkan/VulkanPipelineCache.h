@@ -0,0 +1,28 @@
+#pragma once
+
+#include "API/Vulkan/VulkanHeaders.h"
+
+namespace pe
+{
+    // Device-wide vk::PipelineCache persisted at <Root>/PipelineCache/vulkan.bin, so the driver reuses the
+    // PSOs it compiled on earlier launches and before shader hot reloads. The file is only loaded when its
+    // vendor, device, driver version, pipeline-cache UUID and driver UUID match the running device.
+    class VulkanPipelineCache
+    {
+    public:
+        static void Init();
+        // Merges the job workers' caches into the main one, writes the file and destroys every cache
+        static void Shutdown();
+
+        // Cache for the calling thread. Each job worker gets its own so background pipeline creation
+        // never contends on the driver's cache lock; the main cache serves every other thread.
+        static vk::PipelineCache Get();
+
+    private:
+        static void Save();
+
+        inline static vk::PipelineCache s_cache{};
+        inline static std::vector<vk::PipelineCache> s_workerCaches{};
+        inline static std::mutex s_mutex{};
+    };
+} // namespace pe
@@ -9,6 +9,7 @@
 #include "API/Shader.h"
 #include "API/Vulkan/VulkanDescriptorImpl.h"
 #include "API/Vulkan/VulkanImageImpl.h"
+#include "API/Vulkan/VulkanPipelineCache.h"
 #include "API/Vulkan/VulkanRenderPassImpl.h"
 #include "API/Vulkan/VulkanRHITypeUtils.h"
 #include "API/Vulkan/VulkanShaderImpl.h"
@@ -110,12 +111,6 @@ namespace pe
             m_pipeline = vk::Pipeline{};
         }
 
-        if (m_cache)
-        {
-            VulkanRhi::Device().destroyPipelineCache(m_cache);
-            m_cache = vk::PipelineCache{};
-        }
-
         if (m_sbtBuffer)
         {
             Buffer::Destroy(m_sbtBuffer);
@@ -166,7 +161,7 @@ namespace pe
         m_layout = VulkanRhi::Device().createPipelineLayout(plci);
         compinfo.layout = m_layout;
 
-        auto result = VulkanRhi::Device().createComputePipeline(m_cache, compinfo);
+        auto result = VulkanRhi::Device().createComputePipeline(VulkanPipelineCache::Get(), compinfo);
         PE_ERROR_IF(result.result != vk::Result::eSuccess, "Failed to create compute pipeline!");
         m_pipeline = result.value;
 
@@ -447,12 +442,7 @@ namespace pe
         // Base Pipeline Index
         pipeinfo.basePipelineIndex = -1;
 
-        vk::PipelineCacheCreateInfo cacheInfo{};
-        cacheInfo.pInitialData = nullptr;
-        cacheInfo.initialDataSize = 0;
-        m_cache = VulkanRhi::Device().createPipelineCache(cacheInfo);
-
-        auto result = VulkanRhi::Device().createGraphicsPipeline(m_cache, pipeinfo);
+        auto result = VulkanRhi::Device().createGraphicsPipeline(VulkanPipelineCache::Get(), pipeinfo);
         PE_ERROR_IF(result.result != vk::Result::eSuccess, "Failed to create graphics pipeline!");
         m_pipeline = result.value;
 
@@ -613,7 +603,7 @@ namespace pe
         pipelineInfo.maxPipelineRayRecursionDepth = m_info.acceleration.maxRecursionDepth;
         pipelineInfo.layout = m_layout;
 
-        auto result = VulkanRhi::Device().createRayTracingPipelineKHR(nullptr, nullptr, pipelineInfo);
+        auto result = VulkanRhi::Device().createRayTracingPipelineKHR(nullptr, VulkanPipelineCache::Get(), pipelineInfo);
         PE_ERROR_IF(result.result != vk::Result::eSuccess, "Failed to create Ray Tracing pipeline!");
         m_pipeline = result.value;
 
@@ -32,23 +32,38 @@ namespace pe
                                  Semaphore *wait,
                                  Semaphore *signal,
                                  Semaphore *submissionsSemaphore,
-                                 uint64_t submissionValue)
+                                 uint64_t submissionValue,
+                                 const std::vector<QueueWait> &queueWaits)
     {
         std::lock_guard<std::mutex> lock(s_submitMutex);
 
         if (RHII.GetCaps().sync2)
         {
-            vk::SemaphoreSubmitInfo waitSemaphoreSubmitInfo{};
+            std::vector<vk::SemaphoreSubmitInfo> waitSemaphoreSubmitInfos{};
             std::vector<vk::SemaphoreSubmitInfo> signalSemaphoreSubmitInfos{};
             std::vector<vk::CommandBufferSubmitInfo> commandBufferSubmitInfos{};
 
+            waitSemaphoreSubmitInfos.reserve(1 + queueWaits.size());
             signalSemaphoreSubmitInfos.reserve(2);
             commandBufferSubmitInfos.reserve(commandBuffersCount);
 
             if (wait)
             {
-                waitSemaphoreSubmitInfo.semaphore = GetVulkanSemaphore(wait);
-                waitSemaphoreSubmitInfo.stageMask = ToVkPipelineStageFlags(wait->GetStageFlags());
+                vk::SemaphoreSubmitInfo info{};
+                info.semaphore = GetVulkanSemaphore(wait);
+                info.stageMask = ToVkPipelineStageFlags(wait->GetStageFlags());
+                waitSemaphoreSubmitInfos.push_back(info);
+            }
+
+            for (const QueueWait &queueWait : queueWaits)
+            {
+                vk::SemaphoreSubmitInfo info{};
+                info.semaphore = GetVulkanSemaphore(queueWait.semaphore);
+                info.stageMask = ToVkPipelineStageFlags(queueWait.stageFlags);
+                if (!info.stageMask)
+                    info.stageMask = vk::PipelineStageFlagBits2::eAllCommands;
+                info.value = queueWait.value;
+                waitSemaphoreSubmitInfos.push_back(info);
             }
 
             if (signal)
@@ -81,8 +96,8 @@ namespace pe
             }
 
             vk::SubmitInfo2 si{};
-            si.waitSemaphoreInfoCount = wait ? 1 : 0;
-            si.pWaitSemaphoreInfos = &waitSemaphoreSubmitInfo;
+            si.waitSemaphoreInfoCount = static_cast<uint32_t>(waitSemaphoreSubmitInfos.size());
+            si.pWaitSemaphoreInfos = waitSemaphoreSubmitInfos.data();
             si.commandBufferInfoCount = static_cast<uint32_t>(commandBufferSubmitInfos.size());
             si.pCommandBufferInfos = commandBufferSubmitInfos.data();
             si.signalSemaphoreInfoCount = static_cast<uint32_t>(signalSemaphoreSubmitInfos.size());
@@ -126,6 +141,16 @@ namespace pe
             waitValues.push_back(0);
         }
 
+        for (const QueueWait &queueWait : queueWaits)
+        {
+            vk::PipelineStageFlags stageMask = ToVkPipelineStageFlagsLegacy(queueWait.stageFlags);
+            if (!stageMask)
+                stageMask = vk::PipelineStageFlagBits::eAllCommands;
+            waitSemaphores.push_back(GetVulkanSemaphore(queueWait.semaphore));
+            waitStages.push_back(stageMask);
+            waitValues.push_back(queueWait.value);
+        }
+
         if (signal)
         {
             signalSemaphores.push_back(GetVulkanSemaphore(signal));
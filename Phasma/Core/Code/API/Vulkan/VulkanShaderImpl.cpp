@@ -66,7 +66,7 @@ namespace pe
 
             FileInfo *file_info = new FileInfo{
                 full_path,
-                FileSystem(full_path, std::ios_base::in | std::ios_base::ate | std::ios::binary).ReadAll()};
+                std::string(FileView(full_path).Text())};
 
             included_files.insert(full_path);
 
@@ -306,7 +306,7 @@ namespace pe
     // Important: Every PeHandle should provide a constructor and a destructor managing the
     // create and destroy of the API_HANDLE
     template <class T, class API_HANDLE>
-    class PeHandle : public PeHandleBase, public NoCopy, public NoMove
+    class PeHandle : public PeHandleBase, public PeTracked, public NoCopy, public NoMove
     {
     public:
         template <class... Params>
@@ -316,7 +316,7 @@ namespace pe
             T *ptr = new T(std::forward<Params>(params)...);
 
 #if defined(PE_TRACK_RESOURCES)
-            PeTracker::Track(typeid(T), (void *)ptr);
+            PeTracker::Track(ptr);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
             void *handle = (void *)detail::ToUintPtr(ptr->ApiHandle());
             PE_INFO("Object %s created (Handle: %p)", Demangle(typeid(API_HANDLE).name()).c_str(), handle);
@@ -334,12 +334,12 @@ namespace pe
             {
 #if defined(PE_TRACK_RESOURCES)
                 void *handle = (void *)detail::ToUintPtr(ptr->ApiHandle());
+                PeTracker::Untrack(ptr);
 #endif
 
                 delete ptr; // should call ~T() destructor
 
 #if defined(PE_TRACK_RESOURCES)
-                PeTracker::Untrack(typeid(T), (void *)ptr);
 #if !defined(PE_TRACK_RESOURCES_NOSPAM)
                 PE_INFO("Object %s destroyed (Handle: %p)", Demangle(typeid(API_HANDLE).name()).c_str(), handle);
 #endif
@@ -356,12 +356,7 @@ namespace pe
 #if defined(PE_TRACK_RESOURCES)
         static std::vector<T *> GetHandles()
         {
-            auto ptrs = PeTracker::GetHandles(typeid(T));
-            std::vector<T *> result;
-            result.reserve(ptrs.size());
-            for (void *p : ptrs)
-                result.push_back(static_cast<T *>(p));
-            return result;
+            return PeTracker::GetHandles<T>();
         }
 #endif
 
@@ -0,0 +1,385 @@
+#include "Base/BlockCompress.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr int kBc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+        constexpr int kAstcWeights2[4] = {0, 21, 43, 64};
+        constexpr int kAstcWeights3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+
+        // Block mode field for a 4x4 weight grid, single plane (ASTC spec, 2D block modes, row 1)
+        constexpr uint32_t kAstcMode4x4Quant4 = 0x042;
+        constexpr uint32_t kAstcMode4x4Quant8 = 0x053;
+        constexpr uint32_t kAstcCemRgbDirect = 8;
+        constexpr uint32_t kAstcCemRgbaDirect = 12;
+
+        // Little-endian bit packing into a zeroed block
+        void PutBits(uint8_t *out, uint32_t &pos, uint32_t value, uint32_t bits)
+        {
+            for (uint32_t i = 0; i < bits; i++, pos++)
+            {
+                if ((value >> i) & 1u)
+                    out[pos >> 3] |= static_cast<uint8_t>(1u << (pos & 7u));
+            }
+        }
+
+        float Clamp255(float v)
+        {
+            return std::clamp(v, 0.0f, 255.0f);
+        }
+
+        // Endpoints of the line through the first `channels` components of the texels along their
+        // principal axis, spanning the projected extent. A flat block collapses to its mean.
+        void FitLine(const uint8_t *texels, int channels, float lo[4], float hi[4])
+        {
+            float mean[4] = {};
+            for (int i = 0; i < 16; i++)
+                for (int c = 0; c < channels; c++)
+                    mean[c] += texels[i * 4 + c];
+            for (int c = 0; c < channels; c++)
+                mean[c] /= 16.0f;
+
+            float cov[4][4] = {};
+            for (int i = 0; i < 16; i++)
+            {
+                float d[4] = {};
+                for (int c = 0; c < channels; c++)
+                    d[c] = texels[i * 4 + c] - mean[c];
+                for (int a = 0; a < channels; a++)
+                    for (int b = 0; b < channels; b++)
+                        cov[a][b] += d[a] * d[b];
+            }
+
+            // Power iteration, seeded with the widest channel's covariance row so the correlation
+            // signs are right from the start
+            int widest = 0;
+            for (int c = 1; c < channels; c++)
+                if (cov[c][c] > cov[widest][widest])
+                    widest = c;
+
+            float axis[4] = {};
+            for (int c = 0; c < channels; c++)
+                axis[c] = cov[widest][c];
+            for (int iter = 0; iter < 8; iter++)
+            {
+                float next[4] = {};
+                float scale = 0.0f;
+                for (int a = 0; a < channels; a++)
+                {
+                    for (int b = 0; b < channels; b++)
+                        next[a] += cov[a][b] * axis[b];
+                    scale = std::max(scale, std::abs(next[a]));
+                }
+                if (scale <= 0.0f)
+                    break;
+                for (int a = 0; a < channels; a++)
+                    axis[a] = next[a] / scale;
+            }
+
+            float length = 0.0f;
+            for (int c = 0; c < channels; c++)
+                length += axis[c] * axis[c];
+
+            for (int c = 0; c < 4; c++)
+                lo[c] = hi[c] = c < channels ? mean[c] : 255.0f;
+            if (length <= 1e-8f)
+                return;
+
+            length = std::sqrt(length);
+            float tMin = std::numeric_limits<float>::max();
+            float tMax = std::numeric_limits<float>::lowest();
+            for (int i = 0; i < 16; i++)
+            {
+                float t = 0.0f;
+                for (int c = 0; c < channels; c++)
+                    t += (texels[i * 4 + c] - mean[c]) * axis[c] / length;
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+            for (int c = 0; c < channels; c++)
+            {
+                lo[c] = Clamp255(mean[c] + tMin * axis[c] / length);
+                hi[c] = Clamp255(mean[c] + tMax * axis[c] / length);
+            }
+        }
+
+        // Least-squares endpoints for fixed per-texel interpolation weights (0..64)
+        bool Refit(const uint8_t *texels, int channels, const int *weights, float lo[4], float hi[4])
+        {
+            float a = 0.0f, b = 0.0f, c = 0.0f;
+            float sum0[4] = {};
+            float sum1[4] = {};
+            for (int i = 0; i < 16; i++)
+            {
+                const float w = weights[i] / 64.0f;
+                const float v = 1.0f - w;
+                a += v * v;
+                b += v * w;
+                c += w * w;
+                for (int ch = 0; ch < channels; ch++)
+                {
+                    sum0[ch] += v * texels[i * 4 + ch];
+                    sum1[ch] += w * texels[i * 4 + ch];
+                }
+            }
+
+            const float det = a * c - b * b;
+            if (std::abs(det) < 1e-6f)
+                return false;
+
+            for (int ch = 0; ch < channels; ch++)
+            {
+                lo[ch] = Clamp255((c * sum0[ch] - b * sum1[ch]) / det);
+                hi[ch] = Clamp255((a * sum1[ch] - b * sum0[ch]) / det);
+            }
+            return true;
+        }
+
+        // Picks each texel's interpolation weight between two 8-bit endpoints; returns the squared
+        // error. The projection onto the endpoint line gives a first guess, its neighbours settle it.
+        uint32_t PickWeights(const uint8_t *texels, int channels, const int e[2][4],
+                             const int *levels, int levelCount, uint8_t *index)
+        {
+            int palette[16][4];
+            for (int l = 0; l < levelCount; l++)
+                for (int c = 0; c < channels; c++)
+                    palette[l][c] = (e[0][c] * (64 - levels[l]) + e[1][c] * levels[l] + 32) >> 6;
+
+            float dir[4] = {};
+            float length2 = 0.0f;
+            for (int c = 0; c < channels; c++)
+            {
+                dir[c] = static_cast<float>(e[1][c] - e[0][c]);
+                length2 += dir[c] * dir[c];
+            }
+
+            uint32_t total = 0;
+            for (int i = 0; i < 16; i++)
+            {
+                const uint8_t *texel = texels + i * 4;
+                int guess = 0;
+                if (length2 > 0.0f)
+                {
+                    float t = 0.0f;
+                    for (int c = 0; c < channels; c++)
+                        t += (texel[c] - e[0][c]) * dir[c];
+                    guess = std::clamp(static_cast<int>(t / length2 * (levelCount - 1) + 0.5f), 0, levelCount - 1);
+                }
+
+                uint32_t bestError = UINT32_MAX;
+                for (int l = std::max(guess - 1, 0); l <= std::min(guess + 1, levelCount - 1); l++)
+                {
+                    uint32_t error = 0;
+                    for (int c = 0; c < channels; c++)
+                    {
+                        const int d = texel[c] - palette[l][c];
+                        error += static_cast<uint32_t>(d * d);
+                    }
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        index[i] = static_cast<uint8_t>(l);
+                    }
+                }
+                total += bestError;
+            }
+            return total;
+        }
+
+        int RoundToByte(float v)
+        {
+            return static_cast<int>(Clamp255(v) + 0.5f);
+        }
+    } // namespace
+
+    void EncodeBc4Block(const uint8_t *texels, uint8_t *out, uint32_t channel)
+    {
+        int lo = 255;
+        int hi = 0;
+        for (int i = 0; i < 16; i++)
+        {
+            lo = std::min<int>(lo, texels[i * 4 + channel]);
+            hi = std::max<int>(hi, texels[i * 4 + channel]);
+        }
+
+        std::memset(out, 0, 8);
+        out[0] = static_cast<uint8_t>(hi);
+        out[1] = static_cast<uint8_t>(lo);
+        if (hi == lo)
+            return; // every index 0 selects endpoint 0
+
+        // endpoint 0 > endpoint 1 selects the 8-value mode: e0, e1, then six steps from e0 to e1
+        int palette[8] = {hi, lo};
+        for (int k = 1; k < 7; k++)
+            palette[k + 1] = ((7 - k) * hi + k * lo + 3) / 7;
+
+        uint32_t pos = 16;
+        for (int i = 0; i < 16; i++)
+        {
+            const int v = texels[i * 4 + channel];
+            uint32_t best = 0;
+            for (uint32_t k = 1; k < 8; k++)
+                if (std::abs(v - palette[k]) < std::abs(v - palette[best]))
+                    best = k;
+            PutBits(out, pos, best, 3);
+        }
+    }
+
+    void EncodeBc5Block(const uint8_t *texels, uint8_t *out)
+    {
+        EncodeBc4Block(texels, out, 0);
+        EncodeBc4Block(texels, out + 8, 1);
+    }
+
+    void EncodeBc7Block(const uint8_t *texels, uint8_t *out)
+    {
+        float lo[4], hi[4];
+        FitLine(texels, 4, lo, hi);
+
+        int bestQ[2][4] = {};
+        int bestP[2] = {};
+        uint8_t bestIndex[16] = {};
+        uint32_t bestError = UINT32_MAX;
+        for (int round = 0; round < 3; round++)
+        {
+            // Mode 6 endpoints are 7 bits per channel plus one shared low bit per endpoint
+            for (int pbits = 0; pbits < 4; pbits++)
+            {
+                const int p[2] = {pbits & 1, pbits >> 1};
+                int q[2][4];
+                int e[2][4];
+                for (int c = 0; c < 4; c++)
+                {
+                    q[0][c] = std::clamp(static_cast<int>((lo[c] - p[0]) * 0.5f + 0.5f), 0, 127);
+                    q[1][c] = std::clamp(static_cast<int>((hi[c] - p[1]) * 0.5f + 0.5f), 0, 127);
+                    e[0][c] = (q[0][c] << 1) | p[0];
+                    e[1][c] = (q[1][c] << 1) | p[1];
+                }
+
+                uint8_t index[16];
+                const uint32_t error = PickWeights(texels, 4, e, kBc7Weights4, 16, index);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    std::memcpy(bestQ, q, sizeof(q));
+                    bestP[0] = p[0];
+                    bestP[1] = p[1];
+                    std::memcpy(bestIndex, index, sizeof(index));
+                }
+            }
+
+            if (bestError == 0 || round == 2)
+                break;
+
+            int weights[16];
+            for (int i = 0; i < 16; i++)
+                weights[i] = kBc7Weights4[bestIndex[i]];
+            if (!Refit(texels, 4, weights, lo, hi))
+                break;
+        }
+
+        // The anchor texel's index is stored without its top bit
+        if (bestIndex[0] & 8)
+        {
+            std::swap(bestQ[0], bestQ[1]);
+            std::swap(bestP[0], bestP[1]);
+            for (uint8_t &index : bestIndex)
+                index = static_cast<uint8_t>(15 - index);
+        }
+
+        std::memset(out, 0, 16);
+        uint32_t pos = 0;
+        PutBits(out, pos, 1u << 6, 7); // mode 6
+        for (int c = 0; c < 4; c++)
+        {
+            PutBits(out, pos, static_cast<uint32_t>(bestQ[0][c]), 7);
+            PutBits(out, pos, static_cast<uint32_t>(bestQ[1][c]), 7);
+        }
+        PutBits(out, pos, static_cast<uint32_t>(bestP[0]), 1);
+        PutBits(out, pos, static_cast<uint32_t>(bestP[1]), 1);
+        for (int i = 0; i < 16; i++)
+            PutBits(out, pos, bestIndex[i], i == 0 ? 3 : 4);
+    }
+
+    void EncodeAstc4x4Block(const uint8_t *texels, uint8_t *out)
+    {
+        bool hasAlpha = false;
+        for (int i = 0; i < 16; i++)
+            hasAlpha |= texels[i * 4 + 3] != 255;
+
+        // Both pairings leave 256-level endpoints: 64 of 79 spare bits for RGBA, 48 of 63 for RGB
+        const int channels = hasAlpha ? 4 : 3;
+        const int *levels = hasAlpha ? kAstcWeights2 : kAstcWeights3;
+        const int levelCount = hasAlpha ? 4 : 8;
+
+        float lo[4], hi[4];
+        FitLine(texels, channels, lo, hi);
+
+        int bestE[2][4] = {};
+        uint8_t bestWeight[16] = {};
+        uint32_t bestError = UINT32_MAX;
+        for (int round = 0; round < 2; round++)
+        {
+            int e[2][4];
+            for (int c = 0; c < 4; c++)
+            {
+                e[0][c] = RoundToByte(lo[c]);
+                e[1][c] = RoundToByte(hi[c]);
+            }
+            // Direct-endpoint modes swap and blue-contract when endpoint 1 is the darker one
+            if (e[0][0] + e[0][1] + e[0][2] > e[1][0] + e[1][1] + e[1][2])
+            {
+                std::swap(e[0], e[1]);
+            }
+
+            uint8_t weight[16];
+            const uint32_t error = PickWeights(texels, channels, e, levels, levelCount, weight);
+            if (error < bestError)
+            {
+                bestError = error;
+                std::memcpy(bestE, e, sizeof(e));
+                std::memcpy(bestWeight, weight, sizeof(weight));
+            }
+
+            if (bestError == 0 || round == 1)
+                break;
+
+            int weights[16];
+            for (int i = 0; i < 16; i++)
+                weights[i] = levels[bestWeight[i]];
+            for (int c = 0; c < 4; c++)
+            {
+                lo[c] = static_cast<float>(bestE[0][c]);
+                hi[c] = static_cast<float>(bestE[1][c]);
+            }
+            if (!Refit(texels, channels, weights, lo, hi))
+                break;
+        }
+
+        std::memset(out, 0, 16);
+        uint32_t pos = 0;
+        PutBits(out, pos, hasAlpha ? kAstcMode4x4Quant4 : kAstcMode4x4Quant8, 11);
+        PutBits(out, pos, 0, 2); // one partition
+        PutBits(out, pos, hasAlpha ? kAstcCemRgbaDirect : kAstcCemRgbDirect, 4);
+        for (int c = 0; c < channels; c++)
+        {
+            PutBits(out, pos, static_cast<uint32_t>(bestE[0][c]), 8);
+            PutBits(out, pos, static_cast<uint32_t>(bestE[1][c]), 8);
+        }
+
+        // Weights fill the block from the top down, bit-reversed
+        const uint32_t bits = hasAlpha ? 2 : 3;
+        for (uint32_t i = 0; i < 16; i++)
+        {
+            for (uint32_t b = 0; b < bits; b++)
+            {
+                if ((bestWeight[i] >> b) & 1u)
+                {
+                    const uint32_t bit = 127 - (i * bits + b);
+                    out[bit >> 3] |= static_cast<uint8_t>(1u << (bit & 7u));
+                }
+            }
+        }
+    }
+} // namespace pe
@@ -0,0 +1,19 @@
+#pragma once
+
+namespace pe
+{
+    // GPU block encoders for cooked textures. Every function takes one 4x4 block of RGBA8 texels,
+    // row-major (64 bytes), and writes the block exactly as the GPU samples it.
+    // ponytail: one mode per format (BC7 mode 6, ASTC 4x4 single-partition direct endpoints) fitted
+    // along the principal axis with a least-squares refine. Fast and predictable; a multi-partition
+    // search (bc7enc, astcenc) buys a few dB more on busy blocks if install quality ever needs it.
+
+    // 8 bytes: one channel (0 = R) in the 8-value interpolated mode
+    void EncodeBc4Block(const uint8_t *texels, uint8_t *out, uint32_t channel = 0);
+    // 16 bytes: R and G as two BC4 blocks (normal-map XY)
+    void EncodeBc5Block(const uint8_t *texels, uint8_t *out);
+    // 16 bytes: RGBA, mode 6 (7-bit endpoints + p-bits, 4-bit indices)
+    void EncodeBc7Block(const uint8_t *texels, uint8_t *out);
+    // 16 bytes: LDR RGB (3-bit weights) for opaque blocks, LDR RGBA (2-bit weights) when any alpha < 255
+    void EncodeAstc4x4Block(const uint8_t *texels, uint8_t *out);
+} // namespace pe
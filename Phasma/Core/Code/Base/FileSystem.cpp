@@ -1,5 +1,10 @@
 #include "FileSystem.h"
 #include "GamePack.h"
+#if defined(PE_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
 
 namespace pe
 {
@@ -94,4 +99,172 @@ namespace pe
         if (m_fstream.is_open())
             m_fstream.close();
     }
+
+    bool MappedFile::Open(const std::filesystem::path &path)
+    {
+        Close();
+#if defined(PE_WIN32)
+        HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || static_cast<uint64_t>(size.QuadPart) > std::numeric_limits<size_t>::max())
+        {
+            CloseHandle(file);
+            return false;
+        }
+        m_file = file;
+        m_size = static_cast<size_t>(size.QuadPart);
+        m_open = true;
+        if (m_size == 0)
+            return true; // empty files cannot be mapped; an empty span is the whole content
+
+        m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping)
+            m_data = static_cast<const uint8_t *>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+#else
+        const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+        struct stat info{};
+        if (fstat(fd, &info) != 0 || info.st_size < 0)
+        {
+            close(fd);
+            return false;
+        }
+        m_size = static_cast<size_t>(info.st_size);
+        m_open = true;
+        if (m_size == 0)
+        {
+            close(fd);
+            return true;
+        }
+
+        void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // the mapping keeps the file alive
+        if (data != MAP_FAILED)
+            m_data = static_cast<const uint8_t *>(data);
+#endif
+        if (!m_data)
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+#if defined(PE_WIN32)
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file)
+            CloseHandle(m_file);
+        m_mapping = nullptr;
+        m_file = nullptr;
+#else
+        if (m_data)
+            munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_open = false;
+    }
+
+    bool FileView::Open(const std::string &file)
+    {
+        Close();
+        if (IsGamePackManagedAsset(file))
+        {
+            if (std::optional<std::span<const uint8_t>> view = ViewGamePackAsset(file))
+            {
+                m_bytes = *view;
+            }
+            else if (std::optional<std::string> data = ReadGamePackAsset(file))
+            {
+                m_decoded = std::move(*data);
+                m_bytes = {reinterpret_cast<const uint8_t *>(m_decoded.data()), m_decoded.size()};
+            }
+            else
+            {
+                return false;
+            }
+            m_open = true;
+            return true;
+        }
+
+        if (!m_mapped.Open(std::filesystem::path(reinterpret_cast<const char8_t *>(file.c_str()))))
+            return false;
+        m_bytes = m_mapped.Bytes();
+        m_open = true;
+        return true;
+    }
+
+    void FileView::Close()
+    {
+        m_mapped.Close();
+        m_decoded = {};
+        m_bytes = {};
+        m_open = false;
+    }
+
+    FileChunkReader::FileChunkReader(const std::string &file, size_t chunkSize)
+        : m_file(file), m_chunkSize(std::max<size_t>(chunkSize, 1))
+    {
+        if (IsGamePackManagedAsset(m_file))
+        {
+            if (std::optional<std::span<const uint8_t>> view = ViewGamePackAsset(m_file))
+            {
+                m_view = *view;
+                m_size = view->size();
+                m_open = true;
+            }
+            else if (std::optional<uint64_t> size = GetGamePackAssetSize(m_file))
+            {
+                m_size = *size;
+                m_fromPack = true;
+                m_open = true;
+            }
+            return;
+        }
+
+        m_stream.open(std::filesystem::path(reinterpret_cast<const char8_t *>(m_file.c_str())),
+                      std::ios::in | std::ios::binary | std::ios::ate);
+        if (!m_stream.is_open())
+            return;
+        m_size = static_cast<uint64_t>(m_stream.tellg());
+        m_stream.seekg(0);
+        m_open = true;
+    }
+
+    std::span<const uint8_t> FileChunkReader::Next()
+    {
+        if (!m_open || m_failed || m_offset >= m_size)
+            return {};
+
+        const size_t size = static_cast<size_t>(std::min<uint64_t>(m_chunkSize, m_size - m_offset));
+        std::span<const uint8_t> chunk;
+        if (!m_view.empty())
+        {
+            chunk = m_view.subspan(static_cast<size_t>(m_offset), size);
+        }
+        else
+        {
+            m_chunk.resize(size);
+            const bool read = m_fromPack
+                                  ? ReadGamePackAssetRange(m_file, m_offset, m_chunk)
+                                  : static_cast<bool>(m_stream.read(reinterpret_cast<char *>(m_chunk.data()), size));
+            if (!read)
+            {
+                m_failed = true;
+                return {};
+            }
+            chunk = m_chunk;
+        }
+        m_offset += size;
+        return chunk;
+    }
 } // namespace pe
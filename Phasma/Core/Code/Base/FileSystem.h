@@ -32,4 +32,87 @@ namespace pe
         std::ios_base::openmode m_mode;
         size_t m_size = 0;
     };
+
+    // Read-only memory map of a whole file. Pages fault in on first touch, so mapping a multi-GB
+    // file costs nothing until its bytes are read.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        bool Open(const std::filesystem::path &path);
+        void Close();
+
+        bool IsOpen() const { return m_open; }
+        const uint8_t *Data() const { return m_data; }
+        size_t Size() const { return m_size; }
+        std::span<const uint8_t> Bytes() const { return {m_data, m_size}; }
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size = 0;
+        bool m_open = false;
+#if defined(PE_WIN32)
+        void *m_file = nullptr;    // HANDLE
+        void *m_mapping = nullptr; // HANDLE
+#endif
+    };
+
+    // Read-only view of a whole file without copying it: a memory map of a loose file, or a slice of
+    // the mapped game pack for pack entries stored raw. Compressed pack entries are decoded once into
+    // the view. Same pack rules as FileSystem: a managed path missing from the pack stays closed.
+    class FileView
+    {
+    public:
+        FileView() = default;
+        explicit FileView(const std::string &file) { Open(file); }
+        FileView(const FileView &) = delete;
+        FileView &operator=(const FileView &) = delete;
+
+        bool Open(const std::string &file); // UTF-8 path
+        void Close();
+
+        bool IsOpen() const { return m_open; }
+        const uint8_t *Data() const { return m_bytes.data(); }
+        size_t Size() const { return m_bytes.size(); }
+        std::span<const uint8_t> Bytes() const { return m_bytes; }
+        std::string_view Text() const { return {reinterpret_cast<const char *>(m_bytes.data()), m_bytes.size()}; }
+
+    private:
+        MappedFile m_mapped;
+        std::string m_decoded; // compressed pack entries only
+        std::span<const uint8_t> m_bytes;
+        bool m_open = false;
+    };
+
+    // Reads a file front to back in fixed-size chunks, for files too large to hold at once. Loose
+    // files are read through one reused buffer; compressed pack entries decode only the blocks each
+    // chunk overlaps, and raw ones hand out slices of the mapped pack.
+    class FileChunkReader
+    {
+    public:
+        explicit FileChunkReader(const std::string &file, size_t chunkSize = 1 << 20); // UTF-8 path
+
+        bool IsOpen() const { return m_open; }
+        bool Failed() const { return m_failed; }
+        uint64_t Size() const { return m_size; }
+        uint64_t Offset() const { return m_offset; }
+        // The next chunk, empty at the end or after a read error; valid until the next call
+        std::span<const uint8_t> Next();
+
+    private:
+        std::string m_file;
+        std::ifstream m_stream;
+        std::span<const uint8_t> m_view; // raw pack entries
+        std::vector<uint8_t> m_chunk;
+        size_t m_chunkSize;
+        uint64_t m_size = 0;
+        uint64_t m_offset = 0;
+        bool m_fromPack = false;
+        bool m_open = false;
+        bool m_failed = false;
+    };
 } // namespace pe
@@ -1,7 +1,9 @@
 #include "Base/GamePack.h"
+#include "Base/Lz4.h"
 
 #include <array>
 #include <fstream>
+#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -9,22 +11,82 @@ namespace pe
 {
     namespace
     {
-        constexpr std::array<char, 8> kMagic = {'P', 'E', 'P', 'A', 'K', '0', '1', '\0'};
-        constexpr uint32_t kVersion = 1;
+        // Layout (little-endian):
+        //   header: magic[8], u32 version, u32 entry count, u32 block size, u32 reserved,
+        //           u64 toc offset, u64 XxHash64 of the toc
+        //   entry data, each entry starting on a kDataAlignment boundary
+        //   toc: per entry u32 path length, u32 codec, u64 offset, u64 stored size, u64 size,
+        //        u64 XxHash64 of the stored bytes, u64 XxHash64 of the content, path bytes
+        // The toc sits at the end so opening reads one contiguous block instead of touching a page
+        // per entry across the whole file.
+        // A Raw entry stores its bytes as is. An Lz4 entry is split into block-size pieces compressed
+        // independently (random access, parallel decode): u32 stored size per block, then the blocks.
+        // A block whose stored size equals its raw size did not compress and is stored raw.
+        // The content hash is the build manifest: GamePackWriter compares it against fresh sources to
+        // copy unchanged entries out of the previous pack without compressing them again.
+        constexpr std::array<char, 8> kMagic = {'P', 'E', 'P', 'A', 'K', '0', '4', '\0'};
+        constexpr uint32_t kVersion = 4;
         constexpr uint32_t kMaxEntries = 100000;
         constexpr uint32_t kMaxPathLength = 4096;
+        constexpr uint64_t kDataAlignment = 16;
+        constexpr uint32_t kBlockSize = 128 * 1024;
+        constexpr size_t kHeaderSize = kMagic.size() + sizeof(uint32_t) * 4 + sizeof(uint64_t) * 2;
+        constexpr size_t kTocEntrySize = sizeof(uint32_t) * 2 + sizeof(uint64_t) * 5;
+        constexpr uint32_t kParallelBlocks = 4; // fewer blocks (de)compress faster than a ParallelFor fans out
+        // GamePackWriter keeps at most this many entries, or about this many source bytes, in flight
+        constexpr uint32_t kWriteWindowEntries = 64;
+        constexpr uint64_t kWriteWindowBytes = 64ull << 20;
+
+        enum class PackCodec : uint32_t
+        {
+            Raw,
+            Lz4,
+            Count
+        };
+
+        enum class EntryState : uint8_t
+        {
+            Unverified,
+            Valid,
+            Corrupt
+        };
 
         struct PackEntry
         {
             uint64_t offset = 0;
+            uint64_t storedSize = 0;
             uint64_t size = 0;
+            uint64_t hash = 0;
+            uint64_t contentHash = 0;
+            PackCodec codec = PackCodec::Raw;
+        };
+
+        struct PackToc
+        {
+            uint32_t blockSize = kBlockSize;
+            std::vector<PackEntry> entries;                  // file order
+            std::unordered_map<std::string, uint32_t> index; // pack path -> entries index
+        };
+
+        // One independently compressed piece of an Lz4 entry
+        struct PackBlock
+        {
+            const uint8_t *data;
+            uint32_t storedSize;
+            uint32_t size;
         };
 
         std::filesystem::path s_packPath;
-        std::unordered_map<std::string, PackEntry> s_entries;
+        MappedFile s_pack;
+        uint32_t s_blockSize = kBlockSize;
+        std::vector<PackEntry> s_entryList;                     // toc order, which is file order
+        std::unique_ptr<std::atomic<EntryState>[]> s_entryState; // per s_entryList index
+        std::unordered_map<std::string, uint32_t> s_entries;     // pack path -> s_entryList index
         std::unordered_set<std::string> s_managedRoots;
         std::string s_assetsRoot;        // canonical Path::Assets at pack-open time, trailing slash
         std::string s_runtimeAssetsRoot; // canonical Path::RuntimeAssets at pack-open time, trailing slash
+        std::thread s_verifyThread;
+        std::atomic<bool> s_verifyCancel{false};
 
         std::string CanonicalRootString(const std::string &root)
         {
@@ -115,125 +177,275 @@ namespace pe
             return {};
         }
 
-        uint64_t HashBytes(const uint8_t *data, size_t size, uint64_t hash = 14695981039346656037ull)
+        // Hashes the entry the first time anyone asks; concurrent first readers may both hash it,
+        // which is cheaper than making every later read synchronise.
+        bool VerifyEntry(uint32_t index)
         {
-            for (size_t i = 0; i < size; ++i)
+            std::atomic<EntryState> &state = s_entryState[index];
+            const EntryState current = state.load(std::memory_order_acquire);
+            if (current != EntryState::Unverified)
+                return current == EntryState::Valid;
+
+            const PackEntry &entry = s_entryList[index];
+            const bool valid = XxHash64(s_pack.Data() + entry.offset, static_cast<size_t>(entry.storedSize)) == entry.hash;
+            if (state.exchange(valid ? EntryState::Valid : EntryState::Corrupt, std::memory_order_acq_rel) ==
+                    EntryState::Unverified &&
+                !valid)
             {
-                hash ^= data[i];
-                hash *= 1099511628211ull;
+                PE_WARN("Corrupt game pack entry at offset %llu", static_cast<unsigned long long>(entry.offset));
             }
-            return hash;
+            return valid;
         }
 
-        template <typename T>
-        bool ReadValue(std::ifstream &file, T &value)
+        // Walks an Lz4 entry's block index; false when the index does not add up to the stored bytes
+        bool LocateBlocks(const PackEntry &entry, std::vector<PackBlock> &blocks)
         {
-            return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(value)));
-        }
+            const uint64_t count = (entry.size + s_blockSize - 1) / s_blockSize;
+            const uint8_t *index = s_pack.Data() + entry.offset;
+            if (entry.storedSize < count * sizeof(uint32_t))
+                return false;
 
-        template <typename T>
-        void WriteValue(std::ofstream &file, const T &value)
-        {
-            file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+            blocks.clear();
+            blocks.reserve(static_cast<size_t>(count));
+            const uint8_t *data = index + count * sizeof(uint32_t);
+            uint64_t remainingStored = entry.storedSize - count * sizeof(uint32_t);
+            uint64_t remainingSize = entry.size;
+            for (uint64_t i = 0; i < count; ++i)
+            {
+                uint32_t storedSize;
+                std::memcpy(&storedSize, index + i * sizeof(uint32_t), sizeof(storedSize));
+                const uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(remainingSize, s_blockSize));
+                if (storedSize > remainingStored || storedSize > size)
+                    return false;
+                blocks.push_back({data, storedSize, size});
+                data += storedSize;
+                remainingStored -= storedSize;
+                remainingSize -= size;
+            }
+            return remainingStored == 0;
         }
 
-        bool VerifyData(std::ifstream &file, uint64_t size, uint64_t expected)
+        bool DecodeBlock(const PackBlock &block, uint8_t *dst)
         {
-            std::array<uint8_t, 65536> buffer{};
-            uint64_t remaining = size;
-            uint64_t hash = 14695981039346656037ull;
-            while (remaining > 0)
+            if (block.storedSize == block.size)
             {
-                const size_t chunk = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
-                if (!file.read(reinterpret_cast<char *>(buffer.data()), chunk))
-                    return false;
-                hash = HashBytes(buffer.data(), chunk, hash);
-                remaining -= chunk;
+                std::memcpy(dst, block.data, block.size);
+                return true;
             }
-            return hash == expected;
+            return Lz4Decompress(block.data, block.storedSize, dst, block.size);
         }
-    } // namespace
 
-    bool OpenGamePack(const std::filesystem::path &path, std::string *error)
-    {
-        CloseGamePack();
+        // Already-compressed formats gain nothing from another pass; everything else is tried and kept
+        // only when it pays for the block index
+        PackCodec ChooseCodec(const std::string &path, size_t size)
+        {
+            if (size < 256)
+                return PackCodec::Raw;
+            std::string extension = std::filesystem::path(path).extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(),
+                           [](unsigned char c)
+                           { return static_cast<char>(std::tolower(c)); });
+            static const std::unordered_set<std::string> s_compressed = {
+                ".png", ".jpg", ".jpeg", ".ogg", ".mp3", ".flac", ".ktx2", ".basis", ".zip", ".gz", ".pepak"};
+            return s_compressed.contains(extension) ? PackCodec::Raw : PackCodec::Lz4;
+        }
 
-        std::ifstream file(path, std::ios::binary | std::ios::ate);
-        if (!file)
+        void StopVerifyThread()
         {
-            SetError(error, "Failed to open game pack: " + path.generic_string());
-            return false;
+            if (!s_verifyThread.joinable())
+                return;
+            s_verifyCancel.store(true, std::memory_order_relaxed);
+            s_verifyThread.join();
+            s_verifyCancel.store(false, std::memory_order_relaxed);
         }
 
-        const std::streamoff end = file.tellg();
-        if (end < static_cast<std::streamoff>(kMagic.size() + sizeof(uint32_t) * 2))
+        template <typename T>
+        bool ReadValue(const uint8_t *&cursor, const uint8_t *end, T &value)
         {
-            SetError(error, "Game pack is truncated: " + path.generic_string());
-            return false;
+            if (static_cast<size_t>(end - cursor) < sizeof(value))
+                return false;
+            std::memcpy(&value, cursor, sizeof(value));
+            cursor += sizeof(value);
+            return true;
         }
-        const uint64_t fileSize = static_cast<uint64_t>(end);
-        file.seekg(0);
 
-        std::array<char, 8> magic{};
-        uint32_t version = 0;
-        uint32_t count = 0;
-        if (!file.read(magic.data(), magic.size()) || !ReadValue(file, version) || !ReadValue(file, count) ||
-            magic != kMagic || version != kVersion || count > kMaxEntries)
+        template <typename T>
+        void WriteValue(std::ofstream &file, const T &value)
         {
-            SetError(error, "Invalid or unsupported game pack: " + path.generic_string());
-            return false;
+            file.write(reinterpret_cast<const char *>(&value), sizeof(value));
         }
 
-        for (uint32_t i = 0; i < count; ++i)
+        template <typename T>
+        void AppendValue(std::string &out, const T &value)
         {
-            uint32_t pathLength = 0;
-            uint64_t dataSize = 0;
-            uint64_t expectedHash = 0;
-            if (!ReadValue(file, pathLength) || !ReadValue(file, dataSize) || !ReadValue(file, expectedHash) ||
-                pathLength == 0 || pathLength > kMaxPathLength)
+            out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+
+        // Checks the header and the toc of a mapped pack; entry data is left to the per-entry hashes
+        bool ParsePack(const MappedFile &pack, const std::filesystem::path &path, PackToc &toc, std::string *error)
+        {
+            const uint8_t *cursor = pack.Data();
+            const uint8_t *const fileEnd = cursor + pack.Size();
+            const uint64_t fileSize = pack.Size();
+            if (fileSize < kHeaderSize)
             {
-                SetError(error, "Invalid game pack entry header");
-                CloseGamePack();
+                SetError(error, "Game pack is truncated: " + path.generic_string());
                 return false;
             }
 
-            std::string entryPath(pathLength, '\0');
-            if (!file.read(entryPath.data(), pathLength))
+            std::array<char, 8> magic{};
+            uint32_t version = 0;
+            uint32_t count = 0;
+            uint32_t blockSize = 0;
+            uint32_t reserved = 0;
+            uint64_t tocOffset = 0;
+            uint64_t tocHash = 0;
+            std::memcpy(magic.data(), cursor, magic.size());
+            cursor += magic.size();
+            if (!ReadValue(cursor, fileEnd, version) || !ReadValue(cursor, fileEnd, count) ||
+                !ReadValue(cursor, fileEnd, blockSize) || !ReadValue(cursor, fileEnd, reserved) ||
+                !ReadValue(cursor, fileEnd, tocOffset) || !ReadValue(cursor, fileEnd, tocHash) ||
+                magic != kMagic || version != kVersion || count > kMaxEntries ||
+                blockSize < 4096 || blockSize > (16u << 20))
             {
-                SetError(error, "Truncated game pack path");
-                CloseGamePack();
+                SetError(error, "Invalid or unsupported game pack (re-export the game): " + path.generic_string());
                 return false;
             }
-            entryPath = NormalizeRelativePath(std::move(entryPath));
-            if (entryPath.empty() || s_entries.contains(entryPath))
+
+            // The toc is the only part hashed up front: it is small and every offset below comes from it
+            if (tocOffset < kHeaderSize || tocOffset > fileSize ||
+                XxHash64(pack.Data() + tocOffset, static_cast<size_t>(fileSize - tocOffset)) != tocHash)
             {
-                SetError(error, "Invalid or duplicate game pack path");
-                CloseGamePack();
+                SetError(error, "Corrupt game pack table of contents: " + path.generic_string());
                 return false;
             }
 
-            const std::streamoff dataOffset = file.tellg();
-            if (dataOffset < 0 || static_cast<uint64_t>(dataOffset) > fileSize ||
-                dataSize > fileSize - static_cast<uint64_t>(dataOffset) ||
-                !VerifyData(file, dataSize, expectedHash))
+            cursor = pack.Data() + tocOffset;
+            toc.blockSize = blockSize;
+            toc.entries.reserve(count);
+            toc.index.reserve(count);
+            for (uint32_t i = 0; i < count; ++i)
             {
-                SetError(error, "Corrupt game pack entry: " + entryPath);
-                CloseGamePack();
+                uint32_t pathLength = 0;
+                uint32_t codec = 0;
+                PackEntry entry;
+                if (!ReadValue(cursor, fileEnd, pathLength) || !ReadValue(cursor, fileEnd, codec) ||
+                    !ReadValue(cursor, fileEnd, entry.offset) || !ReadValue(cursor, fileEnd, entry.storedSize) ||
+                    !ReadValue(cursor, fileEnd, entry.size) || !ReadValue(cursor, fileEnd, entry.hash) ||
+                    !ReadValue(cursor, fileEnd, entry.contentHash) ||
+                    codec >= static_cast<uint32_t>(PackCodec::Count) || pathLength == 0 || pathLength > kMaxPathLength ||
+                    static_cast<size_t>(fileEnd - cursor) < pathLength)
+                {
+                    SetError(error, "Invalid game pack entry header");
+                    return false;
+                }
+
+                std::string entryPath = NormalizeRelativePath(std::string(reinterpret_cast<const char *>(cursor), pathLength));
+                cursor += pathLength;
+                if (entryPath.empty() || toc.index.contains(entryPath))
+                {
+                    SetError(error, "Invalid or duplicate game pack path");
+                    return false;
+                }
+
+                entry.codec = static_cast<PackCodec>(codec);
+                if (entry.offset < kHeaderSize || entry.offset > tocOffset || entry.storedSize > tocOffset - entry.offset ||
+                    entry.size > std::numeric_limits<size_t>::max() ||
+                    (entry.codec == PackCodec::Raw && entry.storedSize != entry.size))
+                {
+                    SetError(error, "Corrupt game pack entry: " + entryPath);
+                    return false;
+                }
+
+                toc.index.emplace(std::move(entryPath), static_cast<uint32_t>(toc.entries.size()));
+                toc.entries.push_back(entry);
+            }
+
+            if (cursor != fileEnd)
+            {
+                SetError(error, "Unexpected trailing data in game pack");
                 return false;
             }
+            return true;
+        }
 
-            s_entries.emplace(entryPath, PackEntry{static_cast<uint64_t>(dataOffset), dataSize});
-            const size_t slash = entryPath.find('/');
-            s_managedRoots.insert(entryPath.substr(0, slash));
+        // Lz4 entry layout: the u32 stored size of every block, then the blocks
+        void CompressEntry(std::span<const uint8_t> data, std::vector<uint8_t> &out)
+        {
+            const size_t blockCount = (data.size() + kBlockSize - 1) / kBlockSize;
+            std::vector<std::vector<uint8_t>> blocks(blockCount); // empty: the block is stored raw
+            auto compress = [&](uint32_t b)
+            {
+                const size_t offset = static_cast<size_t>(b) * kBlockSize;
+                const size_t size = std::min<size_t>(kBlockSize, data.size() - offset);
+                std::vector<uint8_t> &block = blocks[b];
+                block.resize(Lz4CompressBound(size));
+                const size_t written = Lz4Compress(data.data() + offset, size, block.data(), block.size());
+                if (written == 0 || written >= size)
+                    block.clear();
+                else
+                    block.resize(written);
+            };
+            // A single large mesh spreads over the workers as well as a window of small scripts does
+            if (blockCount >= kParallelBlocks)
+                ParallelFor(static_cast<uint32_t>(blockCount), 1, compress, JobPriority::Normal);
+            else
+                for (uint32_t b = 0; b < blockCount; ++b)
+                    compress(b);
+
+            out.assign(blockCount * sizeof(uint32_t), 0);
+            for (size_t b = 0; b < blockCount; ++b)
+            {
+                const std::vector<uint8_t> &block = blocks[b];
+                const size_t rawOffset = b * kBlockSize;
+                const uint32_t rawSize = static_cast<uint32_t>(std::min<size_t>(kBlockSize, data.size() - rawOffset));
+                const uint32_t storedSize = block.empty() ? rawSize : static_cast<uint32_t>(block.size());
+                std::memcpy(out.data() + b * sizeof(uint32_t), &storedSize, sizeof(storedSize));
+                if (block.empty())
+                    out.insert(out.end(), data.begin() + rawOffset, data.begin() + rawOffset + rawSize);
+                else
+                    out.insert(out.end(), block.begin(), block.end());
+            }
         }
 
-        if (static_cast<uint64_t>(file.tellg()) != fileSize)
+        // A process that never closes the pack still has to stop the verifier before s_pack unmaps
+        struct PackShutdown
+        {
+            ~PackShutdown() { StopVerifyThread(); }
+        } s_packShutdown;
+    } // namespace
+
+    bool OpenGamePack(const std::filesystem::path &path, std::string *error)
+    {
+        CloseGamePack();
+
+        if (!s_pack.Open(path))
+        {
+            SetError(error, "Failed to open game pack: " + path.generic_string());
+            return false;
+        }
+
+        PackToc toc;
+        if (!ParsePack(s_pack, path, toc, error))
         {
-            SetError(error, "Unexpected trailing data in game pack");
             CloseGamePack();
             return false;
         }
 
+        for (const auto &[entryPath, index] : toc.index)
+        {
+            (void)index;
+            s_managedRoots.insert(entryPath.substr(0, entryPath.find('/')));
+        }
+        const uint32_t count = static_cast<uint32_t>(toc.entries.size());
+        s_entryList = std::move(toc.entries);
+        s_entries = std::move(toc.index);
+
+        s_entryState = std::make_unique<std::atomic<EntryState>[]>(count);
+        for (uint32_t i = 0; i < count; ++i)
+            s_entryState[i].store(EntryState::Unverified, std::memory_order_relaxed);
+
+        s_blockSize = toc.blockSize;
         s_packPath = std::filesystem::absolute(path).lexically_normal();
         Path::Init();
         s_assetsRoot = CanonicalRootString(Path::Assets);
@@ -243,13 +455,46 @@ namespace pe
 
     void CloseGamePack()
     {
+        StopVerifyThread();
+        s_pack.Close();
         s_packPath.clear();
+        s_entryList.clear();
+        s_entryState.reset();
         s_entries.clear();
         s_managedRoots.clear();
         s_assetsRoot.clear();
         s_runtimeAssetsRoot.clear();
     }
 
+    bool VerifyGamePack(std::string *error)
+    {
+        for (const auto &[path, index] : s_entries)
+        {
+            if (!VerifyEntry(index))
+            {
+                SetError(error, "Corrupt game pack entry: " + path);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void VerifyGamePackInBackground()
+    {
+        if (!HasGamePack() || s_verifyThread.joinable())
+            return;
+
+        // File order, so a cold pack streams in sequentially instead of seeking
+        s_verifyThread = std::thread([]()
+                                     {
+                                         for (uint32_t i = 0; i < s_entryList.size(); ++i)
+                                         {
+                                             if (s_verifyCancel.load(std::memory_order_relaxed))
+                                                 return;
+                                             VerifyEntry(i);
+                                         } });
+    }
+
     bool HasGamePack()
     {
         return !s_packPath.empty();
@@ -277,23 +522,126 @@ namespace pe
         return s_managedRoots.contains(relative.substr(0, slash));
     }
 
-    std::optional<std::string> ReadGamePackAsset(const std::filesystem::path &path)
+    std::optional<std::span<const uint8_t>> ViewGamePackAsset(const std::filesystem::path &path)
     {
-        const std::string relative = ToPackPath(path);
-        const auto it = s_entries.find(relative);
+        const auto it = s_entries.find(ToPackPath(path));
+        if (it == s_entries.end() || s_entryList[it->second].codec != PackCodec::Raw || !VerifyEntry(it->second))
+            return std::nullopt;
+        const PackEntry &entry = s_entryList[it->second];
+        return std::span<const uint8_t>(s_pack.Data() + entry.offset, static_cast<size_t>(entry.size));
+    }
+
+    std::optional<uint64_t> GetGamePackAssetSize(const std::filesystem::path &path)
+    {
+        const auto it = s_entries.find(ToPackPath(path));
         if (it == s_entries.end())
             return std::nullopt;
+        return s_entryList[it->second].size;
+    }
+
+    bool VerifyGamePackContent(std::string *error)
+    {
+        if (!VerifyGamePack(error))
+            return false;
+
+        for (const auto &[path, index] : s_entries)
+        {
+            const PackEntry &entry = s_entryList[index];
+            if (entry.codec == PackCodec::Raw)
+            {
+                if (XxHash64(s_pack.Data() + entry.offset, static_cast<size_t>(entry.size)) == entry.contentHash)
+                    continue;
+            }
+            else
+            {
+                const std::optional<std::string> data = ReadGamePackAsset(path);
+                if (data && XxHash64(data->data(), data->size()) == entry.contentHash)
+                    continue;
+            }
+            SetError(error, "Game pack entry does not decode to its content: " + path);
+            return false;
+        }
+        return true;
+    }
+
+    std::optional<std::string> ReadGamePackAsset(const std::filesystem::path &path)
+    {
+        const auto it = s_entries.find(ToPackPath(path));
+        if (it == s_entries.end() || !VerifyEntry(it->second))
+            return std::nullopt;
+
+        const PackEntry &entry = s_entryList[it->second];
+        const uint8_t *stored = s_pack.Data() + entry.offset;
+        if (entry.codec == PackCodec::Raw)
+            return std::string(reinterpret_cast<const char *>(stored), static_cast<size_t>(entry.size));
 
-        std::ifstream file(s_packPath, std::ios::binary);
-        if (!file || it->second.size > std::numeric_limits<size_t>::max())
+        std::vector<PackBlock> blocks;
+        if (!LocateBlocks(entry, blocks))
             return std::nullopt;
-        file.seekg(static_cast<std::streamoff>(it->second.offset));
-        std::string data(static_cast<size_t>(it->second.size), '\0');
-        if (!file.read(data.data(), static_cast<std::streamsize>(data.size())))
+
+        std::string data(static_cast<size_t>(entry.size), '\0');
+        uint8_t *out = reinterpret_cast<uint8_t *>(data.data());
+        std::atomic<bool> valid{true};
+        auto decode = [&](uint32_t i)
+        {
+            if (!DecodeBlock(blocks[i], out + static_cast<size_t>(i) * s_blockSize))
+                valid.store(false, std::memory_order_relaxed);
+        };
+        if (blocks.size() >= kParallelBlocks)
+            ParallelFor(static_cast<uint32_t>(blocks.size()), 1, decode, JobPriority::Normal);
+        else
+            for (uint32_t i = 0; i < blocks.size(); ++i)
+                decode(i);
+        if (!valid.load(std::memory_order_relaxed))
             return std::nullopt;
         return data;
     }
 
+    bool ReadGamePackAssetRange(const std::filesystem::path &path, uint64_t offset, std::span<uint8_t> out)
+    {
+        const auto it = s_entries.find(ToPackPath(path));
+        if (it == s_entries.end() || !VerifyEntry(it->second))
+            return false;
+
+        const PackEntry &entry = s_entryList[it->second];
+        if (offset > entry.size || out.size() > entry.size - offset)
+            return false;
+        if (out.empty())
+            return true;
+        if (entry.codec == PackCodec::Raw)
+        {
+            std::memcpy(out.data(), s_pack.Data() + entry.offset + offset, out.size());
+            return true;
+        }
+
+        std::vector<PackBlock> blocks;
+        if (!LocateBlocks(entry, blocks))
+            return false;
+
+        // Only the blocks the range touches are decoded; partial ones go through a scratch block
+        thread_local std::vector<uint8_t> scratch;
+        const uint64_t end = offset + out.size();
+        for (uint64_t b = offset / s_blockSize; b * s_blockSize < end; ++b)
+        {
+            const PackBlock &block = blocks[static_cast<size_t>(b)];
+            const uint64_t blockStart = b * s_blockSize;
+            const uint64_t from = std::max(offset, blockStart);
+            const uint64_t to = std::min(end, blockStart + block.size);
+            uint8_t *dst = out.data() + (from - offset);
+            if (from == blockStart && to == blockStart + block.size)
+            {
+                if (!DecodeBlock(block, dst))
+                    return false;
+                continue;
+            }
+            scratch.resize(block.size);
+            if (!DecodeBlock(block, scratch.data()))
+                return false;
+            std::memcpy(dst, scratch.data() + (from - blockStart), static_cast<size_t>(to - from));
+        }
+        return true;
+    }
+
     std::vector<std::string> ListGamePackAssets(const std::filesystem::path &prefix)
     {
         std::vector<std::string> paths;
@@ -304,9 +652,9 @@ namespace pe
         if (!normalizedPrefix.empty() && normalizedPrefix.back() != '/')
             normalizedPrefix.push_back('/');
 
-        for (const auto &[path, entry] : s_entries)
+        for (const auto &[path, index] : s_entries)
         {
-            (void)entry;
+            (void)index;
             if (projectRoot && path.starts_with("RuntimeAssets/"))
                 continue;
             if (normalizedPrefix.empty() || path.starts_with(normalizedPrefix))
@@ -320,15 +668,94 @@ namespace pe
                        const std::vector<GamePackBuildEntry> &entries,
                        std::string *error)
     {
-        if (entries.size() > kMaxEntries)
+        GamePackWriter writer;
+        for (const GamePackBuildEntry &entry : entries)
+            writer.AddView(entry.path, entry.data);
+        return writer.Write(path, error);
+    }
+
+    GamePackWriter::GamePackWriter(std::filesystem::path previousPack)
+        : m_previousPack(std::move(previousPack))
+    {
+    }
+
+    void GamePackWriter::Add(std::string path, uint64_t sizeHint, Loader loader)
+    {
+        Source &source = m_sources.emplace_back();
+        source.path = std::move(path);
+        source.sizeHint = sizeHint;
+        source.loader = std::move(loader);
+    }
+
+    void GamePackWriter::AddFile(std::string path, std::filesystem::path file)
+    {
+        std::error_code ec;
+        const uint64_t size = std::filesystem::file_size(file, ec);
+        Source &source = m_sources.emplace_back();
+        source.path = std::move(path);
+        source.sizeHint = ec ? 0 : size;
+        source.file = std::move(file);
+    }
+
+    void GamePackWriter::AddView(std::string path, std::span<const uint8_t> data)
+    {
+        Source &source = m_sources.emplace_back();
+        source.path = std::move(path);
+        source.sizeHint = data.size();
+        source.view = data;
+    }
+
+    bool GamePackWriter::Write(const std::filesystem::path &path, std::string *error)
+    {
+        m_stats = {};
+        if (m_sources.size() > kMaxEntries)
         {
             SetError(error, "Too many game pack entries");
             return false;
         }
 
+        std::vector<std::string> normalizedPaths;
+        normalizedPaths.reserve(m_sources.size());
+        std::unordered_set<std::string> paths;
+        for (const Source &source : m_sources)
+        {
+            std::string normalized = NormalizeRelativePath(source.path);
+            if (normalized.empty() || normalized.size() > kMaxPathLength || !paths.insert(normalized).second)
+            {
+                SetError(error, "Invalid or duplicate game pack path: " + source.path);
+                return false;
+            }
+            normalizedPaths.push_back(std::move(normalized));
+        }
+
+        std::vector<uint32_t> order(m_sources.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&normalizedPaths](uint32_t a, uint32_t b)
+                  { return normalizedPaths[a] < normalizedPaths[b]; });
+
+        std::error_code ec;
+        MappedFile previous;
+        PackToc previousToc;
+        bool reuse = false;
+        if (!m_previousPack.empty() && std::filesystem::exists(m_previousPack, ec))
+        {
+            std::string reason = "cannot be opened";
+            reuse = previous.Open(m_previousPack) && ParsePack(previous, m_previousPack, previousToc, &reason);
+            if (reuse && previousToc.blockSize != kBlockSize)
+            {
+                reason = "different block size";
+                reuse = false;
+            }
+            if (!reuse)
+            {
+                PE_WARN("Rebuilding every game pack entry, previous pack %s: %s",
+                        m_previousPack.generic_string().c_str(), reason.c_str());
+                previous.Close();
+            }
+        }
+
         std::filesystem::path temporary = path;
         temporary += ".tmp";
-        std::error_code ec;
         std::filesystem::create_directories(path.parent_path(), ec);
         if (ec)
         {
@@ -343,51 +770,169 @@ namespace pe
             SetError(error, "Failed to create game pack: " + temporary.generic_string());
             return false;
         }
+        auto fail = [&](std::string message)
+        {
+            file.close();
+            std::filesystem::remove(temporary, ec);
+            SetError(error, std::move(message));
+            return false;
+        };
 
-        file.write(kMagic.data(), kMagic.size());
-        WriteValue(file, kVersion);
-        const uint32_t count = static_cast<uint32_t>(entries.size());
-        WriteValue(file, count);
+        // Header placeholder; the toc offset and hash are patched in once the data is written
+        const std::array<char, kHeaderSize> zeroHeader{};
+        file.write(zeroHeader.data(), zeroHeader.size());
 
-        std::unordered_set<std::string> paths;
-        for (const GamePackBuildEntry &entry : entries)
+        struct Prepared
         {
-            const std::string normalized = NormalizeRelativePath(entry.path);
-            if (normalized.empty() || normalized.size() > kMaxPathLength || !paths.insert(normalized).second)
+            MappedFile mapped;          // AddFile sources are mapped, not copied
+            std::vector<uint8_t> data;  // what a Loader produced
+            std::vector<uint8_t> compressed;
+            std::span<const uint8_t> stored;
+            PackCodec codec = PackCodec::Raw;
+            uint64_t size = 0;
+            uint64_t hash = 0;
+            uint64_t contentHash = 0;
+            bool reused = false;
+            std::string error;
+        };
+
+        auto prepare = [&](const Source &source, const std::string &packPath, Prepared &out)
+        {
+            std::span<const uint8_t> content = source.view;
+            if (!source.file.empty())
             {
-                file.close();
-                std::filesystem::remove(temporary, ec);
-                SetError(error, "Invalid or duplicate game pack path: " + entry.path);
-                return false;
+                if (!out.mapped.Open(source.file))
+                {
+                    out.error = "Failed to read " + source.file.generic_string();
+                    return;
+                }
+                content = out.mapped.Bytes();
+            }
+            else if (source.loader)
+            {
+                try
+                {
+                    out.data = source.loader();
+                }
+                catch (const std::exception &e)
+                {
+                    out.error = e.what();
+                    return;
+                }
+                content = out.data;
             }
+            out.size = content.size();
+            out.contentHash = XxHash64(content.data(), content.size());
 
-            const uint32_t pathLength = static_cast<uint32_t>(normalized.size());
-            const uint64_t dataSize = static_cast<uint64_t>(entry.data.size());
-            const uint64_t hash = HashBytes(entry.data.data(), entry.data.size());
-            WriteValue(file, pathLength);
-            WriteValue(file, dataSize);
-            WriteValue(file, hash);
-            file.write(normalized.data(), normalized.size());
-            file.write(reinterpret_cast<const char *>(entry.data.data()),
-                       static_cast<std::streamsize>(entry.data.size()));
+            if (reuse)
+            {
+                const auto it = previousToc.index.find(packPath);
+                if (it != previousToc.index.end())
+                {
+                    // The old stored bytes are rehashed so a damaged previous pack cannot leak into this one
+                    const PackEntry &old = previousToc.entries[it->second];
+                    const uint8_t *oldStored = previous.Data() + old.offset;
+                    if (old.contentHash == out.contentHash && old.size == out.size &&
+                        XxHash64(oldStored, static_cast<size_t>(old.storedSize)) == old.hash)
+                    {
+                        out.stored = {oldStored, static_cast<size_t>(old.storedSize)};
+                        out.codec = old.codec;
+                        out.hash = old.hash;
+                        out.reused = true;
+                        return;
+                    }
+                }
+            }
+
+            out.stored = content;
+            if (ChooseCodec(packPath, content.size()) == PackCodec::Lz4)
+            {
+                CompressEntry(content, out.compressed);
+                // Keep it compressed only when that saves at least 1/16 after the block index
+                if (out.compressed.size() <= content.size() - content.size() / 16)
+                {
+                    out.codec = PackCodec::Lz4;
+                    out.stored = out.compressed;
+                }
+            }
+            out.hash = XxHash64(out.stored.data(), out.stored.size());
+        };
+
+        std::string toc;
+        toc.reserve(m_sources.size() * (kTocEntrySize + 64));
+        uint64_t offset = kHeaderSize;
+        for (size_t first = 0; first < order.size();)
+        {
+            // Load and compress a window of entries across the workers, then write it in order; memory
+            // stays at one window instead of the whole game
+            size_t last = first;
+            uint64_t windowBytes = 0;
+            while (last < order.size() && last - first < kWriteWindowEntries &&
+                   (last == first || windowBytes + m_sources[order[last]].sizeHint <= kWriteWindowBytes))
+            {
+                windowBytes += m_sources[order[last]].sizeHint;
+                ++last;
+            }
+
+            std::vector<Prepared> window(last - first);
+            ParallelFor(static_cast<uint32_t>(window.size()), 1, [&](uint32_t i)
+                        {
+                            const uint32_t index = order[first + i];
+                            prepare(m_sources[index], normalizedPaths[index], window[i]); }, JobPriority::Normal);
+
+            for (size_t i = 0; i < window.size(); ++i)
+            {
+                const Prepared &entry = window[i];
+                const std::string &normalized = normalizedPaths[order[first + i]];
+                if (!entry.error.empty())
+                    return fail(normalized + ": " + entry.error);
+
+                const uint64_t padding = (kDataAlignment - offset % kDataAlignment) % kDataAlignment;
+                file.write(zeroHeader.data(), static_cast<std::streamsize>(padding));
+                offset += padding;
+
+                AppendValue(toc, static_cast<uint32_t>(normalized.size()));
+                AppendValue(toc, static_cast<uint32_t>(entry.codec));
+                AppendValue(toc, offset);
+                AppendValue(toc, static_cast<uint64_t>(entry.stored.size()));
+                AppendValue(toc, entry.size);
+                AppendValue(toc, entry.hash);
+                AppendValue(toc, entry.contentHash);
+                toc += normalized;
+
+                file.write(reinterpret_cast<const char *>(entry.stored.data()), static_cast<std::streamsize>(entry.stored.size()));
+                offset += entry.stored.size();
+
+                ++m_stats.entries;
+                m_stats.reused += entry.reused ? 1 : 0;
+                m_stats.rawBytes += entry.size;
+                m_stats.storedBytes += entry.stored.size();
+            }
+            first = last;
         }
+        // Unmapped before the rename below, which may replace the very file it maps
+        previous.Close();
+
+        const uint64_t tocOffset = offset;
+        file.write(toc.data(), static_cast<std::streamsize>(toc.size()));
+
+        file.seekp(0);
+        file.write(kMagic.data(), kMagic.size());
+        WriteValue(file, kVersion);
+        WriteValue(file, static_cast<uint32_t>(order.size()));
+        WriteValue(file, kBlockSize);
+        WriteValue(file, uint32_t{0});
+        WriteValue(file, tocOffset);
+        WriteValue(file, XxHash64(toc.data(), toc.size()));
         file.close();
         if (!file)
-        {
-            std::filesystem::remove(temporary, ec);
-            SetError(error, "Failed while writing game pack");
-            return false;
-        }
+            return fail("Failed while writing game pack");
 
         std::filesystem::remove(path, ec);
         ec.clear();
         std::filesystem::rename(temporary, path, ec);
         if (ec)
-        {
-            std::filesystem::remove(temporary, ec);
-            SetError(error, "Failed to finalize game pack: " + ec.message());
-            return false;
-        }
+            return fail("Failed to finalize game pack: " + ec.message());
         return true;
     }
 } // namespace pe
@@ -16,9 +16,65 @@ namespace pe
     [[nodiscard]] bool HasGamePack();
     [[nodiscard]] bool HasGamePackAsset(const std::filesystem::path &path);
     [[nodiscard]] bool IsGamePackManagedAsset(const std::filesystem::path &path);
+    // Entries are hash-checked on first access (or by VerifyGamePack*), not at open: a corrupt entry
+    // reads as missing. Views point into the mapped pack and stay valid until CloseGamePack; only
+    // entries stored uncompressed have one, the rest go through the Read functions.
+    [[nodiscard]] std::optional<std::span<const uint8_t>> ViewGamePackAsset(const std::filesystem::path &path);
+    [[nodiscard]] std::optional<uint64_t> GetGamePackAssetSize(const std::filesystem::path &path);
     [[nodiscard]] std::optional<std::string> ReadGamePackAsset(const std::filesystem::path &path);
+    // Decodes only the compressed blocks overlapping [offset, offset + out.size())
+    [[nodiscard]] bool ReadGamePackAssetRange(const std::filesystem::path &path, uint64_t offset, std::span<uint8_t> out);
+    // Checks every entry not yet checked, now; false (with the entry in `error`) on the first corrupt one
+    [[nodiscard]] bool VerifyGamePack(std::string *error = nullptr);
+    // VerifyGamePack plus a full decode of every entry, checked against the content hash recorded when
+    // the pack was built; catches codec bugs the stored-bytes hash cannot. The exporter runs it.
+    [[nodiscard]] bool VerifyGamePackContent(std::string *error = nullptr);
+    // Checks the remaining entries on a background thread in file order; CloseGamePack stops it
+    void VerifyGamePackInBackground();
     [[nodiscard]] std::vector<std::string> ListGamePackAssets(const std::filesystem::path &prefix = {});
     [[nodiscard]] bool WriteGamePack(const std::filesystem::path &path,
                                      const std::vector<GamePackBuildEntry> &entries,
                                      std::string *error = nullptr);
+
+    // Builds a pack without holding the game in memory: sources are loaded, hashed and compressed on
+    // the job system a window at a time and written out in path order. Given the previous build of
+    // the pack, an entry whose content hash did not change is copied from it as stored instead of
+    // being compressed again.
+    class GamePackWriter
+    {
+    public:
+        // Runs on a job worker; throwing fails Write with the exception's message
+        using Loader = std::function<std::vector<uint8_t>()>;
+
+        struct Stats
+        {
+            uint32_t entries = 0;
+            uint32_t reused = 0; // copied from the previous pack
+            uint64_t rawBytes = 0;
+            uint64_t storedBytes = 0;
+        };
+
+        explicit GamePackWriter(std::filesystem::path previousPack = {});
+
+        // sizeHint only paces how many entries are in flight at once
+        void Add(std::string path, uint64_t sizeHint, Loader loader);
+        void AddFile(std::string path, std::filesystem::path file); // mapped, not copied
+        void AddView(std::string path, std::span<const uint8_t> data); // must outlive Write
+        [[nodiscard]] bool Write(const std::filesystem::path &path, std::string *error = nullptr);
+        [[nodiscard]] const Stats &GetStats() const { return m_stats; }
+
+    private:
+        struct Source
+        {
+            std::string path;
+            uint64_t sizeHint = 0;
+            Loader loader;
+            std::filesystem::path file;
+            std::span<const uint8_t> view;
+        };
+
+        std::filesystem::path m_previousPack;
+        std::vector<Source> m_sources;
+        Stats m_stats;
+    };
 } // namespace pe
@@ -31,6 +31,63 @@ namespace pe
         return hash;
     }
 
+    // XXH64 over a byte range: four independent 64-bit lanes per 32-byte stripe, so it runs at
+    // memory bandwidth where byte-at-a-time FNV-1a manages ~1 GB/s. Portable and stable across
+    // toolchains (little-endian reads), so it is safe for hashes persisted to disk (game packs).
+    inline uint64_t XxHash64(const void *data, size_t size, uint64_t seed = 0) noexcept
+    {
+        constexpr uint64_t P1 = 11400714785074694791ULL;
+        constexpr uint64_t P2 = 14029467366897019727ULL;
+        constexpr uint64_t P3 = 1609587929392839161ULL;
+        constexpr uint64_t P4 = 9650029242287828579ULL;
+        constexpr uint64_t P5 = 2870177450012600261ULL;
+
+        const auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+        const auto read64 = [](const uint8_t *p) { uint64_t v; std::memcpy(&v, p, 8); return v; };
+        const auto read32 = [](const uint8_t *p) { uint32_t v; std::memcpy(&v, p, 4); return static_cast<uint64_t>(v); };
+        const auto round = [&rotl](uint64_t acc, uint64_t input) { return rotl(acc + input * P2, 31) * P1; };
+        const auto merge = [&round](uint64_t acc, uint64_t lane) { return (acc ^ round(0, lane)) * P1 + P4; };
+
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        const uint8_t *const end = p + size;
+        uint64_t hash;
+        if (size >= 32)
+        {
+            uint64_t v1 = seed + P1 + P2, v2 = seed + P2, v3 = seed, v4 = seed - P1;
+            for (const uint8_t *const limit = end - 32; p <= limit; p += 32)
+            {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+            }
+            hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            hash = merge(merge(merge(merge(hash, v1), v2), v3), v4);
+        }
+        else
+        {
+            hash = seed + P5;
+        }
+        hash += static_cast<uint64_t>(size);
+
+        for (; p + 8 <= end; p += 8)
+            hash = rotl(hash ^ round(0, read64(p)), 27) * P1 + P4;
+        if (p + 4 <= end)
+        {
+            hash = rotl(hash ^ (read32(p) * P1), 23) * P2 + P3;
+            p += 4;
+        }
+        for (; p < end; ++p)
+            hash = rotl(hash ^ (*p * P5), 11) * P1;
+
+        hash ^= hash >> 33;
+        hash *= P2;
+        hash ^= hash >> 29;
+        hash *= P3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
     class Hash
     {
     public:
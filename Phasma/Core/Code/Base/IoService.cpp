@@ -0,0 +1,699 @@
+#include "Base/IoService.h"
+#include "Base/GamePack.h"
+#if defined(PE_LINUX)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace pe
+{
+    namespace
+    {
+        constexpr uint32_t YieldsBeforeSleep = 64;
+        constexpr uint32_t IoThreadCount = 3;
+
+        JobPriority ToJobPriority(IoPriority priority)
+        {
+            return static_cast<JobPriority>(priority);
+        }
+
+        std::filesystem::path ToPath(const std::string &utf8)
+        {
+            return std::filesystem::path(reinterpret_cast<const char8_t *>(utf8.c_str()));
+        }
+
+        // Clamps the requested range to a file of `fileSize` bytes; false when it starts past the end
+        bool ResolveRange(const IoRead &read, uint64_t fileSize, uint64_t &size)
+        {
+            if (read.offset > fileSize)
+                return false;
+            size = std::min(read.size, fileSize - read.offset);
+            return true;
+        }
+
+        IoStatus ReadFromPack(const IoRead &read, std::vector<uint8_t> &data, std::span<const uint8_t> &bytes)
+        {
+            const std::filesystem::path path = ToPath(read.path);
+            const std::optional<uint64_t> fileSize = GetGamePackAssetSize(path);
+            uint64_t size = 0;
+            if (!fileSize)
+                return IoStatus::NotFound;
+            if (!ResolveRange(read, *fileSize, size))
+                return IoStatus::Failed;
+
+            if (std::optional<std::span<const uint8_t>> view = ViewGamePackAsset(path))
+            {
+                bytes = view->subspan(read.offset, size);
+                return IoStatus::Done;
+            }
+
+            data.resize(size);
+            if (!ReadGamePackAssetRange(path, read.offset, data))
+                return IoStatus::Failed;
+            bytes = data;
+            return IoStatus::Done;
+        }
+
+        // Blocking read for the thread backend
+        IoStatus ReadLoose(const IoRead &read, std::vector<uint8_t> &data)
+        {
+            const std::filesystem::path path = ToPath(read.path);
+            std::ifstream in(path, std::ios::binary | std::ios::ate);
+            if (!in.is_open())
+            {
+                std::error_code ec;
+                return std::filesystem::exists(path, ec) ? IoStatus::Failed : IoStatus::NotFound;
+            }
+
+            uint64_t size = 0;
+            if (!ResolveRange(read, static_cast<uint64_t>(in.tellg()), size))
+                return IoStatus::Failed;
+
+            data.resize(size);
+            in.seekg(static_cast<std::streamoff>(read.offset));
+            in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(size));
+            return in ? IoStatus::Done : IoStatus::Failed;
+        }
+    } // namespace
+
+#if defined(PE_LINUX)
+    // A single io_uring driven through the raw syscalls (liburing is not a dependency). Only the ring
+    // thread touches the submission side, so the SQ needs no lock; an eventfd poll stays armed so a new
+    // request wakes a thread blocked in io_uring_enter.
+    class IoService::Ring
+    {
+    public:
+        static constexpr uint32_t Depth = 32;
+        static constexpr uint64_t WakeTag = 0;
+
+        struct Read
+        {
+            IoHandle request;
+            int fd = -1;
+            uint64_t offset = 0; // of the next byte in the file
+            uint64_t done = 0;
+            iovec iov{};
+        };
+
+        static std::unique_ptr<Ring> Create()
+        {
+            auto ring = std::unique_ptr<Ring>(new Ring());
+            return ring->Init() ? std::move(ring) : nullptr;
+        }
+
+        ~Ring()
+        {
+            if (m_sqes)
+                munmap(m_sqes, m_sqesSize);
+            if (m_cqRing && m_cqRing != m_sqRing)
+                munmap(m_cqRing, m_cqRingSize);
+            if (m_sqRing)
+                munmap(m_sqRing, m_sqRingSize);
+            if (m_wakeFd >= 0)
+                close(m_wakeFd);
+            if (m_fd >= 0)
+                close(m_fd);
+        }
+
+        void Wake()
+        {
+            const uint64_t one = 1;
+            [[maybe_unused]] const ssize_t written = write(m_wakeFd, &one, sizeof(one));
+        }
+
+        void ArmWake()
+        {
+            io_uring_sqe &sqe = NextSqe();
+            sqe.opcode = IORING_OP_POLL_ADD;
+            sqe.fd = m_wakeFd;
+            sqe.poll_events = POLLIN;
+            sqe.user_data = WakeTag;
+        }
+
+        void DrainWake()
+        {
+            uint64_t value = 0;
+            [[maybe_unused]] const ssize_t bytes = read(m_wakeFd, &value, sizeof(value));
+        }
+
+        void PrepareRead(uint32_t slot)
+        {
+            Read &read = m_reads[slot];
+            read.iov.iov_base = read.request->m_data.data() + read.done;
+            read.iov.iov_len = read.request->m_data.size() - read.done;
+
+            io_uring_sqe &sqe = NextSqe();
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = read.fd;
+            sqe.addr = reinterpret_cast<uint64_t>(&read.iov);
+            sqe.len = 1;
+            sqe.off = read.offset + read.done;
+            sqe.user_data = slot + 1;
+        }
+
+        // Submits what was prepared and, when `wait`, blocks for at least one completion
+        bool Enter(bool wait)
+        {
+            const uint32_t submit = m_pending;
+            for (;;)
+            {
+                const long result = syscall(__NR_io_uring_enter, m_fd, submit, wait ? 1u : 0u,
+                                            wait ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+                if (result >= 0)
+                {
+                    m_pending = 0;
+                    return true;
+                }
+                if (errno != EINTR)
+                    return false;
+            }
+        }
+
+        template <class F>
+        void Reap(F &&onCompletion)
+        {
+            uint32_t head = *m_cqHead;
+            const uint32_t tail = std::atomic_ref<uint32_t>(*m_cqTail).load(std::memory_order_acquire);
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe &cqe = m_cqes[head & m_cqMask];
+                onCompletion(cqe.user_data, cqe.res);
+            }
+            std::atomic_ref<uint32_t>(*m_cqHead).store(head, std::memory_order_release);
+        }
+
+        bool AcquireSlot(uint32_t &slot)
+        {
+            if (m_free.empty())
+                return false;
+            slot = m_free.back();
+            m_free.pop_back();
+            return true;
+        }
+
+        void ReleaseSlot(uint32_t slot)
+        {
+            Read &read = m_reads[slot];
+            if (read.fd >= 0)
+                close(read.fd);
+            read = {};
+            m_free.push_back(slot);
+        }
+
+        Read &Get(uint32_t slot) { return m_reads[slot]; }
+        uint32_t InFlight() const { return Depth - static_cast<uint32_t>(m_free.size()); }
+
+    private:
+        Ring() = default;
+
+        bool Init()
+        {
+            io_uring_params params{};
+            // One extra entry for the wake poll
+            m_fd = static_cast<int>(syscall(__NR_io_uring_setup, Depth + 1, &params));
+            if (m_fd < 0)
+                return false;
+
+            m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+            m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            const bool singleMap = params.features & IORING_FEAT_SINGLE_MMAP;
+            if (singleMap)
+                m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+
+            m_sqRing = Map(m_sqRingSize, IORING_OFF_SQ_RING);
+            m_cqRing = singleMap ? m_sqRing : Map(m_cqRingSize, IORING_OFF_CQ_RING);
+            m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+            m_sqes = static_cast<io_uring_sqe *>(Map(m_sqesSize, IORING_OFF_SQES));
+            if (!m_sqRing || !m_cqRing || !m_sqes)
+                return false;
+
+            auto *sq = static_cast<uint8_t *>(m_sqRing);
+            m_sqTail = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+            m_sqMask = *reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+            m_sqArray = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+
+            auto *cq = static_cast<uint8_t *>(m_cqRing);
+            m_cqHead = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+            m_cqTail = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+            m_cqMask = *reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+            m_cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+            m_wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            if (m_wakeFd < 0)
+                return false;
+
+            m_reads.resize(Depth);
+            for (uint32_t i = Depth; i-- > 0;)
+                m_free.push_back(i);
+            return true;
+        }
+
+        void *Map(size_t size, uint64_t offset)
+        {
+            void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, static_cast<off_t>(offset));
+            return ptr == MAP_FAILED ? nullptr : ptr;
+        }
+
+        io_uring_sqe &NextSqe()
+        {
+            const uint32_t tail = *m_sqTail;
+            const uint32_t index = tail & m_sqMask;
+            io_uring_sqe &sqe = m_sqes[index];
+            sqe = {};
+            m_sqArray[index] = index;
+            std::atomic_ref<uint32_t>(*m_sqTail).store(tail + 1, std::memory_order_release);
+            ++m_pending;
+            return sqe;
+        }
+
+        int m_fd = -1;
+        int m_wakeFd = -1;
+        void *m_sqRing = nullptr;
+        void *m_cqRing = nullptr;
+        size_t m_sqRingSize = 0;
+        size_t m_cqRingSize = 0;
+        io_uring_sqe *m_sqes = nullptr;
+        size_t m_sqesSize = 0;
+        uint32_t *m_sqTail = nullptr;
+        uint32_t *m_sqArray = nullptr;
+        uint32_t m_sqMask = 0;
+        uint32_t *m_cqHead = nullptr;
+        uint32_t *m_cqTail = nullptr;
+        io_uring_cqe *m_cqes = nullptr;
+        uint32_t m_cqMask = 0;
+        uint32_t m_pending = 0;
+
+        std::vector<Read> m_reads;
+        std::vector<uint32_t> m_free;
+    };
+#else
+    class IoService::Ring
+    {
+    public:
+        void Wake() {}
+    };
+#endif
+
+    void IoRequest::Wait() const
+    {
+        // Same spin-help as JobCounter::Wait: the callback itself may be queued behind the waiter
+        JobSystem &jobs = JobSystem::Get();
+        uint32_t idle = 0;
+        while (!IsDone())
+        {
+            if (jobs.TryRunOne(ToJobPriority(m_priority)))
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < YieldsBeforeSleep)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    bool IoRequest::Cancel()
+    {
+        return IoService::Get().Cancel(*this);
+    }
+
+    IoService &IoService::Get()
+    {
+        static IoService service;
+        return service;
+    }
+
+    IoService::IoService()
+    {
+        // Completions are job system jobs; constructing it first makes it outlive the service
+        JobSystem::Get();
+
+        const char *env = std::getenv("PE_IO_BACKEND");
+        const bool forceThreads = env && std::string_view(env) == "threads";
+#if defined(PE_LINUX)
+        if (!forceThreads)
+            m_ring = Ring::Create();
+#endif
+
+        if (m_ring)
+        {
+            m_threads.emplace_back([this]()
+                                   { RingLoop(); });
+        }
+        else
+        {
+            for (uint32_t i = 0; i < IoThreadCount; ++i)
+                m_threads.emplace_back([this]()
+                                       { ThreadLoop(); });
+        }
+        PE_INFO("IoService: %s backend", GetBackendName());
+    }
+
+    IoService::~IoService()
+    {
+        std::vector<IoHandle> dropped;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop.store(true);
+            for (auto &queue : m_queues)
+            {
+                for (IoHandle &request : queue)
+                {
+                    if (request->m_queued)
+                        dropped.push_back(request);
+                }
+                queue.clear();
+            }
+            m_queued = 0;
+        }
+        Wake();
+        m_cv.notify_all();
+        for (std::thread &thread : m_threads)
+            thread.join();
+
+        // Past main(): whatever the callbacks captured may be gone, so only waiters are released
+        for (IoHandle &request : dropped)
+        {
+            request->m_status.store(IoStatus::Cancelled, std::memory_order_release);
+            Finish(*request);
+        }
+    }
+
+    const char *IoService::GetBackendName() const
+    {
+        return m_ring ? "io_uring" : "threads";
+    }
+
+    IoService::Stats IoService::GetStats() const
+    {
+        return {m_requests.load(std::memory_order_relaxed), m_packReads.load(std::memory_order_relaxed),
+                m_cancelled.load(std::memory_order_relaxed), m_failed.load(std::memory_order_relaxed),
+                m_bytes.load(std::memory_order_relaxed)};
+    }
+
+    IoHandle IoService::Read(IoRead read, IoPriority priority, IoCallback callback)
+    {
+        auto request = std::make_shared<IoRequest>();
+        request->m_read = std::move(read);
+        request->m_priority = priority;
+        request->m_callback = std::move(callback);
+        request->m_self = request;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Enqueue(request);
+        }
+        Wake();
+        return request;
+    }
+
+    std::vector<IoHandle> IoService::ReadBatch(std::vector<IoRead> reads, IoPriority priority, const IoCallback &callback)
+    {
+        std::vector<IoHandle> requests;
+        requests.reserve(reads.size());
+        for (IoRead &read : reads)
+        {
+            auto request = std::make_shared<IoRequest>();
+            request->m_read = std::move(read);
+            request->m_priority = priority;
+            request->m_callback = callback;
+            request->m_self = request;
+            requests.push_back(std::move(request));
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const IoHandle &request : requests)
+                Enqueue(request);
+        }
+        Wake();
+        return requests;
+    }
+
+    void IoService::Enqueue(const IoHandle &request)
+    {
+        m_requests.fetch_add(1, std::memory_order_relaxed);
+        request->m_queued = true;
+        m_queues[static_cast<size_t>(request->m_priority)].push_back(request);
+        ++m_queued;
+    }
+
+    void IoService::Wake()
+    {
+        if (m_ring)
+            m_ring->Wake();
+        else
+            m_cv.notify_all();
+    }
+
+    IoHandle IoService::PopLocked()
+    {
+        for (auto &queue : m_queues)
+        {
+            while (!queue.empty())
+            {
+                IoHandle request = std::move(queue.front());
+                queue.pop_front();
+                if (!request->m_queued)
+                    continue; // cancelled while queued
+                request->m_queued = false;
+                --m_queued;
+                return request;
+            }
+        }
+        return nullptr;
+    }
+
+    bool IoService::Cancel(IoRequest &request)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!request.m_queued)
+                return false;
+            // Left in its queue as a tombstone; PopLocked skips it
+            request.m_queued = false;
+            --m_queued;
+        }
+        m_cancelled.fetch_add(1, std::memory_order_relaxed);
+        Complete(request, IoStatus::Cancelled);
+        return true;
+    }
+
+    // Pack entries are a copy or a decode out of the mapping, which is CPU work: it runs on the job
+    // system in the completion job itself instead of holding up the disk queue
+    void IoService::Issue(const IoHandle &request)
+    {
+        request->m_fromPack = IsGamePackManagedAsset(ToPath(request->m_read.path));
+        if (request->m_fromPack)
+        {
+            m_packReads.fetch_add(1, std::memory_order_relaxed);
+            request->m_job.execute = RunCompletion;
+            request->m_job.request = request.get();
+            JobSystem::Get().Submit(&request->m_job, ToJobPriority(request->m_priority));
+        }
+    }
+
+    void IoService::Complete(IoRequest &request, IoStatus status)
+    {
+        if (status == IoStatus::Done)
+        {
+            request.m_bytes = request.m_data;
+            m_bytes.fetch_add(request.m_data.size(), std::memory_order_relaxed);
+        }
+        else if (status != IoStatus::Cancelled)
+        {
+            m_failed.fetch_add(1, std::memory_order_relaxed);
+        }
+        request.m_status.store(status, std::memory_order_release);
+
+        // Reads still in flight at shutdown complete past main(), when the callback's captures may be gone
+        if (!request.m_callback || m_stop.load(std::memory_order_relaxed))
+        {
+            Finish(request);
+            return;
+        }
+        request.m_job.execute = RunCompletion;
+        request.m_job.request = &request;
+        JobSystem::Get().Submit(&request.m_job, ToJobPriority(request.m_priority));
+    }
+
+    void IoService::Finish(IoRequest &request)
+    {
+        // The last reference may be this one; drop it only after the flag is published
+        IoHandle self = std::move(request.m_self);
+        request.m_callback = nullptr;
+        request.m_finished.store(true, std::memory_order_release);
+    }
+
+    void IoService::RunCompletion(Job *job)
+    {
+        IoRequest &request = *static_cast<IoRequest::CompletionJob *>(job)->request;
+        if (request.m_fromPack && request.GetStatus() == IoStatus::Pending)
+        {
+            const IoStatus status = ReadFromPack(request.m_read, request.m_data, request.m_bytes);
+            IoService &service = Get();
+            if (status == IoStatus::Done)
+                service.m_bytes.fetch_add(request.m_bytes.size(), std::memory_order_relaxed);
+            else
+                service.m_failed.fetch_add(1, std::memory_order_relaxed);
+            request.m_status.store(status, std::memory_order_release);
+        }
+
+        if (request.m_callback)
+        {
+            try
+            {
+                request.m_callback(request);
+            }
+            catch (const std::exception &e)
+            {
+                PE_WARN("IoService: callback for %s threw: %s", request.m_read.path.c_str(), e.what());
+            }
+        }
+        Finish(request);
+    }
+
+    void IoService::ThreadLoop()
+    {
+        for (;;)
+        {
+            IoHandle request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this]()
+                          { return m_stop || m_queued > 0; });
+                if (m_stop)
+                    return;
+                request = PopLocked();
+            }
+            if (!request)
+                continue;
+
+            Issue(request);
+            if (!request->m_fromPack)
+                Complete(*request, ReadLoose(request->m_read, request->m_data));
+        }
+    }
+
+#if defined(PE_LINUX)
+    void IoService::RingLoop()
+    {
+        Ring &ring = *m_ring;
+        ring.ArmWake();
+
+        auto start = [&](IoHandle request)
+        {
+            const int fd = open(request->m_read.path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                Complete(*request, errno == ENOENT || errno == ENOTDIR ? IoStatus::NotFound : IoStatus::Failed);
+                return;
+            }
+
+            struct stat info{};
+            uint64_t size = 0;
+            if (fstat(fd, &info) != 0 || !ResolveRange(request->m_read, static_cast<uint64_t>(info.st_size), size))
+            {
+                close(fd);
+                Complete(*request, IoStatus::Failed);
+                return;
+            }
+            if (size == 0)
+            {
+                close(fd);
+                Complete(*request, IoStatus::Done);
+                return;
+            }
+
+            request->m_data.resize(size);
+            uint32_t slot = 0;
+            ring.AcquireSlot(slot); // callers only start reads while a slot is free
+            Ring::Read &read = ring.Get(slot);
+            read.request = std::move(request);
+            read.fd = fd;
+            read.offset = read.request->m_read.offset;
+            ring.PrepareRead(slot);
+        };
+
+        auto onCompletion = [&](uint64_t tag, int32_t result)
+        {
+            if (tag == Ring::WakeTag)
+            {
+                ring.DrainWake();
+                ring.ArmWake();
+                return;
+            }
+
+            const uint32_t slot = static_cast<uint32_t>(tag - 1);
+            Ring::Read &read = ring.Get(slot);
+            if (result == -EAGAIN || result == -EINTR)
+            {
+                ring.PrepareRead(slot);
+                return;
+            }
+            if (result > 0)
+            {
+                read.done += static_cast<uint64_t>(result);
+                if (read.done < read.request->m_data.size())
+                {
+                    ring.PrepareRead(slot); // short read
+                    return;
+                }
+            }
+
+            // A zero-byte read before the end means the file shrank under us
+            IoHandle request = std::move(read.request);
+            ring.ReleaseSlot(slot);
+            Complete(*request, result > 0 ? IoStatus::Done : IoStatus::Failed);
+        };
+
+        // ponytail: open() and fstat() stay synchronous on the ring thread; they hit the dentry cache for
+        // everything streamed more than once, and IORING_OP_OPENAT needs a newer kernel than READV
+        bool stopping = false;
+        while (!stopping || ring.InFlight() > 0)
+        {
+            std::vector<IoHandle> issue;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                stopping = m_stop.load();
+                const uint32_t room = Ring::Depth - ring.InFlight();
+                while (!stopping && issue.size() < room)
+                {
+                    IoHandle request = PopLocked();
+                    if (!request)
+                        break;
+                    issue.push_back(std::move(request));
+                }
+            }
+
+            for (IoHandle &request : issue)
+            {
+                Issue(request);
+                if (!request->m_fromPack)
+                    start(std::move(request));
+            }
+
+            if (stopping && ring.InFlight() == 0)
+                break;
+            if (!ring.Enter(true))
+            {
+                PE_WARN("IoService: io_uring_enter failed (errno %d)", errno);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            ring.Reap(onCompletion);
+        }
+    }
+#else
+    void IoService::RingLoop()
+    {
+    }
+#endif
+} // namespace pe
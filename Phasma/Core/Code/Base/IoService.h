@@ -0,0 +1,134 @@
+#pragma once
+#include "Base/PhasmaExport.h"
+
+namespace pe
+{
+    // Issue order for queued reads. The completion callback runs on the job system at the matching
+    // JobPriority, so a High read also jumps the queue for its callback.
+    enum class IoPriority : uint8_t
+    {
+        High,   // needed this frame or the next (visible chunks, player-facing loads)
+        Normal, // streaming ahead of the camera, scene preloads
+        Low,    // speculative prefetch
+        Count
+    };
+
+    enum class IoStatus : uint8_t
+    {
+        Pending,
+        Done,
+        NotFound,
+        Failed,
+        Cancelled
+    };
+
+    struct IoRead
+    {
+        std::string path; // UTF-8; pack-managed paths are served from the game pack
+        uint64_t offset = 0;
+        uint64_t size = UINT64_MAX; // to the end of the file
+    };
+
+    class IoRequest;
+    using IoHandle = std::shared_ptr<IoRequest>;
+    // Runs once per request on a job worker, for cancelled and failed reads too
+    using IoCallback = std::function<void(IoRequest &request)>;
+
+    class PE_API IoRequest : public NoCopy
+    {
+    public:
+        const IoRead &GetRead() const { return m_read; }
+        IoPriority GetPriority() const { return m_priority; }
+        // The result is set before the callback runs; IsDone turns true once it returned
+        IoStatus GetStatus() const { return m_status.load(std::memory_order_acquire); }
+        bool IsDone() const { return m_finished.load(std::memory_order_acquire); }
+
+        // Runs pending jobs of the request's priority or higher until it is done
+        void Wait() const;
+        // Drops the read if it was not issued yet; the callback still runs, with IoStatus::Cancelled
+        bool Cancel();
+
+        // Valid while the request is alive; raw game pack entries point into the mapped pack
+        std::span<const uint8_t> Bytes() const { return m_bytes; }
+
+    private:
+        friend class IoService;
+
+        struct CompletionJob : Job
+        {
+            IoRequest *request = nullptr;
+        };
+
+        IoRead m_read;
+        IoPriority m_priority = IoPriority::Normal;
+        IoCallback m_callback;
+        std::vector<uint8_t> m_data;
+        std::span<const uint8_t> m_bytes;
+        std::atomic<IoStatus> m_status{IoStatus::Pending};
+        std::atomic<bool> m_finished{false};
+        bool m_queued = false; // guarded by the service lock
+        bool m_fromPack = false;
+        CompletionJob m_job;
+        IoHandle m_self; // keeps the request alive until its callback ran
+    };
+
+    // Asynchronous file reads for streaming. Requests wait in one queue per priority and are issued
+    // highest class first; on Linux they go through io_uring, elsewhere (or when the kernel refuses a
+    // ring, or PE_IO_BACKEND=threads) through a few blocking I/O threads. Game pack entries never touch
+    // the disk queue: they are copied or decoded straight from the mapping on a job worker.
+    class PE_API IoService
+    {
+    public:
+        static IoService &Get();
+
+        IoHandle Read(IoRead read, IoPriority priority = IoPriority::Normal, IoCallback callback = {});
+        // Queues every read under one lock and wakes the backend once
+        std::vector<IoHandle> ReadBatch(std::vector<IoRead> reads, IoPriority priority = IoPriority::Normal,
+                                        const IoCallback &callback = {});
+
+        const char *GetBackendName() const;
+
+        struct Stats
+        {
+            uint64_t requests;
+            uint64_t packReads;
+            uint64_t cancelled;
+            uint64_t failed;
+            uint64_t bytes;
+        };
+        Stats GetStats() const;
+
+        ~IoService();
+
+    private:
+        class Ring;
+        friend class IoRequest;
+
+        IoService();
+        void Enqueue(const IoHandle &request);
+        void Wake();
+        IoHandle PopLocked();
+        bool Cancel(IoRequest &request);
+        void Issue(const IoHandle &request);
+        void Complete(IoRequest &request, IoStatus status);
+        static void Finish(IoRequest &request);
+        static void RunCompletion(Job *job);
+        void ThreadLoop();
+        void RingLoop();
+
+        std::mutex m_mutex;
+        std::condition_variable m_cv;
+        std::deque<IoHandle> m_queues[static_cast<size_t>(IoPriority::Count)];
+        uint32_t m_queued = 0;
+        std::atomic<bool> m_stop{false};
+
+        std::unique_ptr<Ring> m_ring; // null on the thread backend
+        std::vector<std::thread> m_threads;
+
+        std::atomic<uint64_t> m_requests{0};
+        std::atomic<uint64_t> m_packReads{0};
+        std::atomic<uint64_t> m_cancelled{0};
+        std::atomic<uint64_t> m_failed{0};
+        std::atomic<uint64_t> m_bytes{0};
+    };
+} // namespace pe
@@ -0,0 +1,582 @@
+#include "Base/JobSystem.h"
+#if defined(PE_WIN32)
+#include <windows.h>
+#elif defined(PE_LINUX) || defined(PE_ANDROID)
+#include <pthread.h>
+#endif
+
+namespace pe
+{
+    namespace
+    {
+        thread_local uint32_t t_workerIndex = UINT32_MAX;
+
+        constexpr size_t PriorityCount = static_cast<size_t>(JobPriority::Count);
+        constexpr int64_t DequeCapacity = 4096;     // per worker, per priority; overflow spills to injection
+        constexpr size_t InjectionCapacity = 16384; // per priority
+        constexpr uint32_t SpinsBeforePark = 64;
+        constexpr uint32_t MaxParallelForHelpers = 64;
+        constexpr uint32_t YieldsBeforeSleep = 256;
+
+        size_t WorkerCountFromEnv()
+        {
+            size_t count = std::thread::hardware_concurrency();
+            count = count > 1 ? count - 1 : 1;
+            if (const char *env = std::getenv("PE_JOB_WORKERS"))
+            {
+                const long value = std::strtol(env, nullptr, 10);
+                if (value > 0)
+                    count = static_cast<size_t>(value);
+            }
+            // Never fewer than two: Low jobs are capped at half the workers, so one always stays free for
+            // frame work even when a background job blocks on a future
+            return std::max<size_t>(2, count);
+        }
+
+        void SetCurrentThreadName(const char *name)
+        {
+#if defined(PE_WIN32)
+            wchar_t wide[32]{};
+            for (size_t i = 0; i < 31 && name[i]; ++i)
+                wide[i] = static_cast<wchar_t>(name[i]);
+            SetThreadDescription(GetCurrentThread(), wide);
+#elif defined(PE_LINUX) || defined(PE_ANDROID)
+            pthread_setname_np(pthread_self(), name);
+#else
+            (void)name;
+#endif
+        }
+
+        // Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli 2013 memory orders) over a fixed
+        // ring. Only the owning worker pushes and pops at the bottom; any thread steals from the top.
+        class WorkStealingDeque
+        {
+        public:
+            bool Push(Job *job)
+            {
+                const int64_t b = m_bottom.load(std::memory_order_relaxed);
+                const int64_t t = m_top.load(std::memory_order_acquire);
+                if (b - t >= DequeCapacity)
+                    return false;
+
+                m_items[b & (DequeCapacity - 1)].store(job, std::memory_order_relaxed);
+                m_bottom.store(b + 1, std::memory_order_release);
+                return true;
+            }
+
+            Job *Pop()
+            {
+                const int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(b, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                int64_t t = m_top.load(std::memory_order_relaxed);
+
+                if (t > b)
+                {
+                    m_bottom.store(b + 1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                Job *job = m_items[b & (DequeCapacity - 1)].load(std::memory_order_relaxed);
+                if (t == b)
+                {
+                    // Last element: race the thieves for it
+                    if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                        job = nullptr;
+                    m_bottom.store(b + 1, std::memory_order_relaxed);
+                }
+                return job;
+            }
+
+            Job *Steal()
+            {
+                int64_t t = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t b = m_bottom.load(std::memory_order_acquire);
+                if (t >= b)
+                    return nullptr;
+
+                Job *job = m_items[t & (DequeCapacity - 1)].load(std::memory_order_relaxed);
+                if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return nullptr;
+                return job;
+            }
+
+        private:
+            alignas(64) std::atomic<int64_t> m_top{0};
+            alignas(64) std::atomic<int64_t> m_bottom{0};
+            std::array<std::atomic<Job *>, DequeCapacity> m_items{};
+        };
+    } // namespace
+
+    // Bounded MPMC queue (Vyukov) used for submissions from threads that own no deque
+    class JobSystem::InjectionQueue
+    {
+    public:
+        InjectionQueue()
+        {
+            for (size_t i = 0; i < InjectionCapacity; ++i)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        bool Push(Job *job)
+        {
+            size_t pos = m_enqueue.load(std::memory_order_relaxed);
+            Cell *cell;
+            for (;;)
+            {
+                cell = &m_cells[pos & (InjectionCapacity - 1)];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = m_enqueue.load(std::memory_order_relaxed);
+                }
+            }
+            cell->job = job;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        Job *Pop()
+        {
+            size_t pos = m_dequeue.load(std::memory_order_relaxed);
+            Cell *cell;
+            for (;;)
+            {
+                cell = &m_cells[pos & (InjectionCapacity - 1)];
+                const size_t seq = cell->sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (m_dequeue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    pos = m_dequeue.load(std::memory_order_relaxed);
+                }
+            }
+            Job *job = cell->job;
+            cell->sequence.store(pos + InjectionCapacity, std::memory_order_release);
+            return job;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            Job *job;
+        };
+
+        alignas(64) std::atomic<size_t> m_enqueue{0};
+        alignas(64) std::atomic<size_t> m_dequeue{0};
+        std::unique_ptr<Cell[]> m_cells{new Cell[InjectionCapacity]};
+    };
+
+    struct JobSystem::Worker
+    {
+        WorkStealingDeque deques[PriorityCount];
+        uint32_t rng = 0;
+    };
+
+    JobSystem &JobSystem::Get()
+    {
+        static JobSystem instance;
+        return instance;
+    }
+
+    uint32_t JobSystem::GetWorkerIndex()
+    {
+        return t_workerIndex;
+    }
+
+    JobSystem::JobSystem()
+    {
+        for (auto &queue : m_injection)
+            queue = std::make_unique<InjectionQueue>();
+
+        const size_t count = WorkerCountFromEnv();
+        m_lowLimit = static_cast<uint32_t>(std::max<size_t>(1, count / 2));
+
+        m_workers.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_workers.push_back(std::make_unique<Worker>());
+            m_workers.back()->rng = static_cast<uint32_t>(i * 2654435761u + 1u);
+        }
+
+        m_threads.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            m_threads.emplace_back([this, i] { WorkerLoop(static_cast<uint32_t>(i)); });
+    }
+
+    JobSystem::~JobSystem()
+    {
+        m_stop.store(true, std::memory_order_seq_cst);
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        m_epoch.notify_all();
+        for (std::thread &t : m_threads)
+        {
+            if (t.joinable())
+                t.join();
+        }
+    }
+
+    void JobSystem::Submit(Job *job, JobPriority priority)
+    {
+        const size_t p = static_cast<size_t>(priority);
+        const uint32_t self = t_workerIndex;
+        if (self == UINT32_MAX || !m_workers[self]->deques[p].Push(job))
+        {
+            m_injected.fetch_add(1, std::memory_order_relaxed);
+            while (!m_injection[p]->Push(job))
+            {
+                // Saturated: make progress ourselves rather than spin on a full ring
+                if (!TryRunOne(priority))
+                    std::this_thread::yield();
+            }
+        }
+        Wake();
+    }
+
+    void JobSystem::Wake()
+    {
+        m_epoch.fetch_add(1, std::memory_order_seq_cst);
+        if (m_sleeping.load(std::memory_order_seq_cst) > 0)
+            m_epoch.notify_one();
+    }
+
+    bool JobSystem::AcquireLowSlot()
+    {
+        uint32_t active = m_lowActive.load(std::memory_order_relaxed);
+        while (active < m_lowLimit)
+        {
+            if (m_lowActive.compare_exchange_weak(active, active + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    void JobSystem::ReleaseLowSlot()
+    {
+        m_lowActive.fetch_sub(1, std::memory_order_release);
+    }
+
+    Job *JobSystem::FindJob(uint32_t self, JobPriority priority, bool &stolen)
+    {
+        const size_t p = static_cast<size_t>(priority);
+        stolen = false;
+
+        if (self != UINT32_MAX)
+        {
+            if (Job *job = m_workers[self]->deques[p].Pop())
+                return job;
+        }
+
+        if (Job *job = m_injection[p]->Pop())
+            return job;
+
+        const uint32_t count = static_cast<uint32_t>(m_workers.size());
+        uint32_t start = 0;
+        if (self != UINT32_MAX)
+        {
+            uint32_t &rng = m_workers[self]->rng;
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            start = rng % count;
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t victim = (start + i) % count;
+            if (victim == self)
+                continue;
+            if (Job *job = m_workers[victim]->deques[p].Steal())
+            {
+                stolen = true;
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    Job *JobSystem::FindJob(uint32_t self, JobPriority lowest, JobPriority &found)
+    {
+        for (size_t p = 0; p <= static_cast<size_t>(lowest); ++p)
+        {
+            const JobPriority priority = static_cast<JobPriority>(p);
+            const bool low = priority == JobPriority::Low;
+            if (low && !AcquireLowSlot())
+                continue;
+
+            bool stolen = false;
+            if (Job *job = FindJob(self, priority, stolen))
+            {
+                if (stolen)
+                    m_stolen.fetch_add(1, std::memory_order_relaxed);
+                found = priority;
+                return job;
+            }
+
+            if (low)
+                ReleaseLowSlot();
+        }
+        return nullptr;
+    }
+
+    void JobSystem::Run(Job *job, JobPriority priority)
+    {
+        job->execute(job);
+        if (priority == JobPriority::Low)
+            ReleaseLowSlot();
+        m_executed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool JobSystem::TryRunOne(JobPriority lowest)
+    {
+        JobPriority found{};
+        Job *job = FindJob(t_workerIndex, lowest, found);
+        if (!job)
+            return false;
+        Run(job, found);
+        return true;
+    }
+
+    void JobSystem::WorkerLoop(uint32_t index)
+    {
+        t_workerIndex = index;
+        char name[16];
+        std::snprintf(name, sizeof(name), "PE Worker %u", index);
+        SetCurrentThreadName(name);
+
+        uint32_t spins = 0;
+        for (;;)
+        {
+            JobPriority found{};
+            if (Job *job = FindJob(index, JobPriority::Low, found))
+            {
+                Run(job, found);
+                spins = 0;
+                continue;
+            }
+
+            if (m_stop.load(std::memory_order_acquire))
+                return;
+
+            if (++spins < SpinsBeforePark)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            spins = 0;
+
+            // Park. Re-check for work after announcing ourselves so a Submit racing with us either sees
+            // m_sleeping > 0 and notifies, or its epoch bump makes the wait below return immediately.
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            const uint32_t epoch = m_epoch.load(std::memory_order_seq_cst);
+            if (Job *job = FindJob(index, JobPriority::Low, found))
+            {
+                m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+                Run(job, found);
+                continue;
+            }
+            if (!m_stop.load(std::memory_order_acquire))
+            {
+                m_parks.fetch_add(1, std::memory_order_relaxed);
+                m_epoch.wait(epoch, std::memory_order_seq_cst);
+            }
+            m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+    JobSystem::Stats JobSystem::GetStats() const
+    {
+        return {m_executed.load(std::memory_order_relaxed),
+                m_stolen.load(std::memory_order_relaxed),
+                m_injected.load(std::memory_order_relaxed),
+                m_parks.load(std::memory_order_relaxed)};
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grain, RangeFn body, void *ctx, JobPriority priority)
+    {
+        if (count == 0)
+            return;
+
+        grain = std::max<uint32_t>(1, grain);
+        const uint32_t chunks = (count + grain - 1) / grain;
+        const uint32_t helpers = std::min({chunks - 1, GetWorkerCount(), MaxParallelForHelpers});
+        if (helpers == 0)
+        {
+            body(ctx, 0, count);
+            return;
+        }
+
+        struct Shared
+        {
+            std::atomic<uint32_t> next{0};
+            uint32_t count;
+            uint32_t grain;
+            uint32_t chunks;
+            RangeFn body;
+            void *ctx;
+            JobCounter done;
+            std::atomic<bool> failed{false};
+            std::exception_ptr error; // first throw, written once by whoever set `failed`
+
+            // Never throws: a worker has no handler above it, and the caller must still wait for the
+            // helpers before this frame goes away. The first error skips the chunks nobody took yet.
+            void Drain()
+            {
+                try
+                {
+                    for (uint32_t chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+                         chunk = next.fetch_add(1, std::memory_order_relaxed))
+                    {
+                        const uint32_t begin = chunk * grain;
+                        body(ctx, begin, std::min(begin + grain, count));
+                    }
+                }
+                catch (...)
+                {
+                    if (!failed.exchange(true, std::memory_order_acq_rel))
+                        error = std::current_exception();
+                    next.store(chunks, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        struct Helper : Job
+        {
+            Shared *shared;
+        };
+
+        Shared shared;
+        shared.count = count;
+        shared.grain = grain;
+        shared.chunks = chunks;
+        shared.body = body;
+        shared.ctx = ctx;
+
+        // Helpers that start after the caller drained every chunk just find nothing left and finish
+        std::array<Helper, MaxParallelForHelpers> jobs;
+        shared.done.Add(helpers);
+        for (uint32_t i = 0; i < helpers; ++i)
+        {
+            jobs[i].shared = &shared;
+            jobs[i].execute = [](Job *job)
+            {
+                Shared *s = static_cast<Helper *>(job)->shared;
+                s->Drain();
+                s->done.Done();
+            };
+            Submit(&jobs[i], priority);
+        }
+
+        shared.Drain();
+        shared.done.Wait(priority);
+        if (shared.error)
+            std::rethrow_exception(shared.error);
+    }
+
+    void JobCounter::Wait(JobPriority lowest) const
+    {
+        // Spin-help instead of parking: Done() must stay the last access to the counter, which rules out
+        // a notify after the decrement, and by the time anyone waits the remaining work is usually short
+        JobSystem &jobs = JobSystem::Get();
+        uint32_t idle = 0;
+        while (!IsDone())
+        {
+            if (jobs.TryRunOne(lowest))
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < YieldsBeforeSleep)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        Wait();
+        Reset();
+    }
+
+    TaskGraph::Task *TaskGraph::AcquireTask()
+    {
+        Task *task = m_tasks.Acquire();
+        task->execute = &TaskGraph::ExecuteTask;
+        task->graph = this;
+        task->successors = nullptr;
+        task->dependencies = 0;
+        ++m_taskCount;
+        return task;
+    }
+
+    void TaskGraph::Precede(Task *before, Task *after)
+    {
+        Edge *edge = m_edges.Acquire();
+        edge->to = after;
+        edge->next = before->successors;
+        before->successors = edge;
+        ++after->dependencies;
+    }
+
+    void TaskGraph::Run()
+    {
+        if (m_taskCount == 0)
+            return;
+
+        m_counter.Add(static_cast<uint32_t>(m_taskCount));
+        for (size_t i = 0; i < m_taskCount; ++i)
+            m_tasks[i].pending.store(m_tasks[i].dependencies, std::memory_order_relaxed);
+
+        JobSystem &jobs = JobSystem::Get();
+        for (size_t i = 0; i < m_taskCount; ++i)
+        {
+            if (m_tasks[i].dependencies == 0)
+                jobs.Submit(&m_tasks[i], m_priority);
+        }
+    }
+
+    void TaskGraph::ExecuteTask(Job *job)
+    {
+        Task *task = static_cast<Task *>(job);
+        TaskGraph *graph = task->graph;
+        task->invoke(task->storage);
+
+        for (Edge *edge = task->successors; edge; edge = edge->next)
+        {
+            if (edge->to->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                JobSystem::Get().Submit(edge->to, graph->m_priority);
+        }
+        graph->m_counter.Done();
+    }
+
+    void TaskGraph::Reset()
+    {
+        for (size_t i = 0; i < m_taskCount; ++i)
+            m_tasks[i].destroy(m_tasks[i].storage);
+        m_tasks.Reset();
+        m_edges.Reset();
+        m_taskCount = 0;
+    }
+} // namespace pe
@@ -0,0 +1,226 @@
+#pragma once
+#include "Base/PhasmaExport.h"
+
+namespace pe
+{
+    // Scheduling classes for the engine-wide worker set. Workers always drain higher classes first,
+    // from their own deque, then the shared injection queue, then by stealing from siblings.
+    enum class JobPriority : uint8_t
+    {
+        High,   // frame-critical fan-out (render graph pass updates, physics steps)
+        Normal, // gameplay/streaming work the next few frames depend on (voxel gen/meshing, loads)
+        Low,    // background tooling (editor imports/saves); capped so it never owns every worker
+        Count
+    };
+
+    // Minimal type-erased unit of work. Ownership stays with whoever submitted it: `execute` runs it and
+    // is responsible for releasing it (self-delete, return to a pool, ...). No allocation happens in the
+    // scheduler itself.
+    struct Job
+    {
+        void (*execute)(Job *job) = nullptr;
+    };
+
+    // One scheduler for the whole process: hardware_concurrency() - 1 workers (the main thread is the
+    // remaining core), each owning a lock-free Chase-Lev deque per priority. Jobs pushed from a worker go
+    // to its own deque (LIFO for cache warmth, FIFO for thieves); jobs pushed from any other thread go
+    // through a bounded lock-free MPMC injection queue per priority. Idle workers park on an atomic epoch.
+    class PE_API JobSystem
+    {
+    public:
+        static JobSystem &Get();
+
+        void Submit(Job *job, JobPriority priority = JobPriority::Normal);
+
+        // Pops and runs one pending job of priority `lowest` or higher on the calling thread. Waiters use it
+        // so blocking on work helps instead of stalling a core; passing the priority being waited on keeps
+        // the main thread from picking up long background jobs while it waits on frame work.
+        bool TryRunOne(JobPriority lowest = JobPriority::Normal);
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+        // Index of the calling worker in [0, GetWorkerCount()), or UINT32_MAX for non-worker threads.
+        static uint32_t GetWorkerIndex();
+        static bool IsWorkerThread() { return GetWorkerIndex() != UINT32_MAX; }
+
+        using RangeFn = void (*)(void *ctx, uint32_t begin, uint32_t end);
+
+        // Splits [0, count) into `grain`-sized chunks and runs `body` on them across the workers and the
+        // calling thread, returning once every chunk is done. Helper jobs live on the caller's stack.
+        void ParallelFor(uint32_t count, uint32_t grain, RangeFn body, void *ctx, JobPriority priority);
+
+        struct Stats
+        {
+            uint64_t executed;
+            uint64_t stolen;
+            uint64_t injected;
+            uint64_t parks;
+        };
+        Stats GetStats() const;
+
+        ~JobSystem();
+
+    private:
+        struct Worker;
+        class InjectionQueue;
+
+        JobSystem();
+        void WorkerLoop(uint32_t index);
+        Job *FindJob(uint32_t self, JobPriority lowest, JobPriority &found);
+        Job *FindJob(uint32_t self, JobPriority priority, bool &stolen);
+        void Run(Job *job, JobPriority priority);
+        bool AcquireLowSlot();
+        void ReleaseLowSlot();
+        void Wake();
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::vector<std::thread> m_threads;
+        std::unique_ptr<InjectionQueue> m_injection[static_cast<size_t>(JobPriority::Count)];
+
+        std::atomic<uint32_t> m_epoch{0};
+        std::atomic<uint32_t> m_sleeping{0};
+        std::atomic<uint32_t> m_lowActive{0};
+        uint32_t m_lowLimit{1};
+        std::atomic<bool> m_stop{false};
+
+        std::atomic<uint64_t> m_executed{0};
+        std::atomic<uint64_t> m_stolen{0};
+        std::atomic<uint64_t> m_injected{0};
+        std::atomic<uint64_t> m_parks{0};
+    };
+
+    // Completion counter: producers Add() per job, jobs Done() when they finish. Done() is the job's last
+    // touch of the counter, so the owner may destroy it as soon as Wait() returns.
+    class PE_API JobCounter
+    {
+    public:
+        void Add(uint32_t n = 1) { m_value.fetch_add(n, std::memory_order_relaxed); }
+        void Done() { m_value.fetch_sub(1, std::memory_order_acq_rel); }
+        bool IsDone() const { return m_value.load(std::memory_order_acquire) == 0; }
+
+        // Runs pending jobs of priority `lowest` or higher until the counter drains
+        void Wait(JobPriority lowest = JobPriority::High) const;
+
+    private:
+        std::atomic<uint32_t> m_value{0};
+    };
+
+    // fn(index) for every index in [0, count); `grain` indices per job. If fn throws, the remaining
+    // chunks are skipped and the first exception is rethrown here once every helper has finished.
+    template <class F>
+    void ParallelFor(uint32_t count, uint32_t grain, F &&fn, JobPriority priority = JobPriority::High)
+    {
+        using Fn = std::remove_reference_t<F>;
+        JobSystem::Get().ParallelFor(
+            count, grain,
+            [](void *ctx, uint32_t begin, uint32_t end)
+            {
+                Fn &body = *static_cast<Fn *>(ctx);
+                for (uint32_t i = begin; i < end; ++i)
+                    body(i);
+            },
+            const_cast<void *>(static_cast<const void *>(&fn)), priority);
+    }
+
+    // Small dependency graph of tasks, rebuilt and run once per frame. Tasks and edges come from chunked
+    // pools that Reset() rewinds without freeing, so a graph reused every frame stops allocating once it
+    // has seen its largest frame. Build on one thread, then Run() and Wait().
+    class PE_API TaskGraph : public NoCopy
+    {
+    public:
+        static constexpr size_t TaskStorage = 64;
+
+        struct Task;
+
+        explicit TaskGraph(JobPriority priority = JobPriority::High) : m_priority{priority} {}
+        ~TaskGraph();
+
+        template <class F>
+        Task *Add(F &&fn);
+
+        // `after` starts only once `before` (and its other predecessors) finished
+        void Precede(Task *before, Task *after);
+
+        // Continuation: adds `fn` to run after `before`
+        template <class F>
+        Task *Then(Task *before, F &&fn)
+        {
+            Task *task = Add(std::forward<F>(fn));
+            Precede(before, task);
+            return task;
+        }
+
+        void Run();
+        void Wait() const { m_counter.Wait(m_priority); }
+        bool IsDone() const { return m_counter.IsDone(); }
+
+        // Destroys the task functors and rewinds the pools; the graph must not be running
+        void Reset();
+
+        size_t GetTaskCount() const { return m_taskCount; }
+
+        struct Edge
+        {
+            Task *to;
+            Edge *next;
+        };
+
+        struct Task : Job
+        {
+            alignas(std::max_align_t) unsigned char storage[TaskStorage];
+            void (*invoke)(void *storage);
+            void (*destroy)(void *storage);
+            TaskGraph *graph;
+            Edge *successors;
+            uint32_t dependencies;
+            std::atomic<uint32_t> pending;
+        };
+
+    private:
+        template <class T>
+        class Pool
+        {
+        public:
+            static constexpr size_t ChunkSize = 256;
+
+            T *Acquire()
+            {
+                if (m_used == m_chunks.size() * ChunkSize)
+                    m_chunks.push_back(std::make_unique<T[]>(ChunkSize));
+                T *item = &m_chunks[m_used / ChunkSize][m_used % ChunkSize];
+                ++m_used;
+                return item;
+            }
+
+            T &operator[](size_t index) { return m_chunks[index / ChunkSize][index % ChunkSize]; }
+            void Reset() { m_used = 0; }
+
+        private:
+            std::vector<std::unique_ptr<T[]>> m_chunks;
+            size_t m_used = 0;
+        };
+
+        Task *AcquireTask();
+        static void ExecuteTask(Job *job);
+
+        JobPriority m_priority;
+        JobCounter m_counter;
+        Pool<Task> m_tasks;
+        Pool<Edge> m_edges;
+        size_t m_taskCount = 0;
+    };
+
+    template <class F>
+    TaskGraph::Task *TaskGraph::Add(F &&fn)
+    {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= TaskStorage, "TaskGraph task captures too much; capture a pointer to the data instead");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "TaskGraph task functor is over-aligned");
+
+        Task *task = AcquireTask();
+        new (task->storage) Fn(std::forward<F>(fn));
+        task->invoke = [](void *storage) { (*static_cast<Fn *>(storage))(); };
+        task->destroy = [](void *storage) { static_cast<Fn *>(storage)->~Fn(); };
+        return task;
+    }
+} // namespace pe
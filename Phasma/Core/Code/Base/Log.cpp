@@ -1,3 +1,4 @@
+#include <csignal>
 
 namespace pe
 {
@@ -5,26 +6,268 @@ namespace pe
     std::vector<std::pair<std::string, LogType>> Log::s_earlyLogs;
     FILE *Log::s_file = nullptr;
 
-    std::mutex &GetLogMutex()
+    namespace
     {
-        static std::mutex mutex;
-        return mutex;
-    }
+        // Bounded MPSC ring (Vyukov sequence numbers): producers claim a slot with one CAS and copy the
+        // message into the slot's retained string, the log thread delivers in claim order.
+        constexpr uint64_t kSlotCount = 4096; // power of two
+        constexpr size_t kSlotReserve = 256;
+        constexpr size_t kMaxRetainedSlotBytes = 16 * 1024; // a huge shader log should not pin its slot
+        constexpr auto kIdleWake = std::chrono::milliseconds(100);
+        // Identical messages beyond kRepeatBurst per kRepeatWindow are counted instead of printed
+        constexpr auto kRepeatWindow = std::chrono::seconds(1);
+        constexpr uint32_t kRepeatBurst = 8;
+        constexpr size_t kRepeatSampleChars = 160;
+
+        using SteadyClock = std::chrono::steady_clock;
+
+        enum class LogState : uint32_t
+        {
+            Idle,    // nothing logged yet, thread not started
+            Running, // log thread owns delivery
+            Stopped, // after Shutdown: synchronous delivery
+        };
+
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{0};
+            LogType type = LogType::Info;
+            std::string text;
+        };
+
+        struct LogQueue
+        {
+            std::unique_ptr<Slot[]> slots;
+            std::atomic<uint64_t> enqueuePos{0};
+            std::atomic<uint64_t> delivered{0};
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<uint32_t> writers{0};
+            std::atomic<LogState> state{LogState::Idle};
+            std::atomic<bool> sleeping{false};
+            std::atomic<bool> crashed{false};
+
+            std::mutex wakeMutex;
+            std::condition_variable wakeCv;
+            std::condition_variable deliveredCv;
+            bool wakeRequested = false; // wakeMutex
+
+            std::once_flag startFlag;
+            std::thread worker;
+        };
+
+        thread_local bool s_isLogThread = false;
+
+        // Leaked on purpose: static destructors that log run after Shutdown and must still find it
+        LogQueue &GetQueue()
+        {
+            static LogQueue &queue = *new LogQueue();
+            return queue;
+        }
+
+        // Serializes delivery: console, file, callbacks and early logs
+        std::mutex &GetLogMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        bool TryPush(LogQueue &queue, const std::string &msg, LogType type)
+        {
+            uint64_t pos = queue.enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Slot &slot = queue.slots[pos & (kSlotCount - 1)];
+                const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+                if (diff == 0)
+                {
+                    if (queue.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.type = type;
+                        slot.text.assign(msg);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // full: the log thread has not recycled this slot yet
+                }
+                else
+                {
+                    pos = queue.enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void WakeWorker(LogQueue &queue)
+        {
+            // Pairs with the fence in WorkerMain: either the worker sees the new slot before sleeping,
+            // or we see it sleeping and wake it
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (queue.sleeping.load(std::memory_order_relaxed) && queue.sleeping.exchange(false))
+            {
+                std::lock_guard<std::mutex> lock(queue.wakeMutex);
+                queue.wakeRequested = true;
+                queue.wakeCv.notify_one();
+            }
+        }
+
+        const char *Prefix(LogType type)
+        {
+            switch (type)
+            {
+            case LogType::Warn:
+                return "[WARN] ";
+            case LogType::Error:
+                return "[ERROR] ";
+            default:
+                return "[INFO] ";
+            }
+        }
+
+        // Log thread only
+        class RepeatFilter
+        {
+        public:
+            template <class Emit>
+            bool Admit(const std::string &text, LogType type, SteadyClock::time_point now, Emit &&emit)
+            {
+                const uint64_t key = std::hash<std::string_view>{}(text) * 31 + static_cast<uint64_t>(type);
+                auto [it, inserted] = m_entries.try_emplace(key);
+                Entry &entry = it->second;
+                if (inserted || now - entry.windowStart >= kRepeatWindow)
+                {
+                    Report(entry, emit);
+                    entry.windowStart = now;
+                    entry.count = 0;
+                }
+
+                if (++entry.count <= kRepeatBurst)
+                    return true;
+
+                if (entry.suppressed++ == 0)
+                {
+                    entry.type = type;
+                    entry.sample.assign(text, 0, kRepeatSampleChars);
+                }
+                return false;
+            }
+
+            template <class Emit>
+            void Expire(SteadyClock::time_point now, Emit &&emit)
+            {
+                if (now - m_lastExpire < kRepeatWindow / 4)
+                    return;
+                m_lastExpire = now;
+
+                for (auto it = m_entries.begin(); it != m_entries.end();)
+                {
+                    if (now - it->second.windowStart < kRepeatWindow)
+                    {
+                        ++it;
+                        continue;
+                    }
+                    Report(it->second, emit);
+                    it = m_entries.erase(it);
+                }
+            }
+
+        private:
+            struct Entry
+            {
+                SteadyClock::time_point windowStart{};
+                uint32_t count = 0;
+                uint32_t suppressed = 0;
+                LogType type = LogType::Info;
+                std::string sample;
+            };
+
+            template <class Emit>
+            static void Report(Entry &entry, Emit &emit)
+            {
+                if (entry.suppressed == 0)
+                    return;
+                emit("Suppressed " + std::to_string(entry.suppressed) + " repeats of: " + entry.sample, entry.type);
+                entry.suppressed = 0;
+            }
+
+            std::unordered_map<uint64_t, Entry> m_entries;
+            SteadyClock::time_point m_lastExpire{};
+        };
+
+        std::terminate_handler s_previousTerminate = nullptr;
+
+        void OnTerminate()
+        {
+            Log::FlushOnCrash();
+            if (s_previousTerminate)
+                s_previousTerminate();
+            std::abort();
+        }
+
+        void OnCrashSignal(int sig)
+        {
+            Log::FlushOnCrash();
+            std::signal(sig, SIG_DFL);
+            std::raise(sig);
+        }
+
+        void InstallCrashHandlers()
+        {
+            s_previousTerminate = std::set_terminate(OnTerminate);
+
+            // Leave signals alone when something else (sanitizers, a crash reporter) already owns them
+            for (int sig : {SIGSEGV, SIGABRT, SIGFPE, SIGILL})
+            {
+                auto previous = std::signal(sig, OnCrashSignal);
+                if (previous != SIG_DFL && previous != SIG_ERR)
+                    std::signal(sig, previous);
+            }
+        }
+    } // namespace
 
     void Log::Init()
     {
         Path::Init();
 
-        std::lock_guard<std::mutex> lock(GetLogMutex());
-        if (!s_file)
         {
-            std::string logPath = Path::Root + "PhasmaEngine.log";
+            std::lock_guard<std::mutex> lock(GetLogMutex());
+            if (!s_file)
+            {
+                std::string logPath = Path::Root + "PhasmaEngine.log";
 #if defined(PE_WIN32)
-            s_file = _fsopen(logPath.c_str(), "w", _SH_DENYNO);
+                s_file = _fsopen(logPath.c_str(), "w", _SH_DENYNO);
 #else
-            s_file = fopen(logPath.c_str(), "w");
+                s_file = fopen(logPath.c_str(), "w");
 #endif
+            }
         }
+
+        static std::once_flag handlersFlag;
+        std::call_once(handlersFlag, InstallCrashHandlers);
+        Start();
+    }
+
+    void Log::Start()
+    {
+        LogQueue &queue = GetQueue();
+        std::call_once(queue.startFlag, [&queue]()
+                       {
+                           queue.slots = std::make_unique<Slot[]>(kSlotCount);
+                           for (uint64_t i = 0; i < kSlotCount; ++i)
+                           {
+                               queue.slots[i].sequence.store(i, std::memory_order_relaxed);
+                               queue.slots[i].text.reserve(kSlotReserve);
+                           }
+
+                           LogState expected = LogState::Idle;
+                           if (!queue.state.compare_exchange_strong(expected, LogState::Running))
+                               return; // Shutdown ran first
+
+                           queue.worker = std::thread(&Log::WorkerMain);
+                           std::atexit(&Log::Shutdown);
+                       });
     }
 
     void Log::Attach(Callback cb)
@@ -39,63 +282,39 @@ namespace pe
         }
     }
 
-    void Log::Dispatch(const std::string &msg, LogType type)
+    void Log::Deliver(const std::string &msg, LogType type)
     {
-        Path::Init();
-
-        std::lock_guard<std::mutex> lock(GetLogMutex());
-
-        std::string prefix = "";
-        std::string colorCodeCout = "";
-        std::string resetCodeCout = "\033[0m";
-
-        switch (type)
-        {
-        case LogType::Info:
-            prefix = "[INFO] ";
-            colorCodeCout = "\033[0m";
-            break; // White/Default
-        case LogType::Warn:
-            prefix = "[WARN] ";
-            colorCodeCout = "\033[33m";
-            break; // Yellow
-        case LogType::Error:
-            prefix = "[ERROR] ";
-            colorCodeCout = "\033[31m";
-            break; // Red
-        }
-
-        std::string finalMsg = prefix + msg;
+        // ponytail: colors are always emitted; modern Windows consoles and every Unix terminal handle them
+        const char *prefix = Prefix(type);
+        const char *color = type == LogType::Warn ? "\033[33m" : type == LogType::Error ? "\033[31m"
+                                                                                         : "\033[0m";
+        std::fputs(color, stdout);
+        std::fputs(prefix, stdout);
+        std::fwrite(msg.data(), 1, msg.size(), stdout);
+        std::fputs("\033[0m\n", stdout);
 
-        // Console Output (with ANSI colors if supported, or just text)
-        // Windows CMD supports ANSI since Win10 sometimes, but let's stick to simple cout for now or simple codes.
-        std::cout << colorCodeCout << finalMsg << resetCodeCout << std::endl;
-
-        // File Output
-        if (s_file)
-        {
-            fprintf(s_file, "%s\n", finalMsg.c_str());
-            fflush(s_file);
-        }
-        else
+        if (!s_file)
         {
+            Path::Init();
             std::string logPath = Path::Root + "PhasmaEngine.log";
 #if defined(PE_WIN32)
             s_file = _fsopen(logPath.c_str(), "a", _SH_DENYNO);
 #else
             s_file = fopen(logPath.c_str(), "a");
 #endif
-            if (s_file)
-            {
-                fprintf(s_file, "%s\n", finalMsg.c_str());
-                fflush(s_file);
-            }
+        }
+        if (s_file)
+        {
+            std::fputs(prefix, s_file);
+            std::fwrite(msg.data(), 1, msg.size(), s_file);
+            std::fputc('\n', s_file);
         }
 
         // Callbacks (e.g. ImGui Console)
+        std::string finalMsg = prefix + msg;
         if (s_callbacks.empty())
         {
-            s_earlyLogs.push_back({finalMsg, type});
+            s_earlyLogs.push_back({std::move(finalMsg), type});
         }
         else
         {
@@ -106,6 +325,222 @@ namespace pe
         }
     }
 
+    void Log::WorkerMain()
+    {
+        s_isLogThread = true;
+        LogQueue &queue = GetQueue();
+        RepeatFilter repeats;
+        uint64_t pos = queue.delivered.load(std::memory_order_relaxed);
+        const auto emit = [](const std::string &msg, LogType type)
+        { Deliver(msg, type); };
+
+        for (;;)
+        {
+            bool deliveredAny = false;
+            {
+                std::lock_guard<std::mutex> lock(GetLogMutex());
+                const SteadyClock::time_point now = SteadyClock::now();
+                while (!queue.crashed.load(std::memory_order_relaxed))
+                {
+                    Slot &slot = queue.slots[pos & (kSlotCount - 1)];
+                    if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+                        break;
+
+                    if (repeats.Admit(slot.text, slot.type, now, emit))
+                        Deliver(slot.text, slot.type);
+                    if (slot.text.capacity() > kMaxRetainedSlotBytes)
+                    {
+                        std::string().swap(slot.text);
+                        slot.text.reserve(kSlotReserve);
+                    }
+
+                    slot.sequence.store(pos + kSlotCount, std::memory_order_release);
+                    queue.delivered.store(++pos, std::memory_order_release);
+                    deliveredAny = true;
+                }
+
+                if (const uint64_t dropped = queue.dropped.exchange(0, std::memory_order_relaxed))
+                    Deliver("Log queue full, dropped " + std::to_string(dropped) + " messages", LogType::Warn);
+                repeats.Expire(now, emit);
+
+                // One flush per batch instead of per line
+                std::fflush(stdout);
+                if (s_file)
+                    std::fflush(s_file);
+            }
+
+            std::unique_lock<std::mutex> lock(queue.wakeMutex);
+            if (deliveredAny)
+                queue.deliveredCv.notify_all();
+            if (queue.crashed.load(std::memory_order_relaxed))
+                break;
+
+            const bool pending = queue.slots[pos & (kSlotCount - 1)].sequence.load(std::memory_order_acquire) == pos + 1;
+            if (queue.state.load(std::memory_order_acquire) != LogState::Running && !pending)
+                break;
+            if (pending || deliveredAny)
+                continue;
+
+            queue.sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (queue.slots[pos & (kSlotCount - 1)].sequence.load(std::memory_order_relaxed) == pos + 1 ||
+                queue.state.load(std::memory_order_relaxed) != LogState::Running)
+            {
+                queue.sleeping.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            queue.wakeCv.wait_for(lock, kIdleWake, [&queue]()
+                                  { return queue.wakeRequested; });
+            queue.wakeRequested = false;
+            queue.sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void Log::Dispatch(const std::string &msg, LogType type)
+    {
+        LogQueue &queue = GetQueue();
+        if (queue.state.load(std::memory_order_acquire) == LogState::Idle)
+            Start();
+
+        // Registering as a writer keeps Shutdown from draining while this message is half pushed
+        queue.writers.fetch_add(1, std::memory_order_seq_cst);
+        if (queue.state.load(std::memory_order_seq_cst) == LogState::Running &&
+            !queue.crashed.load(std::memory_order_relaxed))
+        {
+            bool pushed = TryPush(queue, msg, type);
+            // Errors wait for room, the rest is counted and reported; the log thread itself never waits
+            if (!pushed && type == LogType::Error && !s_isLogThread)
+            {
+                while (!pushed && queue.state.load(std::memory_order_acquire) == LogState::Running)
+                {
+                    WakeWorker(queue);
+                    std::this_thread::yield();
+                    pushed = TryPush(queue, msg, type);
+                }
+            }
+
+            if (pushed)
+            {
+                queue.writers.fetch_sub(1, std::memory_order_release);
+                WakeWorker(queue);
+                return;
+            }
+            if (queue.state.load(std::memory_order_acquire) == LogState::Running)
+            {
+                queue.dropped.fetch_add(1, std::memory_order_relaxed);
+                queue.writers.fetch_sub(1, std::memory_order_release);
+                return;
+            }
+        }
+        queue.writers.fetch_sub(1, std::memory_order_release);
+
+        std::lock_guard<std::mutex> lock(GetLogMutex());
+        Deliver(msg, type);
+        std::fflush(stdout);
+        if (s_file)
+            std::fflush(s_file);
+    }
+
+    void Log::Flush()
+    {
+        LogQueue &queue = GetQueue();
+        if (queue.state.load(std::memory_order_acquire) != LogState::Running || s_isLogThread)
+            return;
+
+        const uint64_t target = queue.enqueuePos.load(std::memory_order_acquire);
+        std::unique_lock<std::mutex> lock(queue.wakeMutex);
+        queue.wakeRequested = true;
+        queue.wakeCv.notify_one();
+        queue.deliveredCv.wait(lock, [&queue, target]()
+                               { return queue.delivered.load(std::memory_order_acquire) >= target ||
+                                        queue.state.load(std::memory_order_acquire) != LogState::Running; });
+    }
+
+    void Log::Shutdown()
+    {
+        LogQueue &queue = GetQueue();
+        LogState previous = queue.state.exchange(LogState::Stopped, std::memory_order_seq_cst);
+        if (previous != LogState::Running)
+            return;
+
+        while (queue.writers.load(std::memory_order_acquire) != 0)
+            std::this_thread::yield();
+
+        if (queue.worker.joinable())
+        {
+            if (s_isLogThread)
+            {
+                queue.worker.detach();
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(queue.wakeMutex);
+                queue.wakeRequested = true;
+                queue.wakeCv.notify_one();
+            }
+            queue.worker.join();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queue.wakeMutex);
+            queue.deliveredCv.notify_all();
+        }
+
+        // The worker drains before exiting; this only catches it having been killed mid-batch (Windows
+        // terminates threads before DLL atexit handlers run), so never block on a lock it may still hold.
+        std::unique_lock<std::mutex> lock(GetLogMutex(), std::try_to_lock);
+        if (!lock)
+        {
+            FlushOnCrash();
+            return;
+        }
+        uint64_t pos = queue.delivered.load(std::memory_order_acquire);
+        for (;; ++pos)
+        {
+            Slot &slot = queue.slots[pos & (kSlotCount - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+                break;
+            Deliver(slot.text, slot.type);
+            slot.sequence.store(pos + kSlotCount, std::memory_order_release);
+        }
+        queue.delivered.store(pos, std::memory_order_release);
+        std::fflush(stdout);
+        if (s_file)
+            std::fflush(s_file);
+    }
+
+    void Log::FlushOnCrash()
+    {
+        // No locks and no allocation: the crashing thread may hold the log mutex or be the log thread.
+        // ponytail: a line the log thread was printing at the moment of the crash can appear twice.
+        LogQueue &queue = GetQueue();
+        if (queue.crashed.exchange(true) || !queue.slots)
+            return;
+
+        uint64_t pos = queue.delivered.load(std::memory_order_acquire);
+        const uint64_t end = queue.enqueuePos.load(std::memory_order_acquire);
+        for (; pos != end; ++pos)
+        {
+            const Slot &slot = queue.slots[pos & (kSlotCount - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+                continue; // claimed but not yet written
+            const char *prefix = Prefix(slot.type);
+            std::fputs(prefix, stderr);
+            std::fwrite(slot.text.data(), 1, slot.text.size(), stderr);
+            std::fputc('\n', stderr);
+            if (s_file)
+            {
+                std::fputs(prefix, s_file);
+                std::fwrite(slot.text.data(), 1, slot.text.size(), s_file);
+                std::fputc('\n', s_file);
+            }
+        }
+        std::fflush(stdout);
+        std::fflush(stderr);
+        if (s_file)
+            std::fflush(s_file);
+    }
+
     void Log::Info(const std::string &msg)
     {
         Dispatch(msg, LogType::Info);
@@ -123,6 +558,8 @@ namespace pe
 
     void Log::ClearCallbacks()
     {
+        // Callbacks run on the log thread; drain first so none is mid-call into unloading module code
+        Flush();
         std::lock_guard<std::mutex> lock(GetLogMutex());
         s_callbacks.clear();
     }
@@ -9,20 +9,39 @@ namespace pe
         Error
     };
 
+    // Callers copy the message into a preallocated ring slot and return; a background thread does the
+    // console, file and callback delivery. Identical messages past a small burst per second are
+    // collapsed into one "suppressed" line. Before the thread starts and after Shutdown, messages are
+    // delivered synchronously.
     class Log
     {
     public:
         using Callback = std::function<void(const std::string &, LogType)>;
 
+        // Opens the log file and installs the terminate/crash-signal handlers that flush pending messages
         static void Init();
         static void Info(const std::string &msg);
         static void Warn(const std::string &msg);
         static void Error(const std::string &msg);
+        // Callbacks run on the log thread, one at a time, not on the thread that logged (Attach replays
+        // early logs on the calling thread). Anything they share with the main thread needs a lock;
+        // queue the message and consume it on the main thread, as the editor Console does.
         static void Attach(Callback cb);
+        // Waits until nothing queued can still reach a callback, so module code can be unloaded after it
         static void ClearCallbacks();
 
+        // Blocks until every message logged before the call has been delivered
+        static void Flush();
+        // Delivers what is queued, stops the log thread and falls back to synchronous logging (also runs at exit)
+        static void Shutdown();
+        // Best-effort write of queued messages straight to stderr and the file from a crashing thread
+        static void FlushOnCrash();
+
     private:
+        static void Start();
         static void Dispatch(const std::string &msg, LogType type);
+        static void Deliver(const std::string &msg, LogType type);
+        static void WorkerMain();
 
         static std::vector<Callback> s_callbacks;
         static std::vector<std::pair<std::string, LogType>> s_earlyLogs;
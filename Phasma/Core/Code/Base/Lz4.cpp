@@ -0,0 +1,187 @@
+#include "Base/Lz4.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr size_t kMinMatch = 4;
+        constexpr size_t kLastLiterals = 5; // the format ends every block with at least this many literals
+        constexpr size_t kMatchFindLimit = 12; // no match may start in the last 12 bytes
+        constexpr size_t kMaxOffset = 65535;
+        constexpr uint32_t kHashLog = 14;
+
+        uint32_t Read32(const uint8_t *p)
+        {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        uint32_t HashSequence(uint32_t sequence)
+        {
+            return (sequence * 2654435761u) >> (32 - kHashLog);
+        }
+
+        // Token nibble plus 255-run extension bytes
+        uint8_t *WriteLength(uint8_t *op, size_t length)
+        {
+            for (; length >= 255; length -= 255)
+                *op++ = 255;
+            *op++ = static_cast<uint8_t>(length);
+            return op;
+        }
+
+        bool ReadLength(const uint8_t *&ip, const uint8_t *end, size_t &length)
+        {
+            uint8_t byte;
+            do
+            {
+                if (ip >= end)
+                    return false;
+                byte = *ip++;
+                length += byte;
+            } while (byte == 255);
+            return true;
+        }
+
+        uint8_t *EmitSequence(uint8_t *op, const uint8_t *opEnd, const uint8_t *literals, size_t literalLength,
+                              size_t offset, size_t matchLength)
+        {
+            const size_t worstCase = 1 + literalLength / 255 + 1 + literalLength + 2 + matchLength / 255 + 1;
+            if (static_cast<size_t>(opEnd - op) < worstCase)
+                return nullptr;
+
+            uint8_t *token = op++;
+            *token = static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4);
+            if (literalLength >= 15)
+                op = WriteLength(op, literalLength - 15);
+            std::memcpy(op, literals, literalLength);
+            op += literalLength;
+
+            if (matchLength == 0) // last sequence: literals only
+                return op;
+
+            *op++ = static_cast<uint8_t>(offset);
+            *op++ = static_cast<uint8_t>(offset >> 8);
+            const size_t encodedMatch = matchLength - kMinMatch;
+            *token |= static_cast<uint8_t>(std::min<size_t>(encodedMatch, 15));
+            if (encodedMatch >= 15)
+                op = WriteLength(op, encodedMatch - 15);
+            return op;
+        }
+    } // namespace
+
+    size_t Lz4Compress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity)
+    {
+        thread_local std::array<uint32_t, 1u << kHashLog> table;
+        table.fill(0);
+
+        uint8_t *op = dst;
+        const uint8_t *const opEnd = dst + capacity;
+        size_t anchor = 0;
+        if (size > kMatchFindLimit)
+        {
+            const size_t matchStartLimit = size - kMatchFindLimit;
+            const size_t matchEndLimit = size - kLastLiterals;
+            size_t ip = 1;
+            while (ip < matchStartLimit)
+            {
+                const uint32_t sequence = Read32(src + ip);
+                uint32_t &slot = table[HashSequence(sequence)];
+                size_t candidate = slot;
+                slot = static_cast<uint32_t>(ip);
+                if (candidate >= ip || ip - candidate > kMaxOffset || Read32(src + candidate) != sequence)
+                {
+                    // Skip faster through data that keeps missing, like LZ4's acceleration
+                    ip += 1 + ((ip - anchor) >> 6);
+                    continue;
+                }
+
+                while (ip > anchor && candidate > 0 && src[ip - 1] == src[candidate - 1])
+                {
+                    --ip;
+                    --candidate;
+                }
+                size_t matchLength = kMinMatch;
+                while (ip + matchLength < matchEndLimit && src[ip + matchLength] == src[candidate + matchLength])
+                    ++matchLength;
+
+                op = EmitSequence(op, opEnd, src + anchor, ip - anchor, ip - candidate, matchLength);
+                if (!op)
+                    return 0;
+                ip += matchLength;
+                anchor = ip;
+                if (ip < matchStartLimit)
+                    table[HashSequence(Read32(src + ip - 2))] = static_cast<uint32_t>(ip - 2);
+            }
+        }
+
+        op = EmitSequence(op, opEnd, src + anchor, size - anchor, 0, 0);
+        return op ? static_cast<size_t>(op - dst) : 0;
+    }
+
+    bool Lz4Decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t dstSize)
+    {
+        const uint8_t *ip = src;
+        const uint8_t *const ipEnd = src + size;
+        uint8_t *op = dst;
+        uint8_t *const opEnd = dst + dstSize;
+        while (ip < ipEnd)
+        {
+            const uint8_t token = *ip++;
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !ReadLength(ip, ipEnd, literalLength))
+                return false;
+            if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op))
+                return false;
+            if (literalLength <= 16 && ipEnd - ip >= 16 && opEnd - op >= 16)
+                std::memcpy(op, ip, 16); // fixed-size copy of the common short run
+            else
+                std::memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+            if (ip == ipEnd)
+                return op == opEnd;
+
+            if (ipEnd - ip < 2)
+                return false;
+            const size_t offset = static_cast<size_t>(ip[0]) | static_cast<size_t>(ip[1]) << 8;
+            ip += 2;
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !ReadLength(ip, ipEnd, matchLength))
+                return false;
+            matchLength += kMinMatch;
+            if (offset == 0 || offset > static_cast<size_t>(op - dst) || matchLength > static_cast<size_t>(opEnd - op))
+                return false;
+
+            const uint8_t *match = op - offset;
+            uint8_t *const matchEnd = op + matchLength;
+            if (offset >= 16 && static_cast<size_t>(opEnd - matchEnd) >= 16)
+            {
+                // 16-byte steps may write up to 15 bytes past the match; that is still inside dst and
+                // the next sequence overwrites it
+                for (; op < matchEnd; op += 16, match += 16)
+                    std::memcpy(op, match, 16);
+                op = matchEnd;
+            }
+            else if (offset >= 8 && static_cast<size_t>(opEnd - matchEnd) >= 8)
+            {
+                for (; op < matchEnd; op += 8, match += 8)
+                    std::memcpy(op, match, 8);
+                op = matchEnd;
+            }
+            else if (offset >= matchLength)
+            {
+                std::memcpy(op, match, matchLength);
+                op = matchEnd;
+            }
+            else
+            {
+                // Overlapping copy repeats the last `offset` bytes (run-length style)
+                for (size_t i = 0; i < matchLength; ++i)
+                    *op++ = match[i];
+            }
+        }
+        return size == 0 && dstSize == 0;
+    }
+} // namespace pe
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace pe
+{
+    // LZ4 block format (no frame, no checksums): greedy single-probe compressor, bounds-checked
+    // decompressor. Blocks are bit-compatible with liblz4's LZ4_compress_default/LZ4_decompress_safe,
+    // so the library can replace this without touching packed data.
+    // ponytail: no high-compression mode; swap in LZ4_HC at cook time if install size needs it.
+    [[nodiscard]] constexpr size_t Lz4CompressBound(size_t size) { return size + size / 255 + 16; }
+
+    // Returns the compressed size, or 0 when the output does not fit in `capacity`
+    [[nodiscard]] size_t Lz4Compress(const uint8_t *src, size_t size, uint8_t *dst, size_t capacity);
+
+    // Succeeds only when `src` decodes to exactly `dstSize` bytes; never reads or writes out of bounds
+    [[nodiscard]] bool Lz4Decompress(const uint8_t *src, size_t size, uint8_t *dst, size_t dstSize);
+} // namespace pe
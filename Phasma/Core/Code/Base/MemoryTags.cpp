@@ -0,0 +1,236 @@
+#include "Base/MemoryTags.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+
+        constexpr const char *kTagNames[kTagCount] = {
+            "Untagged",
+            "Scene",
+            "Voxel",
+            "Terrain",
+            "Staging",
+            "Undo",
+            "Script",
+            "Textures",
+            "RenderTargets",
+        };
+
+        // One cache line per tag so busy tags don't contend with each other
+        struct alignas(64) TagCounters
+        {
+            std::atomic<int64_t> cpuBytes{0}; // signed: a free can land before a racing alloc is counted
+            std::atomic<int64_t> gpuBytes{0};
+            std::atomic<int64_t> reportedBytes{0};
+            std::atomic<uint64_t> cpuPeak{0};
+            std::atomic<uint64_t> gpuPeak{0};
+            std::atomic<uint32_t> allocs{0};
+        };
+
+        struct ReporterEntry
+        {
+            MemoryTracker::ReporterId id;
+            MemoryTag tag;
+            MemoryTracker::Reporter reporter;
+        };
+
+        TagCounters s_counters[kTagCount];
+        thread_local MemoryTag s_currentTag = MemoryTag::Untagged;
+
+        std::mutex s_mutex; // reporters and the latched stats
+        std::vector<ReporterEntry> s_reporters;
+        MemoryTracker::ReporterId s_nextReporterId = 1;
+        MemoryTracker::TagStats s_latched[kTagCount];
+
+        TagCounters &Counters(MemoryTag tag)
+        {
+            const size_t index = static_cast<size_t>(tag);
+            return s_counters[index < kTagCount ? index : 0];
+        }
+
+        uint64_t Positive(int64_t value)
+        {
+            return value > 0 ? static_cast<uint64_t>(value) : 0;
+        }
+
+        void RaisePeak(std::atomic<uint64_t> &peak, uint64_t value)
+        {
+            uint64_t current = peak.load(std::memory_order_relaxed);
+            while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+    } // namespace
+
+    const char *MemoryTracker::GetTagName(MemoryTag tag)
+    {
+        const size_t index = static_cast<size_t>(tag);
+        return index < kTagCount ? kTagNames[index] : "Invalid";
+    }
+
+    MemoryTag MemoryTracker::GetCurrentTag()
+    {
+        return s_currentTag;
+    }
+
+    MemoryTag MemoryTracker::SetCurrentTag(MemoryTag tag)
+    {
+        const MemoryTag previous = s_currentTag;
+        s_currentTag = tag;
+        return previous;
+    }
+
+    void MemoryTracker::AddCpu(MemoryTag tag, size_t bytes)
+    {
+        TagCounters &c = Counters(tag);
+        c.allocs.fetch_add(1, std::memory_order_relaxed);
+        const int64_t live = c.cpuBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+                             static_cast<int64_t>(bytes);
+        RaisePeak(c.cpuPeak, Positive(live + c.reportedBytes.load(std::memory_order_relaxed)));
+    }
+
+    void MemoryTracker::RemoveCpu(MemoryTag tag, size_t bytes)
+    {
+        Counters(tag).cpuBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    }
+
+    void MemoryTracker::AddGpu(MemoryTag tag, size_t bytes)
+    {
+        TagCounters &c = Counters(tag);
+        c.allocs.fetch_add(1, std::memory_order_relaxed);
+        const int64_t live = c.gpuBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+                             static_cast<int64_t>(bytes);
+        RaisePeak(c.gpuPeak, Positive(live));
+    }
+
+    void MemoryTracker::RemoveGpu(MemoryTag tag, size_t bytes)
+    {
+        Counters(tag).gpuBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    }
+
+    MemoryTracker::ReporterId MemoryTracker::AddReporter(MemoryTag tag, Reporter reporter)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        const ReporterId id = s_nextReporterId++;
+        s_reporters.push_back({id, tag, std::move(reporter)});
+        return id;
+    }
+
+    void MemoryTracker::RemoveReporter(ReporterId id)
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (auto it = s_reporters.begin(); it != s_reporters.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                s_reporters.erase(it);
+                return;
+            }
+        }
+    }
+
+    void MemoryTracker::EndFrame()
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+
+        int64_t reported[kTagCount] = {};
+        for (const ReporterEntry &entry : s_reporters)
+            reported[static_cast<size_t>(entry.tag)] += static_cast<int64_t>(entry.reporter());
+
+        for (size_t i = 0; i < kTagCount; ++i)
+        {
+            TagCounters &c = s_counters[i];
+            c.reportedBytes.store(reported[i], std::memory_order_relaxed);
+
+            const uint64_t cpu = Positive(c.cpuBytes.load(std::memory_order_relaxed) + reported[i]);
+            RaisePeak(c.cpuPeak, cpu);
+
+            TagStats &stats = s_latched[i];
+            stats.tag = static_cast<MemoryTag>(i);
+            stats.cpuBytes = cpu;
+            stats.cpuPeakBytes = c.cpuPeak.load(std::memory_order_relaxed);
+            stats.gpuBytes = Positive(c.gpuBytes.load(std::memory_order_relaxed));
+            stats.gpuPeakBytes = c.gpuPeak.load(std::memory_order_relaxed);
+            stats.allocsPerFrame = c.allocs.exchange(0, std::memory_order_relaxed);
+        }
+    }
+
+    void MemoryTracker::GetStats(std::vector<TagStats> &out)
+    {
+        out.clear();
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (const TagStats &stats : s_latched)
+        {
+            if (stats.cpuPeakBytes || stats.gpuPeakBytes || stats.allocsPerFrame)
+                out.push_back(stats);
+        }
+    }
+} // namespace pe
+
+#if defined(PE_MEMORY_TAG_NEW)
+// Every heap allocation carries a 16-byte header with its size and tag, so frees are charged back to the
+// tag that allocated them even when another thread or scope frees them. Aligned new/delete keep the
+// runtime's own implementation and stay uncounted.
+// The replacement interposes process-wide on ELF and Mach-O. On Windows it would only bind inside
+// PhasmaCore.dll while other modules free through their own CRT, so CMake refuses the option there.
+namespace
+{
+    constexpr size_t kTagHeader = 16;
+
+    void *TaggedAlloc(size_t size)
+    {
+        const pe::MemoryTag tag = pe::MemoryTracker::GetCurrentTag();
+        void *block = std::malloc(size + kTagHeader);
+        if (!block)
+            return nullptr;
+
+        auto *header = static_cast<uint64_t *>(block);
+        header[0] = size;
+        header[1] = static_cast<uint64_t>(tag);
+        pe::MemoryTracker::AddCpu(tag, size);
+        return static_cast<char *>(block) + kTagHeader;
+    }
+
+    void TaggedFree(void *p) noexcept
+    {
+        if (!p)
+            return;
+
+        void *block = static_cast<char *>(p) - kTagHeader;
+        const auto *header = static_cast<const uint64_t *>(block);
+        pe::MemoryTracker::RemoveCpu(static_cast<pe::MemoryTag>(header[1]), static_cast<size_t>(header[0]));
+        std::free(block);
+    }
+} // namespace
+
+void *operator new(size_t size)
+{
+    if (void *p = TaggedAlloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return TaggedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return TaggedAlloc(size);
+}
+
+void operator delete(void *p) noexcept { TaggedFree(p); }
+void operator delete[](void *p) noexcept { TaggedFree(p); }
+void operator delete(void *p, size_t) noexcept { TaggedFree(p); }
+void operator delete[](void *p, size_t) noexcept { TaggedFree(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { TaggedFree(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { TaggedFree(p); }
+#endif
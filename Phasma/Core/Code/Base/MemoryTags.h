@@ -0,0 +1,125 @@
+#pragma once
+
+namespace pe
+{
+    enum class MemoryTag : uint8_t
+    {
+        Untagged,
+        Scene,
+        Voxel,
+        Terrain,
+        Staging,
+        Undo,
+        Script,
+        Textures,
+        RenderTargets,
+        Count
+    };
+
+    // Per-subsystem live/peak bytes for CPU and GPU memory plus allocations per frame. Three ways in:
+    //  - MemoryTagScope / PE_MEMORY_TAG: allocations made on this thread inside the scope take the tag
+    //    (Buffer::Create and Image::Create read it; so does the optional tagged global operator new)
+    //  - TaggedAllocator / PE_MEMORY_TAGGED_NEW: containers and classes that always belong to one tag
+    //  - Reporters: arenas and pools that already know their size report it once per frame
+    // Counting is a couple of relaxed atomics per allocation; totals are latched in EndFrame.
+    class MemoryTracker
+    {
+    public:
+        struct TagStats
+        {
+            MemoryTag tag = MemoryTag::Untagged;
+            uint64_t cpuBytes = 0;
+            uint64_t cpuPeakBytes = 0;
+            uint64_t gpuBytes = 0;
+            uint64_t gpuPeakBytes = 0;
+            uint32_t allocsPerFrame = 0;
+        };
+
+        using Reporter = std::function<uint64_t()>;
+        using ReporterId = uint32_t;
+
+        static const char *GetTagName(MemoryTag tag);
+        static MemoryTag GetCurrentTag();
+
+        static void AddCpu(MemoryTag tag, size_t bytes);
+        static void RemoveCpu(MemoryTag tag, size_t bytes);
+        static void AddGpu(MemoryTag tag, size_t bytes);
+        static void RemoveGpu(MemoryTag tag, size_t bytes);
+
+        // `reporter` returns the CPU bytes it currently owns. Reporters run on the frame thread inside
+        // EndFrame, so they may only read state that thread owns.
+        static ReporterId AddReporter(MemoryTag tag, Reporter reporter);
+        static void RemoveReporter(ReporterId id);
+
+        // Called by Profiler::EndFrame: polls reporters, latches allocation counts and peaks
+        static void EndFrame();
+        // Stats for every tag with any activity, as of the last EndFrame
+        static void GetStats(std::vector<TagStats> &out);
+
+        // Returns the previous tag
+        static MemoryTag SetCurrentTag(MemoryTag tag);
+    };
+
+    class MemoryTagScope
+    {
+    public:
+        explicit MemoryTagScope(MemoryTag tag) : m_previous{MemoryTracker::SetCurrentTag(tag)} {}
+        ~MemoryTagScope() { MemoryTracker::SetCurrentTag(m_previous); }
+
+        MemoryTagScope(const MemoryTagScope &) = delete;
+        MemoryTagScope &operator=(const MemoryTagScope &) = delete;
+
+    private:
+        MemoryTag m_previous;
+    };
+
+    // std-compatible allocator that charges its memory to a fixed tag
+    template <class T, MemoryTag Tag>
+    class TaggedAllocator
+    {
+    public:
+        using value_type = T;
+
+        template <class U>
+        struct rebind
+        {
+            using other = TaggedAllocator<U, Tag>;
+        };
+
+        TaggedAllocator() noexcept = default;
+        template <class U>
+        TaggedAllocator(const TaggedAllocator<U, Tag> &) noexcept {}
+
+        T *allocate(size_t n)
+        {
+            MemoryTracker::AddCpu(Tag, n * sizeof(T));
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T *p, size_t n) noexcept
+        {
+            MemoryTracker::RemoveCpu(Tag, n * sizeof(T));
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <class U>
+        bool operator==(const TaggedAllocator<U, Tag> &) const noexcept { return true; }
+        template <class U>
+        bool operator!=(const TaggedAllocator<U, Tag> &) const noexcept { return false; }
+    };
+} // namespace pe
+
+#define PE_MEMORY_TAG(tag) pe::MemoryTagScope PE_CONCAT(_peMemoryTag, __LINE__)(pe::MemoryTag::tag)
+
+// Class-level operator new/delete that charge every instance to `tag`
+#define PE_MEMORY_TAGGED_NEW(tag)                                        \
+    static void *operator new(size_t size)                               \
+    {                                                                    \
+        pe::MemoryTracker::AddCpu(pe::MemoryTag::tag, size);             \
+        return ::operator new(size);                                     \
+    }                                                                    \
+    static void operator delete(void *p, size_t size) noexcept           \
+    {                                                                    \
+        pe::MemoryTracker::RemoveCpu(pe::MemoryTag::tag, size);          \
+        ::operator delete(p);                                            \
+    }
@@ -4,30 +4,201 @@ namespace pe
 {
     namespace
     {
-        std::mutex s_globalMutex;
-        std::unordered_map<size_t, std::deque<void *>> s_handlesMap;
+        // The handle index carries the shard in its top bits and the slot within the shard below them
+        constexpr uint32_t kShardBits = 4;
+        constexpr uint32_t kShardCount = 1u << kShardBits;
+        constexpr uint32_t kSlotBits = 32 - kShardBits;
+        constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1;
+        constexpr uint32_t kMaxSlots = kSlotMask; // all ones in the last shard would be UINT32_MAX
+
+        // Dense object array for iteration plus a sparse slot array for handles; untracking swaps the
+        // last object into the hole. Each shard has its own lock and free list.
+        struct alignas(64) TypeShard
+        {
+            struct Slot
+            {
+                uint32_t dense = 0;      // index into objects, or the next free slot while free
+                uint32_t generation = 1; // bumped on untrack so old handles stop resolving
+            };
+
+            std::mutex mutex;
+            std::vector<void *> objects;
+            std::vector<uint32_t> denseToSlot;
+            std::vector<Slot> slots;
+            uint32_t freeHead = UINT32_MAX;
+
+            bool IsLive(uint32_t slot, uint32_t generation) const
+            {
+                return slot < slots.size() && slots[slot].generation == generation;
+            }
+        };
+
+        // Threads track into their own shard, so threads creating objects of one type do not share a
+        // lock; untrack and resolve go to the shard named by the handle, whichever thread calls them.
+        struct TypeRegistry
+        {
+            TypeShard shards[kShardCount];
+        };
+
+        uint32_t ThreadShard()
+        {
+            static std::atomic<uint32_t> s_nextShard{0};
+            thread_local const uint32_t shard = s_nextShard.fetch_add(1, std::memory_order_relaxed) & (kShardCount - 1);
+            return shard;
+        }
+
+        // Open-addressed by type hash; published entries are never removed, so lookups need no lock
+        constexpr size_t kMaxTypes = 128; // power of two
+
+        struct TypeEntry
+        {
+            std::atomic<size_t> hash{0};
+            std::atomic<TypeRegistry *> registry{nullptr};
+        };
+
+        TypeEntry s_types[kMaxTypes];
+        std::mutex s_typesMutex;
+
+        TypeRegistry *FindRegistry(const std::type_info &type, bool create)
+        {
+            const size_t hash = type.hash_code();
+            for (size_t i = 0; i < kMaxTypes; ++i)
+            {
+                TypeEntry &entry = s_types[(hash + i) & (kMaxTypes - 1)];
+                TypeRegistry *registry = entry.registry.load(std::memory_order_acquire);
+                if (!registry)
+                {
+                    if (!create)
+                        return nullptr;
+
+                    std::lock_guard<std::mutex> lock(s_typesMutex);
+                    registry = entry.registry.load(std::memory_order_acquire);
+                    if (!registry)
+                    {
+                        // Lives until exit: objects can be untracked from static destructors
+                        registry = new TypeRegistry();
+                        entry.hash.store(hash, std::memory_order_relaxed);
+                        entry.registry.store(registry, std::memory_order_release);
+                        return registry;
+                    }
+                }
+                if (entry.hash.load(std::memory_order_relaxed) == hash)
+                    return registry;
+            }
+
+            PE_ERROR("PeTracker: more than %zu tracked types", kMaxTypes);
+            return nullptr;
+        }
     } // namespace
 
-    void PeTracker::Track(const std::type_info &type, void *ptr)
+    PeTrackerHandle PeTracker::Track(const std::type_info &type, void *ptr)
     {
-        std::lock_guard<std::mutex> lock(s_globalMutex);
-        s_handlesMap[type.hash_code()].push_back(ptr);
+        TypeRegistry *registry = FindRegistry(type, true);
+        if (!registry)
+            return {};
+
+        const uint32_t shardIndex = ThreadShard();
+        TypeShard &shard = registry->shards[shardIndex];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        uint32_t index = shard.freeHead;
+        if (index != UINT32_MAX)
+        {
+            shard.freeHead = shard.slots[index].dense;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(shard.slots.size());
+            if (index >= kMaxSlots)
+            {
+                PE_ERROR("PeTracker: more than %u live objects of %s in one shard", kMaxSlots, type.name());
+                return {};
+            }
+            shard.slots.emplace_back();
+        }
+
+        TypeShard::Slot &slot = shard.slots[index];
+        slot.dense = static_cast<uint32_t>(shard.objects.size());
+        shard.objects.push_back(ptr);
+        shard.denseToSlot.push_back(index);
+        return {(shardIndex << kSlotBits) | index, slot.generation};
     }
 
-    void PeTracker::Untrack(const std::type_info &type, void *ptr)
+    void PeTracker::Untrack(const std::type_info &type, PeTrackerHandle handle)
     {
-        std::lock_guard<std::mutex> lock(s_globalMutex);
-        auto it = s_handlesMap.find(type.hash_code());
-        if (it != s_handlesMap.end())
-            std::erase(it->second, ptr);
+        TypeRegistry *registry = FindRegistry(type, false);
+        if (!registry)
+            return;
+
+        if (!handle.IsValid())
+            return;
+
+        TypeShard &shard = registry->shards[handle.index >> kSlotBits];
+        const uint32_t index = handle.index & kSlotMask;
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!shard.IsLive(index, handle.generation))
+            return;
+
+        TypeShard::Slot &slot = shard.slots[index];
+        const uint32_t dense = slot.dense;
+        const uint32_t last = static_cast<uint32_t>(shard.objects.size() - 1);
+        if (dense != last)
+        {
+            shard.objects[dense] = shard.objects[last];
+            shard.denseToSlot[dense] = shard.denseToSlot[last];
+            shard.slots[shard.denseToSlot[dense]].dense = dense;
+        }
+        shard.objects.pop_back();
+        shard.denseToSlot.pop_back();
+
+        slot.generation++;
+        slot.dense = shard.freeHead;
+        shard.freeHead = index;
     }
 
-    std::vector<void *> PeTracker::GetHandles(const std::type_info &type)
+    void *PeTracker::Resolve(const std::type_info &type, PeTrackerHandle handle)
     {
-        std::lock_guard<std::mutex> lock(s_globalMutex);
-        auto it = s_handlesMap.find(type.hash_code());
-        if (it != s_handlesMap.end())
-            return {it->second.begin(), it->second.end()};
-        return {};
+        TypeRegistry *registry = FindRegistry(type, false);
+        if (!registry)
+            return nullptr;
+
+        if (!handle.IsValid())
+            return nullptr;
+
+        TypeShard &shard = registry->shards[handle.index >> kSlotBits];
+        const uint32_t index = handle.index & kSlotMask;
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.IsLive(index, handle.generation) ? shard.objects[shard.slots[index].dense] : nullptr;
+    }
+
+    size_t PeTracker::Count(const std::type_info &type)
+    {
+        TypeRegistry *registry = FindRegistry(type, false);
+        if (!registry)
+            return 0;
+
+        size_t count = 0;
+        for (TypeShard &shard : registry->shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            count += shard.objects.size();
+        }
+        return count;
+    }
+
+    void PeTracker::ForEach(const std::type_info &type, Visit visit, void *user)
+    {
+        TypeRegistry *registry = FindRegistry(type, false);
+        if (!registry)
+            return;
+
+        for (TypeShard &shard : registry->shards)
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (void *object : shard.objects)
+            {
+                if (!visit(object, user))
+                    return;
+            }
+        }
     }
 } // namespace pe
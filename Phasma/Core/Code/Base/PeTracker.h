@@ -3,12 +3,87 @@
 
 namespace pe
 {
+    // Shard + slot index and generation into one type's registry. A handle goes stale when its object
+    // is untracked, and stays stale even after the slot is reused.
+    struct PeTrackerHandle
+    {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != UINT32_MAX; }
+    };
+
+    // Base for tracked objects: keeps the object's handle so Untrack needs no search
+    class PeTracked
+    {
+    public:
+        PeTrackerHandle GetTrackerHandle() const { return m_trackerHandle; }
+
+    private:
+        friend class PeTracker;
+        PeTrackerHandle m_trackerHandle{};
+    };
+
     // PE_API resource tracker. Lives entirely in PhasmaCore.dll
+    // One slot map per type, split into shards with their own lock and free list: Track/Untrack are
+    // O(1), each thread tracks into its own shard so creating objects of one type from several threads
+    // does not contend, and the type lookup itself is lock-free once a type has been seen.
     class PE_API PeTracker
     {
     public:
-        static void Track(const std::type_info &type, void *ptr);
-        static void Untrack(const std::type_info &type, void *ptr);
-        static std::vector<void *> GetHandles(const std::type_info &type);
+        using Visit = bool (*)(void *object, void *user); // false stops the iteration
+
+        static PeTrackerHandle Track(const std::type_info &type, void *ptr);
+        static void Untrack(const std::type_info &type, PeTrackerHandle handle);
+        // nullptr for stale handles
+        static void *Resolve(const std::type_info &type, PeTrackerHandle handle);
+        static size_t Count(const std::type_info &type);
+        // Visits live objects in no particular order, one shard at a time under that shard's lock:
+        // `visit` must not create or destroy objects of the same type.
+        static void ForEach(const std::type_info &type, Visit visit, void *user);
+
+        template <class T>
+        static void Track(T *ptr)
+        {
+            ptr->PeTracked::m_trackerHandle = Track(typeid(T), static_cast<void *>(ptr));
+        }
+
+        // Call before deleting the object
+        template <class T>
+        static void Untrack(T *ptr)
+        {
+            Untrack(typeid(T), ptr->PeTracked::m_trackerHandle);
+            ptr->PeTracked::m_trackerHandle = {};
+        }
+
+        // `fn(T *)` may return bool; false stops the iteration
+        template <class T, class Fn>
+        static void ForEach(Fn &&fn)
+        {
+            ForEach(
+                typeid(T),
+                [](void *object, void *user) -> bool
+                {
+                    Fn &f = *static_cast<std::remove_reference_t<Fn> *>(user);
+                    if constexpr (std::is_same_v<std::invoke_result_t<Fn &, T *>, bool>)
+                        return f(static_cast<T *>(object));
+                    else
+                    {
+                        f(static_cast<T *>(object));
+                        return true;
+                    }
+                },
+                const_cast<void *>(static_cast<const void *>(std::addressof(fn))));
+        }
+
+        template <class T>
+        static std::vector<T *> GetHandles()
+        {
+            std::vector<T *> out;
+            out.reserve(Count(typeid(T)));
+            ForEach<T>([&out](T *object)
+                       { out.push_back(object); });
+            return out;
+        }
     };
 } // namespace pe
@@ -1,25 +1,24 @@
-
 #include <cstring>
+#if defined(PE_WIN32)
+#include <windows.h>
+#elif defined(PE_LINUX) || defined(PE_ANDROID)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace pe
 {
-    std::vector<Profiler::Entry> Profiler::s_entries[2];
-    std::vector<Profiler::Counter> Profiler::s_counters[2];
-    float Profiler::s_frameTimes[2] = {};
-    std::chrono::high_resolution_clock::time_point Profiler::s_frameStart;
-    thread_local std::vector<Profiler::ActiveScope> Profiler::s_scopeStack;
-    thread_local uint32_t Profiler::s_currentDepth = 0;
-    uint32_t Profiler::s_writeIndex = 0;
-    uint64_t Profiler::s_frameGeneration = 0;
+    using Clock = std::chrono::high_resolution_clock;
 
     namespace
     {
-        // BeginScope/EndScope are lockless: each scope atomically claims a
-        // pre-allocated slot in s_entries[writeIndex]. Mutex is only taken on
-        // the rare paths (frame boundaries, widget reads, counter mutation).
+        // Scopes are recorded into per-thread rings when they close and drained
+        // into one flat frame on EndFrame. The hot paths (BeginScope, EndScope,
+        // AddCounter) never lock; the mutex only guards frame boundaries, reads
+        // and thread registration.
         constexpr uint32_t kMaxEntriesPerFrame = 16384;
-
-        std::atomic<uint32_t> g_entryCount[2] = {{0}, {0}};
+        constexpr uint32_t kRecordCapacity = 8192; // per thread, power of two
+        constexpr uint32_t kMaxCountersPerThread = 256;
 
         std::mutex &ProfilerMutex()
         {
@@ -27,32 +26,118 @@ namespace pe
             return mutex;
         }
 
-        // Pointer-identity keyed counter accumulator. PE_PROFILE_COUNTER always
-        // passes a string literal so the const char* address is stable for the
-        // process lifetime. Lookup is O(1) instead of strcmp-over-vector.
-        std::unordered_map<const char *, uint64_t> &CounterMap(uint32_t writeIndex)
+        float ToMs(Clock::duration d)
         {
-            static std::unordered_map<const char *, uint64_t> maps[2];
-            return maps[writeIndex];
+            return std::chrono::duration<float, std::milli>(d).count();
         }
 
-        void EnsureCapacity(std::vector<Profiler::Entry> &entries)
+        uint64_t CurrentThreadId()
         {
-            if (entries.size() < kMaxEntriesPerFrame)
-                entries.resize(kMaxEntriesPerFrame);
+#if defined(PE_WIN32)
+            return static_cast<uint64_t>(GetCurrentThreadId());
+#elif defined(PE_LINUX) || defined(PE_ANDROID)
+            return static_cast<uint64_t>(syscall(SYS_gettid));
+#else
+            return static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#endif
         }
     } // namespace
 
+    struct Profiler::ThreadBuffer
+    {
+        struct Record
+        {
+            const char *name;
+            Clock::time_point start;
+            Clock::time_point end;
+            uint32_t depth;
+        };
+
+        struct CounterSlot
+        {
+            const char *name = nullptr;
+            std::atomic<uint64_t> value{0};
+        };
+
+        // Single producer (the owning thread), single consumer (EndFrame)
+        std::unique_ptr<Record[]> records = std::make_unique<Record[]>(kRecordCapacity);
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+        std::atomic<uint32_t> dropped{0};
+
+        // Slots are append-only; EndFrame takes each value with an exchange so no add is lost
+        std::array<CounterSlot, kMaxCountersPerThread> counters;
+        std::atomic<uint32_t> counterCount{0};
+        std::unordered_map<const char *, uint32_t> counterLookup; // owner only
+
+        char name[32] = {};
+        uint64_t id = 0;
+        uint32_t order = 0; // lane sort key: main thread, then job workers, then everything else
+
+        // Buffers outlive their threads so EndFrame never races a thread exit; the set only grows
+        // with the number of distinct threads that ever profiled.
+        static std::mutex &RegistryMutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static std::vector<std::unique_ptr<ThreadBuffer>> &Registry()
+        {
+            static std::vector<std::unique_ptr<ThreadBuffer>> registry;
+            return registry;
+        }
+    };
+
+    std::vector<Profiler::Entry> Profiler::s_entries[2];
+    std::vector<Profiler::Counter> Profiler::s_counters[2];
+    std::vector<Profiler::Thread> Profiler::s_threads[2];
+    float Profiler::s_frameTimes[2] = {};
+    uint64_t Profiler::s_frameNumbers[2] = {UINT64_MAX, UINT64_MAX};
+    uint64_t Profiler::s_frameCount = 0;
+    Clock::time_point Profiler::s_frameStart;
+    thread_local std::vector<Profiler::ActiveScope> Profiler::s_scopeStack;
+    thread_local Profiler::ThreadBuffer *Profiler::s_threadBuffer = nullptr;
+    uint32_t Profiler::s_writeIndex = 0;
+
+    Profiler::ThreadBuffer &Profiler::GetThreadBuffer()
+    {
+        if (s_threadBuffer)
+            return *s_threadBuffer;
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->id = CurrentThreadId();
+
+        std::lock_guard<std::mutex> lock(ThreadBuffer::RegistryMutex());
+        const uint32_t worker = JobSystem::GetWorkerIndex();
+        if (worker != UINT32_MAX)
+        {
+            std::snprintf(buffer->name, sizeof(buffer->name), "Worker %u", worker);
+            buffer->order = 1 + worker;
+        }
+        else
+        {
+            const uint32_t index = static_cast<uint32_t>(ThreadBuffer::Registry().size());
+            std::snprintf(buffer->name, sizeof(buffer->name), "Thread %u", index);
+            buffer->order = (1u << 16) + index;
+        }
+
+        s_threadBuffer = buffer.get();
+        ThreadBuffer::Registry().push_back(std::move(buffer));
+        return *s_threadBuffer;
+    }
+
     void Profiler::BeginFrame()
     {
+        ThreadBuffer &buffer = GetThreadBuffer();
+
         std::lock_guard<std::mutex> lock(ProfilerMutex());
-        s_frameStart = std::chrono::high_resolution_clock::now();
-        EnsureCapacity(s_entries[s_writeIndex]);
-        g_entryCount[s_writeIndex].store(0, std::memory_order_relaxed);
-        s_counters[s_writeIndex].clear();
-        CounterMap(s_writeIndex).clear();
-        s_frameGeneration++;
-        s_currentDepth = 0;
+        s_frameStart = Clock::now();
+        if (buffer.order != 0)
+        {
+            std::snprintf(buffer.name, sizeof(buffer.name), "Main");
+            buffer.order = 0;
+        }
         s_scopeStack.clear();
     }
 
@@ -61,36 +146,99 @@ namespace pe
         while (!s_scopeStack.empty())
             EndScope();
 
-        auto now = std::chrono::high_resolution_clock::now();
-        std::lock_guard<std::mutex> lock(ProfilerMutex());
-        s_frameTimes[s_writeIndex] = std::chrono::duration<float, std::milli>(now - s_frameStart).count();
+        auto now = Clock::now();
+        {
+            std::lock_guard<std::mutex> lock(ProfilerMutex());
+            s_frameTimes[s_writeIndex] = ToMs(now - s_frameStart);
+            s_frameNumbers[s_writeIndex] = s_frameCount++;
+            DrainThreads(now);
+
+            s_writeIndex ^= 1;
+        }
 
-        s_writeIndex ^= 1;
+        MemoryTracker::EndFrame();
     }
 
-    void Profiler::BeginScope(const char *name)
+    void Profiler::DrainThreads(Clock::time_point frameEnd)
     {
-        const auto start = std::chrono::high_resolution_clock::now();
-        const uint32_t writeIndex = s_writeIndex;
-        const uint32_t index = g_entryCount[writeIndex].fetch_add(1, std::memory_order_relaxed);
-        // Scopes fired before the first BeginFrame safely no-op the write.
-        if (index < s_entries[writeIndex].size())
+        // Only ever runs on the frame thread under ProfilerMutex, so the scratch can be static
+        static std::vector<ThreadBuffer *> buffers;
+        static std::vector<ThreadBuffer::Record> records;
+        static std::unordered_map<const char *, size_t> counterIndex;
+
+        auto &entries = s_entries[s_writeIndex];
+        auto &counters = s_counters[s_writeIndex];
+        auto &threads = s_threads[s_writeIndex];
+        entries.clear();
+        counters.clear();
+        threads.clear();
+        counterIndex.clear();
+
         {
-            Entry &entry = s_entries[writeIndex][index];
-            entry.name = name;
-            entry.depth = s_currentDepth;
-            entry.timeMs = 0.0f;
-            entry.startOffsetMs = std::chrono::duration<float, std::milli>(start - s_frameStart).count();
+            std::lock_guard<std::mutex> lock(ThreadBuffer::RegistryMutex());
+            buffers.clear();
+            for (auto &buffer : ThreadBuffer::Registry())
+                buffers.push_back(buffer.get());
         }
+        std::sort(buffers.begin(), buffers.end(),
+                  [](const ThreadBuffer *a, const ThreadBuffer *b) { return a->order < b->order; });
+
+        uint64_t dropped = 0;
+        for (ThreadBuffer *buffer : buffers)
+        {
+            const uint32_t head = buffer->head.load(std::memory_order_acquire);
+            const uint32_t tail = buffer->tail.load(std::memory_order_relaxed);
+            records.clear();
+            for (uint32_t i = tail; i != head; ++i)
+                records.push_back(buffer->records[i & (kRecordCapacity - 1)]);
+            buffer->tail.store(head, std::memory_order_release);
 
-        ActiveScope scope{};
-        scope.start = start;
-        scope.entryIndex = index;
-        scope.writeIndex = writeIndex;
-        scope.generation = s_frameGeneration;
-        s_scopeStack.push_back(scope);
+            // Records arrive in close order (children first); the views expect pre-order per lane
+            std::sort(records.begin(), records.end(),
+                      [](const ThreadBuffer::Record &a, const ThreadBuffer::Record &b)
+                      { return a.start != b.start ? a.start < b.start : a.depth < b.depth; });
 
-        s_currentDepth++;
+            const uint32_t lane = static_cast<uint32_t>(threads.size());
+            threads.push_back({buffer->name, buffer->id});
+            for (const ThreadBuffer::Record &record : records)
+            {
+                // Leftovers from before the first BeginFrame, or from a long pause between frames
+                if (record.end < s_frameStart)
+                    continue;
+
+                if (entries.size() == kMaxEntriesPerFrame)
+                {
+                    dropped++;
+                    continue;
+                }
+
+                // Scopes that straddle the frame boundary are clipped to the part inside this frame
+                const Clock::time_point start = std::max(record.start, s_frameStart);
+                const Clock::time_point end = std::max(std::min(record.end, frameEnd), start);
+                entries.push_back({record.name, ToMs(end - start), ToMs(start - s_frameStart), record.depth, lane});
+            }
+            dropped += buffer->dropped.exchange(0, std::memory_order_relaxed);
+
+            const uint32_t counterCount = buffer->counterCount.load(std::memory_order_acquire);
+            for (uint32_t i = 0; i < counterCount; ++i)
+            {
+                ThreadBuffer::CounterSlot &slot = buffer->counters[i];
+                const uint64_t value = slot.value.exchange(0, std::memory_order_relaxed);
+                auto [it, inserted] = counterIndex.try_emplace(slot.name, counters.size());
+                if (inserted)
+                    counters.push_back({slot.name, value});
+                else
+                    counters[it->second].value += value;
+            }
+        }
+
+        if (dropped)
+            counters.push_back({"Profiler Dropped Scopes", dropped});
+    }
+
+    void Profiler::BeginScope(const char *name)
+    {
+        s_scopeStack.push_back({name, Clock::now()});
     }
 
     void Profiler::EndScope()
@@ -98,66 +246,83 @@ namespace pe
         if (s_scopeStack.empty())
             return;
 
-        auto end = std::chrono::high_resolution_clock::now();
+        const Clock::time_point end = Clock::now();
         const ActiveScope scope = s_scopeStack.back();
+        s_scopeStack.pop_back();
 
-        if (scope.entryIndex < s_entries[scope.writeIndex].size())
+        ThreadBuffer &buffer = GetThreadBuffer();
+        const uint32_t head = buffer.head.load(std::memory_order_relaxed);
+        if (head - buffer.tail.load(std::memory_order_acquire) == kRecordCapacity)
         {
-            s_entries[scope.writeIndex][scope.entryIndex].timeMs =
-                std::chrono::duration<float, std::milli>(end - scope.start).count();
+            // Nobody drained this thread for a while (no frames running); keep the oldest scopes
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
         }
 
-        s_scopeStack.pop_back();
-        s_currentDepth--;
+        buffer.records[head & (kRecordCapacity - 1)] = {scope.name, scope.start, end, static_cast<uint32_t>(s_scopeStack.size())};
+        buffer.head.store(head + 1, std::memory_order_release);
     }
 
     void Profiler::AddCounter(const char *name, uint64_t value)
     {
-        std::lock_guard<std::mutex> lock(ProfilerMutex());
-        CounterMap(s_writeIndex)[name] += value;
+        // Pointer-identity keyed: PE_PROFILE_COUNTER always passes a string
+        // literal so the const char* address is stable for the process lifetime.
+        ThreadBuffer &buffer = GetThreadBuffer();
+        auto it = buffer.counterLookup.find(name);
+        if (it == buffer.counterLookup.end())
+        {
+            const uint32_t slot = buffer.counterCount.load(std::memory_order_relaxed);
+            if (slot == kMaxCountersPerThread)
+                return;
+
+            buffer.counters[slot].name = name;
+            it = buffer.counterLookup.emplace(name, slot).first;
+            buffer.counterCount.store(slot + 1, std::memory_order_release);
+        }
+        buffer.counters[it->second].value.fetch_add(value, std::memory_order_relaxed);
     }
 
     const std::vector<Profiler::Entry> &Profiler::GetEntries()
     {
         std::lock_guard<std::mutex> lock(ProfilerMutex());
-        const uint32_t readIndex = s_writeIndex ^ 1;
-        auto &entries = s_entries[readIndex];
-        uint32_t count = g_entryCount[readIndex].load(std::memory_order_relaxed);
-        if (count > kMaxEntriesPerFrame)
-            count = kMaxEntriesPerFrame;
-        if (entries.size() > count)
-            entries.resize(count);
-        return entries;
+        return s_entries[s_writeIndex ^ 1];
     }
 
     const std::vector<Profiler::Counter> &Profiler::GetCounters()
     {
         std::lock_guard<std::mutex> lock(ProfilerMutex());
-        const uint32_t readIndex = s_writeIndex ^ 1;
-        auto &counters = s_counters[readIndex];
-        auto &map = CounterMap(readIndex);
-        if (counters.size() != map.size())
-        {
-            counters.clear();
-            counters.reserve(map.size());
-            for (auto &kv : map)
-                counters.push_back({kv.first, kv.second});
-        }
-        else
-        {
-            // Same set of names this frame — just refresh values in place.
-            for (Counter &c : counters)
-            {
-                auto it = map.find(c.name);
-                if (it != map.end())
-                    c.value = it->second;
-            }
-        }
-        return counters;
+        return s_counters[s_writeIndex ^ 1];
+    }
+
+    const std::vector<Profiler::Thread> &Profiler::GetThreads()
+    {
+        std::lock_guard<std::mutex> lock(ProfilerMutex());
+        return s_threads[s_writeIndex ^ 1];
     }
 
     float Profiler::GetFrameTimeMs()
     {
         return s_frameTimes[s_writeIndex ^ 1];
     }
+
+    uint64_t Profiler::GetFrameNumber()
+    {
+        std::lock_guard<std::mutex> lock(ProfilerMutex());
+        return s_frameNumbers[s_writeIndex ^ 1];
+    }
+
+    bool Profiler::TakeRetiredFrame(uint64_t frameNumber, std::vector<Entry> &entries, std::vector<Counter> &counters,
+                                    std::vector<Thread> &threads)
+    {
+        // The write slot keeps the retired frame until the next EndFrame drains into it, and nothing reads it
+        std::lock_guard<std::mutex> lock(ProfilerMutex());
+        if (frameNumber == UINT64_MAX || s_frameNumbers[s_writeIndex] != frameNumber)
+            return false;
+
+        s_entries[s_writeIndex].swap(entries);
+        s_counters[s_writeIndex].swap(counters);
+        s_threads[s_writeIndex].swap(threads);
+        s_frameNumbers[s_writeIndex] = UINT64_MAX;
+        return true;
+    }
 } // namespace pe
@@ -15,6 +15,14 @@ namespace pe
             float timeMs;
             float startOffsetMs;
             uint32_t depth;
+            uint32_t thread; // index into GetThreads()
+        };
+
+        // One timeline lane per thread that recorded scopes; the main thread (the one driving BeginFrame) is lane 0
+        struct Thread
+        {
+            const char *name;
+            uint64_t id;
         };
 
         struct Counter
@@ -32,25 +40,39 @@ namespace pe
 
         static const std::vector<Entry> &GetEntries();
         static const std::vector<Counter> &GetCounters();
+        static const std::vector<Thread> &GetThreads();
         static float GetFrameTimeMs();
+        // Number of the frame the getters above return (counts EndFrame calls); UINT64_MAX before the first
+        static uint64_t GetFrameNumber();
+
+        // Hands over frame `frameNumber` once it has retired (the frame before the one the getters return)
+        // by swapping its vectors with the caller's, which the profiler clears and refills later. O(1), and
+        // works once per frame; false if that frame is not the retired one or was already taken.
+        static bool TakeRetiredFrame(uint64_t frameNumber, std::vector<Entry> &entries, std::vector<Counter> &counters,
+                                     std::vector<Thread> &threads);
 
     private:
         struct ActiveScope
         {
+            const char *name;
             std::chrono::high_resolution_clock::time_point start;
-            uint32_t entryIndex;
-            uint32_t writeIndex;
-            uint64_t generation;
         };
 
+        struct ThreadBuffer;
+
+        static ThreadBuffer &GetThreadBuffer();
+        static void DrainThreads(std::chrono::high_resolution_clock::time_point frameEnd);
+
         static std::vector<Entry> s_entries[2];
         static std::vector<Counter> s_counters[2];
+        static std::vector<Thread> s_threads[2];
         static float s_frameTimes[2];
+        static uint64_t s_frameNumbers[2];
+        static uint64_t s_frameCount;
         static std::chrono::high_resolution_clock::time_point s_frameStart;
         static thread_local std::vector<ActiveScope> s_scopeStack;
-        static thread_local uint32_t s_currentDepth;
+        static thread_local ThreadBuffer *s_threadBuffer;
         static uint32_t s_writeIndex;
-        static uint64_t s_frameGeneration;
     };
 
     struct CpuProfileScope
@@ -0,0 +1,423 @@
+#include "Base/ProfilerFlightRecorder.h"
+#include "Base/ProfilerWire.h"
+#include "API/Debug.h"
+
+namespace pe
+{
+    namespace
+    {
+        // Bounds memory when a scene emits a lot of scopes per frame: the window shrinks instead
+        constexpr size_t kMaxRecordedEntries = 1u << 20;
+        constexpr size_t kMaxSpareFrames = 64;
+
+        void PutU32(std::ostream &out, uint32_t value)
+        {
+            const char bytes[4] = {
+                static_cast<char>(value & 0xff),
+                static_cast<char>((value >> 8) & 0xff),
+                static_cast<char>((value >> 16) & 0xff),
+                static_cast<char>((value >> 24) & 0xff),
+            };
+            out.write(bytes, 4);
+        }
+
+        uint32_t GetU32(const char *p)
+        {
+            const auto *b = reinterpret_cast<const uint8_t *>(p);
+            return static_cast<uint32_t>(b[0]) | (static_cast<uint32_t>(b[1]) << 8) |
+                   (static_cast<uint32_t>(b[2]) << 16) | (static_cast<uint32_t>(b[3]) << 24);
+        }
+
+        std::string DumpStem()
+        {
+            const std::time_t time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+            std::tm local{};
+#if defined(PE_WIN32)
+            localtime_s(&local, &time);
+#else
+            localtime_r(&time, &local);
+#endif
+            std::ostringstream stem;
+            stem << "hitch_" << std::put_time(&local, "%Y%m%d_%H%M%S");
+            return stem.str();
+        }
+
+        void AppendChromeEvent(std::string &out, const char *name, const char *category, double tsUs, double durUs,
+                               uint64_t pid, uint64_t tid)
+        {
+            char num[160];
+            out += "{\"name\":\"";
+            ProfilerSnapshot::AppendJsonEscaped(out, name);
+            out += "\",\"cat\":\"";
+            out += category;
+            std::snprintf(num, sizeof(num), "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%llu,\"tid\":%llu},",
+                          tsUs, durUs, (unsigned long long)pid, (unsigned long long)tid);
+            out += num;
+        }
+
+        void AppendChromeName(std::string &out, const char *kind, uint64_t pid, uint64_t tid, const char *name)
+        {
+            char num[96];
+            std::snprintf(num, sizeof(num), "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%llu,\"tid\":%llu,\"args\":{\"name\":\"",
+                          kind, (unsigned long long)pid, (unsigned long long)tid);
+            out += num;
+            ProfilerSnapshot::AppendJsonEscaped(out, name);
+            out += "\"}},";
+        }
+    } // namespace
+
+    void ProfilerFlightRecorder::Start(const Config &config, const std::string &directory)
+    {
+        if (m_running)
+            return;
+
+        m_config = config;
+        m_directory = directory;
+        m_running = true;
+        m_dumpCount = 0;
+        m_lastDumpSeconds = -1.0;
+        m_clock.Start();
+
+        m_enabledGpuTiming = m_config.gpuTiming && !Debug::IsGpuTimingEnabled();
+        if (m_enabledGpuTiming)
+            Debug::SetGpuTimingEnabled(true);
+
+        m_gpuToken = EventSystem::RegisterCallbackWithToken(
+            EventType::AfterCommandWait,
+            [this](const std::any &data)
+            {
+                try
+                {
+                    const auto &samples = std::any_cast<const std::vector<GpuTimerSample> &>(data);
+                    if (samples.empty())
+                        return;
+                    std::lock_guard lock(m_gpuMutex);
+                    m_gpuSamples = samples;
+                }
+                catch (const std::bad_any_cast &)
+                {
+                }
+            });
+    }
+
+    void ProfilerFlightRecorder::Stop()
+    {
+        if (!m_running)
+            return;
+        m_running = false;
+
+        EventSystem::UnregisterCallback(EventType::AfterCommandWait, m_gpuToken);
+        m_gpuToken = 0;
+
+        if (m_enabledGpuTiming && Debug::IsGpuTimingEnabled())
+            Debug::SetGpuTimingEnabled(false);
+        m_enabledGpuTiming = false;
+
+        if (m_pendingDump.valid())
+            m_pendingDump.wait();
+        m_pendingDump = {};
+
+        m_frames.clear();
+        m_current = {};
+        m_hasCurrent = false;
+        m_spare.clear();
+        m_entryCount = 0;
+        std::lock_guard lock(m_gpuMutex);
+        m_gpuSamples.clear();
+    }
+
+    void ProfilerFlightRecorder::PopFront()
+    {
+        m_entryCount -= m_frames.front().cpu.size();
+        Recycle(std::move(m_frames.front()));
+        m_frames.pop_front();
+    }
+
+    void ProfilerFlightRecorder::Recycle(Frame &&frame)
+    {
+        // The vectors go back to the Profiler on a later swap, which clears them; only their capacity matters
+        if (m_spare.size() < kMaxSpareFrames)
+            m_spare.push_back(std::move(frame));
+    }
+
+    void ProfilerFlightRecorder::Tick()
+    {
+        if (!m_running)
+            return;
+
+        const double now = m_clock.Count();
+
+        // Last Tick's frame has retired by now: take its scopes over without copying. If a Tick was
+        // skipped the Profiler has already reused that slot and the frame is dropped.
+        if (m_hasCurrent)
+        {
+            m_hasCurrent = false;
+            if (Profiler::TakeRetiredFrame(m_current.number, m_current.cpu, m_current.counters, m_current.threads))
+            {
+                m_entryCount += m_current.cpu.size();
+                m_frames.push_back(std::move(m_current));
+            }
+            else
+            {
+                Recycle(std::move(m_current));
+            }
+            m_current = {};
+        }
+
+        Frame frame;
+        if (!m_spare.empty())
+        {
+            frame = std::move(m_spare.back());
+            m_spare.pop_back();
+        }
+
+        FrameTimer &frameTimer = FrameTimer::Instance();
+        const double dt = frameTimer.GetDelta();
+        frame.fps = dt > 0.0 ? static_cast<float>(1.0 / dt) : 0.f;
+        frame.sample.frameMs = Profiler::GetFrameTimeMs();
+        frame.sample.cpuTotalMs = static_cast<float>(MILLI(frameTimer.GetCpuTotal()));
+        frame.sample.cpuUpdateMs = static_cast<float>(MILLI(frameTimer.GetUpdatesStamp()));
+        frame.sample.cpuDrawMs = frame.sample.cpuTotalMs - frame.sample.cpuUpdateMs;
+        frame.startSeconds = now - frame.sample.frameMs / 1000.0;
+        frame.number = Profiler::GetFrameNumber();
+
+        // A handful of tags, and recycled slots keep the steady state allocation-free
+        ProfilerSnapshot::GatherMemoryTags(frame.memoryTags);
+        frame.gpu.clear();
+        {
+            std::lock_guard lock(m_gpuMutex);
+            frame.gpu.swap(m_gpuSamples);
+        }
+        frame.sample.gpuTotalMs = 0.f;
+        for (const GpuTimerSample &sample : frame.gpu)
+        {
+            if (sample.depth == 0)
+                frame.sample.gpuTotalMs += sample.timeMs;
+        }
+
+        const float frameMs = frame.sample.frameMs;
+        m_current = std::move(frame);
+        m_hasCurrent = true;
+        while (m_frames.size() > 1 &&
+               (now - m_frames.front().startSeconds > m_config.windowSeconds || m_entryCount > kMaxRecordedEntries))
+            PopFront();
+
+        if (frameMs > m_config.hitchBudgetMs && m_dumpCount < m_config.maxDumps &&
+            (m_lastDumpSeconds < 0.0 || now - m_lastDumpSeconds >= m_config.cooldownSeconds))
+        {
+            char reason[64];
+            std::snprintf(reason, sizeof(reason), "%.1f ms frame over %.1f ms budget", frameMs, m_config.hitchBudgetMs);
+            if (Dump(reason))
+                m_dumpCount++;
+        }
+    }
+
+    bool ProfilerFlightRecorder::Dump(const char *reason)
+    {
+        if (!m_running || (m_frames.empty() && !m_hasCurrent))
+            return false;
+        if (m_pendingDump.valid() && m_pendingDump.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        // The newest frame (usually the hitch itself) is still the one the Profiler exposes, so it is
+        // copied here; only dumps pay for that
+        if (m_hasCurrent)
+        {
+            m_hasCurrent = false;
+            if (m_current.number == Profiler::GetFrameNumber())
+            {
+                m_current.cpu = Profiler::GetEntries();
+                m_current.threads = Profiler::GetThreads();
+                m_current.counters = Profiler::GetCounters();
+                m_frames.push_back(std::move(m_current));
+            }
+            m_current = {};
+            if (m_frames.empty())
+                return false;
+        }
+
+        auto frames = std::make_shared<std::vector<Frame>>(std::make_move_iterator(m_frames.begin()),
+                                                           std::make_move_iterator(m_frames.end()));
+        m_frames.clear();
+        m_entryCount = 0;
+        m_lastDumpSeconds = m_clock.Count();
+
+        const std::string path = m_directory + DumpStem() + "_" + std::to_string(m_dumpCount) + ".pefr";
+        Log::Warn("Profiler: flight recorder dump (" + std::string(reason ? reason : "manual") + ", " +
+                  std::to_string(frames->size()) + " frames) -> " + path);
+
+        const bool chromeTrace = m_config.chromeTrace;
+        const std::string directory = m_directory;
+        m_pendingDump = ThreadPool::GUI.Enqueue(
+            [frames, path, directory, chromeTrace]()
+            {
+                std::error_code ec;
+                std::filesystem::create_directories(directory, ec);
+                WriteDump(*frames, path, chromeTrace);
+            });
+        return true;
+    }
+
+    void ProfilerFlightRecorder::WriteDump(const std::vector<Frame> &frames, const std::string &path, bool chromeTrace)
+    {
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                Log::Error("Profiler: cannot write flight recorder dump " + path);
+                return;
+            }
+
+            file.write(kFileMagic, sizeof(kFileMagic));
+            PutU32(file, kFileVersion);
+
+            ProfilerWireEncoder encoder;
+            ProfilerSnapshot snapshot;
+            std::string payload;
+            for (const Frame &frame : frames)
+            {
+                snapshot.fps = frame.fps;
+                snapshot.frameMs = frame.sample.frameMs;
+                snapshot.cpuTotalMs = frame.sample.cpuTotalMs;
+                snapshot.cpuUpdateMs = frame.sample.cpuUpdateMs;
+                snapshot.cpuDrawMs = frame.sample.cpuDrawMs;
+                snapshot.gpuTotalMs = frame.sample.gpuTotalMs;
+                snapshot.cpuScopeTotalMs = 0.f;
+                for (const Profiler::Entry &entry : frame.cpu)
+                {
+                    if (entry.depth == 0 && entry.thread == 0)
+                        snapshot.cpuScopeTotalMs += entry.timeMs;
+                }
+                snapshot.cpuEntries = frame.cpu;
+                snapshot.cpuThreads = frame.threads;
+                snapshot.counters = frame.counters;
+                snapshot.memoryTags = frame.memoryTags;
+                snapshot.gpuSamples = frame.gpu;
+                snapshot.frameHistory.assign(1, frame.sample);
+
+                encoder.Encode(snapshot, payload);
+                PutU32(file, static_cast<uint32_t>(payload.size()));
+                file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+            }
+            if (!file)
+                Log::Error("Profiler: flight recorder dump " + path + " is incomplete");
+        }
+
+        if (!chromeTrace)
+            return;
+
+        // Trace Event JSON: CPU threads under pid 1 by OS thread id, frames and GPU passes under pid 2
+        std::string json;
+        json.reserve(256 + frames.size() * 4096);
+        json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        AppendChromeName(json, "process_name", 1, 0, "CPU");
+        AppendChromeName(json, "process_name", 2, 0, "Frames / GPU");
+        AppendChromeName(json, "thread_name", 2, 0, "Frames");
+        AppendChromeName(json, "thread_name", 2, 1, "GPU");
+
+        std::unordered_set<uint64_t> namedThreads;
+        char num[160];
+        for (const Frame &frame : frames)
+        {
+            const double frameUs = frame.startSeconds * 1e6;
+            for (const Profiler::Thread &thread : frame.threads)
+            {
+                if (namedThreads.insert(thread.id).second)
+                    AppendChromeName(json, "thread_name", 1, thread.id, thread.name);
+            }
+
+            AppendChromeEvent(json, "Frame", "frame", frameUs, frame.sample.frameMs * 1000.0, 2, 0);
+            for (const Profiler::Entry &entry : frame.cpu)
+            {
+                const uint64_t tid = entry.thread < frame.threads.size() ? frame.threads[entry.thread].id : 0;
+                AppendChromeEvent(json, entry.name, "cpu", frameUs + entry.startOffsetMs * 1000.0,
+                                  entry.timeMs * 1000.0, 1, tid);
+            }
+            // ponytail: GPU samples are the latest completed GPU frame, placed on the CPU frame that received them
+            for (const GpuTimerSample &sample : frame.gpu)
+                AppendChromeEvent(json, sample.name.c_str(), "gpu", frameUs + sample.startOffsetMs * 1000.0,
+                                  sample.timeMs * 1000.0, 2, 1);
+            for (const Profiler::Counter &counter : frame.counters)
+            {
+                json += "{\"name\":\"";
+                ProfilerSnapshot::AppendJsonEscaped(json, counter.name);
+                std::snprintf(num, sizeof(num), "\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"value\":%llu}},",
+                              frameUs, (unsigned long long)counter.value);
+                json += num;
+            }
+        }
+        if (json.back() == ',')
+            json.pop_back();
+        json += "]}";
+
+        const std::string tracePath = path.substr(0, path.size() - std::strlen(".pefr")) + ".trace.json";
+        std::ofstream trace(tracePath, std::ios::binary | std::ios::trunc);
+        trace.write(json.data(), static_cast<std::streamsize>(json.size()));
+        if (!trace)
+            Log::Error("Profiler: cannot write flight recorder trace " + tracePath);
+    }
+
+    bool ProfilerFlightRecorder::ReadDump(const std::string &path, std::vector<std::string> &outPayloads)
+    {
+        outPayloads.clear();
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+        const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (data.size() < 8 || std::memcmp(data.data(), kFileMagic, sizeof(kFileMagic)) != 0 ||
+            GetU32(data.data() + 4) != kFileVersion)
+            return false;
+
+        size_t offset = 8;
+        while (offset + 4 <= data.size())
+        {
+            const uint32_t length = GetU32(data.data() + offset);
+            offset += 4;
+            if (length > data.size() - offset)
+                return false;
+            outPayloads.emplace_back(data, offset, length);
+            offset += length;
+        }
+        return offset == data.size();
+    }
+
+    std::optional<ProfilerFlightRecorder::Config> ParseFlightRecorderArgs(int argc, char *argv[])
+    {
+        ProfilerFlightRecorder::Config config;
+        bool enabled = true;
+
+        if (const char *env = std::getenv("PE_FLIGHT_RECORDER"))
+        {
+            if (std::strcmp(env, "0") == 0 || std::strcmp(env, "false") == 0)
+                enabled = false;
+            else if (std::isdigit(static_cast<unsigned char>(env[0])))
+            {
+                config.hitchBudgetMs = static_cast<float>(std::atof(env));
+                config.gpuTiming = true;
+            }
+        }
+
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--no-flight-recorder") == 0)
+                enabled = false;
+            else if (std::strcmp(argv[i], "--flight-recorder") == 0)
+            {
+                enabled = true;
+                config.gpuTiming = true;
+            }
+            else if (std::strncmp(argv[i], "--flight-recorder=", 18) == 0)
+            {
+                enabled = true;
+                config.gpuTiming = true;
+                const float budget = static_cast<float>(std::atof(argv[i] + 18));
+                if (budget > 0.f)
+                    config.hitchBudgetMs = budget;
+            }
+        }
+
+        if (!enabled || config.hitchBudgetMs <= 0.f)
+            return std::nullopt;
+        return config;
+    }
+} // namespace pe
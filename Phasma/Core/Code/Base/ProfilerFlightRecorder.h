@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Base/ProfilerSnapshot.h"
+
+namespace pe
+{
+    // Keeps the last few seconds of Profiler frames (CPU scopes per thread, counters, GPU timer samples)
+    // in memory and writes them out when a frame blows the hitch budget, so slow frames can be inspected
+    // after the fact without a viewer attached. Recording is O(1) per frame: once a frame retires, its
+    // scope/counter/thread vectors are swapped out of the Profiler for recycled ones
+    // (Profiler::TakeRetiredFrame), so the newest frame only joins the window one Tick later and is
+    // copied only when a dump fires. Encoding and file I/O happen on a background job.
+    //
+    // Dump file (.pefr): "PEFR", little-endian uint32 version, then the frames oldest first, each as a
+    // little-endian uint32 length + ProfilerWire payload sharing one string table. PhasmaProfiler opens it
+    // offline (--open or drag and drop). A Chrome/Perfetto trace JSON can be written next to it.
+    // ponytail: a dump takes the whole window, so history restarts empty after each one.
+    class ProfilerFlightRecorder
+    {
+    public:
+        static constexpr char kFileMagic[4] = {'P', 'E', 'F', 'R'};
+        static constexpr uint32_t kFileVersion = 2;
+
+        struct Config
+        {
+            float hitchBudgetMs = 100.f;   // frames slower than this trigger a dump
+            double windowSeconds = 10.0;   // history kept in memory
+            double cooldownSeconds = 30.0; // minimum time between automatic dumps
+            uint32_t maxDumps = 8;         // automatic dumps per session
+            bool chromeTrace = true;       // also write <dump>.trace.json
+            // Turn GPU timestamp queries on at Start so dumps include GPU passes. Whoever switches timing
+            // off later (the live stream on disconnect, a user) wins; the recorder does not re-enable it.
+            bool gpuTiming = false;
+        };
+
+        ProfilerFlightRecorder() = default;
+        ~ProfilerFlightRecorder() { Stop(); }
+
+        ProfilerFlightRecorder(const ProfilerFlightRecorder &) = delete;
+        ProfilerFlightRecorder &operator=(const ProfilerFlightRecorder &) = delete;
+
+        // Registers AfterCommandWait for GPU samples. Dumps go to `directory` (created on first dump).
+        void Start(const Config &config, const std::string &directory);
+        // Waits for an in-flight dump
+        void Stop();
+        bool IsRunning() const { return m_running; }
+
+        // Call once per frame after Profiler::EndFrame(), next to ProfilerStreamServer::Tick()
+        void Tick();
+
+        // Writes the current window now, regardless of budget and cooldown. False while a dump is still
+        // being written or nothing was recorded yet.
+        bool Dump(const char *reason);
+
+        // Splits a .pefr file into its ProfilerWire payloads, oldest first
+        static bool ReadDump(const std::string &path, std::vector<std::string> &outPayloads);
+
+    private:
+        struct Frame
+        {
+            uint64_t number = UINT64_MAX; // Profiler::GetFrameNumber
+            double startSeconds = 0.0;
+            float fps = 0.f;
+            ProfilerFrameSample sample;
+            std::vector<Profiler::Entry> cpu;
+            std::vector<Profiler::Thread> threads;
+            std::vector<Profiler::Counter> counters;
+            std::vector<ProfilerMemoryTag> memoryTags;
+            std::vector<GpuTimerSample> gpu;
+        };
+
+        static void WriteDump(const std::vector<Frame> &frames, const std::string &path, bool chromeTrace);
+        void PopFront();
+        void Recycle(Frame &&frame);
+
+        Config m_config;
+        std::string m_directory;
+        bool m_running = false;
+        bool m_enabledGpuTiming = false; // Start switched it on, so Stop switches it off
+
+        std::deque<Frame> m_frames;
+        // The newest frame: timings, memory tags and GPU samples are filled, its scopes still live in the
+        // Profiler until the next Tick takes them
+        Frame m_current;
+        bool m_hasCurrent = false;
+        std::vector<Frame> m_spare;
+        size_t m_entryCount = 0;
+
+        EventSystem::CallbackToken m_gpuToken{};
+        std::mutex m_gpuMutex;
+        std::vector<GpuTimerSample> m_gpuSamples;
+
+        Timer m_clock;
+        double m_lastDumpSeconds = -1.0;
+        uint32_t m_dumpCount = 0;
+        std::shared_future<void> m_pendingDump;
+    };
+
+    // --flight-recorder[=budget_ms] / --no-flight-recorder / PE_FLIGHT_RECORDER (0 disables, a number sets
+    // the budget). On by default (see Core/Profiler/FlightRecorder in PhasmaBench for the per-frame cost), CPU only: GPU timing is enabled only when the recorder was explicitly
+    // asked for through the flag or a PE_FLIGHT_RECORDER budget. Returns nullopt if disabled.
+    std::optional<ProfilerFlightRecorder::Config> ParseFlightRecorderArgs(int argc, char *argv[]);
+} // namespace pe
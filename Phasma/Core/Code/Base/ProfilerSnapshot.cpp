@@ -8,28 +8,7 @@ namespace pe
     {
         void AppendEscaped(std::string &out, const char *s)
         {
-            if (!s)
-                return;
-            for (const char *p = s; *p; ++p)
-            {
-                const unsigned char c = static_cast<unsigned char>(*p);
-                if (c == '"' || c == '\\')
-                {
-                    out.push_back('\\');
-                    out.push_back(static_cast<char>(c));
-                }
-                else if (c < 0x20 || c >= 0x7f)
-                {
-                    // Keep stream UTF-8 JSON-safe; dangling/dynamic scope names can be garbage.
-                    char buf[8];
-                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
-                    out += buf;
-                }
-                else
-                {
-                    out.push_back(static_cast<char>(c));
-                }
-            }
+            ProfilerSnapshot::AppendJsonEscaped(out, s);
         }
 
         void AppendEscaped(std::string &out, const std::string &s)
@@ -38,6 +17,32 @@ namespace pe
         }
     } // namespace
 
+    void ProfilerSnapshot::AppendJsonEscaped(std::string &out, const char *s)
+    {
+        if (!s)
+            return;
+        for (const char *p = s; *p; ++p)
+        {
+            const unsigned char c = static_cast<unsigned char>(*p);
+            if (c == '"' || c == '\\')
+            {
+                out.push_back('\\');
+                out.push_back(static_cast<char>(c));
+            }
+            else if (c < 0x20 || c >= 0x7f)
+            {
+                // Keep stream UTF-8 JSON-safe; dangling/dynamic scope names can be garbage.
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            }
+            else
+            {
+                out.push_back(static_cast<char>(c));
+            }
+        }
+    }
+
     ProfilerSnapshot ProfilerSnapshot::Gather(std::vector<GpuTimerSample> gpuSamples)
     {
         ProfilerSnapshot d;
@@ -65,12 +70,15 @@ namespace pe
         d.gpuHostBudgetMb = gpu.host.budget >> 20;
 
         d.cpuEntries = Profiler::GetEntries();
+        d.cpuThreads = Profiler::GetThreads();
         for (const auto &e : d.cpuEntries)
         {
-            if (e.depth == 0)
+            // Worker lanes overlap the main thread, only its roots add up to the frame
+            if (e.depth == 0 && e.thread == 0)
                 d.cpuScopeTotalMs += e.timeMs;
         }
         d.counters = Profiler::GetCounters();
+        GatherMemoryTags(d.memoryTags);
 
         d.gpuSamples = std::move(gpuSamples);
         for (const auto &s : d.gpuSamples)
@@ -81,6 +89,24 @@ namespace pe
         return d;
     }
 
+    void ProfilerSnapshot::GatherMemoryTags(std::vector<ProfilerMemoryTag> &out)
+    {
+        static thread_local std::vector<MemoryTracker::TagStats> s_stats;
+        MemoryTracker::GetStats(s_stats);
+
+        out.clear();
+        for (const MemoryTracker::TagStats &stats : s_stats)
+        {
+            ProfilerMemoryTag &tag = out.emplace_back();
+            tag.name = MemoryTracker::GetTagName(stats.tag);
+            tag.cpuBytes = stats.cpuBytes;
+            tag.cpuPeakBytes = stats.cpuPeakBytes;
+            tag.gpuBytes = stats.gpuBytes;
+            tag.gpuPeakBytes = stats.gpuPeakBytes;
+            tag.allocsPerFrame = stats.allocsPerFrame;
+        }
+    }
+
     std::string ProfilerSnapshot::ToJson() const
     {
         std::string out;
@@ -122,9 +148,24 @@ namespace pe
         out += num;
         std::snprintf(num, sizeof(num), "\"gpu_host_other_mb\":%llu,", (unsigned long long)gpuHostOtherMb);
         out += num;
-        std::snprintf(num, sizeof(num), "\"gpu_host_budget_mb\":%llu", (unsigned long long)gpuHostBudgetMb);
+        std::snprintf(num, sizeof(num), "\"gpu_host_budget_mb\":%llu,", (unsigned long long)gpuHostBudgetMb);
         out += num;
-        out += "}},";
+        out += "\"tags\":[";
+        for (size_t i = 0; i < memoryTags.size(); ++i)
+        {
+            const auto &t = memoryTags[i];
+            out += "{\"name\":\"";
+            AppendEscaped(out, t.name);
+            std::snprintf(num, sizeof(num),
+                          "\",\"cpu_bytes\":%llu,\"cpu_peak_bytes\":%llu,\"gpu_bytes\":%llu,"
+                          "\"gpu_peak_bytes\":%llu,\"allocs_per_frame\":%u}",
+                          (unsigned long long)t.cpuBytes, (unsigned long long)t.cpuPeakBytes,
+                          (unsigned long long)t.gpuBytes, (unsigned long long)t.gpuPeakBytes, t.allocsPerFrame);
+            out += num;
+            if (i + 1 < memoryTags.size())
+                out += ',';
+        }
+        out += "]}},";
 
         out += "\"frame_history\":[";
         for (size_t i = 0; i < frameHistory.size(); ++i)
@@ -160,6 +201,18 @@ namespace pe
         out += "\"cpu\":{";
         std::snprintf(num, sizeof(num), "\"total_ms\":%.3f,", cpuScopeTotalMs);
         out += num;
+        out += "\"threads\":[";
+        for (size_t i = 0; i < cpuThreads.size(); ++i)
+        {
+            const auto &t = cpuThreads[i];
+            out += "{\"name\":\"";
+            AppendEscaped(out, t.name);
+            std::snprintf(num, sizeof(num), "\",\"id\":%llu}", (unsigned long long)t.id);
+            out += num;
+            if (i + 1 < cpuThreads.size())
+                out += ',';
+        }
+        out += "],";
         out += "\"scopes\":[";
         for (size_t i = 0; i < cpuEntries.size(); ++i)
         {
@@ -167,8 +220,8 @@ namespace pe
             out += "{\"name\":\"";
             AppendEscaped(out, e.name);
             std::snprintf(num, sizeof(num),
-                          "\",\"depth\":%u,\"cur_ms\":%.3f,\"start_offset_ms\":%.3f}",
-                          e.depth, e.timeMs, e.startOffsetMs);
+                          "\",\"depth\":%u,\"thread\":%u,\"cur_ms\":%.3f,\"start_offset_ms\":%.3f}",
+                          e.depth, e.thread, e.timeMs, e.startOffsetMs);
             out += num;
             if (i + 1 < cpuEntries.size())
                 out += ',';
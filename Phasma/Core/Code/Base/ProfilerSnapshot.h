@@ -11,6 +11,17 @@ namespace pe
         float gpuTotalMs = 0.f;
     };
 
+    // MemoryTracker stats for one tag; name is a static string or points into a wire decoder's table
+    struct ProfilerMemoryTag
+    {
+        const char *name = "";
+        uint64_t cpuBytes = 0;
+        uint64_t cpuPeakBytes = 0;
+        uint64_t gpuBytes = 0;
+        uint64_t gpuPeakBytes = 0;
+        uint32_t allocsPerFrame = 0;
+    };
+
     // In-memory profiler frame for live stream or disk dump. Gather only — no UI.
     struct ProfilerSnapshot
     {
@@ -35,14 +46,20 @@ namespace pe
         uint64_t gpuHostBudgetMb = 0;
 
         std::vector<Profiler::Entry> cpuEntries;
+        std::vector<Profiler::Thread> cpuThreads;
         std::vector<Profiler::Counter> counters;
         std::vector<GpuTimerSample> gpuSamples;
         std::vector<ProfilerFrameSample> frameHistory;
+        std::vector<ProfilerMemoryTag> memoryTags;
 
         // Pulls current Core/RHI metrics. gpuSamples are caller-owned (e.g. drained AfterCommandWait).
         static ProfilerSnapshot Gather(std::vector<GpuTimerSample> gpuSamples = {});
+        static void GatherMemoryTags(std::vector<ProfilerMemoryTag> &out);
 
         // Compact single-line JSON (safe for length-prefixed stream frames).
         std::string ToJson() const;
+
+        // Appends `s` as the body of a JSON string literal (no quotes)
+        static void AppendJsonEscaped(std::string &out, const char *s);
     };
 } // namespace pe
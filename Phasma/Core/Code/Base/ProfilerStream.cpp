@@ -245,6 +245,7 @@ namespace pe
             // One client: drop previous.
             CloseClient();
             m_publishIntervalSeconds.store(0.25, std::memory_order_relaxed);
+            m_binary.store(false, std::memory_order_relaxed);
             m_clientFd.store(ToStoredFd(client));
             Log::Info("ProfilerStream: client connected");
         }
@@ -278,6 +279,17 @@ namespace pe
                 const auto rate = static_cast<ProfilerRefreshRate>(value);
                 m_publishIntervalSeconds.store(RefreshIntervalSeconds(rate), std::memory_order_relaxed);
             }
+            else if (value == kProfilerWireCommandBase + kProfilerWireVersion)
+            {
+                // A fresh client knows no names yet
+                m_encoder.Reset();
+                m_binary.store(true, std::memory_order_relaxed);
+            }
+            else if (value >= kProfilerWireCommandBase && value < kProfilerRenderDocCaptureBase)
+            {
+                Log::Warn("ProfilerStream: client asked for unsupported wire version " +
+                          std::to_string(value - kProfilerWireCommandBase) + ", staying on JSON");
+            }
             else if (value >= kProfilerRenderDocCaptureBase &&
                      value < kProfilerRenderDocCaptureBase + kProfilerMaxRenderDocCaptureFrames)
             {
@@ -293,20 +305,20 @@ namespace pe
         }
     }
 
-    bool ProfilerStreamServer::SendFrame(const std::string &json)
+    bool ProfilerStreamServer::SendFrame(const std::string &payload)
     {
         const SocketFd fd = FromStoredFd(m_clientFd.load());
         if (fd == kInvalidSocket)
             return false;
 
-        const uint32_t len = static_cast<uint32_t>(json.size());
+        const uint32_t len = static_cast<uint32_t>(payload.size());
         uint8_t header[4] = {
             static_cast<uint8_t>(len & 0xff),
             static_cast<uint8_t>((len >> 8) & 0xff),
             static_cast<uint8_t>((len >> 16) & 0xff),
             static_cast<uint8_t>((len >> 24) & 0xff),
         };
-        if (!SendAll(fd, header, 4) || !SendAll(fd, json.data(), json.size()))
+        if (!SendAll(fd, header, 4) || !SendAll(fd, payload.data(), payload.size()))
         {
             CloseClient();
             return false;
@@ -381,8 +393,15 @@ namespace pe
             sampledMs += sample.frameMs;
         if (sampledMs > 0.f)
             snapshot.fps = 1000.f * static_cast<float>(snapshot.frameHistory.size()) / sampledMs;
-        const std::string json = snapshot.ToJson();
-        SendFrame(json);
+        if (m_binary.load(std::memory_order_relaxed))
+        {
+            m_encoder.Encode(snapshot, m_wireBuffer);
+            SendFrame(m_wireBuffer);
+        }
+        else
+        {
+            SendFrame(snapshot.ToJson());
+        }
     }
 
     bool ProfilerStreamClient::Connect(const char *host, int port)
@@ -472,6 +491,11 @@ namespace pe
         return SendCommand(static_cast<uint8_t>(kProfilerRenderDocCaptureBase + frameCount - 1));
     }
 
+    bool ProfilerStreamClient::RequestBinaryFrames()
+    {
+        return SendCommand(static_cast<uint8_t>(kProfilerWireCommandBase + kProfilerWireVersion));
+    }
+
     bool ProfilerStreamClient::SendCommand(uint8_t value)
     {
         if (m_fd < 0)
@@ -487,7 +511,7 @@ namespace pe
         return false;
     }
 
-    bool ProfilerStreamClient::TryRecvFrame(std::string &outJson)
+    bool ProfilerStreamClient::TryRecvFrame(std::string &outPayload)
     {
         if (m_fd < 0)
             return false;
@@ -536,7 +560,7 @@ namespace pe
             if (m_buf.size() < m_pendingLen)
                 return false;
 
-            outJson.assign(reinterpret_cast<const char *>(m_buf.data()), m_pendingLen);
+            outPayload.assign(reinterpret_cast<const char *>(m_buf.data()), m_pendingLen);
             m_buf.erase(m_buf.begin(), m_buf.begin() + static_cast<std::ptrdiff_t>(m_pendingLen));
             m_haveLen = false;
             m_pendingLen = 0;
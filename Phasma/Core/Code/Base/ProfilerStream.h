@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base/ProfilerSnapshot.h"
+#include "Base/ProfilerWire.h"
 
 #include <cstdint>
 
@@ -17,10 +18,13 @@ namespace pe
 
     inline constexpr uint8_t kProfilerRenderDocCaptureBase = 0x80;
     inline constexpr uint8_t kProfilerMaxRenderDocCaptureFrames = 64;
+    // Client sends kProfilerWireCommandBase + kProfilerWireVersion to switch the stream to binary frames
+    inline constexpr uint8_t kProfilerWireCommandBase = 0x40;
 
     // Loopback live profiler: Player/Editor pushes snapshot frames; PhasmaProfiler pulls them.
-    // Server to client: little-endian uint32 length + UTF-8 JSON payload.
-    // Client to server: one-byte refresh or encoded RenderDoc capture command.
+    // Server to client: little-endian uint32 length + payload. Payloads are UTF-8 JSON until the client
+    // asks for the binary ProfilerWire protocol (tools that never ask keep getting JSON).
+    // Client to server: one-byte refresh, binary protocol request, or encoded RenderDoc capture command.
     // ponytail: one client; reconnect replaces; GPU timing on only while a client is connected.
     class ProfilerStreamServer
     {
@@ -50,7 +54,7 @@ namespace pe
         void AcceptLoop();
         void CloseClient();
         void PollClientCommands();
-        bool SendFrame(const std::string &json);
+        bool SendFrame(const std::string &payload);
 
         int m_port = kDefaultPort;
         std::atomic<bool> m_running{false};
@@ -66,6 +70,9 @@ namespace pe
 
         Timer m_publishTimer;
         std::atomic<double> m_publishIntervalSeconds{0.25};
+        std::atomic<bool> m_binary{false};
+        ProfilerWireEncoder m_encoder;
+        std::string m_wireBuffer;
         bool m_firstPublish = true;
         bool m_gpuTimingOn = false;
     };
@@ -87,9 +94,11 @@ namespace pe
         bool SetRefreshRate(ProfilerRefreshRate rate);
         // Requests 1..64 consecutive RenderDoc frames from the Player. Non-blocking.
         bool TriggerRenderDocCapture(uint8_t frameCount);
+        // Asks for ProfilerWire frames instead of JSON. Players that predate it ignore the request.
+        bool RequestBinaryFrames();
 
-        // Non-blocking: returns true when a full frame was read into outJson.
-        bool TryRecvFrame(std::string &outJson);
+        // Non-blocking: returns true when a full frame (JSON or ProfilerWire) was read into outPayload.
+        bool TryRecvFrame(std::string &outPayload);
 
     private:
         bool SendCommand(uint8_t value);
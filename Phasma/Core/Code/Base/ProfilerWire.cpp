@@ -0,0 +1,355 @@
+#include "Base/ProfilerWire.h"
+
+namespace pe
+{
+    namespace
+    {
+        // A stream that keeps minting dynamic scope names would otherwise grow both tables forever
+        constexpr size_t kMaxNames = 1u << 16;
+        // Decoder-side sanity bound on any element count; every element costs at least one byte anyway
+        constexpr uint64_t kMaxElements = 1u << 20;
+
+        void PutVarint(std::string &out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<char>(value));
+        }
+
+        void PutZigZag(std::string &out, int64_t value)
+        {
+            PutVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        // ponytail: every supported target is little-endian, so floats go out as their raw bytes
+        void PutFloat(std::string &out, float value)
+        {
+            char bytes[sizeof(float)];
+            std::memcpy(bytes, &value, sizeof(float));
+            out.append(bytes, sizeof(float));
+        }
+
+        int64_t ToUs(float ms)
+        {
+            return std::llround(static_cast<double>(ms) * 1000.0);
+        }
+
+        uint64_t ToUnsignedUs(float ms)
+        {
+            return ms > 0.f ? static_cast<uint64_t>(ToUs(ms)) : 0;
+        }
+
+        float FromUs(int64_t us)
+        {
+            return static_cast<float>(static_cast<double>(us) / 1000.0);
+        }
+
+        struct Reader
+        {
+            const uint8_t *p;
+            const uint8_t *end;
+            bool ok = true;
+
+            uint8_t Byte()
+            {
+                if (p == end)
+                {
+                    ok = false;
+                    return 0;
+                }
+                return *p++;
+            }
+
+            uint64_t Varint()
+            {
+                uint64_t value = 0;
+                for (uint32_t shift = 0; shift < 64; shift += 7)
+                {
+                    const uint8_t byte = Byte();
+                    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+                    if (!(byte & 0x80))
+                        return value;
+                }
+                ok = false;
+                return 0;
+            }
+
+            int64_t ZigZag()
+            {
+                const uint64_t value = Varint();
+                return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+            }
+
+            float Float()
+            {
+                float value = 0.f;
+                if (end - p < static_cast<std::ptrdiff_t>(sizeof(float)))
+                {
+                    ok = false;
+                    return value;
+                }
+                std::memcpy(&value, p, sizeof(float));
+                p += sizeof(float);
+                return value;
+            }
+
+            size_t Count()
+            {
+                const uint64_t count = Varint();
+                if (count > kMaxElements || count > static_cast<uint64_t>(end - p))
+                    ok = false;
+                return ok ? static_cast<size_t>(count) : 0;
+            }
+        };
+    } // namespace
+
+    void ProfilerWireEncoder::Reset()
+    {
+        m_ids.clear();
+        m_names.clear();
+        m_resetPending = true;
+    }
+
+    uint32_t ProfilerWireEncoder::Intern(std::string_view name)
+    {
+        auto it = m_ids.find(name);
+        if (it != m_ids.end())
+            return it->second;
+
+        const uint32_t id = static_cast<uint32_t>(m_names.size());
+        const std::string &stored = m_names.emplace_back(name);
+        m_ids.emplace(stored, id);
+        m_newNames.push_back(id);
+        return id;
+    }
+
+    void ProfilerWireEncoder::Encode(const ProfilerSnapshot &snapshot, std::string &out)
+    {
+        if (m_names.size() > kMaxNames)
+            Reset();
+
+        // Names are interned while the body is written, so the body goes to scratch and the
+        // string table delta is emitted in front of it
+        std::string &body = m_body;
+        body.clear();
+        m_newNames.clear();
+
+        PutVarint(body, snapshot.frameHistory.size());
+        for (const ProfilerFrameSample &sample : snapshot.frameHistory)
+        {
+            PutVarint(body, ToUnsignedUs(sample.frameMs));
+            PutVarint(body, ToUnsignedUs(sample.cpuTotalMs));
+            PutVarint(body, ToUnsignedUs(sample.cpuUpdateMs));
+            PutVarint(body, ToUnsignedUs(sample.cpuDrawMs));
+            PutVarint(body, ToUnsignedUs(sample.gpuTotalMs));
+        }
+
+        PutVarint(body, snapshot.cpuThreads.size());
+        for (const Profiler::Thread &thread : snapshot.cpuThreads)
+        {
+            PutVarint(body, Intern(thread.name ? thread.name : ""));
+            PutVarint(body, thread.id);
+        }
+
+        int64_t previousStart = 0;
+        PutVarint(body, snapshot.cpuEntries.size());
+        for (const Profiler::Entry &entry : snapshot.cpuEntries)
+        {
+            const int64_t start = ToUs(entry.startOffsetMs);
+            PutVarint(body, Intern(entry.name ? entry.name : ""));
+            PutVarint(body, entry.thread);
+            PutVarint(body, entry.depth);
+            PutZigZag(body, start - previousStart);
+            PutVarint(body, ToUnsignedUs(entry.timeMs));
+            previousStart = start;
+        }
+
+        previousStart = 0;
+        PutVarint(body, snapshot.gpuSamples.size());
+        for (const GpuTimerSample &sample : snapshot.gpuSamples)
+        {
+            const int64_t start = ToUs(sample.startOffsetMs);
+            PutVarint(body, Intern(sample.name));
+            PutVarint(body, sample.depth);
+            PutZigZag(body, start - previousStart);
+            PutVarint(body, ToUnsignedUs(sample.timeMs));
+            previousStart = start;
+        }
+
+        PutVarint(body, snapshot.counters.size());
+        for (const Profiler::Counter &counter : snapshot.counters)
+        {
+            PutVarint(body, Intern(counter.name ? counter.name : ""));
+            PutVarint(body, counter.value);
+        }
+
+        PutVarint(body, snapshot.memoryTags.size());
+        for (const ProfilerMemoryTag &tag : snapshot.memoryTags)
+        {
+            PutVarint(body, Intern(tag.name ? tag.name : ""));
+            PutVarint(body, tag.cpuBytes);
+            PutVarint(body, tag.cpuPeakBytes);
+            PutVarint(body, tag.gpuBytes);
+            PutVarint(body, tag.gpuPeakBytes);
+            PutVarint(body, tag.allocsPerFrame);
+        }
+
+        uint8_t flags = 0;
+        if (m_resetPending)
+            flags |= kProfilerWireResetTable;
+        if (snapshot.renderDocAvailable)
+            flags |= kProfilerWireRenderDoc;
+        m_resetPending = false;
+
+        out.clear();
+        out.push_back(static_cast<char>(kProfilerWireMagic));
+        out.push_back(static_cast<char>(kProfilerWireVersion));
+        out.push_back(static_cast<char>(flags));
+
+        PutFloat(out, snapshot.fps);
+        PutFloat(out, snapshot.frameMs);
+        PutFloat(out, snapshot.cpuTotalMs);
+        PutFloat(out, snapshot.cpuUpdateMs);
+        PutFloat(out, snapshot.cpuDrawMs);
+        PutFloat(out, snapshot.cpuScopeTotalMs);
+        PutFloat(out, snapshot.gpuTotalMs);
+        PutVarint(out, snapshot.renderDocCaptureCount);
+        for (uint64_t mb : {snapshot.ramTotalMb, snapshot.ramUsedMb, snapshot.ramProcessMb,
+                            snapshot.gpuVramAppMb, snapshot.gpuVramOtherMb, snapshot.gpuVramBudgetMb,
+                            snapshot.gpuHostAppMb, snapshot.gpuHostOtherMb, snapshot.gpuHostBudgetMb})
+            PutVarint(out, mb);
+
+        PutVarint(out, m_newNames.size());
+        for (uint32_t id : m_newNames)
+        {
+            const std::string &name = m_names[id];
+            PutVarint(out, name.size());
+            out += name;
+        }
+        out += body;
+    }
+
+    bool ProfilerWireDecoder::Decode(const std::string &payload, ProfilerSnapshot &out)
+    {
+        if (!IsProfilerWireFrame(payload) || static_cast<uint8_t>(payload[1]) != kProfilerWireVersion)
+            return false;
+
+        Reader in{reinterpret_cast<const uint8_t *>(payload.data()) + 3,
+                  reinterpret_cast<const uint8_t *>(payload.data()) + payload.size()};
+        const uint8_t flags = static_cast<uint8_t>(payload[2]);
+        if (flags & kProfilerWireResetTable)
+            m_names.clear();
+
+        out = {};
+        out.renderDocAvailable = (flags & kProfilerWireRenderDoc) != 0;
+        out.fps = in.Float();
+        out.frameMs = in.Float();
+        out.cpuTotalMs = in.Float();
+        out.cpuUpdateMs = in.Float();
+        out.cpuDrawMs = in.Float();
+        out.cpuScopeTotalMs = in.Float();
+        out.gpuTotalMs = in.Float();
+        out.renderDocCaptureCount = static_cast<uint32_t>(in.Varint());
+        for (uint64_t *mb : {&out.ramTotalMb, &out.ramUsedMb, &out.ramProcessMb,
+                             &out.gpuVramAppMb, &out.gpuVramOtherMb, &out.gpuVramBudgetMb,
+                             &out.gpuHostAppMb, &out.gpuHostOtherMb, &out.gpuHostBudgetMb})
+            *mb = in.Varint();
+
+        const size_t newNames = in.Count();
+        for (size_t i = 0; i < newNames && in.ok; ++i)
+        {
+            const size_t length = in.Count();
+            if (!in.ok)
+                break;
+            m_names.emplace_back(reinterpret_cast<const char *>(in.p), length);
+            in.p += length;
+        }
+        if (m_names.size() > kMaxNames * 2)
+            in.ok = false;
+
+        const auto name = [&](uint64_t id) -> const std::string *
+        {
+            if (id >= m_names.size())
+            {
+                in.ok = false;
+                return nullptr;
+            }
+            return &m_names[static_cast<size_t>(id)];
+        };
+
+        const size_t historyCount = in.Count();
+        out.frameHistory.resize(historyCount);
+        for (ProfilerFrameSample &sample : out.frameHistory)
+        {
+            sample.frameMs = FromUs(static_cast<int64_t>(in.Varint()));
+            sample.cpuTotalMs = FromUs(static_cast<int64_t>(in.Varint()));
+            sample.cpuUpdateMs = FromUs(static_cast<int64_t>(in.Varint()));
+            sample.cpuDrawMs = FromUs(static_cast<int64_t>(in.Varint()));
+            sample.gpuTotalMs = FromUs(static_cast<int64_t>(in.Varint()));
+        }
+
+        const size_t threadCount = in.Count();
+        out.cpuThreads.resize(threadCount);
+        for (Profiler::Thread &thread : out.cpuThreads)
+        {
+            const std::string *threadName = name(in.Varint());
+            thread.name = threadName ? threadName->c_str() : "";
+            thread.id = in.Varint();
+        }
+
+        int64_t start = 0;
+        const size_t entryCount = in.Count();
+        out.cpuEntries.resize(entryCount);
+        for (Profiler::Entry &entry : out.cpuEntries)
+        {
+            const std::string *entryName = name(in.Varint());
+            entry.name = entryName ? entryName->c_str() : "";
+            entry.thread = static_cast<uint32_t>(in.Varint());
+            entry.depth = static_cast<uint32_t>(in.Varint());
+            start += in.ZigZag();
+            entry.startOffsetMs = FromUs(start);
+            entry.timeMs = FromUs(static_cast<int64_t>(in.Varint()));
+        }
+
+        start = 0;
+        const size_t gpuCount = in.Count();
+        out.gpuSamples.resize(gpuCount);
+        for (GpuTimerSample &sample : out.gpuSamples)
+        {
+            const std::string *sampleName = name(in.Varint());
+            if (sampleName)
+                sample.name = *sampleName;
+            sample.depth = static_cast<size_t>(in.Varint());
+            start += in.ZigZag();
+            sample.startOffsetMs = FromUs(start);
+            sample.timeMs = FromUs(static_cast<int64_t>(in.Varint()));
+        }
+
+        const size_t counterCount = in.Count();
+        out.counters.resize(counterCount);
+        for (Profiler::Counter &counter : out.counters)
+        {
+            const std::string *counterName = name(in.Varint());
+            counter.name = counterName ? counterName->c_str() : "";
+            counter.value = in.Varint();
+        }
+
+        const size_t tagCount = in.Count();
+        out.memoryTags.resize(tagCount);
+        for (ProfilerMemoryTag &tag : out.memoryTags)
+        {
+            const std::string *tagName = name(in.Varint());
+            tag.name = tagName ? tagName->c_str() : "";
+            tag.cpuBytes = in.Varint();
+            tag.cpuPeakBytes = in.Varint();
+            tag.gpuBytes = in.Varint();
+            tag.gpuPeakBytes = in.Varint();
+            tag.allocsPerFrame = static_cast<uint32_t>(in.Varint());
+        }
+
+        return in.ok;
+    }
+} // namespace pe
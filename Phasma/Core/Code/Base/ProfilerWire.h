@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Base/ProfilerSnapshot.h"
+
+namespace pe
+{
+    // Binary profiler frames: a fraction of the JSON size and no text formatting on the frame thread.
+    // Frame layout (little-endian, unsigned LEB128 varints, zigzag for signed deltas):
+    //   u8 magic, u8 version, u8 flags (kProfilerWireResetTable | kProfilerWireRenderDoc)
+    //   overview: 7 x f32, varint renderdoc captures, 9 x varint memory MB
+    //   varint new string count, then per string: varint length + bytes (ids continue the table)
+    //   varint frame history count, then per sample: 5 x varint us
+    //   varint thread count, then per thread: varint name id, varint os thread id
+    //   varint cpu scope count, then per scope: varint name id, varint thread, varint depth,
+    //                                           zigzag start delta us, varint duration us
+    //   varint gpu sample count, same encoding as cpu scopes without the thread
+    //   varint counter count, then per counter: varint name id, varint value
+    //   varint memory tag count, then per tag: varint name id, varint cpu bytes, varint cpu peak,
+    //                                          varint gpu bytes, varint gpu peak, varint allocs per frame
+    // Names go into a per-connection string table the first time they are used; a frame with
+    // kProfilerWireResetTable set starts a new table.
+    inline constexpr uint8_t kProfilerWireMagic = 0xB7; // never the first byte of a JSON frame
+    inline constexpr uint8_t kProfilerWireVersion = 2;
+    inline constexpr uint8_t kProfilerWireResetTable = 1 << 0;
+    inline constexpr uint8_t kProfilerWireRenderDoc = 1 << 1; // RenderDoc capture API available
+
+    inline bool IsProfilerWireFrame(const std::string &payload)
+    {
+        return payload.size() >= 3 && static_cast<uint8_t>(payload[0]) == kProfilerWireMagic;
+    }
+
+    class ProfilerWireEncoder
+    {
+    public:
+        // Appends one frame to `out` (cleared first); the buffer is meant to be reused across frames
+        void Encode(const ProfilerSnapshot &snapshot, std::string &out);
+
+        // Forget every name the peer knows; the next frame re-sends the table
+        void Reset();
+
+    private:
+        uint32_t Intern(std::string_view name);
+
+        std::unordered_map<std::string_view, uint32_t> m_ids;
+        std::deque<std::string> m_names; // backs the m_ids keys
+        std::vector<uint32_t> m_newNames;
+        std::string m_body;
+        bool m_resetPending = true;
+    };
+
+    class ProfilerWireDecoder
+    {
+    public:
+        // Entry/Thread/Counter names in `out` point into this decoder's table: they stay valid until the
+        // next frame that resets it, or Reset(). A failed decode leaves the table out of sync, so the
+        // caller drops the connection.
+        bool Decode(const std::string &payload, ProfilerSnapshot &out);
+        void Reset() { m_names.clear(); }
+
+    private:
+        std::deque<std::string> m_names;
+    };
+} // namespace pe
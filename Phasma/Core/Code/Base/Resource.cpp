@@ -0,0 +1,86 @@
+#include "Base/Resource.h"
+
+namespace pe
+{
+    namespace
+    {
+        constexpr uint32_t YieldsBeforeSleep = 64;
+    } // namespace
+
+    Resource::Resource(const Resource &other)
+        : m_resourceId(other.m_resourceId), m_state(other.GetState()), m_loadError(other.m_loadError),
+          m_dependencies(other.GetDependencies())
+    {
+    }
+
+    Resource &Resource::operator=(const Resource &other)
+    {
+        if (this == &other)
+            return *this;
+        std::vector<std::shared_ptr<Resource>> dependencies = other.GetDependencies();
+        m_resourceId = other.m_resourceId;
+        m_loadError = other.m_loadError;
+        SetState(other.GetState());
+        std::lock_guard<std::mutex> lock(m_dependencyMutex);
+        m_dependencies = std::move(dependencies);
+        return *this;
+    }
+
+    void Resource::AddDependency(std::shared_ptr<Resource> dependency)
+    {
+        if (!dependency || dependency.get() == this)
+            return;
+        std::lock_guard<std::mutex> lock(m_dependencyMutex);
+        m_dependencies.push_back(std::move(dependency));
+    }
+
+    std::vector<std::shared_ptr<Resource>> Resource::GetDependencies() const
+    {
+        std::lock_guard<std::mutex> lock(m_dependencyMutex);
+        return m_dependencies;
+    }
+
+    bool Resource::IsReady() const
+    {
+        if (GetState() != ResourceState::Ready)
+            return false;
+        for (const std::shared_ptr<Resource> &dependency : GetDependencies())
+        {
+            if (!dependency->IsReady())
+                return false;
+        }
+        return true;
+    }
+
+    bool Resource::IsPending() const
+    {
+        if (GetState() == ResourceState::Loading)
+            return true;
+        for (const std::shared_ptr<Resource> &dependency : GetDependencies())
+        {
+            if (dependency->IsPending())
+                return true;
+        }
+        return false;
+    }
+
+    void Resource::Wait() const
+    {
+        // Same spin-help as JobCounter::Wait: the load itself may be queued behind the waiter
+        JobSystem &jobs = JobSystem::Get();
+        uint32_t idle = 0;
+        while (IsPending())
+        {
+            if (jobs.TryRunOne(JobPriority::Normal))
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < YieldsBeforeSleep)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+} // namespace pe
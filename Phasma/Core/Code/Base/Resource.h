@@ -1,11 +1,21 @@
 #pragma once
+#include "Base/PhasmaExport.h"
 
 namespace pe
 {
-    class Resource
+    enum class ResourceState : uint8_t
+    {
+        Loading, // ResourceManager is running Load()
+        Ready,
+        Failed // Load() threw
+    };
+
+    class PE_API Resource
     {
     public:
-        Resource() : m_resourceId(""), m_loaded(false) {}
+        Resource() : m_resourceId("") {}
+        Resource(const Resource &other);
+        Resource &operator=(const Resource &other);
         virtual ~Resource() = default;
 
         virtual void Load() {}
@@ -14,10 +24,34 @@ namespace pe
         const std::string &GetResourceId() const { return m_resourceId; }
         void SetResourceId(const std::string &id) { m_resourceId = id; }
 
-        bool IsLoaded() const { return m_loaded; }
+        // Resources created outside the ResourceManager are Ready from the start
+        ResourceState GetState() const { return m_state.load(std::memory_order_acquire); }
+        void SetState(ResourceState state) { m_state.store(state, std::memory_order_release); }
+        bool IsLoaded() const { return GetState() == ResourceState::Ready; }
+        // What Load() threw; set before the state turns Failed, empty otherwise
+        std::exception_ptr GetLoadError() const { return m_loadError; }
+
+        // Resources this one needs before it is usable, e.g. the pass info a cooked model started
+        // loading in parallel with its textures. IsReady and Wait cover the whole (acyclic) tree.
+        void AddDependency(std::shared_ptr<Resource> dependency);
+        std::vector<std::shared_ptr<Resource>> GetDependencies() const;
+
+        // This resource and every dependency loaded successfully
+        bool IsReady() const;
+        // Something in the tree is still loading
+        bool IsPending() const;
+        // Runs pending jobs until nothing in the tree is loading; check IsReady after for failures
+        void Wait() const;
 
     protected:
         std::string m_resourceId;
-        bool m_loaded;
+
+    private:
+        friend class ResourceManager;
+
+        std::atomic<ResourceState> m_state{ResourceState::Ready};
+        std::exception_ptr m_loadError;
+        mutable std::mutex m_dependencyMutex;
+        std::vector<std::shared_ptr<Resource>> m_dependencies;
     };
 } // namespace pe
@@ -0,0 +1,85 @@
+#include "Base/ResourceManager.h"
+
+namespace pe
+{
+    namespace
+    {
+        struct LoadJob : Job
+        {
+            std::shared_ptr<Resource> resource;
+        };
+    } // namespace
+
+    ResourceManager &ResourceManager::Get()
+    {
+        static ResourceManager instance;
+        return instance;
+    }
+
+    ResourceManager::Stats ResourceManager::GetStats() const
+    {
+        return {m_hits.load(std::memory_order_relaxed), m_joins.load(std::memory_order_relaxed),
+                m_misses.load(std::memory_order_relaxed), m_inFlight.load(std::memory_order_relaxed)};
+    }
+
+    void ResourceManager::PublishCounters() const
+    {
+        PE_PROFILE_COUNTER("Resources.InFlight", m_inFlight.load(std::memory_order_relaxed));
+    }
+
+    void ResourceManager::CountLookup(bool joined)
+    {
+        if (joined)
+        {
+            m_joins.fetch_add(1, std::memory_order_relaxed);
+            PE_PROFILE_COUNTER("Resources.Joins", 1);
+        }
+        else
+        {
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            PE_PROFILE_COUNTER("Resources.CacheHits", 1);
+        }
+    }
+
+    void ResourceManager::RunLoad(const std::shared_ptr<Resource> &resource)
+    {
+        // Joined waiters spin on the state, so it must leave Loading even when Load() throws, and they
+        // rethrow the same error
+        try
+        {
+            resource->Load();
+            resource->SetState(ResourceState::Ready);
+        }
+        catch (...)
+        {
+            resource->m_loadError = std::current_exception();
+            resource->SetState(ResourceState::Failed);
+            m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void ResourceManager::ScheduleLoad(std::shared_ptr<Resource> resource)
+    {
+        auto *job = new LoadJob();
+        job->resource = std::move(resource);
+        job->execute = [](Job *base)
+        {
+            std::unique_ptr<LoadJob> self(static_cast<LoadJob *>(base));
+            try
+            {
+                Get().RunLoad(self->resource);
+            }
+            catch (const std::exception &e)
+            {
+                PE_WARN("[ResourceManager] Failed to load %s: %s", self->resource->GetResourceId().c_str(), e.what());
+            }
+            catch (...)
+            {
+                PE_WARN("[ResourceManager] Failed to load %s", self->resource->GetResourceId().c_str());
+            }
+        };
+        JobSystem::Get().Submit(job, JobPriority::Normal);
+    }
+} // namespace pe
@@ -30,55 +30,59 @@ namespace pe
         std::shared_ptr<T> m_ptr;
     };
 
-    class ResourceManager
+    // Process-wide cache of shared resources, keyed by type and id. Entries are weak: a resource lives
+    // as long as some handle does. The cache is split into shards, each behind its own reader/writer
+    // lock, and no lock is held while a resource loads, so loads of different ids run concurrently and
+    // lookups never wait on a slow Load(). A request for an id that is already loading joins that load.
+    class PE_API ResourceManager
     {
     public:
-        static ResourceManager &Get()
-        {
-            static ResourceManager instance;
-            return instance;
-        }
+        static ResourceManager &Get();
 
+        // Loads on the calling thread, or waits for the load already in flight for this id. Either way
+        // a failed Load() rethrows its exception here.
         template <typename T, typename... Args>
         ResourceHandle<T> Load(const std::string &id, Args &&...args)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            auto typeIdx = std::type_index(typeid(T));
-
-            auto &cache = m_resources[typeIdx];
-            auto it = cache.find(id);
-
-            if (it != cache.end())
+            bool created = false;
+            std::shared_ptr<T> resource = Acquire<T>(id, created, std::forward<Args>(args)...);
+            if (created)
             {
-                std::shared_ptr<Resource> res = it->second.lock();
-                if (res)
-                {
-                    return ResourceHandle<T>(std::static_pointer_cast<T>(res));
-                }
+                RunLoad(resource);
             }
+            else
+            {
+                resource->Wait();
+                if (resource->GetState() == ResourceState::Failed && resource->GetLoadError())
+                    std::rethrow_exception(resource->GetLoadError());
+            }
+            return ResourceHandle<T>(resource);
+        }
 
-            // Not found or expired, create new
-            std::shared_ptr<T> newResource = std::make_shared<T>(std::forward<Args>(args)...);
-            newResource->SetResourceId(id);
-            newResource->Load();
-
-            cache[id] = newResource; // Store weak_ptr
-
-            return ResourceHandle<T>(newResource);
+        // Returns at once; Load() runs on the job system. Wait (or check IsReady) before use; a failed
+        // load leaves the resource Failed with its error in GetLoadError.
+        template <typename T, typename... Args>
+        ResourceHandle<T> LoadAsync(const std::string &id, Args &&...args)
+        {
+            bool created = false;
+            std::shared_ptr<T> resource = Acquire<T>(id, created, std::forward<Args>(args)...);
+            if (created)
+                ScheduleLoad(resource);
+            return ResourceHandle<T>(resource);
         }
 
+        // Cached resource, loaded or still loading; empty when absent or expired
         template <typename T>
         ResourceHandle<T> Find(const std::string &id)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            auto typeIdx = std::type_index(typeid(T));
-            auto typeIt = m_resources.find(typeIdx);
-            if (typeIt == m_resources.end())
+            Shard &shard = GetShard(id);
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto typeIt = shard.types.find(std::type_index(typeid(T)));
+            if (typeIt == shard.types.end())
                 return ResourceHandle<T>();
 
-            auto &cache = typeIt->second;
-            auto it = cache.find(id);
-            if (it == cache.end())
+            auto it = typeIt->second.find(id);
+            if (it == typeIt->second.end())
                 return ResourceHandle<T>();
 
             std::shared_ptr<Resource> res = it->second.lock();
@@ -91,22 +95,78 @@ namespace pe
         template <typename T>
         void Register(const std::string &id, std::shared_ptr<T> resource)
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            auto typeIdx = std::type_index(typeid(T));
             resource->SetResourceId(id);
-            m_resources[typeIdx][id] = resource;
+            Shard &shard = GetShard(id);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            shard.types[std::type_index(typeid(T))][id] = resource;
         }
 
+        struct Stats
+        {
+            uint64_t hits;     // found loaded
+            uint64_t joins;    // found still loading, and waited on that load instead of starting another
+            uint64_t misses;   // started a load
+            uint32_t inFlight; // loads running or queued now
+        };
+        Stats GetStats() const;
+
+        // Per-frame profiler counters; the hit/join/miss ones are reported as they happen
+        void PublishCounters() const;
+
     private:
+        static constexpr size_t ShardCount = 16;
+
+        struct Shard
+        {
+            std::shared_mutex mutex;
+            // Type Index -> (string id -> weak_ptr<Resource>)
+            std::unordered_map<std::type_index, std::unordered_map<std::string, std::weak_ptr<Resource>>> types;
+        };
+
         ResourceManager() = default;
         ~ResourceManager() = default;
         ResourceManager(const ResourceManager &) = delete;
         ResourceManager &operator=(const ResourceManager &) = delete;
 
-        std::mutex m_mutex;
-        // Type Index -> (string id -> weak_ptr<Resource>)
-        // We use weak_ptr so that the ResourceManager doesn't keep resources alive on its own.
-        // Resources are automatically destroyed when all ResourceHandles are gone.
-        std::unordered_map<std::type_index, std::unordered_map<std::string, std::weak_ptr<Resource>>> m_resources;
+        Shard &GetShard(const std::string &id) { return m_shards[std::hash<std::string>{}(id) % ShardCount]; }
+
+        // The cached resource for id, or a new one (state Loading, created = true) the caller must load
+        template <typename T, typename... Args>
+        std::shared_ptr<T> Acquire(const std::string &id, bool &created, Args &&...args)
+        {
+            Shard &shard = GetShard(id);
+            std::unique_lock<std::shared_mutex> lock(shard.mutex);
+            std::weak_ptr<Resource> &slot = shard.types[std::type_index(typeid(T))][id];
+            std::shared_ptr<Resource> res = slot.lock();
+            if (res && res->GetState() != ResourceState::Failed) // a failed load is retried
+            {
+                CountLookup(res->GetState() == ResourceState::Loading);
+                created = false;
+                return std::static_pointer_cast<T>(res);
+            }
+
+            // Not found, expired or failed: create new
+            std::shared_ptr<T> resource = std::make_shared<T>(std::forward<Args>(args)...);
+            resource->SetResourceId(id);
+            resource->SetState(ResourceState::Loading);
+            slot = resource; // Store weak_ptr
+            lock.unlock();
+
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            m_inFlight.fetch_add(1, std::memory_order_relaxed);
+            PE_PROFILE_COUNTER("Resources.CacheMisses", 1);
+            created = true;
+            return resource;
+        }
+
+        void CountLookup(bool joined);
+        void RunLoad(const std::shared_ptr<Resource> &resource);
+        void ScheduleLoad(std::shared_ptr<Resource> resource);
+
+        std::array<Shard, ShardCount> m_shards;
+        std::atomic<uint64_t> m_hits{0};
+        std::atomic<uint64_t> m_joins{0};
+        std::atomic<uint64_t> m_misses{0};
+        std::atomic<uint32_t> m_inFlight{0};
     };
 } // namespace pe
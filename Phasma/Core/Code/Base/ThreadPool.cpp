@@ -1,4 +1,3 @@
-
 namespace pe
 {
     static size_t ClampThreads(size_t n)
@@ -6,6 +5,11 @@ namespace pe
         return std::max<size_t>(1, n);
     }
 
+    ThreadPool::ThreadPool(JobPriority priority)
+        : m_shared{true}, m_priority{priority}
+    {
+    }
+
     ThreadPool::ThreadPool(size_t threads)
     {
         const size_t count = ClampThreads(threads);
@@ -40,6 +44,12 @@ namespace pe
 
     ThreadPool::~ThreadPool()
     {
+        if (m_shared)
+        {
+            WaitIdle();
+            return;
+        }
+
         {
             std::unique_lock<std::mutex> lock(m_queue_mutex);
             m_stop = true;
@@ -52,17 +62,63 @@ namespace pe
         }
     }
 
+    void ThreadPool::Dispatch(std::function<void()> &&task)
+    {
+        if (m_shared)
+        {
+            auto *job = new TaskJob();
+            job->execute = &ThreadPool::ExecuteTask;
+            job->fn = std::move(task);
+            job->pool = this;
+            m_pending.fetch_add(1, std::memory_order_relaxed);
+            JobSystem::Get().Submit(job, m_priority);
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            if (m_stop)
+                throw std::runtime_error("enqueue on stopped ThreadPool");
+            m_tasks.emplace_back(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void ThreadPool::ExecuteTask(Job *job)
+    {
+        auto *task = static_cast<TaskJob *>(job);
+        ThreadPool *pool = task->pool;
+        task->fn();
+        delete task;
+
+        if (pool->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            pool->m_pending.notify_all();
+    }
+
     void ThreadPool::WaitIdle()
     {
+        if (m_shared)
+        {
+            // A worker blocking here would take a core out of the pool it is waiting on, so it helps instead
+            const bool help = JobSystem::IsWorkerThread();
+            for (uint32_t pending = m_pending.load(std::memory_order_acquire); pending != 0;
+                 pending = m_pending.load(std::memory_order_acquire))
+            {
+                if (help && JobSystem::Get().TryRunOne(JobPriority::Low))
+                    continue;
+                m_pending.wait(pending, std::memory_order_acquire);
+            }
+            return;
+        }
+
         std::unique_lock<std::mutex> lock(m_queue_mutex);
         m_idle.wait(lock, [this] { return m_tasks.empty() && m_activeWorkers == 0; });
     }
 
-    static const size_t N = ClampThreads(std::thread::hardware_concurrency());
-    PE_API ThreadPool ThreadPool::General(N);
-    PE_API ThreadPool ThreadPool::Update(N);
-    PE_API ThreadPool ThreadPool::Render(N);
-    PE_API ThreadPool ThreadPool::FW(1);
-    PE_API ThreadPool ThreadPool::GUI(N);
+    PE_API ThreadPool ThreadPool::General(JobPriority::Normal);
+    PE_API ThreadPool ThreadPool::Update(JobPriority::High);
+    PE_API ThreadPool ThreadPool::Render(JobPriority::High);
+    PE_API ThreadPool ThreadPool::FW(size_t{1});
+    PE_API ThreadPool ThreadPool::GUI(JobPriority::Low);
     PE_API std::thread::id ThreadPool::MainThreadID = std::this_thread::get_id();
 } // namespace pe
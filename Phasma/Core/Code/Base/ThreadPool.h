@@ -1,28 +1,47 @@
 #pragma once
+#include "Base/JobSystem.h"
 
 namespace pe
 {
+    // Future-returning front end over the engine JobSystem. The shared pools are priority classes on
+    // the same worker set rather than separate thread groups; a pool constructed with a thread count
+    // owns dedicated threads instead (used for long-lived loops that would otherwise pin a worker).
     class PE_API ThreadPool
     {
     public:
+        explicit ThreadPool(JobPriority priority);
         explicit ThreadPool(size_t threads);
         ~ThreadPool();
 
         template <class F, class... Args>
         auto Enqueue(F &&fn, Args &&...args) -> std::shared_future<std::invoke_result_t<F, Args...>>;
 
-        // Wait until all tasks are done and no workers are active
+        // Wait until every task enqueued through this pool has finished
         void WaitIdle();
 
-        static ThreadPool General;
-        static ThreadPool Update;
-        static ThreadPool Render;
-        static ThreadPool FW;
-        static ThreadPool GUI;
+        static ThreadPool General; // JobPriority::Normal
+        static ThreadPool Update;  // JobPriority::High
+        static ThreadPool Render;  // JobPriority::High
+        static ThreadPool FW;      // dedicated thread, owned by the FileWatcher loop
+        static ThreadPool GUI;     // JobPriority::Low
         // Main thread id
         static std::thread::id MainThreadID;
 
     private:
+        struct TaskJob : Job
+        {
+            std::function<void()> fn;
+            ThreadPool *pool;
+        };
+
+        void Dispatch(std::function<void()> &&task);
+        static void ExecuteTask(Job *job);
+
+        bool m_shared{false};
+        JobPriority m_priority{JobPriority::Normal};
+        std::atomic<uint32_t> m_pending{0};
+
+        // Dedicated mode only
         std::vector<std::thread> m_workers;
         std::deque<std::function<void()>> m_tasks;
 
@@ -46,14 +65,8 @@ namespace pe
             });
 
         std::shared_future<return_type> future = task_ptr->get_future().share();
-        {
-            std::unique_lock<std::mutex> lock(m_queue_mutex);
-            if (m_stop)
-                throw std::runtime_error("enqueue on stopped ThreadPool");
-            m_tasks.emplace_back([task_ptr = std::move(task_ptr)]() mutable
-                                 { (*task_ptr)(); });
-        }
-        m_condition.notify_one();
+        Dispatch([task_ptr = std::move(task_ptr)]() mutable
+                 { (*task_ptr)(); });
         return future;
     }
 } // namespace pe
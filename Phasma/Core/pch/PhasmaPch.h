@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <deque>
 #include <execution>
 #include <filesystem>
@@ -33,6 +34,7 @@
 #include <regex>
 #include <set>
 #include <shared_mutex>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
@@ -81,12 +83,15 @@
 #include "Base/Math.h"
 #include "Base/Base.h"
 #include "Base/Path.h"
+#include "Base/JobSystem.h"
 #include "Base/ThreadPool.h"
 #include "Base/Delegate.h"
 #include "Base/Timer.h"
 #include "Base/Profiler.h"
+#include "Base/MemoryTags.h"
 #include "Base/FileSystem.h"
 #include "Base/GamePack.h"
+#include "Base/IoService.h"
 #include "Base/FileWatcher.h"
 #include "Base/EventSystem.h"
 #include "Base/Resource.h"
@@ -617,6 +617,7 @@ namespace pe
     bool App::Frame()
     {
         Profiler::BeginFrame();
+        ResourceManager::Get().PublishCounters();
 
         RHII.NextFrame();
 
@@ -2456,7 +2456,38 @@ namespace pe
                     int count = args.value("count", 100);
                     std::string level = args.value("level", "all");
 
-                    const auto &logs = console->GetLogs();
+                    // Tool handlers run on the MCP thread; the console may only be drained and read on
+                    // the main thread, so snapshot it there. Shared state survives a wait_for timeout.
+                    struct State
+                    {
+                        std::mutex mtx;
+                        std::condition_variable cv;
+                        bool done = false;
+                        std::vector<LogEntry> logs;
+                    };
+                    auto state = std::make_shared<State>();
+
+                    gui->QueueMainThreadAction([state, console]()
+                                               {
+                        Log::Flush();
+                        console->DrainPending();
+                        std::vector<LogEntry> logs = console->GetLogs();
+                        {
+                            std::lock_guard lock(state->mtx);
+                            state->logs = std::move(logs);
+                            state->done = true;
+                        }
+                        state->cv.notify_one(); });
+
+                    std::vector<LogEntry> logs;
+                    {
+                        std::unique_lock lock(state->mtx);
+                        if (!state->cv.wait_for(lock, std::chrono::seconds(5), [&state]
+                                                { return state->done; }))
+                            return CallToolResult::Error("timeout waiting for main thread");
+                        logs = std::move(state->logs);
+                    }
+
                     nlohmann::json entries = nlohmann::json::array();
                     int start = std::max(0, (int)logs.size() - count);
                     for (int i = start; i < (int)logs.size(); ++i)
@@ -4819,26 +4819,25 @@ namespace pe
                         uintptr_t address = 0;
                         std::istringstream is(key.substr(2));
                         is >> std::hex >> address;
-                        for (Image *candidate : Image::GetHandles())
-                        {
-                            if (reinterpret_cast<uintptr_t>(candidate) == address)
-                            {
-                                image = candidate;
-                                break;
-                            }
-                        }
+                        PeTracker::ForEach<Image>([&](Image *candidate)
+                                               {
+                                                   if (reinterpret_cast<uintptr_t>(candidate) != address)
+                                                       return true;
+                                                   image = candidate;
+                                                   return false;
+                                               });
                     }
                     else
                     {
                         int matches = 0;
-                        for (Image *candidate : Image::GetHandles())
-                        {
-                            if (candidate && candidate->GetName() == key)
-                            {
-                                image = candidate;
-                                ++matches;
-                            }
-                        }
+                        PeTracker::ForEach<Image>([&](Image *candidate)
+                                               {
+                                                   if (candidate->GetName() == key)
+                                                   {
+                                                       image = candidate;
+                                                       ++matches;
+                                                   }
+                                               });
                         if (matches > 1)
                             state->result = R"({"error":"image name is ambiguous; use image:0x... id from list_image_resources"})";
                     }
@@ -5133,26 +5132,25 @@ namespace pe
                     uintptr_t address = 0;
                     std::istringstream is(key.substr(2));
                     is >> std::hex >> address;
-                    for (Buffer *candidate : Buffer::GetHandles())
-                    {
-                        if (reinterpret_cast<uintptr_t>(candidate) == address)
-                        {
-                            buffer = candidate;
-                            break;
-                        }
-                    }
+                    PeTracker::ForEach<Buffer>([&](Buffer *candidate)
+                                           {
+                                               if (reinterpret_cast<uintptr_t>(candidate) != address)
+                                                   return true;
+                                               buffer = candidate;
+                                               return false;
+                                           });
                 }
                 else
                 {
                     int matches = 0;
-                    for (Buffer *candidate : Buffer::GetHandles())
-                    {
-                        if (candidate && candidate->GetName() == key)
-                        {
-                            buffer = candidate;
-                            ++matches;
-                        }
-                    }
+                    PeTracker::ForEach<Buffer>([&](Buffer *candidate)
+                                           {
+                                               if (candidate->GetName() == key)
+                                               {
+                                                   buffer = candidate;
+                                                   ++matches;
+                                               }
+                                           });
                     if (matches > 1)
                         state->result = R"({"error":"buffer name is ambiguous; use buffer:0x... id from list_buffer_resources"})";
                 }
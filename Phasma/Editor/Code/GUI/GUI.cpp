@@ -3400,6 +3400,9 @@ namespace pe
         // Drain the MCP/tool action queue before the render-state guard so that
         // queued tool calls (screenshot, Lua exec, mouse input) are never starved
         // when the editor window is minimised or rendering is paused.
+        // Log lines first, so console queries among them see everything logged so far.
+        if (auto *console = GetWidget<Console>())
+            console->DrainPending();
         PumpMainThreadActions();
 
         if (!m_initialized)
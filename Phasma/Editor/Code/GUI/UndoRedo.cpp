@@ -219,6 +219,24 @@ namespace pe
         return instance;
     }
 
+    UndoRedo::UndoRedo()
+    {
+        m_memoryReporter = MemoryTracker::AddReporter(MemoryTag::Undo, [this]()
+                                                      {
+            uint64_t bytes = m_idleSnapshot.capacity();
+            for (const auto *stack : {&m_undoStack, &m_redoStack})
+            {
+                for (const HistoryEntry &entry : *stack)
+                    bytes += sizeof(HistoryEntry) + entry.snapshot.capacity() + entry.label.capacity();
+            }
+            return bytes; });
+    }
+
+    UndoRedo::~UndoRedo()
+    {
+        MemoryTracker::RemoveReporter(m_memoryReporter);
+    }
+
     void UndoRedo::CaptureIdleState(Scene &scene)
     {
         if (m_restoring)
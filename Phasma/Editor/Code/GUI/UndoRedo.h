@@ -35,7 +35,8 @@ namespace pe
         void Clear();
 
     private:
-        UndoRedo() = default;
+        UndoRedo();
+        ~UndoRedo();
 
         void PushUndo(HistoryEntry entry);
         void PushRedo(HistoryEntry entry);
@@ -47,6 +48,7 @@ namespace pe
         bool m_hasIdleSnapshot = false;
         bool m_restoring = false;
         int m_settleFrames = 0;
+        MemoryTracker::ReporterId m_memoryReporter = 0;
 
         static constexpr size_t MAX_HISTORY = 100;
         static constexpr int SETTLE_FRAMES = 3;
@@ -22,12 +22,28 @@ namespace pe
         buf[IM_ARRAYSIZE(buf) - 1] = 0;
         va_end(args);
 
-        m_logs.push_back({std::string(buf), type});
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_pending.push_back({std::string(buf), type});
+    }
 
-        if (type == LogType::Warn)
-            ++m_warnCount;
-        else if (type == LogType::Error)
-            ++m_errorCount;
+    void Console::DrainPending()
+    {
+        std::vector<LogEntry> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            if (m_pending.empty())
+                return;
+            pending.swap(m_pending);
+        }
+
+        for (LogEntry &entry : pending)
+        {
+            if (entry.type == LogType::Warn)
+                ++m_warnCount;
+            else if (entry.type == LogType::Error)
+                ++m_errorCount;
+            m_logs.push_back(std::move(entry));
+        }
 
         if (m_autoScroll)
             m_scrollToBottom = true;
@@ -22,7 +22,10 @@ namespace pe
 
         void Update() override;
         void Clear();
+        // Safe from any thread (log callbacks run on the log thread): the entry is queued and shows up
+        // once the main thread calls DrainPending
         void AddLog(LogType type, const char *fmt, ...) IM_FMTARGS(3);
+        void DrainPending();
         const LogEntry *GetLatestLog() const { return m_logs.empty() ? nullptr : &m_logs.back(); }
         const std::vector<LogEntry> &GetLogs() const { return m_logs; }
         int GetWarnCount() const { return m_warnCount; }
@@ -38,6 +41,8 @@ namespace pe
 
     private:
         std::vector<LogEntry> m_logs;
+        std::vector<LogEntry> m_pending; // m_pendingMutex
+        std::mutex m_pendingMutex;
         ImGuiTextFilter m_filter;
         bool m_autoScroll;
         bool m_scrollToBottom;
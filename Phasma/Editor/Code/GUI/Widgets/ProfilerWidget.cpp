@@ -453,9 +453,10 @@ namespace pe
         d.gpu = RHII.GetGpuMemorySnapshot();
 
         d.cpuEntries = Profiler::GetEntries();
+        d.cpuThreads = Profiler::GetThreads();
         for (const auto &e : d.cpuEntries)
         {
-            if (e.depth == 0)
+            if (e.depth == 0 && e.thread == 0)
                 d.cpuScopeTotal += e.timeMs;
             m_cpuStats[e.name].Push(e.timeMs);
         }
@@ -690,15 +691,15 @@ namespace pe
             if (it != m_cpuStats.end() && !it->second.samples.empty())
             {
                 const auto &st = it->second;
-                fprintf(f, "      {\"name\": \"%s\", \"depth\": %u, \"min_ms\": %.3f, \"cur_ms\": %.3f, \"max_ms\": %.3f, \"avg_ms\": %.3f}%s\n",
-                        e.name, e.depth,
+                fprintf(f, "      {\"name\": \"%s\", \"depth\": %u, \"thread\": %u, \"min_ms\": %.3f, \"cur_ms\": %.3f, \"max_ms\": %.3f, \"avg_ms\": %.3f}%s\n",
+                        e.name, e.depth, e.thread,
                         st.minMs, e.timeMs, st.maxMs, st.avgMs,
                         (i + 1 < m_data.cpuEntries.size()) ? "," : "");
             }
             else
             {
-                fprintf(f, "      {\"name\": \"%s\", \"depth\": %u, \"cur_ms\": %.3f}%s\n",
-                        e.name, e.depth, e.timeMs,
+                fprintf(f, "      {\"name\": \"%s\", \"depth\": %u, \"thread\": %u, \"cur_ms\": %.3f}%s\n",
+                        e.name, e.depth, e.thread, e.timeMs,
                         (i + 1 < m_data.cpuEntries.size()) ? "," : "");
             }
         }
@@ -1176,33 +1177,39 @@ namespace pe
             return;
         }
 
-        // Compute start offsets from DFS order (Profiler::Entry has no startOffsetMs)
+        // One lane per profiled thread, one row per nesting depth inside a lane
         struct CpuPassEntry
         {
             const Profiler::Entry *entry;
             int idx;
             float startMs;
         };
+        struct CpuLane
+        {
+            const char *name;
+            int firstRow;
+            int rows;
+        };
         std::vector<CpuPassEntry> passes;
+        std::vector<CpuLane> lanes(m_data.cpuThreads.size());
         passes.reserve(m_data.cpuEntries.size());
+        float endMs = 0.f;
+        for (size_t i = 0; i < lanes.size(); ++i)
+            lanes[i] = {m_data.cpuThreads[i].name, 0, 1};
+        for (int i = 0; i < (int)m_data.cpuEntries.size(); ++i)
         {
-            constexpr int kMaxDepth = 32;
-            float cursor[kMaxDepth] = {};
-            float parentStart[kMaxDepth] = {};
-            int prevDepth = 0;
-            for (int i = 0; i < (int)m_data.cpuEntries.size(); ++i)
-            {
-                const auto &e = m_data.cpuEntries[i];
-                int d = std::min((int)e.depth, kMaxDepth - 1);
-                if (i > 0 && d > prevDepth)
-                    cursor[d] = parentStart[prevDepth];
-                float start = cursor[d];
-                parentStart[d] = start;
-                cursor[d] += e.timeMs;
-                if (e.timeMs > 0.f)
-                    passes.push_back({&e, i, start});
-                prevDepth = d;
-            }
+            const auto &e = m_data.cpuEntries[i];
+            if (e.timeMs <= 0.f || e.thread >= lanes.size())
+                continue;
+            passes.push_back({&e, i, e.startOffsetMs});
+            lanes[e.thread].rows = std::max(lanes[e.thread].rows, (int)std::min(e.depth, 8u) + 1);
+            endMs = std::max(endMs, e.startOffsetMs + e.timeMs);
+        }
+        int totalRows = 0;
+        for (CpuLane &lane : lanes)
+        {
+            lane.firstRow = totalRows;
+            totalRows += lane.rows;
         }
 
         if (passes.empty())
@@ -1211,7 +1218,7 @@ namespace pe
             return;
         }
 
-        float spanMs = m_data.cpuScopeTotal > 0.f ? m_data.cpuScopeTotal : m_data.frameMs;
+        float spanMs = std::max(endMs, m_data.frameMs);
         if (spanMs <= 0.f)
             spanMs = 16.67f;
         spanMs *= 1.05f;
@@ -1231,9 +1238,9 @@ namespace pe
 
         const float rowH = 22.f * m_cpuTimelineZoomV;
         const float rowGap = 2.f;
-        const float indentW = 14.f;
+        const float laneGap = 18.f;
         const float availW = ImGui::GetContentRegionAvail().x;
-        const float chartH = static_cast<float>(passes.size()) * (rowH + rowGap) + 4.f;
+        const float chartH = static_cast<float>(totalRows) * (rowH + rowGap) + lanes.size() * laneGap + 4.f;
         const float childH = std::min(chartH + 20.f, ImGui::GetContentRegionAvail().y - 60.f);
 
         ImGui::BeginChild("##cpu_timeline_scroll", {-1, std::max(childH, 60.f)}, false,
@@ -1276,16 +1283,24 @@ namespace pe
             dl->AddText({x + 2.f, origin.y + 2.f}, IM_COL32(120, 120, 130, 200), lbl);
         }
 
+        // Lane labels
+        for (size_t i = 0; i < lanes.size(); ++i)
+        {
+            const float y = origin.y + lanes[i].firstRow * (rowH + rowGap) + i * laneGap;
+            dl->AddLine({origin.x, y + laneGap - 2.f}, {origin.x + chartW, y + laneGap - 2.f}, IM_COL32(80, 80, 95, 200), 1.f);
+            dl->AddText({ImGui::GetWindowPos().x + 4.f, y + 1.f}, IM_COL32(170, 190, 230, 255), lanes[i].name);
+        }
+
         // Scope bars
-        for (int row = 0; row < (int)passes.size(); ++row)
+        for (const CpuPassEntry &pe : passes)
         {
-            const CpuPassEntry &pe = passes[row];
+            const CpuLane &lane = lanes[pe.entry->thread];
             int depth = std::min((int)pe.entry->depth, 8);
 
-            float y0 = origin.y + row * (rowH + rowGap);
+            float y0 = origin.y + (lane.firstRow + depth) * (rowH + rowGap) + (pe.entry->thread + 1) * laneGap;
             float y1 = y0 + rowH;
 
-            float xStart = origin.x + (pe.startMs / spanMs) * chartW + depth * indentW;
+            float xStart = origin.x + (pe.startMs / spanMs) * chartW;
             float xEnd = origin.x + ((pe.startMs + pe.entry->timeMs) / spanMs) * chartW;
             if (xEnd < xStart + 2.f)
                 xEnd = xStart + 2.f;
@@ -1316,6 +1331,7 @@ namespace pe
             {
                 ImGui::BeginTooltip();
                 ImGui::Text("%s", pe.entry->name);
+                ImGui::TextDisabled("%s", lane.name);
                 ImGui::Text("Start: %.3f ms  Duration: %.3f ms", pe.startMs, pe.entry->timeMs);
                 ImGui::Text("CPU share: %.1f%%", rel * 100.f);
                 ImGui::EndTooltip();
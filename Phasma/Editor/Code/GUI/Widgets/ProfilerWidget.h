@@ -98,6 +98,7 @@ namespace pe
             std::vector<GpuTimerSample> gpuSamples;
             float gpuTotal = 0.0f;
             std::vector<Profiler::Entry> cpuEntries;
+            std::vector<Profiler::Thread> cpuThreads;
             std::vector<Profiler::Counter> counters;
             float cpuScopeTotal = 0.0f;
             SystemProcMem ram;
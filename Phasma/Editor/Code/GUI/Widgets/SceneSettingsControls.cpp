@@ -173,7 +173,7 @@ namespace pe
         }
         Track(ImGui::Checkbox("Mesh LOD", &gSettings.lod_enabled));
         ui::ItemTooltip("Discrete mesh level-of-detail: the GPU cull pass swaps each mesh to a simpler index "
-                        "set chosen by camera distance. Levels are generated at load via meshopt.");
+                        "set chosen by projected error (or camera distance). Cooked models bake the levels.");
         if (gSettings.lod_enabled)
         {
             ImGui::Indent(16.0f);
@@ -182,6 +182,10 @@ namespace pe
             if (Track(ImGui::SliderInt("Levels (on load)", &lodCount, 1, 4))) // 4 == Mesh::kMaxLods
                 gSettings.lod_count = static_cast<uint32_t>(lodCount);
             ui::ItemTooltip("LODs generated per mesh. Applies to newly loaded meshes — reload the scene to regenerate.");
+            ImGui::SetNextItemWidth(120.0f);
+            Track(ImGui::DragFloat("Max Error (px)", &gSettings.lod_error_pixels, 0.05f, 0.0f, 16.0f));
+            ui::ItemTooltip("Use the coarsest level whose simplification error stays under this many pixels. "
+                            "0 = switch by the distances below instead (live).");
             ImGui::SetNextItemWidth(200.0f);
             Track(ImGui::DragFloat3("Switch Distances", gSettings.lod_distances.data(), 1.0f, 0.0f, 100000.0f));
             ui::ItemTooltip("World-unit camera distances to switch LOD0->1, 1->2, 2->3 (live).");
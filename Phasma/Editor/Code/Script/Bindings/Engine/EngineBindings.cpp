@@ -199,6 +199,9 @@ namespace pe
                     auto *console = r->GetGUI().GetWidget<Console>();
                     if (!console) return result;
 
+                    // Lua runs on the main thread: pull in entries still queued on the log thread
+                    Log::Flush();
+                    console->DrainPending();
                     const auto &logs = console->GetLogs();
                     int n = count.value_or(100);
                     std::string lvl = level.value_or("all");
@@ -227,6 +227,7 @@ namespace pe
                             [this](CommandBuffer *cmd)
                             { m_gui.ExecutePass(cmd); });
         renderGraph.Compile();
+        m_sceneRenderer.ApplyTransientAliasing();
     }
 
     CommandBuffer *RendererSystem::RecordPasses(uint32_t imageIndex)
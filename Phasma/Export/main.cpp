@@ -18,6 +18,7 @@ namespace
         std::filesystem::path project;
         std::filesystem::path output;
         bool force = false;
+        bool clean = false;
     };
 
     std::string ToUtf8(const std::filesystem::path &path)
@@ -56,6 +57,8 @@ namespace
                 options.output = argv[++i];
             else if (arg == "--force")
                 options.force = true;
+            else if (arg == "--clean")
+                options.clean = true;
             else if (arg == "--help" || arg == "-h")
                 return false;
             else
@@ -66,7 +69,9 @@ namespace
 
     void PrintUsage()
     {
-        std::cout << "Usage: PhasmaExport --project <project-dir> --output <export-dir> [--force]\n";
+        std::cout << "Usage: PhasmaExport --project <project-dir> --output <export-dir> [--force] [--clean]\n"
+                     "  --force  replace an existing export; its game pack is reused for unchanged files\n"
+                     "  --clean  rebuild every game pack entry instead of reusing the previous export's\n";
     }
 
     std::vector<uint8_t> ReadFile(const std::filesystem::path &path)
@@ -92,10 +97,14 @@ namespace
         return 0;
     }
 
-    std::vector<uint8_t> CompileLua(lua_State *lua,
-                                    const std::filesystem::path &sourcePath,
-                                    const std::string &packPath)
+    // Runs on pack writer workers, so each compile gets its own state
+    std::vector<uint8_t> CompileLua(const std::filesystem::path &sourcePath, const std::string &packPath)
     {
+        std::unique_ptr<lua_State, decltype(&lua_close)> state(luaL_newstate(), lua_close);
+        if (!state)
+            throw std::runtime_error("Failed to create Lua compiler state");
+        lua_State *lua = state.get();
+
         const std::vector<uint8_t> source = ReadFile(sourcePath);
         const std::string chunkName = "@" + packPath;
         if (luaL_loadbufferx(lua,
@@ -210,10 +219,23 @@ namespace
                "It is otherwise empty; this file is here so the folder survives being zipped.\n";
     }
 
+    // Only queued here; GamePackWriter::Write reads (or compiles) it when its window comes up
+    void AddToPack(pe::GamePackWriter &pack, const std::string &packPath, const std::filesystem::directory_entry &entry)
+    {
+        if (entry.path().extension() != ".lua")
+        {
+            pack.AddFile(packPath, entry.path());
+            return;
+        }
+        std::error_code ec;
+        const uint64_t size = entry.file_size(ec);
+        pack.Add(packPath, ec ? 0 : size, [source = entry.path(), packPath]()
+                 { return CompileLua(source, packPath); });
+    }
+
     void CopyRuntime(const std::filesystem::path &runtimeDir,
                      const std::filesystem::path &output,
-                     lua_State *lua,
-                     std::vector<pe::GamePackBuildEntry> &packEntries)
+                     pe::GamePackWriter &pack)
     {
         bool copiedPlayer = false;
         bool copiedCore = false;
@@ -246,20 +268,14 @@ namespace
             {
                 continue;
             }
-            pe::GamePackBuildEntry packedEntry;
-            packedEntry.path = "RuntimeAssets/" + relativePath;
-            packedEntry.data = entry.path().extension() == ".lua"
-                                   ? CompileLua(lua, entry.path(), packedEntry.path)
-                                   : ReadFile(entry.path());
-            packEntries.push_back(std::move(packedEntry));
+            AddToPack(pack, "RuntimeAssets/" + relativePath, entry);
         }
         WriteAnchor(output / "RuntimeAssets");
     }
 
     void ExportAssets(const pe::ProjectConfig &project,
                       const std::filesystem::path &output,
-                      lua_State *lua,
-                      std::vector<pe::GamePackBuildEntry> &packEntries)
+                      pe::GamePackWriter &pack)
     {
         const std::filesystem::path assetsRoot = project.AssetsRoot();
         const std::vector<std::string> ignoreRules = ReadIgnoreRules(project.root);
@@ -278,13 +294,7 @@ namespace
             if (entry.path().extension() == ".lua" && HasEditorOnlyMarker(entry.path()))
                 continue;
 
-            const std::string packPath = relative.generic_string();
-            pe::GamePackBuildEntry packedEntry;
-            packedEntry.path = packPath;
-            packedEntry.data = entry.path().extension() == ".lua"
-                                   ? CompileLua(lua, entry.path(), packPath)
-                                   : ReadFile(entry.path());
-            packEntries.push_back(std::move(packedEntry));
+            AddToPack(pack, relative.generic_string(), entry);
         }
     }
 
@@ -337,36 +347,27 @@ int main(int argc, char **argv)
         std::filesystem::remove_all(temporary, ec);
         std::filesystem::create_directories(temporary);
 
+        // The export being replaced holds the last build of every entry; unchanged ones are copied
+        // from it instead of being compressed again
+        std::filesystem::path previousPack;
+        if (!options.clean && std::filesystem::is_regular_file(options.output / pe::kGamePackFileName, ec))
+            previousPack = options.output / pe::kGamePackFileName;
+
         try
         {
-            std::unique_ptr<lua_State, decltype(&lua_close)> lua(luaL_newstate(), lua_close);
-            if (!lua)
-                throw std::runtime_error("Failed to create Lua compiler state");
-
-            std::vector<pe::GamePackBuildEntry> packEntries;
-            CopyRuntime(runtimeDir, temporary, lua.get(), packEntries);
-            ExportAssets(*project, temporary, lua.get(), packEntries);
-            std::sort(packEntries.begin(), packEntries.end(),
-                      [](const auto &a, const auto &b)
-                      { return a.path < b.path; });
+            pe::GamePackWriter pack(previousPack);
+            CopyRuntime(runtimeDir, temporary, pack);
+            ExportAssets(*project, temporary, pack);
 
+            // Reading the pack back checks what landed on disk, and decoding every entry against the
+            // content hash the writer took from the source checks the compressor
             const std::filesystem::path packPath = temporary / pe::kGamePackFileName;
-            if (!pe::WriteGamePack(packPath, packEntries, &error) || !pe::OpenGamePack(packPath, &error) ||
-                pe::ListGamePackAssets().size() != packEntries.size())
+            const pe::GamePackWriter::Stats &stats = pack.GetStats();
+            if (!pack.Write(packPath, &error) || !pe::OpenGamePack(packPath, &error) ||
+                pe::ListGamePackAssets().size() != stats.entries || !pe::VerifyGamePackContent(&error))
             {
                 throw std::runtime_error(error.empty() ? "Game pack verification failed" : error);
             }
-            for (const auto &entry : packEntries)
-            {
-                const std::optional<std::string> data = pe::ReadGamePackAsset(entry.path);
-                if (!data || data->size() != entry.data.size() ||
-                    !std::equal(data->begin(), data->end(), entry.data.begin(),
-                                [](char packed, uint8_t source)
-                                { return static_cast<uint8_t>(packed) == source; }))
-                {
-                    throw std::runtime_error("Game pack verification failed for " + entry.path);
-                }
-            }
             pe::CloseGamePack();
 
             std::filesystem::copy_file(manifest, temporary / pe::kProjectManifestFileName,
@@ -378,7 +379,8 @@ int main(int argc, char **argv)
             std::filesystem::rename(temporary, options.output);
 
             std::cout << "Exported " << project->name << " to " << ToUtf8(options.output) << "\n"
-                      << "  packed: " << packEntries.size() << " files\n";
+                      << "  packed: " << stats.entries << " files, " << stats.reused << " unchanged from the previous export\n"
+                      << "  pack: " << (stats.rawBytes >> 10) << " KB of assets stored in " << (stats.storedBytes >> 10) << " KB\n";
         }
         catch (...)
         {
@@ -115,6 +115,8 @@ val stagePhasmaAssets by tasks.registering(Sync::class) {
     }
     from(prebakedModelsDir) {
         into("Assets/Models")
+        // Cooked textures come in BC (.petex) and ASTC (.astc.petex) variants; the player loads ASTC
+        exclude { it.name.endsWith(".petex") && !it.name.endsWith(".astc.petex") }
     }
     // AgainstTheHero game project (sibling repo): stage the complete runtime asset tree.
     // Old archived modes and the desktop-only entry script stay excluded.
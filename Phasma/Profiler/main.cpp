@@ -1,5 +1,7 @@
-// PhasmaProfiler — live viewer for ProfilerStreamServer (Player --profiler).
+// PhasmaProfiler — live viewer for ProfilerStreamServer (Player --profiler) and offline
+// viewer for ProfilerFlightRecorder dumps (--open <file.pefr> or drag and drop).
 #include "Base/Path.h"
+#include "Base/ProfilerFlightRecorder.h"
 #include "Base/ProfilerStream.h"
 
 #include "imgui.h"
@@ -35,6 +37,7 @@ namespace
 {
     constexpr size_t kMaxFrameHistory = 1800;
     constexpr size_t kMaxScopeRows = 65536;
+    constexpr unsigned kMaxThreadLanes = 256;
     constexpr size_t kMaxCounterRows = 4096;
     constexpr size_t kStatWindow = 40;
     constexpr size_t kMaxTraceEvents = 250000;
@@ -228,6 +231,7 @@ namespace
     {
         std::string name;
         unsigned depth = 0;
+        unsigned thread = 0; // CPU lane, index into LiveFrame::cpuThreads
         float curMs = 0.f;
         float startOffsetMs = 0.f;
     };
@@ -238,6 +242,16 @@ namespace
         uint64_t value = 0;
     };
 
+    struct MemoryTagRow
+    {
+        std::string name;
+        uint64_t cpuBytes = 0;
+        uint64_t cpuPeakBytes = 0;
+        uint64_t gpuBytes = 0;
+        uint64_t gpuPeakBytes = 0;
+        uint32_t allocsPerFrame = 0;
+    };
+
     struct FrameSample
     {
         uint64_t id = 0;
@@ -255,6 +269,7 @@ namespace
         double durationUs = 0.0;
         unsigned depth = 0;
         unsigned track = 0; // 0 frame, 1 CPU, 2 GPU
+        unsigned thread = 0;
     };
 
     struct LiveFrame
@@ -278,8 +293,10 @@ namespace
         uint64_t gpuHostOtherMb = 0;
         uint64_t gpuHostBudgetMb = 0;
         std::vector<ScopeRow> cpu;
+        std::vector<std::string> cpuThreads;
         std::vector<ScopeRow> gpu;
         std::vector<CounterRow> counters;
+        std::vector<MemoryTagRow> memoryTags;
         std::vector<FrameSample> frameBatch;
     };
 
@@ -317,9 +334,12 @@ namespace
         std::unordered_map<std::string, std::deque<float>> counterHistory;
         std::string latestJson;
         uint64_t packets = 0;
+        uint64_t wireBytes = 0;
+        bool binaryWire = false;
         uint64_t nextFrameId = 1;
         uint64_t pinnedFrameId = 0;
         std::vector<TraceEvent> traceEvents;
+        std::vector<std::string> traceThreads;
         uint64_t traceStartUs = 0;
         uint64_t tracePackets = 0;
         bool hasData = false;
@@ -329,6 +349,7 @@ namespace
         void StartTrace()
         {
             traceEvents.clear();
+            traceThreads.clear();
             traceStartUs = SDL_GetTicks64() * 1000;
             tracePackets = 0;
             traceRecording = true;
@@ -354,7 +375,9 @@ namespace
             traceEvents.push_back({"Frame", frameStartUs, frame.frameMs * 1000.0, 0, 0});
             for (const ScopeRow &scope : frame.cpu)
                 traceEvents.push_back({scope.name, frameStartUs + scope.startOffsetMs * 1000.0,
-                                       scope.curMs * 1000.0, scope.depth, 1});
+                                       scope.curMs * 1000.0, scope.depth, 1, scope.thread});
+            if (frame.cpuThreads.size() > traceThreads.size())
+                traceThreads = frame.cpuThreads;
             for (const ScopeRow &scope : frame.gpu)
                 traceEvents.push_back({scope.name, frameStartUs + scope.startOffsetMs * 1000.0,
                                        scope.curMs * 1000.0, scope.depth, 2});
@@ -439,6 +462,8 @@ namespace
             row.name = ReadName(scope);
             if (scope.HasMember("depth") && scope["depth"].IsUint())
                 row.depth = std::min(scope["depth"].GetUint(), 64u);
+            if (scope.HasMember("thread") && scope["thread"].IsUint())
+                row.thread = std::min(scope["thread"].GetUint(), kMaxThreadLanes - 1);
             ReadFloat(scope, "cur_ms", row.curMs);
             ReadFloat(scope, "start_offset_ms", row.startOffsetMs);
             row.curMs = std::max(0.f, row.curMs);
@@ -478,6 +503,23 @@ namespace
                 ReadUint64(memory, "gpu_host_app_mb", frame.gpuHostAppMb);
                 ReadUint64(memory, "gpu_host_other_mb", frame.gpuHostOtherMb);
                 ReadUint64(memory, "gpu_host_budget_mb", frame.gpuHostBudgetMb);
+                if (memory.HasMember("tags") && memory["tags"].IsArray())
+                {
+                    for (const auto &tag : memory["tags"].GetArray())
+                    {
+                        if (!tag.IsObject() || frame.memoryTags.size() >= kMaxCounterRows)
+                            break;
+                        MemoryTagRow row;
+                        row.name = ReadName(tag);
+                        ReadUint64(tag, "cpu_bytes", row.cpuBytes);
+                        ReadUint64(tag, "cpu_peak_bytes", row.cpuPeakBytes);
+                        ReadUint64(tag, "gpu_bytes", row.gpuBytes);
+                        ReadUint64(tag, "gpu_peak_bytes", row.gpuPeakBytes);
+                        if (tag.HasMember("allocs_per_frame") && tag["allocs_per_frame"].IsUint())
+                            row.allocsPerFrame = tag["allocs_per_frame"].GetUint();
+                        frame.memoryTags.push_back(std::move(row));
+                    }
+                }
             }
         }
 
@@ -506,6 +548,15 @@ namespace
         {
             const auto &cpu = doc["cpu"];
             ReadFloat(cpu, "total_ms", frame.cpuScopeTotalMs);
+            if (cpu.HasMember("threads") && cpu["threads"].IsArray())
+            {
+                for (const auto &thread : cpu["threads"].GetArray())
+                {
+                    if (!thread.IsObject() || frame.cpuThreads.size() >= kMaxThreadLanes)
+                        break;
+                    frame.cpuThreads.push_back(ReadName(thread));
+                }
+            }
             if (cpu.HasMember("scopes"))
                 ParseScopes(cpu["scopes"], frame.cpu);
         }
@@ -535,6 +586,81 @@ namespace
         return true;
     }
 
+    // Binary frames arrive already decoded; apply the same bounds ParseFrame does
+    LiveFrame FrameFromSnapshot(const pe::ProfilerSnapshot &snapshot)
+    {
+        LiveFrame frame;
+        frame.fps = snapshot.fps;
+        frame.frameMs = snapshot.frameMs;
+        frame.cpuTotalMs = snapshot.cpuTotalMs;
+        frame.cpuUpdateMs = snapshot.cpuUpdateMs;
+        frame.cpuDrawMs = snapshot.cpuDrawMs;
+        frame.cpuScopeTotalMs = snapshot.cpuScopeTotalMs;
+        frame.gpuTotalMs = snapshot.gpuTotalMs;
+        frame.renderDocCaptureCount = snapshot.renderDocCaptureCount;
+        frame.renderDocAvailable = snapshot.renderDocAvailable;
+        frame.ramTotalMb = snapshot.ramTotalMb;
+        frame.ramUsedMb = snapshot.ramUsedMb;
+        frame.ramProcessMb = snapshot.ramProcessMb;
+        frame.gpuVramAppMb = snapshot.gpuVramAppMb;
+        frame.gpuVramOtherMb = snapshot.gpuVramOtherMb;
+        frame.gpuVramBudgetMb = snapshot.gpuVramBudgetMb;
+        frame.gpuHostAppMb = snapshot.gpuHostAppMb;
+        frame.gpuHostOtherMb = snapshot.gpuHostOtherMb;
+        frame.gpuHostBudgetMb = snapshot.gpuHostBudgetMb;
+        for (const pe::ProfilerMemoryTag &tag : snapshot.memoryTags)
+        {
+            if (frame.memoryTags.size() >= kMaxCounterRows)
+                break;
+            frame.memoryTags.push_back({tag.name ? tag.name : "", tag.cpuBytes, tag.cpuPeakBytes, tag.gpuBytes,
+                                        tag.gpuPeakBytes, tag.allocsPerFrame});
+        }
+
+        for (const pe::ProfilerFrameSample &sample : snapshot.frameHistory)
+        {
+            if (frame.frameBatch.size() >= 512)
+                break;
+            frame.frameBatch.push_back({0, sample.frameMs, sample.cpuTotalMs, sample.cpuUpdateMs,
+                                        sample.cpuDrawMs, sample.gpuTotalMs});
+        }
+        if (frame.frameBatch.empty())
+            frame.frameBatch.push_back({0, frame.frameMs, frame.cpuTotalMs, frame.cpuUpdateMs,
+                                        frame.cpuDrawMs, frame.gpuTotalMs});
+
+        for (const pe::Profiler::Thread &thread : snapshot.cpuThreads)
+        {
+            if (frame.cpuThreads.size() >= kMaxThreadLanes)
+                break;
+            frame.cpuThreads.emplace_back(thread.name);
+        }
+
+        frame.cpu.reserve(std::min(snapshot.cpuEntries.size(), kMaxScopeRows));
+        for (const pe::Profiler::Entry &entry : snapshot.cpuEntries)
+        {
+            if (frame.cpu.size() >= kMaxScopeRows)
+                break;
+            frame.cpu.push_back({entry.name, std::min(entry.depth, 64u), std::min(entry.thread, kMaxThreadLanes - 1),
+                                 std::max(0.f, entry.timeMs), std::max(0.f, entry.startOffsetMs)});
+        }
+
+        frame.gpu.reserve(std::min(snapshot.gpuSamples.size(), kMaxScopeRows));
+        for (const pe::GpuTimerSample &sample : snapshot.gpuSamples)
+        {
+            if (frame.gpu.size() >= kMaxScopeRows)
+                break;
+            frame.gpu.push_back({sample.name, static_cast<unsigned>(std::min<size_t>(sample.depth, 64)), 0,
+                                 std::max(0.f, sample.timeMs), std::max(0.f, sample.startOffsetMs)});
+        }
+
+        for (const pe::Profiler::Counter &counter : snapshot.counters)
+        {
+            if (frame.counters.size() >= kMaxCounterRows)
+                break;
+            frame.counters.push_back({counter.name, counter.value});
+        }
+        return frame;
+    }
+
     float FrameBudgetMs(int targetFps)
     {
         return targetFps > 0 ? 1000.f / static_cast<float>(targetFps) : 16.667f;
@@ -912,6 +1038,57 @@ namespace
         }
     }
 
+    std::string FormatBytes(uint64_t bytes)
+    {
+        char text[32];
+        if (bytes >= (1ull << 30))
+            std::snprintf(text, sizeof(text), "%.2f GB", static_cast<double>(bytes) / static_cast<double>(1ull << 30));
+        else if (bytes >= (1ull << 20))
+            std::snprintf(text, sizeof(text), "%.1f MB", static_cast<double>(bytes) / static_cast<double>(1ull << 20));
+        else if (bytes >= (1ull << 10))
+            std::snprintf(text, sizeof(text), "%.1f KB", static_cast<double>(bytes) / static_cast<double>(1ull << 10));
+        else
+            std::snprintf(text, sizeof(text), "%llu B", static_cast<unsigned long long>(bytes));
+        return text;
+    }
+
+    void DrawMemoryTags(const std::vector<MemoryTagRow> &tags)
+    {
+        if (tags.empty())
+        {
+            ImGui::TextDisabled("No tagged allocations received.");
+            return;
+        }
+
+        if (ImGui::BeginTable("##memory_tags", 6, ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Tag", ImGuiTableColumnFlags_WidthStretch, 0.3f);
+            ImGui::TableSetupColumn("CPU", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("CPU peak", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("GPU", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("GPU peak", ImGuiTableColumnFlags_WidthStretch, 0.15f);
+            ImGui::TableSetupColumn("Allocs", ImGuiTableColumnFlags_WidthFixed, 56.f);
+            ImGui::TableHeadersRow();
+            for (const MemoryTagRow &tag : tags)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(tag.name.c_str());
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(FormatBytes(tag.cpuBytes).c_str());
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextDisabled("%s", FormatBytes(tag.cpuPeakBytes).c_str());
+                ImGui::TableSetColumnIndex(3);
+                ImGui::TextUnformatted(FormatBytes(tag.gpuBytes).c_str());
+                ImGui::TableSetColumnIndex(4);
+                ImGui::TextDisabled("%s", FormatBytes(tag.gpuPeakBytes).c_str());
+                ImGui::TableSetColumnIndex(5);
+                ImGui::Text("%u", tag.allocsPerFrame);
+            }
+            ImGui::EndTable();
+        }
+    }
+
     void DrawMemoryBar(const char *label, uint64_t appMb, uint64_t otherMb, uint64_t budgetMb, ImVec4 color)
     {
         budgetMb = std::max<uint64_t>(budgetMb, 1);
@@ -1090,6 +1267,11 @@ namespace
             DrawMemoryBar("GPU local", frame.gpuVramAppMb, frame.gpuVramOtherMb, frame.gpuVramBudgetMb, kGpuColor);
             DrawMemoryBar("GPU host", frame.gpuHostAppMb, frame.gpuHostOtherMb, frame.gpuHostBudgetMb, kFrameColor);
 
+            ImGui::Spacing();
+            ImGui::SeparatorText("Memory by subsystem");
+            ItemTooltip("MemoryTracker tags: live and peak bytes charged to each subsystem, and allocations in the last frame.");
+            DrawMemoryTags(frame.memoryTags);
+
             ImGui::Spacing();
             ImGui::SeparatorText("GPU hotspots");
             ItemTooltip("The most expensive nested GPU passes in the latest completed GPU frame. Click one for details.");
@@ -1356,15 +1538,19 @@ namespace
         return nice * magnitude;
     }
 
-    void DrawTimeline(const char *id, const std::vector<ScopeRow> &rows, float totalMs,
-                      float &horizontalZoom, float &verticalZoom, int &selected)
+    // With thread lanes (CPU) every lane gets one row per nesting depth so concurrent workers line up under
+    // each other; without them (GPU) every scope keeps its own row.
+    void DrawTimeline(const char *id, const std::vector<ScopeRow> &rows, const std::vector<std::string> &lanes,
+                      float totalMs, float &horizontalZoom, float &verticalZoom, int &selected)
     {
+        const bool laneLayout = !lanes.empty();
+        const size_t maxVisible = laneLayout ? 4096 : 512;
         std::vector<int> visible;
-        visible.reserve(std::min<size_t>(rows.size(), 512));
+        visible.reserve(std::min(rows.size(), maxVisible));
         float spanMs = 0.f;
-        for (int i = 0; i < static_cast<int>(rows.size()) && visible.size() < 512; ++i)
+        for (int i = 0; i < static_cast<int>(rows.size()) && visible.size() < maxVisible; ++i)
         {
-            if (rows[i].curMs <= 0.002f)
+            if (rows[i].curMs <= 0.002f || (laneLayout && rows[i].thread >= lanes.size()))
                 continue;
             visible.push_back(i);
             spanMs = std::max(spanMs, rows[i].startOffsetMs + rows[i].curMs);
@@ -1376,6 +1562,23 @@ namespace
         }
         spanMs = std::max({spanMs * 1.03f, totalMs, 0.1f});
 
+        constexpr unsigned kMaxLaneDepth = 15;
+        std::vector<int> laneFirstRow(lanes.size(), 0);
+        int rowCount = static_cast<int>(visible.size());
+        if (laneLayout)
+        {
+            std::vector<int> laneRows(lanes.size(), 1);
+            for (const int index : visible)
+                laneRows[rows[index].thread] = std::max(laneRows[rows[index].thread],
+                                                        static_cast<int>(std::min(rows[index].depth, kMaxLaneDepth)) + 1);
+            rowCount = 0;
+            for (size_t lane = 0; lane < lanes.size(); ++lane)
+            {
+                laneFirstRow[lane] = rowCount;
+                rowCount += laneRows[lane];
+            }
+        }
+
         ImGui::TextDisabled("H");
         ImGui::SameLine();
         ImGui::SetNextItemWidth(100.f);
@@ -1397,7 +1600,8 @@ namespace
 
         const float rowHeight = 23.f * verticalZoom;
         const float gap = 2.f;
-        const float chartHeight = static_cast<float>(visible.size()) * (rowHeight + gap) + 23.f;
+        const float laneHeader = laneLayout ? 18.f : 0.f;
+        const float chartHeight = static_cast<float>(rowCount) * (rowHeight + gap) + lanes.size() * laneHeader + 23.f;
         const float childHeight = std::max(100.f, ImGui::GetContentRegionAvail().y - 52.f);
         ImGui::PushID(id);
         ImGui::BeginChild("##timeline_scroll", {-1.f, childHeight}, false,
@@ -1432,11 +1636,22 @@ namespace
             draw->AddText({x + 3.f, origin.y + 3.f}, U32(ImVec4(0.40f, 0.46f, 0.55f, 1.f)), label);
         }
 
+        for (size_t lane = 0; lane < lanes.size(); ++lane)
+        {
+            const float y = origin.y + 22.f + laneFirstRow[lane] * (rowHeight + gap) + lane * laneHeader;
+            draw->AddLine({origin.x, y + laneHeader - 2.f}, {origin.x + chartWidth, y + laneHeader - 2.f},
+                          U32(ImVec4(1.f, 1.f, 1.f, 0.12f)));
+            draw->AddText({ImGui::GetWindowPos().x + 4.f, y + 1.f}, U32(kCpuColor), lanes[lane].c_str());
+        }
+
         for (int rowIndex = 0; rowIndex < static_cast<int>(visible.size()); ++rowIndex)
         {
             const int index = visible[rowIndex];
             const ScopeRow &scope = rows[index];
-            const float y0 = origin.y + 22.f + rowIndex * (rowHeight + gap);
+            const float y0 = laneLayout
+                                 ? origin.y + 22.f + (scope.thread + 1) * laneHeader +
+                                       (laneFirstRow[scope.thread] + std::min(scope.depth, kMaxLaneDepth)) * (rowHeight + gap)
+                                 : origin.y + 22.f + rowIndex * (rowHeight + gap);
             const float y1 = y0 + rowHeight;
             const float x0 = origin.x + scope.startOffsetMs / spanMs * chartWidth;
             const float x1 = std::max(x0 + 3.f, origin.x + (scope.startOffsetMs + scope.curMs) / spanMs * chartWidth);
@@ -1458,6 +1673,8 @@ namespace
             {
                 ImGui::BeginTooltip();
                 ImGui::TextUnformatted(scope.name.c_str());
+                if (laneLayout)
+                    ImGui::TextDisabled("%s", lanes[scope.thread].c_str());
                 ImGui::Separator();
                 ImGui::Text("Start %.3f ms", scope.startOffsetMs);
                 ImGui::Text("Duration %.3f ms", scope.curMs);
@@ -1483,7 +1700,7 @@ namespace
         }
     }
 
-    void DrawTimingTab(const char *kind, const std::vector<ScopeRow> &rows,
+    void DrawTimingTab(const char *kind, const std::vector<ScopeRow> &rows, const std::vector<std::string> &lanes,
                        const std::unordered_map<std::string, ScopeStats> &stats, float totalMs,
                        char *filter, size_t filterSize, int &viewMode, float &zoomH, float &zoomV, int &selected)
     {
@@ -1506,7 +1723,7 @@ namespace
         if (viewMode == 0)
             DrawTimingTable("##timings", rows, stats, totalMs, filter, selected);
         else if (viewMode == 1)
-            DrawTimeline("##timeline", rows, totalMs, zoomH, zoomV, selected);
+            DrawTimeline("##timeline", rows, lanes, totalMs, zoomH, zoomV, selected);
         else
             DrawAggregatedTimingTable("##aggregated", rows, totalMs, filter, selected);
     }
@@ -1619,8 +1836,9 @@ namespace
         writer.Key("traceEvents");
         writer.StartArray();
 
-        constexpr std::array<const char *, 3> trackNames = {"Frame", "CPU main thread", "GPU"};
-        for (unsigned track = 0; track < trackNames.size(); ++track)
+        // CPU lanes get their own tids after the fixed frame/GPU tracks
+        constexpr unsigned kCpuLaneTid = 16;
+        const auto threadName = [&](unsigned tid, const char *name)
         {
             writer.StartObject();
             writer.Key("name");
@@ -1630,14 +1848,20 @@ namespace
             writer.Key("pid");
             writer.Uint(1);
             writer.Key("tid");
-            writer.Uint(track);
+            writer.Uint(tid);
             writer.Key("args");
             writer.StartObject();
             writer.Key("name");
-            writer.String(trackNames[track]);
+            writer.String(name);
             writer.EndObject();
             writer.EndObject();
-        }
+        };
+        threadName(0, "Frame");
+        threadName(2, "GPU");
+        for (size_t i = 0; i < session.traceThreads.size(); ++i)
+            threadName(kCpuLaneTid + static_cast<unsigned>(i), session.traceThreads[i].c_str());
+        if (session.traceThreads.empty())
+            threadName(kCpuLaneTid, "CPU main thread");
 
         constexpr std::array<const char *, 3> categories = {"frame", "cpu", "gpu"};
         for (const TraceEvent &event : session.traceEvents)
@@ -1656,7 +1880,7 @@ namespace
             writer.Key("pid");
             writer.Uint(1);
             writer.Key("tid");
-            writer.Uint(event.track);
+            writer.Uint(event.track == 1 ? kCpuLaneTid + event.thread : event.track);
             writer.Key("args");
             writer.StartObject();
             writer.Key("depth");
@@ -1735,8 +1959,10 @@ namespace
         ImGui::TextColored(connected ? kGoodColor : kWarnColor, connected ? "CONNECTED" : "DISCONNECTED");
         ItemTooltip("Whether this viewer currently has a live TCP connection to the Player profiler stream.");
         ImGui::SameLine();
-        ImGui::TextDisabled("%s:%d   |   %llu packets", host, port, static_cast<unsigned long long>(session.packets));
-        ItemTooltip("Loopback stream endpoint and detailed snapshot packets received this session.");
+        ImGui::TextDisabled("%s:%d   |   %llu packets   |   %s %.1f KB/packet", host, port,
+                            static_cast<unsigned long long>(session.packets), session.binaryWire ? "binary" : "JSON",
+                            session.packets ? session.wireBytes / 1024.0 / static_cast<double>(session.packets) : 0.0);
+        ItemTooltip("Loopback stream endpoint, detailed snapshot packets received this session, and the wire format with its average packet size.");
         ImGui::SameLine();
         if (ImGui::Button(connected || autoConnect ? "Disconnect" : "Connect"))
         {
@@ -1956,12 +2182,41 @@ namespace
                     : connected ? "Live profiler data is arriving from the Player."
                                 : "The viewer is waiting for or reconnecting to the Player profiler stream.");
     }
+
+    // Replays a flight recorder dump (.pefr) into a fresh session, oldest frame first
+    bool LoadFlightRecorderDump(const std::string &path, SessionData &session, std::string &notice)
+    {
+        std::vector<std::string> payloads;
+        if (!pe::ProfilerFlightRecorder::ReadDump(path, payloads) || payloads.empty())
+        {
+            notice = "Not a flight recorder dump: " + path;
+            return false;
+        }
+
+        session.Reset();
+        pe::ProfilerWireDecoder decoder;
+        pe::ProfilerSnapshot snapshot;
+        for (size_t i = 0; i < payloads.size(); ++i)
+        {
+            if (!decoder.Decode(payloads[i], snapshot))
+            {
+                notice = "Dump is corrupt after " + std::to_string(i) + " frames: " + path;
+                return session.hasData;
+            }
+            session.wireBytes += payloads[i].size() + 4;
+            session.binaryWire = true;
+            session.Accept(FrameFromSnapshot(snapshot), i + 1 == payloads.size() ? snapshot.ToJson() : std::string());
+        }
+        notice = "Opened " + std::to_string(payloads.size()) + " frames from " + path;
+        return true;
+    }
 } // namespace
 
 int main(int argc, char *argv[])
 {
     char host[64] = "127.0.0.1";
     int port = pe::ProfilerStreamServer::kDefaultPort;
+    std::string openPath;
     if (argc >= 2 && argv[1][0] != '-')
         std::snprintf(host, sizeof(host), "%s", argv[1]);
     if (argc >= 3 && argv[2][0] != '-')
@@ -1976,6 +2231,10 @@ int main(int argc, char *argv[])
             port = std::atoi(argv[++i]);
         else if (std::strncmp(argv[i], "--port=", 7) == 0)
             port = std::atoi(argv[i] + 7);
+        else if (std::strcmp(argv[i], "--open") == 0 && i + 1 < argc)
+            openPath = argv[++i];
+        else if (std::strncmp(argv[i], "--open=", 7) == 0)
+            openPath = argv[i] + 7;
     }
     port = std::clamp(port, 1, 65535);
 
@@ -2061,6 +2320,22 @@ int main(int argc, char *argv[])
     char cpuFilter[96] = {};
     char gpuFilter[96] = {};
     char counterFilter[96] = {};
+    bool binaryDirty = false;
+    pe::ProfilerWireDecoder decoder;
+    pe::ProfilerSnapshot wireSnapshot;
+
+    // Offline dumps replace the session and stop the live connection so it is not mixed in
+    const auto openDump = [&](const std::string &path)
+    {
+        autoConnect = false;
+        client.Disconnect();
+        if (LoadFlightRecorderDump(path, session, notice))
+            status = "OFFLINE";
+        else
+            status = "DISCONNECTED";
+    };
+    if (!openPath.empty())
+        openDump(openPath);
 
     bool running = true;
     while (running)
@@ -2074,6 +2349,11 @@ int main(int argc, char *argv[])
             if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_SPACE &&
                 !ImGui::GetIO().WantTextInput)
                 paused = !paused;
+            if (event.type == SDL_DROPFILE)
+            {
+                openDump(event.drop.file);
+                SDL_free(event.drop.file);
+            }
         }
 
         const double now = SDL_GetTicks64() / 1000.0;
@@ -2083,6 +2363,8 @@ int main(int argc, char *argv[])
             {
                 status = "LIVE";
                 refreshRateDirty = true;
+                binaryDirty = true;
+                decoder.Reset();
             }
             else
             {
@@ -2095,13 +2377,37 @@ int main(int argc, char *argv[])
         {
             if (refreshRateDirty && client.SetRefreshRate(refreshRates[refreshRateIndex]))
                 refreshRateDirty = false;
+            if (binaryDirty && client.RequestBinaryFrames())
+                binaryDirty = false;
 
-            std::string json;
-            while (client.TryRecvFrame(json))
+            std::string payload;
+            while (client.TryRecvFrame(payload))
             {
+                const size_t payloadBytes = payload.size() + 4;
+                if (pe::IsProfilerWireFrame(payload))
+                {
+                    // Decode even while paused so the string table stays in step with the Player
+                    if (!decoder.Decode(payload, wireSnapshot))
+                    {
+                        client.Disconnect();
+                        break;
+                    }
+                    if (!paused)
+                    {
+                        session.wireBytes += payloadBytes;
+                        session.binaryWire = true;
+                        session.Accept(FrameFromSnapshot(wireSnapshot), wireSnapshot.ToJson());
+                    }
+                    continue;
+                }
+
                 LiveFrame frame;
-                if (!paused && ParseFrame(json, frame))
-                    session.Accept(std::move(frame), std::move(json));
+                if (!paused && ParseFrame(payload, frame))
+                {
+                    session.wireBytes += payloadBytes;
+                    session.binaryWire = false;
+                    session.Accept(std::move(frame), std::move(payload));
+                }
             }
             if (!client.IsConnected())
             {
@@ -2197,11 +2503,11 @@ int main(int argc, char *argv[])
                 if (tab == 0)
                     DrawOverview(session, targetFps, requestedTab, selectedCpu, selectedGpu, showFrame, showCpu, showGpu);
                 else if (tab == 1)
-                    DrawTimingTab("CPU", session.live.cpu, session.cpuStats,
+                    DrawTimingTab("CPU", session.live.cpu, session.live.cpuThreads, session.cpuStats,
                                   std::max(session.live.cpuScopeTotalMs, session.live.cpuTotalMs), cpuFilter,
                                   sizeof(cpuFilter), cpuView, cpuZoomH, cpuZoomV, selectedCpu);
                 else if (tab == 2)
-                    DrawTimingTab("GPU", session.live.gpu, session.gpuStats, session.live.gpuTotalMs, gpuFilter,
+                    DrawTimingTab("GPU", session.live.gpu, {}, session.gpuStats, session.live.gpuTotalMs, gpuFilter,
                                   sizeof(gpuFilter), gpuView, gpuZoomH, gpuZoomV, selectedGpu);
                 else if (tab == 3)
                     DrawCounters(session, counterFilter, sizeof(counterFilter));
@@ -50,7 +50,7 @@ namespace pe
                     return true;
 
                 for (Shader *shader : GetShaders())
-                    if (shader->GetPathID() == changedShaderHash.value())
+                    if (shader->DependsOn(changedShaderHash.value()))
                         return true;
 
                 return false;
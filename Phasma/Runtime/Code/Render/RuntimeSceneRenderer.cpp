@@ -194,6 +194,7 @@ namespace pe
 
         m_sceneRenderer.AddScenePassesToRenderGraph();
         renderGraph.Compile();
+        m_sceneRenderer.ApplyTransientAliasing();
     }
 
     CommandBuffer *RuntimeSceneRenderer::RecordPasses(uint32_t imageIndex)
@@ -246,6 +246,7 @@ namespace pe
             Descriptor *idSetTextures = idSets[1];
             idSetUniforms->SetBuffer(0, scene.GetUniforms(frame));
             idSetUniforms->SetBuffer(1, scene.GetMeshConstants());
+            idSetUniforms->SetBuffer(2, scene.GetBuffer());
             idSetUniforms->Update();
             idSetTextures->SetBuffer(0, scene.GetMeshConstants());
             idSetTextures->SetSampler(1, scene.GetDefaultSampler());
@@ -276,7 +277,6 @@ namespace pe
             cmd->SetScissor(0, 0, depth->GetWidth(), depth->GetHeight());
             cmd->BindPipeline(*cache.idPI);
             cmd->BindIndexBuffer(scene.GetBuffer(), 0);
-            cmd->BindVertexBuffer(scene.GetBuffer(), scene.GetPositionsOffset());
             scene.BindDrawIdBuffer(cmd);
             cmd->SetConstants(idConstants);
             cmd->PushConstants();
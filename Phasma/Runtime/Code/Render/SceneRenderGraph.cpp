@@ -289,6 +289,28 @@ namespace pe
         }
     }
 
+    std::vector<PassInfo *> CollectInitializedSceneRenderGraphPassInfos(const SceneRenderGraphPassComponents &components,
+                                                                       std::span<const bool> passInitialized)
+    {
+        PE_ASSERT(passInitialized.size() >= kSceneRenderGraphPassCount,
+                  "Scene render graph pass init state span is too small");
+
+        std::vector<PassInfo *> passInfos;
+        for (const SceneRenderGraphPassDesc &desc : kSceneRenderGraphPasses)
+        {
+            IRenderPassComponent *component = components.*desc.component;
+            if (!passInitialized[static_cast<size_t>(desc.id)] || !component)
+                continue;
+
+            for (PassInfo *passInfo : component->GetPassInfos())
+            {
+                if (passInfo)
+                    passInfos.push_back(passInfo);
+            }
+        }
+        return passInfos;
+    }
+
     void ResizeInitializedSceneRenderGraphPassComponents(const SceneRenderGraphPassComponents &components,
                                                          std::span<bool> passInitialized,
                                                          uint32_t width,
@@ -332,6 +354,20 @@ namespace pe
         }
     }
 
+    void UpdateInitializedSceneRenderGraphPassDescriptorSets(const SceneRenderGraphPassComponents &components,
+                                                             std::span<const bool> passInitialized)
+    {
+        PE_ASSERT(passInitialized.size() >= kSceneRenderGraphPassCount,
+                  "Scene render graph pass init state span is too small");
+
+        for (const SceneRenderGraphPassDesc &desc : kSceneRenderGraphPasses)
+        {
+            IRenderPassComponent *component = components.*desc.component;
+            if (passInitialized[static_cast<size_t>(desc.id)] && component)
+                component->UpdateDescriptorSets();
+        }
+    }
+
     SceneRenderGraphPassComponents GetGlobalSceneRenderGraphPassComponents()
     {
         SceneRenderGraphPassComponents scenePasses{};
@@ -502,19 +538,18 @@ namespace pe
                                               const SceneRenderGraphPassComponents &components,
                                               const SceneRenderGraphPassCondition &isPassEnabled)
     {
-        std::vector<std::shared_future<void>> futures;
-        futures.reserve(renderPassComponents.size());
+        // Reused across frames so the fan-out itself never allocates
+        thread_local std::vector<IRenderPassComponent *> passes;
+        passes.clear();
         for (auto &rc : renderPassComponents)
         {
-            if (!ShouldUpdateSceneRenderGraphPass(components, isPassEnabled, rc))
-                continue;
-
-            futures.push_back(ThreadPool::Update.Enqueue([rc]()
-                                                         { rc->Update(); }));
+            if (ShouldUpdateSceneRenderGraphPass(components, isPassEnabled, rc))
+                passes.push_back(rc);
         }
 
-        for (auto &future : futures)
-            future.wait();
+        IRenderPassComponent *const *list = passes.data(); // workers must not see their own thread_local copy
+        ParallelFor(static_cast<uint32_t>(passes.size()), 1, [list](uint32_t i)
+                    { list[i]->Update(); });
     }
 
     void SetSceneRenderGraphPassScene(const SceneRenderGraphPassComponents &components, Scene &scene)
@@ -9,6 +9,7 @@ namespace pe
 {
     class CommandBuffer;
     class IRenderPassComponent;
+    class PassInfo;
     class Scene;
 
     enum class SceneRenderGraphPassId : uint32_t
@@ -114,6 +115,14 @@ namespace pe
     void DestroyInitializedSceneRenderGraphPassComponents(const SceneRenderGraphPassComponents &components,
                                                           std::span<bool> passInitialized);
 
+    // Rewrites the descriptor sets of every initialized component, e.g. after transient aliasing
+    // recreated the views of the images they sample.
+    void UpdateInitializedSceneRenderGraphPassDescriptorSets(const SceneRenderGraphPassComponents &components,
+                                                             std::span<const bool> passInitialized);
+
+    [[nodiscard]] std::vector<PassInfo *> CollectInitializedSceneRenderGraphPassInfos(const SceneRenderGraphPassComponents &components,
+                                                                                    std::span<const bool> passInitialized);
+
     [[nodiscard]] SceneRenderGraphPassComponents GetGlobalSceneRenderGraphPassComponents();
 
     void UpdateSceneRenderGraphPassStates(std::span<bool> passEnabled, bool hasRayTracingGeometry);
@@ -4,6 +4,7 @@
 #include "API/Image.h"
 #include "API/Queue.h"
 #include "API/RHI.h"
+#include "API/Shader.h"
 #include "Render/RenderPassShaderReload.h"
 #include "Render/SceneScreenshot.h"
 #include "Render/SceneSky.h"
@@ -135,19 +136,30 @@ namespace pe
     void SceneRendererCore::CreateRenderPassComponents(bool includeRayTracingPass, CommandBuffer *cmd)
     {
         (void)cmd;
+        Shader::PrecompileRecorded();
         CreateSceneRenderGraphPassComponents(m_renderPassComponents, includeRayTracingPass);
     }
 
     void SceneRendererCore::DestroyRenderPassComponents()
     {
+        m_renderGraph.ReleaseAliasing();
+        m_deferredRenderGraph.ReleaseAliasing();
         DestroyInitializedSceneRenderGraphPassComponents(m_scenePasses, m_renderGraphPassInitialized);
     }
 
     void SceneRendererCore::ResizeRenderPassComponents(uint32_t width, uint32_t height, bool hasRayTracingGeometry)
     {
+        // Passes recreate their images here, so the aliasing plans would point at destroyed ones
+        m_renderGraph.ReleaseAliasing();
+        m_deferredRenderGraph.ReleaseAliasing();
+
         pe::UpdateSceneRenderGraphPassStates(m_renderGraphPassEnabled, hasRayTracingGeometry);
         ResizeInitializedSceneRenderGraphPassComponents(m_scenePasses, m_renderGraphPassInitialized, width, height);
         InitEnabledRenderPassComponents(nullptr);
+
+        m_renderGraph.Compile();
+        m_deferredRenderGraph.Compile();
+        ApplyTransientAliasing();
     }
 
     void SceneRendererCore::CacheGlobalComponents()
@@ -163,6 +175,15 @@ namespace pe
         // toggles caused device loss). Setting toggles pass no command buffer; lazily initable
         // passes must tolerate nullptr here.
         InitEnabledRenderPassComponents(cmd);
+
+        // Toggles do not rebuild the graphs but they change the transients' lifetimes, and with them
+        // which images may share memory
+        if (m_renderGraph.PassStatesChanged() || m_deferredRenderGraph.PassStatesChanged())
+        {
+            m_renderGraph.Compile();
+            m_deferredRenderGraph.Compile();
+            ApplyTransientAliasing();
+        }
     }
 
     bool SceneRendererCore::IsPassEnabled(SceneRenderGraphPassId passId) const
@@ -215,6 +236,14 @@ namespace pe
         }
     }
 
+    void SceneRendererCore::ApplyTransientAliasing()
+    {
+        bool moved = m_renderGraph.ApplyAliasing();
+        moved |= m_deferredRenderGraph.ApplyAliasing();
+        if (moved)
+            UpdateInitializedSceneRenderGraphPassDescriptorSets(m_scenePasses, m_renderGraphPassInitialized);
+    }
+
     void SceneRendererCore::UpdateRenderPassComponents()
     {
         UpdateSceneRenderGraphPassComponents(m_renderPassComponents,
@@ -227,6 +256,8 @@ namespace pe
     {
         InitEnabledSceneRenderGraphPassComponents(m_scenePasses, [this](SceneRenderGraphPassId passId)
                                                   { return IsPassEnabled(passId); }, m_renderGraphPassInitialized, cmd);
+        // Build the pipelines the previous session bound before the first frame records them
+        CommandBuffer::PrewarmPipelines(CollectInitializedSceneRenderGraphPassInfos(m_scenePasses, m_renderGraphPassInitialized));
     }
 
     void SceneRendererCore::SetRenderPassScene(Scene &scene)
@@ -250,6 +281,11 @@ namespace pe
 
     void SceneRendererCore::PollShaders(std::optional<size_t> hash)
     {
+        // Drop the changed file from the include graph first so the reloaded shaders re-read it
+        if (hash.has_value())
+            ShaderCache::InvalidateFile(hash.value());
+        else
+            ShaderCache::InvalidateAll();
         ReloadRenderPassShaders(m_renderPassComponents, hash);
     }
 
@@ -71,6 +71,8 @@ namespace pe
         void SetPassDeferred(SceneRenderGraphPassId passId, bool deferred);
         bool IsPassDeferred(SceneRenderGraphPassId passId) const;
         void AddScenePassesToRenderGraph();
+        // Places both graphs' transient images as their last Compile planned; call after compiling.
+        void ApplyTransientAliasing();
         void UpdateRenderPassComponents();
         void SetRenderPassScene(Scene &scene);
         void ExecuteRenderGraph(CommandBuffer *cmd);
@@ -5,6 +5,7 @@
 #include "API/Pipeline.h"
 #include "API/Queue.h"
 #include "API/RHI.h"
+#include "API/RenderGraph.h"
 #include "API/Shader.h"
 #include "Render/SceneRendererHost.h"
 
@@ -120,6 +121,11 @@ namespace pe
         UpdateDescriptorSets();
     }
 
+    void ColorGradingPass::DeclareInputs(RGBuilder &builder)
+    {
+        builder.Transient(m_frameImage);
+    }
+
     void ColorGradingPass::ExecutePass(CommandBuffer *cmd)
     {
         auto &gSettings = ActivePostProcessProfile();
@@ -3,6 +3,7 @@
 #include "API/Command.h"
 #include "API/Image.h"
 #include "API/Pipeline.h"
+#include "API/Queue.h"
 #include "API/RHI.h"
 #include "API/RenderGraph.h"
 #include "API/Shader.h"
@@ -143,15 +144,62 @@ namespace pe
         if (!m_scene || m_scene->GetMeshCount() == 0)
             return;
 
-        cmd->BeginDebugRegion("CullingPass");
-
         const uint32_t frame = RHII.GetFrameIndex();
         const bool voxelOcc = VoxelOcclusionActive();
+        // The voxel Hi-Z pyramid is an exclusive image owned by the graphics family, so the occlusion
+        // variant stays in the frame command buffer. The frustum-only cull reads host-written scene data
+        // and concurrent buffers only, so it can run on the compute queue beside the frame.
+        if (!voxelOcc && ExecuteOnComputeQueue())
+            return;
+
+        cmd->BeginDebugRegion("CullingPass");
         m_scene->DispatchCulling(cmd, m_passInfo.get(), m_sortPassInfo.get(),
                                  voxelOcc ? m_voxelHiZ : nullptr,
                                  voxelOcc ? m_occlusionUniforms[frame] : nullptr);
+        cmd->EndDebugRegion();
+    }
+
+    bool CullingPass::ExecuteOnComputeQueue()
+    {
+        Queue *mainQueue = RHII.GetMainQueue();
+        Queue *computeQueue = RHII.GetComputeQueue();
+        if (computeQueue == mainQueue)
+            return false;
 
+        const uint32_t frame = RHII.GetFrameIndex();
+        if (m_computeCmds.size() != RHII.GetSwapchainImageCount())
+            m_computeCmds.resize(RHII.GetSwapchainImageCount(), nullptr);
+        RetireComputeCommand(frame);
+
+        // Arena and scene uploads land on the transfer queue; the cull reads the draw list they write
+        Queue *transferQueue = RHII.GetTransferQueue();
+        if (transferQueue != mainQueue)
+            computeQueue->WaitForQueue(transferQueue, transferQueue->GetSubmissionCount(), PE_STAGE_COMPUTE_SHADER);
+
+        CommandBuffer *cmd = computeQueue->AcquireCommandBuffer();
+        cmd->Begin();
+        cmd->BeginDebugRegion("CullingPass");
+        m_scene->DispatchCulling(cmd, m_passInfo.get(), m_sortPassInfo.get(), nullptr, nullptr);
         cmd->EndDebugRegion();
+        cmd->End();
+        computeQueue->Submit(1, &cmd, nullptr, nullptr);
+        m_computeCmds[frame] = cmd;
+
+        // The frame is submitted after recording, so this wait holds its indirect draws and the compute
+        // passes that read the culled lists.
+        mainQueue->WaitForQueue(computeQueue, computeQueue->GetSubmissionCount(),
+                                PE_STAGE_DRAW_INDIRECT | PE_STAGE_COMPUTE_SHADER);
+        return true;
+    }
+
+    void CullingPass::RetireComputeCommand(uint32_t frame)
+    {
+        if (frame >= m_computeCmds.size() || !m_computeCmds[frame])
+            return;
+
+        m_computeCmds[frame]->Wait();
+        m_computeCmds[frame]->Return();
+        m_computeCmds[frame] = nullptr;
     }
 
     void CullingPass::Resize(uint32_t width, uint32_t height)
@@ -163,6 +211,9 @@ namespace pe
 
     void CullingPass::Destroy()
     {
+        for (uint32_t i = 0; i < m_computeCmds.size(); ++i)
+            RetireComputeCommand(i);
+        m_computeCmds.clear();
         Shader::Destroy(m_passInfo->pCompShader);
         Shader::Destroy(m_sortPassInfo->pCompShader);
         m_sortPassInfo.reset();
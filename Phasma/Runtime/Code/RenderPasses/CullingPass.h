@@ -31,6 +31,10 @@ namespace pe
         // Temporal voxel Hi-Z is active when occlusion culling is enabled, a voxel pyramid exists, and
         // the scene actually has live arena voxels (else the cull stays frustum-only).
         bool VoxelOcclusionActive() const;
+        // Records the cull into its own command buffer on the async-compute queue and makes the main
+        // queue wait for it. Returns false when there is no separate compute queue.
+        bool ExecuteOnComputeQueue();
+        void RetireComputeCommand(uint32_t frame);
 
         Scene *m_scene = nullptr;
         std::unique_ptr<PassInfo> m_sortPassInfo = std::make_unique<PassInfo>();
@@ -43,5 +47,9 @@ namespace pe
         std::vector<Buffer *> m_occlusionUniforms;
         mat4 m_prevViewProj = mat4(1.0f);
         bool m_havePrevViewProj = false;
+
+        // Per-frame cull command buffers submitted to the compute queue, returned when the frame slot
+        // comes around again.
+        std::vector<CommandBuffer *> m_computeCmds;
     };
 } // namespace pe
@@ -58,6 +58,7 @@ namespace pe
     void DOFPass::DeclareInputs(RGBuilder &builder)
     {
         builder.Read(m_depth);
+        builder.Transient(m_frameImage);
     }
 
     void DOFPass::ExecutePass(CommandBuffer *cmd)
@@ -87,6 +87,7 @@ namespace pe
                 Descriptor *setUniforms = sets[0];
                 setUniforms->SetBuffer(0, scene.GetUniforms(frame));
                 setUniforms->SetBuffer(1, scene.GetMeshConstants());
+                setUniforms->SetBuffer(2, scene.GetBuffer());
                 setUniforms->Update();
             }
         }
@@ -117,7 +118,6 @@ namespace pe
         cmd->SetScissor(0, 0, m_depthStencil->GetWidth(), m_depthStencil->GetHeight());
         cmd->BindPipeline(*m_passInfo);
         cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-        cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetPositionsOffset());
         m_scene->BindDrawIdBuffer(cmd);
         cmd->SetConstants(pushConstants);
         cmd->PushConstants();
@@ -126,6 +126,11 @@ namespace pe
 
     void GbufferOpaquePass::UpdatePassInfo()
     {
+        // The voxel and terrain pass infos parse on workers while the main pipeline compiles below
+        if (!m_voxelPassAsset)
+            m_voxelPassAsset = ResourceManager::Get().LoadAsync<PassInfoAsset>(Path::RuntimeAssets + "Shaders/Voxel/voxel_gbuffer.passinfo");
+        if (!m_terrainPassAsset)
+            m_terrainPassAsset = ResourceManager::Get().LoadAsync<PassInfoAsset>(Path::RuntimeAssets + "Shaders/Terrain/terrain_gbuffer.passinfo");
         if (!m_passAsset)
             m_passAsset = ResourceManager::Get().Load<PassInfoAsset>(Path::RuntimeAssets + "PassInfo/standard_pbr.pass");
 
@@ -185,7 +190,10 @@ namespace pe
             };
             try
             {
-                if (!asset)
+                if (asset)
+                    asset->Wait();
+                // A failed async load is retried here, and throws if it fails again
+                if (!asset || asset->GetState() == ResourceState::Failed)
                     asset = ResourceManager::Get().Load<PassInfoAsset>(Path::RuntimeAssets + passinfoPath);
                 const PassVariant *surf = asset ? asset->GetVariant("surface") : nullptr;
                 if (!surf)
@@ -318,6 +326,7 @@ namespace pe
                 Descriptor *setUniforms = sets[0];
                 setUniforms->SetBuffer(0, scene.GetUniforms(frame));
                 setUniforms->SetBuffer(1, scene.GetMeshConstants());
+                setUniforms->SetBuffer(2, scene.GetBuffer());
                 setUniforms->Update();
             }
 
@@ -341,6 +350,7 @@ namespace pe
                     Descriptor *setUniforms = sets[0];
                     setUniforms->SetBuffer(0, scene.GetUniforms(frame));
                     setUniforms->SetBuffer(1, scene.GetMeshConstants());
+                    setUniforms->SetBuffer(2, scene.GetBuffer());
                     setUniforms->Update();
                 }
             }
@@ -394,7 +404,6 @@ namespace pe
 
             cmd->BindPipeline(*m_passInfo);
             cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-            cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetVerticesOffset());
             m_scene->BindDrawIdBuffer(cmd);
             cmd->SetConstants(pushConstants);
             cmd->PushConstants();
@@ -445,7 +454,6 @@ namespace pe
             {
                 cmd->BindPipeline(*m_terrainPassInfo);
                 cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-                cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetVerticesOffset());
                 pushConstants.terrainTexScale = m_scene->GetTerrainTexScale(); // metres per triplanar tile
                 cmd->SetConstants(pushConstants);
                 cmd->PushConstants();
@@ -677,6 +685,7 @@ namespace pe
             Descriptor *setUniforms = sets[0];
             setUniforms->SetBuffer(0, scene.GetUniforms(frame));
             setUniforms->SetBuffer(1, scene.GetMeshConstants());
+            setUniforms->SetBuffer(2, scene.GetBuffer());
             setUniforms->Update();
 
             if (voxelPipelineReady)
@@ -734,7 +743,6 @@ namespace pe
             cmd->SetScissor(0, 0, m_depthStencilRT->GetWidth(), m_depthStencilRT->GetHeight());
             cmd->BindPipeline(*m_passInfo);
             cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-            cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetVerticesOffset());
             m_scene->BindDrawIdBuffer(cmd);
             cmd->SetConstants(pushConstants);
             cmd->PushConstants();
@@ -750,7 +758,6 @@ namespace pe
             cmd->SetScissor(0, 0, m_depthStencilRT->GetWidth(), m_depthStencilRT->GetHeight());
             cmd->BindPipeline(*m_passInfo);
             cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-            cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetVerticesOffset());
             m_scene->BindDrawIdBuffer(cmd);
             cmd->SetConstants(pushConstants);
             cmd->PushConstants();
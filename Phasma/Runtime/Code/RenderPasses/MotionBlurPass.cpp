@@ -67,6 +67,7 @@ namespace pe
     {
         builder.Read(m_velocityRT);
         builder.Read(m_depth);
+        builder.Transient(m_frameImage);
     }
 
     void MotionBlurPass::ExecutePass(CommandBuffer *cmd)
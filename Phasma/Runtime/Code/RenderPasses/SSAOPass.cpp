@@ -250,6 +250,8 @@ namespace pe
         builder.WriteCompute(m_ssaoRawRT);
         builder.WriteCompute(m_ssaoBlurRT);
         builder.WriteCompute(m_ssaoRT);
+        builder.Transient(m_ssaoRawRT);
+        builder.Transient(m_ssaoBlurRT);
     }
 
     void SSAOPass::DeclareOutputs(RGBuilder &builder)
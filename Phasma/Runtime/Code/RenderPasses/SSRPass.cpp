@@ -108,6 +108,7 @@ namespace pe
         builder.Read(m_depth);
         builder.Read(m_srmRT);
         builder.Read(m_albedoRT);
+        builder.Transient(m_frameImage);
     }
 
     void SSRPass::ExecutePass(CommandBuffer *cmd)
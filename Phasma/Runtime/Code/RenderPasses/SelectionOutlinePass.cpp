@@ -121,6 +121,7 @@ namespace pe
 
         sets[0]->SetBuffer(0, scene.GetUniforms(frame));
         sets[0]->SetBuffer(1, scene.GetMeshConstants());
+        sets[0]->SetBuffer(2, scene.GetBuffer());
         sets[0]->Update();
     }
 
@@ -153,7 +154,6 @@ namespace pe
         cmd->SetScissor(0, 0, m_maskRT->GetWidth(), m_maskRT->GetHeight());
         cmd->BindPipeline(*m_passInfoMask);
         cmd->BindIndexBuffer(scene->GetBuffer(), 0);
-        cmd->BindVertexBuffer(scene->GetBuffer(), scene->GetPositionsOffset());
         scene->BindDrawIdBuffer(cmd);
         cmd->SetConstants(maskConstants);
         cmd->PushConstants();
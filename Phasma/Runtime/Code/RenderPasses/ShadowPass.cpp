@@ -176,6 +176,7 @@ namespace pe
                 Descriptor *setUniforms = sets[0];
                 setUniforms->SetBuffer(0, scene.GetUniforms(frame));
                 setUniforms->SetBuffer(1, scene.GetMeshConstants());
+                setUniforms->SetBuffer(2, scene.GetBuffer());
                 setUniforms->Update();
 
                 // Same data/constants for the packed-voxel shadow pipeline (its VS reads the node
@@ -395,7 +396,6 @@ namespace pe
                     Buffer *counters = m_scene->GetShadowCullCounters(frame);
 
                     cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-                    cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetPositionsOffset());
                     m_scene->BindDrawIdBuffer(cmd);
                     if (regularCount > 0)
                         cmd->DrawIndexedIndirectCount(regularIndirect, 0, counters, 0, regularCount);
@@ -416,7 +416,6 @@ namespace pe
                 else
                 {
                     cmd->BindIndexBuffer(m_scene->GetBuffer(), 0);
-                    cmd->BindVertexBuffer(m_scene->GetBuffer(), m_scene->GetPositionsOffset());
                     m_scene->BindDrawIdBuffer(cmd);
                     if (regularCount > 0)
                         cmd->DrawIndexedIndirect(m_scene->GetIndirectAll(), 0, regularCount);
@@ -4,6 +4,7 @@
 #include "API/Image.h"
 #include "API/Pipeline.h"
 #include "API/RHI.h"
+#include "API/RenderGraph.h"
 #include "API/Shader.h"
 #include "Render/SceneRendererHost.h"
 
@@ -55,6 +56,11 @@ namespace pe
         }
     }
 
+    void TonemapPass::DeclareInputs(RGBuilder &builder)
+    {
+        builder.Transient(m_frameImage);
+    }
+
     void TonemapPass::ExecutePass(CommandBuffer *cmd)
     {
         ImageBarrierInfo barrier{};
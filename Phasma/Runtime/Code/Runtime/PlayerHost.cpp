@@ -28,6 +28,7 @@
 #include "Voxel/VoxelSystem.h"
 #include "UI/RuntimeUi.h"
 #include "Window/WindowEvents.h"
+#include "Base/ProfilerFlightRecorder.h"
 #include "Base/ProfilerStream.h"
 #if defined(PE_PLAYER_MCP)
 #include "Agent/PlayerMcp.h"
@@ -429,9 +430,10 @@ namespace pe
         {
         public:
             PlayerFramePump(SDL_Window *window, RuntimeSceneRenderer &renderer, RuntimeUiSystem *runtimeUi,
-                            MainThreadActionQueue *mcpActions, ProfilerStreamServer *profilerStream)
+                            MainThreadActionQueue *mcpActions, ProfilerStreamServer *profilerStream,
+                            ProfilerFlightRecorder *flightRecorder)
                 : m_window(window), m_renderer(renderer), m_runtimeUi(runtimeUi), m_mcpActions(mcpActions),
-                  m_profilerStream(profilerStream)
+                  m_profilerStream(profilerStream), m_flightRecorder(flightRecorder)
             {
             }
 
@@ -445,6 +447,7 @@ namespace pe
                 RHII.NextFrame();
                 FrameTimer::Instance().Tick();
                 Profiler::BeginFrame();
+                ResourceManager::Get().PublishCounters();
                 struct ProfilerFrameGuard
                 {
                     bool open = true;
@@ -491,6 +494,8 @@ namespace pe
                     profilerFrame.Close();
                     if (m_profilerStream)
                         m_profilerStream->Tick();
+                    if (m_flightRecorder)
+                        m_flightRecorder->Tick();
                     SDL_Delay(16);
                     return true;
                 }
@@ -531,6 +536,8 @@ namespace pe
                 profilerFrame.Close();
                 if (m_profilerStream)
                     m_profilerStream->Tick();
+                if (m_flightRecorder)
+                    m_flightRecorder->Tick();
                 LogFrameRate();
                 return true;
             }
@@ -731,6 +738,7 @@ namespace pe
             RuntimeUiSystem *m_runtimeUi = nullptr;
             MainThreadActionQueue *m_mcpActions = nullptr;
             ProfilerStreamServer *m_profilerStream = nullptr;
+            ProfilerFlightRecorder *m_flightRecorder = nullptr;
             bool m_resizePending = false;
             bool m_surfaceRecreatePending = false;
             double m_fpsAccumSeconds = 0.0;
@@ -764,6 +772,8 @@ namespace pe
                     PE_ERROR("%s", packError.c_str());
                     return 1;
                 }
+                // Entries are hash-checked lazily; this finishes the rest off the critical path
+                VerifyGamePackInBackground();
                 FileWatcher::SetEnabled(false);
                 PE_INFO("[Runtime] Loaded game pack: %s", gamePackPath.generic_string().c_str());
             }
@@ -918,13 +928,29 @@ namespace pe
                     }
                 }
 
+                std::unique_ptr<ProfilerFlightRecorder> flightRecorder;
+                if (const std::optional<ProfilerFlightRecorder::Config> recorderConfig = ParseFlightRecorderArgs(argc, argv))
                 {
-                    PlayerFramePump framePump(window.Get(), renderer, runtimeUiPtr, &mcpActions, profilerStream.get());
+                    flightRecorder = std::make_unique<ProfilerFlightRecorder>();
+                    flightRecorder->Start(*recorderConfig, Path::Executable + "ProfilerCaptures/");
+                    PE_INFO("[Profiler] Flight recorder on (dumps frames over %.1f ms to ProfilerCaptures/)",
+                            recorderConfig->hitchBudgetMs);
+                }
+
+                {
+                    PlayerFramePump framePump(window.Get(), renderer, runtimeUiPtr, &mcpActions, profilerStream.get(),
+                                              flightRecorder.get());
                     PE_INFO("[Runtime] Player frame pump running (startup scene render)");
                     framePump.Run();
                     PE_INFO("[Runtime] Player frame pump stopped cleanly");
                 }
 
+                if (flightRecorder)
+                {
+                    flightRecorder->Stop();
+                    flightRecorder.reset();
+                }
+
                 if (profilerStream)
                 {
                     profilerStream->Stop();
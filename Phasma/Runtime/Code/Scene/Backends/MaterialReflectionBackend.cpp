@@ -186,6 +186,7 @@ namespace pe
         switch (RHII.GetApi())
         {
         case PE_GRAPHICS_API_VULKAN:
+        case PE_GRAPHICS_API_NULL:
             return ReflectMaterialResourcesFromVulkan(variant);
         case PE_GRAPHICS_API_DX12:
 #if defined(PE_WIN32)
@@ -19,14 +19,23 @@ namespace pe
         float aabbMaxX;
         float aabbMaxY;
         float aabbMaxZ;
-        // Discrete LOD index ranges (see Mesh::lod*). CullingCS picks a level by camera distance and
-        // overrides the draw's firstIndex/indexCount. lodCount==1 means no simplified levels. Must stay
-        // byte-identical to the HLSL Mesh_Constants in Structures.hlsl. (4 == Mesh::kMaxLods)
+        // Discrete LOD index ranges (see Mesh::lod*). CullingCS picks a level by projected error or
+        // camera distance and overrides the draw's firstIndex/indexCount. lodCount==1 means no simplified
+        // levels. Must stay byte-identical to the HLSL Mesh_Constants in Structures.hlsl. (4 == Mesh::kMaxLods)
         uint32_t lodCount;
         uint32_t lodIndexOffset[4];
         uint32_t lodIndexCount[4];
         uint32_t lodShift;       // per-mesh additive LOD level offset (see Mesh::lodShift)
         uint32_t lodMeshEnabled; // 0 = this mesh ignores LOD (always full detail)
         float lodMeshBias;       // per-mesh camera-distance multiplier (see Mesh::lodBias)
+        float lodError[4];       // per-level object-space error (see Mesh::lodError)
+        // Vertex pulling (Common/VertexFetch.hlsl). The streams are byte offsets of vertex 0 in the
+        // geometry buffer: vertexStream feeds the GBuffer VS, positionStream the depth/shadow VS. Both
+        // point at the packed stream for packed meshes. vertexBase is the draw's vertexOffset, which
+        // D3D12 leaves out of SV_VertexID.
+        uint32_t vertexFormat;   // 0 = Vertex / PositionUvVertex, 1 = PackedVertex
+        uint32_t vertexBase;
+        uint32_t vertexStream;
+        uint32_t positionStream;
     };
 } // namespace pe
@@ -1,4 +1,5 @@
 #include "Scene/ModelAsset.h"
+#include <meshoptimizer.h> // meshopt_simplify for the LOD chains
 #include "API/Image.h"
 #include "API/RHI.h"
 #include "Scene/Material.h"
@@ -192,7 +193,72 @@ namespace pe
         return m_nodeToMesh[nodeIndex];
     }
 
-    ResourceHandle<Image> ModelAsset::LoadTexture(CommandBuffer *cmd, const std::filesystem::path &texturePath)
+    std::string ModelAsset::GetTextureSource(const Material &material, int slot) const
+    {
+        const Image *image = material.textures[slot].get();
+        if (!image || (material.textureMask & TextureBit(static_cast<TextureType>(slot))) == 0)
+            return {};
+
+        // Embedded images carry their aiScene index in the resource id; the display name is empty
+        const std::string &name = image->GetName();
+        if (name.empty() || name[0] == '*' || name.rfind("Embedded_", 0) == 0)
+            return image->GetResourceId();
+        return name;
+    }
+
+    void ModelAsset::BuildLods(uint32_t maxLods, std::vector<MeshLods> &lods, std::vector<uint32_t> &lodIndices) const
+    {
+        static_assert(MeshLods::kMaxLods == Mesh::kMaxLods);
+        static constexpr float kRatios[MeshLods::kMaxLods] = {1.0f, 0.5f, 0.25f, 0.12f};
+        maxLods = std::clamp(maxLods, 1u, MeshLods::kMaxLods);
+
+        lods.assign(m_meshInfos.size(), MeshLods{});
+        std::vector<uint32_t> simplified;
+        for (size_t m = 0; m < m_meshInfos.size(); ++m)
+        {
+            const MeshInfo &mi = m_meshInfos[m];
+            MeshLods &chain = lods[m];
+            chain.indexOffset[0] = mi.indexOffset;
+            chain.indexCount[0] = mi.indicesCount;
+
+            // Simplified levels index the SAME vertices (a subset), so every level shares the mesh's
+            // vertexOffset. Skinned meshes are skipped (joint-weighted simplification would need
+            // attribute-aware collapse).
+            const uint32_t baseIdxCount = mi.indicesCount;
+            if (maxLods < 2 || baseIdxCount < 256 || mi.skinned || mi.verticesCount == 0 ||
+                static_cast<size_t>(mi.indexOffset) + baseIdxCount > m_indices.size() ||
+                static_cast<size_t>(mi.vertexOffset) + mi.verticesCount > m_vertices.size())
+                continue;
+
+            const uint32_t *baseIndices = m_indices.data() + mi.indexOffset; // 0-based within this mesh
+            const float *positions = m_vertices[mi.vertexOffset].position;
+            const size_t vtxCount = mi.verticesCount;
+            // meshopt reports error relative to the mesh extent; scale it to model units
+            const float errorScale = meshopt_simplifyScale(positions, vtxCount, sizeof(Vertex));
+            simplified.resize(baseIdxCount);
+            uint32_t prevCount = baseIdxCount;
+            for (uint32_t lod = 1; lod < maxLods; ++lod)
+            {
+                size_t target = (static_cast<size_t>(baseIdxCount * kRatios[lod]) / 3) * 3; // whole tris
+                if (target < 12)
+                    break;
+                float err = 0.0f;
+                size_t resCount = meshopt_simplify(simplified.data(), baseIndices, baseIdxCount, positions,
+                                                   vtxCount, sizeof(Vertex), target, 0.1f, 0, &err);
+                if (resCount == 0 || resCount >= static_cast<size_t>(prevCount * 0.95f))
+                    break; // no meaningful reduction past this level
+                chain.indexOffset[lod] = static_cast<uint32_t>(lodIndices.size());
+                chain.indexCount[lod] = static_cast<uint32_t>(resCount);
+                chain.error[lod] = std::max(err * errorScale, chain.error[lod - 1]); // coarser never reads as finer
+                chain.count = lod + 1;
+                lodIndices.insert(lodIndices.end(), simplified.begin(), simplified.begin() + resCount);
+                prevCount = static_cast<uint32_t>(resCount);
+            }
+        }
+    }
+
+    ResourceHandle<Image> ModelAsset::LoadTexture(CommandBuffer *cmd, const std::filesystem::path &texturePath,
+                                                  std::span<const uint8_t> fileData, const DecodedPixels *decoded)
     {
         if (texturePath.empty())
             return ResourceHandle<Image>();
@@ -207,7 +273,13 @@ namespace pe
         ResourceHandle<Image> handle = ResourceManager::Get().Find<Image>(normalizedStr);
         if (!handle)
         {
-            Image *rawImg = Image::LoadRGBA8(cmd, normalizedStr);
+            Image *rawImg = nullptr;
+            if (decoded && decoded->pixels)
+                rawImg = Image::LoadRawFromMemory(cmd, decoded->pixels.get(), decoded->width, decoded->height, PE_FORMAT_R8G8B8A8_UNORM, normalizedStr);
+            else if (!fileData.empty())
+                rawImg = Image::LoadRGBA(cmd, normalizedStr, fileData, PE_FORMAT_R8G8B8A8_UNORM);
+            else
+                rawImg = Image::LoadRGBA8(cmd, normalizedStr);
             if (!rawImg)
                 return ResourceHandle<Image>();
 
@@ -292,11 +364,13 @@ namespace pe
         // 5. Rebuild flat vertex/index arrays, skipping orphaned mesh data
         std::vector<Vertex> newVertices;
         std::vector<PositionUvVertex> newPosUvs;
+        std::vector<PackedVertex> newPacked;
         std::vector<uint32_t> newIndices;
         std::vector<AabbVertex> newAabbVerts;
 
         newVertices.reserve(m_vertices.size());
         newPosUvs.reserve(m_positionUvs.size());
+        newPacked.reserve(m_packedVertices.size());
         newIndices.reserve(m_indices.size());
         newAabbVerts.reserve(m_aabbVertices.size());
 
@@ -311,6 +385,9 @@ namespace pe
                                    m_vertices.begin() + vOff, m_vertices.begin() + vOff + mi.verticesCount);
                 newPosUvs.insert(newPosUvs.end(),
                                  m_positionUvs.begin() + vOff, m_positionUvs.begin() + vOff + mi.verticesCount);
+                if (HasPackedVertices())
+                    newPacked.insert(newPacked.end(),
+                                     m_packedVertices.begin() + vOff, m_packedVertices.begin() + vOff + mi.verticesCount);
                 newIndices.insert(newIndices.end(),
                                   m_indices.begin() + iOff, m_indices.begin() + iOff + mi.indicesCount);
                 if (aOff + 8 <= m_aabbVertices.size())
@@ -324,6 +401,7 @@ namespace pe
 
         m_vertices = std::move(newVertices);
         m_positionUvs = std::move(newPosUvs);
+        m_packedVertices = std::move(newPacked);
         m_indices = std::move(newIndices);
         m_aabbVertices = std::move(newAabbVerts);
 
@@ -10,6 +10,19 @@ namespace pe
     class Sampler;
     class CommandBuffer;
     class Image;
+    struct DecodedPixels;
+
+    // Discrete LOD chain of one mesh. Level 0 is the mesh's own index range; the simplified levels
+    // index the same vertices and live in ModelAsset::GetLodIndices(). error is each level's
+    // object-space deviation from the full mesh (model units), which the cull shader projects to pixels.
+    struct MeshLods
+    {
+        static constexpr uint32_t kMaxLods = 4; // == Mesh::kMaxLods
+        uint32_t count = 1;
+        uint32_t indexOffset[kMaxLods] = {0, 0, 0, 0};
+        uint32_t indexCount[kMaxLods] = {0, 0, 0, 0};
+        float error[kMaxLods] = {0.0f, 0.0f, 0.0f, 0.0f};
+    };
 
     struct MeshInfo
     {
@@ -24,6 +37,8 @@ namespace pe
         // First-class material reference (shared across meshes with same material)
         Material *material = nullptr;
         bool skinned = false;
+
+        MeshLods lods; // valid when the model HasBakedLods()
     };
 
     struct NodeInfo
@@ -55,7 +70,10 @@ namespace pe
         // Removes a node and its subtree. Returns true if the model is now empty (caller should delete it).
         bool RemoveNode(int nodeIndex);
 
-        ResourceHandle<Image> LoadTexture(CommandBuffer *cmd, const std::filesystem::path &texturePath);
+        // fileData: the texture file's bytes when the caller already read them (prefetch); empty reads the file.
+        // decoded: the same file already decoded off-thread (Image::DecodeRGBA8); skips the decode here.
+        ResourceHandle<Image> LoadTexture(CommandBuffer *cmd, const std::filesystem::path &texturePath,
+                                          std::span<const uint8_t> fileData = {}, const DecodedPixels *decoded = nullptr);
 
         // Embedded textures (e.g. inside a .glb) have no source file on disk. The cook calls this to
         // recover the ORIGINAL encoded bytes (PNG/JPG) so it can write them next to the .pemesh and
@@ -71,13 +89,28 @@ namespace pe
             return false;
         }
 
+        // The file a material slot samples, as the cook records it: the bound image's source path, or
+        // the aiScene id ("*N") of an embedded texture. Empty when the slot has no texture. The base
+        // reads the slot's Image; ModelAssetAssimp's GPU-free cook import answers without one.
+        virtual std::string GetTextureSource(const Material &material, int slot) const;
+
         // Getters
         size_t GetId() const { return m_id; }
 
         const std::vector<Vertex> &GetVertices() const { return m_vertices; }
         const std::vector<PositionUvVertex> &GetPositionUvs() const { return m_positionUvs; }
+        // Cooked models only: the quantized vertices as loaded, parallel to GetVertices()
+        const std::vector<PackedVertex> &GetPackedVertices() const { return m_packedVertices; }
+        bool HasPackedVertices() const { return !m_packedVertices.empty() && m_packedVertices.size() == m_vertices.size(); }
         const std::vector<AabbVertex> &GetAabbVertices() const { return m_aabbVertices; }
         const std::vector<uint32_t> &GetIndices() const { return m_indices; }
+        const std::vector<uint32_t> &GetLodIndices() const { return m_lodIndices; }
+        bool HasBakedLods() const { return m_lodsBaked; }
+
+        // Simplifies every eligible mesh (non-skinned, 256+ indices) into up to maxLods levels with
+        // meshopt_simplify; lods gets one chain per mesh, lodIndices the simplified index lists. The cook
+        // bakes these into the .pemesh; Scene only calls it for models loaded without baked levels.
+        void BuildLods(uint32_t maxLods, std::vector<MeshLods> &lods, std::vector<uint32_t> &lodIndices) const;
 
         const std::vector<ResourceHandle<Image>> &GetImages() const { return m_images; }
         const std::vector<Sampler *> &GetSamplers() const { return m_samplers; }
@@ -180,8 +213,11 @@ namespace pe
 
         std::vector<Vertex> m_vertices;
         std::vector<PositionUvVertex> m_positionUvs;
+        std::vector<PackedVertex> m_packedVertices;
         std::vector<AabbVertex> m_aabbVertices;
         std::vector<uint32_t> m_indices;
+        std::vector<uint32_t> m_lodIndices; // simplified levels referenced by MeshInfo::lods
+        bool m_lodsBaked = false;
 
         mat4 m_matrix = mat4(1.f);
 
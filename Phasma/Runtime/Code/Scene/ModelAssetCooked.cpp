@@ -1,8 +1,10 @@
 #include "Scene/ModelAssetCooked.h"
+#include <meshoptimizer.h> // vertex codec for the quantized vertex stream
 #include "Scene/ModelAsset.h"
 #include "Scene/Material.h"
 #include "Scene/PassInfoAsset.h"
 #include "API/Command.h"
+#include "API/CookedTexture.h"
 #include "API/Image.h"
 #include "API/Queue.h"
 #include "API/RHI.h"
@@ -16,18 +18,34 @@ namespace pe
         // are both little-endian with identical IEEE-754 float and natural POD alignment, so the
         // vertex/index/aabb streams are a straight blit on both. The sizeof guards in the header catch
         // any future struct-layout change so a stale cooked file fails loudly instead of corrupting.
+        // v4 adds the quantized vertex stream; v3 files (float streams only) still load.
         constexpr char kMagic[4] = {'P', 'E', 'M', 'S'};
-        constexpr uint32_t kVersion = 3;
+        constexpr uint32_t kVersion = 4;
+        constexpr uint32_t kMinVersion = 3;
         constexpr int kTextureSlotCount = 5;
 
         static_assert(static_cast<int>(TextureType::Emissive) + 1 == kTextureSlotCount);
 
+        // How each material slot's texture is cooked (indexed by TextureType)
+        constexpr TextureUsage kSlotUsage[kTextureSlotCount] = {
+            TextureUsage::Color,  // BaseColor
+            TextureUsage::Linear, // MetallicRoughness
+            TextureUsage::Normal, // Normal
+            TextureUsage::Mask,   // Occlusion
+            TextureUsage::Color,  // Emissive
+        };
+
         enum StreamFormat : uint32_t
         {
             Stream_PbrVertex = 0,   // Vertex            (gbuffer / PBR)
             Stream_ShadowPosUv = 1, // PositionUvVertex  (depth / shadows)
             Stream_AabbVertex = 2,  // AabbVertex        (debug bounds)
             Stream_IndexU32 = 3,    // uint32_t          (index buffer)
+            // QuantizedVertex through the meshopt vertex codec; expands to both Vertex and
+            // PositionUvVertex on load, so a file carrying it has no Stream_PbrVertex/ShadowPosUv
+            Stream_PbrVertexQuantized = 4,
+            Stream_MeshLod = 5,     // MeshLodRecord     (one per mesh, baked LOD chain)
+            Stream_LodIndexU32 = 6, // uint32_t          (LOD 1+ index ranges, see MeshLodRecord)
         };
 
 #pragma pack(push, 1)
@@ -55,6 +73,10 @@ namespace pe
             uint32_t byteLength;
         };
 
+        // 40 bytes against 96 + 52 for the float Vertex and PositionUvVertex it replaces on disk; the
+        // same bytes are uploaded as the mesh's GPU vertex stream (see PackedVertex)
+        using QuantizedVertex = PackedVertex;
+
         struct MeshRecord
         {
             uint32_t vertexOffset;
@@ -71,6 +93,15 @@ namespace pe
             int32_t materialIndex;
         };
 
+        // Level 0 repeats the mesh's own index range; levels 1+ are offsets into Stream_LodIndexU32
+        struct MeshLodRecord
+        {
+            uint32_t count;
+            uint32_t indexOffset[MeshLods::kMaxLods];
+            uint32_t indexCount[MeshLods::kMaxLods];
+            float error[MeshLods::kMaxLods];
+        };
+
         struct MaterialScalarRecord
         {
             float baseColorFactor[4];
@@ -91,7 +122,9 @@ namespace pe
         };
 #pragma pack(pop)
 
+        static_assert(sizeof(MeshLodRecord) == 52);
         static_assert(sizeof(MaterialScalarRecord) == 85);
+        static_assert(sizeof(QuantizedVertex) == 40 && sizeof(QuantizedVertex) % 4 == 0); // codec needs 4-byte multiples
 
         // Animation keyframe arrays are raw-blitted; guard that memcpy is valid. The glm aligned
         // layout is identical on x86-64 and arm64 (same as the vertex streams), so the blit is portable.
@@ -198,6 +231,128 @@ namespace pe
             return true;
         }
 
+        // --- quantized vertex stream ---
+        // Half-float UVs are exact to 1/2048 (half a texel of a 1k texture) while |uv| < 2; models with
+        // larger UVs keep the float streams rather than lose texel precision
+        constexpr float kMaxUvError = 1.0f / 2048.0f;
+
+        vec3 OctDecode(float x, float y)
+        {
+            vec3 n(x, y, 1.0f - std::abs(x) - std::abs(y));
+            const float t = std::max(-n.z, 0.0f);
+            n.x += n.x >= 0.0f ? -t : t;
+            n.y += n.y >= 0.0f ? -t : t;
+            return glm::normalize(n);
+        }
+
+        // Projects onto the octahedron, then keeps whichever of the four surrounding snorm16 codes
+        // decodes closest to the input. A zero vector encodes as +Z.
+        void OctEncode(float x, float y, float z, int16_t out[2])
+        {
+            out[0] = out[1] = 0;
+            const float l1 = std::abs(x) + std::abs(y) + std::abs(z);
+            if (!(l1 > 0.0f))
+                return;
+
+            const vec3 n = vec3(x, y, z) / l1;
+            vec2 p(n.x, n.y);
+            if (n.z < 0.0f)
+                p = (1.0f - glm::abs(vec2(p.y, p.x))) * vec2(p.x >= 0.0f ? 1.0f : -1.0f, p.y >= 0.0f ? 1.0f : -1.0f);
+
+            const vec3 target = glm::normalize(vec3(x, y, z));
+            float best = -2.0f;
+            for (int i = 0; i < 4; ++i)
+            {
+                const float qx = std::clamp((i & 1) ? std::ceil(p.x * 32767.0f) : std::floor(p.x * 32767.0f), -32767.0f, 32767.0f);
+                const float qy = std::clamp((i & 2) ? std::ceil(p.y * 32767.0f) : std::floor(p.y * 32767.0f), -32767.0f, 32767.0f);
+                const float d = glm::dot(OctDecode(qx / 32767.0f, qy / 32767.0f), target);
+                if (d > best)
+                {
+                    best = d;
+                    out[0] = static_cast<int16_t>(qx);
+                    out[1] = static_cast<int16_t>(qy);
+                }
+            }
+        }
+
+        // Fails (and the writer falls back to the float streams) when a value does not fit the
+        // quantized layout or the shadow stream is not the vertex stream's position/uv/skin subset
+        bool QuantizeVertices(const std::vector<Vertex> &vertices, const std::vector<PositionUvVertex> &posUvs,
+                              std::vector<QuantizedVertex> &out)
+        {
+            if (posUvs.size() != vertices.size())
+                return false;
+
+            out.resize(vertices.size());
+            for (size_t i = 0; i < vertices.size(); ++i)
+            {
+                const Vertex &v = vertices[i];
+                const PositionUvVertex &pv = posUvs[i];
+                if (std::memcmp(v.position, pv.position, sizeof(v.position)) != 0 ||
+                    std::memcmp(v.uv, pv.uv, sizeof(v.uv)) != 0 ||
+                    std::memcmp(v.joints, pv.joints, sizeof(v.joints)) != 0 ||
+                    std::memcmp(v.weights, pv.weights, sizeof(v.weights)) != 0)
+                    return false;
+
+                QuantizedVertex &q = out[i];
+                std::memcpy(q.position, v.position, sizeof(q.position));
+                for (int c = 0; c < 2; ++c)
+                {
+                    q.uv[c] = meshopt_quantizeHalf(v.uv[c]);
+                    if (!(std::abs(meshopt_dequantizeHalf(q.uv[c]) - v.uv[c]) <= kMaxUvError))
+                        return false;
+                }
+
+                OctEncode(v.normals[0], v.normals[1], v.normals[2], q.normal);
+                OctEncode(v.tangent[0], v.tangent[1], v.tangent[2], q.tangent);
+                q.tangent[1] = static_cast<int16_t>((q.tangent[1] & ~1) | (v.tangent[3] < 0.0f ? 1 : 0));
+
+                for (int c = 0; c < 4; ++c)
+                {
+                    if (!(v.color[c] >= 0.0f && v.color[c] <= 1.0f) || v.joints[c] > 255u ||
+                        !(v.weights[c] >= 0.0f && v.weights[c] <= 1.0f))
+                        return false;
+                    q.color[c] = static_cast<uint8_t>(meshopt_quantizeUnorm(v.color[c], 8));
+                    q.joints[c] = static_cast<uint8_t>(v.joints[c]);
+                    q.weights[c] = static_cast<uint16_t>(meshopt_quantizeUnorm(v.weights[c], 16));
+                }
+            }
+            return true;
+        }
+
+        // The float copies serve CPU users (physics, LOD rebuilds, re-saving); the GPU takes the packed
+        // stream the model keeps alongside them.
+        void DequantizeVertices(const std::vector<QuantizedVertex> &in, std::vector<Vertex> &vertices,
+                                std::vector<PositionUvVertex> &posUvs)
+        {
+            vertices.resize(in.size());
+            posUvs.resize(in.size());
+            for (size_t i = 0; i < in.size(); ++i)
+            {
+                const QuantizedVertex &q = in[i];
+                Vertex &v = vertices[i];
+                PositionUvVertex &pv = posUvs[i];
+
+                std::memcpy(v.position, q.position, sizeof(v.position));
+                v.uv[0] = meshopt_dequantizeHalf(q.uv[0]);
+                v.uv[1] = meshopt_dequantizeHalf(q.uv[1]);
+
+                const vec3 n = OctDecode(q.normal[0] / 32767.0f, q.normal[1] / 32767.0f);
+                const vec3 t = OctDecode(q.tangent[0] / 32767.0f, (q.tangent[1] & ~1) / 32767.0f);
+                FillVertexNormal(v, n.x, n.y, n.z);
+                FillVertexTangent(v, t.x, t.y, t.z, (q.tangent[1] & 1) ? -1.0f : 1.0f);
+                FillVertexColor(v, q.color[0] / 255.0f, q.color[1] / 255.0f, q.color[2] / 255.0f, q.color[3] / 255.0f);
+                FillVertexJointsWeights(v, q.joints[0], q.joints[1], q.joints[2], q.joints[3],
+                                        q.weights[0] / 65535.0f, q.weights[1] / 65535.0f,
+                                        q.weights[2] / 65535.0f, q.weights[3] / 65535.0f);
+
+                std::memcpy(pv.position, v.position, sizeof(pv.position));
+                std::memcpy(pv.uv, v.uv, sizeof(pv.uv));
+                std::memcpy(pv.joints, v.joints, sizeof(pv.joints));
+                std::memcpy(pv.weights, v.weights, sizeof(pv.weights));
+            }
+        }
+
         std::string PathToUtf8String(const std::filesystem::path &path)
         {
             auto pathU8 = path.u8string();
@@ -209,11 +364,6 @@ namespace pe
             return std::filesystem::path(reinterpret_cast<const char8_t *>(path.c_str()));
         }
 
-        uint32_t TextureMaskBit(int slot)
-        {
-            return 1u << static_cast<uint32_t>(slot);
-        }
-
         bool IsPortableRelativePath(const std::filesystem::path &path)
         {
             if (path.empty() || path.is_absolute())
@@ -224,11 +374,6 @@ namespace pe
             return it != normalized.end() && *it != "..";
         }
 
-        bool IsEmbeddedTextureName(const std::string &name)
-        {
-            return name.empty() || name[0] == '*' || name.rfind("Embedded_", 0) == 0;
-        }
-
         std::filesystem::path NormalizeExistingPath(const std::filesystem::path &path)
         {
             std::error_code ec;
@@ -296,10 +441,82 @@ namespace pe
             return true;
         }
 
+        // A file bound to several slots is cooked once, for the most demanding of them: normal maps
+        // keep their XY format, colour beats linear data, and an occlusion map packed into a
+        // metallic-roughness texture (glTF ORM) keeps the channels the other slot reads.
+        int UsageRank(TextureUsage usage)
+        {
+            switch (usage)
+            {
+            case TextureUsage::Normal:
+                return 3;
+            case TextureUsage::Color:
+                return 2;
+            case TextureUsage::Linear:
+                return 1;
+            default:
+                return 0;
+            }
+        }
+
+        // Models cooked in parallel (PhasmaCook --batch) often share texture files. One writer per
+        // destination at a time; the others then find its output fresh and skip the encode.
+        std::mutex &TextureWriteMutex(const std::filesystem::path &dstPath)
+        {
+            static std::mutex s_mutexes[32];
+            return s_mutexes[Fnv1a64(PathToUtf8String(dstPath)) % std::size(s_mutexes)];
+        }
+
+        // Writes the BC .petex at dstPath and its ASTC sibling. `encoded` turns false when the source
+        // is not an image stb decodes (DDS, already cooked); the caller then ships the source as is.
+        bool WriteCookedTexture(std::span<const uint8_t> source, TextureUsage usage,
+                                const std::filesystem::path &dstPath, bool &encoded)
+        {
+            encoded = true;
+            for (TextureTarget target : {TextureTarget::BC, TextureTarget::ASTC})
+            {
+                std::vector<uint8_t> cooked;
+                std::string reason;
+                if (!CookedTexture::Encode(source, usage, target, cooked, reason))
+                {
+                    encoded = false;
+                    return true;
+                }
+
+                const std::filesystem::path variant = target == TextureTarget::BC ? dstPath : CookedTexture::AstcPath(dstPath);
+                FileSystem out(PathToUtf8String(variant), std::ios::out | std::ios::trunc | std::ios::binary);
+                if (!out.IsOpen())
+                {
+                    PE_WARN("[ModelAssetCooked] Failed to write cooked texture '%s'", PathToUtf8String(variant).c_str());
+                    return false;
+                }
+                out.Write(reinterpret_cast<const char *>(cooked.data()), cooked.size());
+            }
+            return true;
+        }
+
+        // Both variants exist and are newer than the source, so a re-cook of the model skips encoding
+        bool IsCookedTextureFresh(const std::filesystem::path &sourcePath, const std::filesystem::path &dstPath)
+        {
+            std::error_code ec;
+            const auto sourceTime = std::filesystem::last_write_time(sourcePath, ec);
+            if (ec)
+                return false;
+
+            for (const std::filesystem::path &variant : {dstPath, CookedTexture::AstcPath(dstPath)})
+            {
+                const auto cookedTime = std::filesystem::last_write_time(variant, ec);
+                if (ec || cookedTime < sourceTime)
+                    return false;
+            }
+            return true;
+        }
+
         // Embedded textures (.glb) have no source file; recover the original encoded bytes from the
-        // model and write them next to the .pemesh so the slot resolves like any external texture.
+        // model and cook them next to the .pemesh so the slot resolves like any external texture.
         std::string SerializeEmbeddedTexture(const ModelAsset &model,
                                              const std::string &imageName,
+                                             TextureUsage usage,
                                              const std::filesystem::path &outputDir,
                                              const std::string &stem,
                                              std::unordered_map<std::string, std::string> &written)
@@ -317,32 +534,46 @@ namespace pe
                 return {};
             }
 
-            // Deterministic sibling file: <stem>_embedded<N>.<ext>  (imageName is "*N").
+            // Deterministic sibling file: <stem>_embedded<N>.<usage>.petex  (imageName is "*N").
             std::string suffix = imageName;
             suffix.erase(0, 1);
-            const std::filesystem::path relPath = stem + "_embedded" + suffix + "." + ext;
-            const std::filesystem::path dstPath = outputDir / relPath;
+            const std::filesystem::path rawPath = stem + "_embedded" + suffix + "." + ext;
+            std::filesystem::path relPath = CookedTexture::CookedPath(rawPath, usage);
 
             std::error_code ec;
-            std::filesystem::create_directories(dstPath.parent_path(), ec);
+            std::filesystem::create_directories((outputDir / relPath).parent_path(), ec);
 
-            FileSystem out(PathToUtf8String(dstPath), std::ios::out | std::ios::trunc | std::ios::binary);
-            if (!out.IsOpen())
+            bool encoded = true;
+            if (!WriteCookedTexture(bytes, usage, outputDir / relPath, encoded))
             {
-                PE_WARN("[ModelAssetCooked] Failed to write embedded texture '%s'",
-                        PathToUtf8String(dstPath).c_str());
                 written[imageName] = {};
                 return {};
             }
-            out.Write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+
+            if (!encoded)
+            {
+                relPath = rawPath;
+                const std::filesystem::path dstPath = outputDir / relPath;
+                FileSystem out(PathToUtf8String(dstPath), std::ios::out | std::ios::trunc | std::ios::binary);
+                if (!out.IsOpen())
+                {
+                    PE_WARN("[ModelAssetCooked] Failed to write embedded texture '%s'",
+                            PathToUtf8String(dstPath).c_str());
+                    written[imageName] = {};
+                    return {};
+                }
+                out.Write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+            }
 
             const std::string rel = relPath.generic_string();
             written[imageName] = rel;
             return rel;
         }
 
-        std::string SerializeTexturePath(const Material &material,
+        // source: ModelAsset::GetTextureSource for the slot
+        std::string SerializeTexturePath(const std::string &source,
                                          int slot,
+                                         const std::unordered_map<std::string, TextureUsage> &textureUsage,
                                          const std::filesystem::path &sourceDir,
                                          const std::filesystem::path &outputDir,
                                          const ModelAsset &model,
@@ -350,27 +581,20 @@ namespace pe
                                          std::unordered_map<std::string, std::string> &embeddedWritten,
                                          bool &ok)
         {
-            if ((material.textureMask & TextureMaskBit(slot)) == 0)
-                return {};
-
-            Image *image = material.textures[slot].get();
-            if (!image)
+            if (source.empty())
                 return {};
 
-            const std::string &imageName = image->GetName();
-            if (IsEmbeddedTextureName(imageName))
-            {
-                // Embedded textures carry their aiScene index in the resource id ("*N"); the display
-                // name is empty. Use the id so the model can recover the original encoded bytes.
-                return SerializeEmbeddedTexture(model, image->GetResourceId(), outputDir, stem, embeddedWritten);
-            }
+            // Embedded textures are "*N" so the model can recover the original encoded bytes
+            const TextureUsage usage = textureUsage.at(source);
+            if (source[0] == '*')
+                return SerializeEmbeddedTexture(model, source, usage, outputDir, stem, embeddedWritten);
 
-            std::filesystem::path texturePath = NormalizeExistingPath(PathFromUtf8String(imageName));
+            std::filesystem::path texturePath = NormalizeExistingPath(PathFromUtf8String(source));
             std::error_code ec;
             if (!std::filesystem::is_regular_file(texturePath, ec) && !HasGamePackAsset(texturePath))
             {
                 PE_WARN("[ModelAssetCooked] Texture path is not a file, deferring slot %d: %s",
-                        slot, imageName.c_str());
+                        slot, source.c_str());
                 return {};
             }
 
@@ -378,6 +602,37 @@ namespace pe
             if (relativePath.empty())
                 return {};
 
+            const std::filesystem::path cookedRelativePath = CookedTexture::CookedPath(relativePath, usage);
+            const std::filesystem::path cookedPath = outputDir / cookedRelativePath;
+            std::lock_guard<std::mutex> lock(TextureWriteMutex(cookedPath));
+            if (IsCookedTextureFresh(texturePath, cookedPath))
+                return cookedRelativePath.generic_string();
+
+            std::filesystem::create_directories(cookedPath.parent_path(), ec);
+            if (ec)
+            {
+                PE_WARN("[ModelAssetCooked] Failed to create texture directory '%s': %s",
+                        PathToUtf8String(cookedPath.parent_path()).c_str(), ec.message().c_str());
+                ok = false;
+                return {};
+            }
+
+            FileView sourceFile(PathToUtf8String(texturePath));
+            if (!sourceFile.IsOpen())
+            {
+                PE_WARN("[ModelAssetCooked] Failed to read texture '%s'", PathToUtf8String(texturePath).c_str());
+                ok = false;
+                return {};
+            }
+
+            bool encoded = true;
+            ok = WriteCookedTexture(sourceFile.Bytes(), usage, cookedPath, encoded);
+            if (!ok)
+                return {};
+            if (encoded)
+                return cookedRelativePath.generic_string();
+
+            // Already GPU-ready (DDS) or nothing stb decodes: ship the file itself
             ok = CopyCookedTexture(texturePath, outputDir, relativePath);
             if (!ok)
                 return {};
@@ -434,7 +689,7 @@ namespace pe
 
         // Default white/normal material, mirroring Primitives::CreatePrimitiveModel so a cooked model
         // has valid shader inputs even when a serialized texture is missing or deferred.
-        std::unique_ptr<Material> MakeDefaultMaterial(CommandBuffer *cmd)
+        std::unique_ptr<Material> MakeDefaultMaterial(CommandBuffer *cmd, const ResourceHandle<PassInfoAsset> &passInfo = {})
         {
             auto &defaults = ModelAsset::GetDefaultResources(cmd);
             auto mat = std::make_unique<Material>();
@@ -450,6 +705,7 @@ namespace pe
             mat->metallic = 0.f;
             mat->roughness = 1.f;
             mat->occlusionStrength = 1.f;
+            mat->passInfoAsset = passInfo;
             if (!mat->passInfoAsset)
                 mat->passInfoAsset = ResourceManager::Get().Load<PassInfoAsset>(Path::RuntimeAssets + "PassInfo/standard_pbr.pass");
             mat->SyncParamsFromLegacy();
@@ -465,7 +721,13 @@ namespace pe
         return ext == kExtension;
     }
 
-    bool ModelAssetCooked::WriteToFile(const ModelAsset *model, const std::filesystem::path &file)
+    uint32_t ModelAssetCooked::GetFormatVersion()
+    {
+        return kVersion;
+    }
+
+    bool ModelAssetCooked::WriteToFile(const ModelAsset *model, const std::filesystem::path &file,
+                                       std::vector<std::filesystem::path> *textureFiles)
     {
         if (!model)
             return false;
@@ -499,6 +761,42 @@ namespace pe
         for (size_t i = 0; i < materials.size(); i++)
             materialIndex[materials[i].get()] = static_cast<int32_t>(i);
 
+        // Quantized and codec-compressed when every vertex fits the layout, float streams otherwise
+        std::vector<QuantizedVertex> quantized;
+        std::vector<uint8_t> encodedVertices;
+        if (QuantizeVertices(vertices, posUvs, quantized))
+        {
+            encodedVertices.resize(meshopt_encodeVertexBufferBound(quantized.size(), sizeof(QuantizedVertex)));
+            encodedVertices.resize(meshopt_encodeVertexBuffer(encodedVertices.data(), encodedVertices.size(),
+                                                              quantized.data(), quantized.size(), sizeof(QuantizedVertex)));
+        }
+        const bool quantize = !encodedVertices.empty();
+
+        // LOD chains are baked here so loading a .pemesh never runs the simplifier
+        std::vector<MeshLods> lods;
+        std::vector<uint32_t> lodIndices;
+        if (model->HasBakedLods())
+        {
+            for (const MeshInfo &mi : meshInfos)
+                lods.push_back(mi.lods);
+            lodIndices = model->GetLodIndices();
+        }
+        else
+        {
+            model->BuildLods(MeshLods::kMaxLods, lods, lodIndices);
+        }
+        std::vector<MeshLodRecord> lodRecords(lods.size());
+        for (size_t i = 0; i < lods.size(); i++)
+        {
+            lodRecords[i].count = lods[i].count;
+            for (uint32_t l = 0; l < MeshLods::kMaxLods; l++)
+            {
+                lodRecords[i].indexOffset[l] = lods[i].indexOffset[l];
+                lodRecords[i].indexCount[l] = lods[i].indexCount[l];
+                lodRecords[i].error[l] = lods[i].error[l];
+            }
+        }
+
         ByteWriter w;
 
         Header header{};
@@ -508,7 +806,7 @@ namespace pe
         header.sizeofVertex = static_cast<uint32_t>(sizeof(Vertex));
         header.sizeofPositionUv = static_cast<uint32_t>(sizeof(PositionUvVertex));
         header.sizeofAabbVertex = static_cast<uint32_t>(sizeof(AabbVertex));
-        header.streamCount = 4;
+        header.streamCount = (quantize ? 3 : 4) + 2;
         header.meshCount = static_cast<uint32_t>(meshInfos.size());
         header.nodeCount = static_cast<uint32_t>(nodeInfos.size());
         header.materialCount = static_cast<uint32_t>(materials.size());
@@ -525,16 +823,36 @@ namespace pe
             d.byteLength = static_cast<uint32_t>(stride * count);
             return d;
         };
-        w.Pod(streamDesc(Stream_PbrVertex, sizeof(Vertex), vertices.size()));
-        w.Pod(streamDesc(Stream_ShadowPosUv, sizeof(PositionUvVertex), posUvs.size()));
+        if (quantize)
+        {
+            StreamDesc d = streamDesc(Stream_PbrVertexQuantized, sizeof(QuantizedVertex), quantized.size());
+            d.byteLength = static_cast<uint32_t>(encodedVertices.size());
+            w.Pod(d);
+        }
+        else
+        {
+            w.Pod(streamDesc(Stream_PbrVertex, sizeof(Vertex), vertices.size()));
+            w.Pod(streamDesc(Stream_ShadowPosUv, sizeof(PositionUvVertex), posUvs.size()));
+        }
         w.Pod(streamDesc(Stream_AabbVertex, sizeof(AabbVertex), aabbs.size()));
         w.Pod(streamDesc(Stream_IndexU32, sizeof(uint32_t), indices.size()));
+        w.Pod(streamDesc(Stream_MeshLod, sizeof(MeshLodRecord), lodRecords.size()));
+        w.Pod(streamDesc(Stream_LodIndexU32, sizeof(uint32_t), lodIndices.size()));
 
-        // GPU-ready blobs, in stream-descriptor order.
-        w.Raw(vertices.data(), vertices.size() * sizeof(Vertex));
-        w.Raw(posUvs.data(), posUvs.size() * sizeof(PositionUvVertex));
+        // Blobs, in stream-descriptor order.
+        if (quantize)
+        {
+            w.Raw(encodedVertices.data(), encodedVertices.size());
+        }
+        else
+        {
+            w.Raw(vertices.data(), vertices.size() * sizeof(Vertex));
+            w.Raw(posUvs.data(), posUvs.size() * sizeof(PositionUvVertex));
+        }
         w.Raw(aabbs.data(), aabbs.size() * sizeof(AabbVertex));
         w.Raw(indices.data(), indices.size() * sizeof(uint32_t));
+        w.Raw(lodRecords.data(), lodRecords.size() * sizeof(MeshLodRecord));
+        w.Raw(lodIndices.data(), lodIndices.size() * sizeof(uint32_t));
 
         // Mesh table.
         for (const MeshInfo &mi : meshInfos)
@@ -572,7 +890,24 @@ namespace pe
             w.String(ni.name);
         }
 
-        // Material table. MeshRecord::materialIndex points into this table.
+        // Material table. MeshRecord::materialIndex points into this table. Textures are cooked to
+        // .petex first, each file once, for the strongest usage any slot binds it with.
+        std::unordered_map<std::string, TextureUsage> textureUsage;
+        for (const auto &materialPtr : materials)
+        {
+            if (!materialPtr)
+                continue;
+            for (int slot = 0; slot < kTextureSlotCount; slot++)
+            {
+                const std::string source = model->GetTextureSource(*materialPtr, slot);
+                if (source.empty())
+                    continue;
+                auto [it, inserted] = textureUsage.emplace(source, kSlotUsage[slot]);
+                if (!inserted && UsageRank(kSlotUsage[slot]) > UsageRank(it->second))
+                    it->second = kSlotUsage[slot];
+            }
+        }
+
         const std::string stem = PathToUtf8String(path.stem());
         std::unordered_map<std::string, std::string> embeddedWritten; // dedup embedded-texture writes
         for (const auto &materialPtr : materials)
@@ -586,10 +921,23 @@ namespace pe
             {
                 bool copyOk = true;
                 const std::string relPath =
-                    SerializeTexturePath(material, slot, sourceDir, outputDir, *model, stem, embeddedWritten, copyOk);
+                    SerializeTexturePath(model->GetTextureSource(material, slot), slot, textureUsage, sourceDir, outputDir,
+                                         *model, stem, embeddedWritten, copyOk);
                 if (!copyOk)
                     return false;
                 w.String(relPath);
+
+                if (textureFiles && !relPath.empty())
+                {
+                    const std::filesystem::path texturePath = (outputDir / PathFromUtf8String(relPath)).lexically_normal();
+                    if (std::find(textureFiles->begin(), textureFiles->end(), texturePath) == textureFiles->end())
+                    {
+                        textureFiles->push_back(texturePath);
+                        const std::filesystem::path astcPath = CookedTexture::AstcPath(texturePath);
+                        if (std::filesystem::is_regular_file(astcPath, ec))
+                            textureFiles->push_back(astcPath);
+                    }
+                }
             }
         }
 
@@ -652,15 +1000,21 @@ namespace pe
 
         auto pathU8 = file.u8string();
         std::string pathStr(reinterpret_cast<const char *>(pathU8.c_str()));
-        FileSystem in(pathStr);
+        // Parsed straight out of the mapped file (or pack entry); the streams are copied once, into the model
+        FileView in(pathStr);
         if (!in.IsOpen())
         {
             PE_WARN("[ModelAssetCooked] Failed to open: %s", pathStr.c_str());
             return nullptr;
         }
-        std::vector<uint8_t> blob = in.ReadAllBytes();
+        return LoadFromMemory(in.Bytes(), file);
+    }
 
-        ByteReader r{blob.data(), blob.size()};
+    ModelAsset *ModelAssetCooked::LoadFromMemory(std::span<const uint8_t> bytes, const std::filesystem::path &file)
+    {
+        auto pathU8 = file.u8string();
+        std::string pathStr(reinterpret_cast<const char *>(pathU8.c_str()));
+        ByteReader r{bytes.data(), bytes.size()};
         Header header{};
         if (!r.Pod(header))
         {
@@ -672,10 +1026,10 @@ namespace pe
             PE_WARN("[ModelAssetCooked] Bad magic for %s", pathStr.c_str());
             return nullptr;
         }
-        if (header.version != kVersion)
+        if (header.version < kMinVersion || header.version > kVersion)
         {
-            PE_WARN("[ModelAssetCooked] Unsupported version (got v%u, expected v%u) for %s; re-cook required",
-                    header.version, kVersion, pathStr.c_str());
+            PE_WARN("[ModelAssetCooked] Unsupported version (got v%u, expected v%u..v%u) for %s; re-cook required",
+                    header.version, kMinVersion, kVersion, pathStr.c_str());
             return nullptr;
         }
         if (header.sizeofVertex != sizeof(Vertex) ||
@@ -695,6 +1049,7 @@ namespace pe
             }
 
         ModelAsset *model = new ModelAsset();
+        std::vector<MeshLodRecord> lodRecords;
 
         // Stream blobs, in descriptor order.
         for (const StreamDesc &s : streams)
@@ -718,6 +1073,20 @@ namespace pe
                 if (s.count)
                     std::memcpy(model->m_positionUvs.data(), p, s.byteLength);
                 break;
+            case Stream_PbrVertexQuantized:
+            {
+                std::vector<QuantizedVertex> quantized(s.count);
+                if (s.stride != sizeof(QuantizedVertex) ||
+                    meshopt_decodeVertexBuffer(quantized.data(), quantized.size(), sizeof(QuantizedVertex), p, s.byteLength) != 0)
+                {
+                    PE_WARN("[ModelAssetCooked] Corrupt quantized vertex stream: %s", pathStr.c_str());
+                    delete model;
+                    return nullptr;
+                }
+                DequantizeVertices(quantized, model->m_vertices, model->m_positionUvs);
+                model->m_packedVertices = std::move(quantized);
+                break;
+            }
             case Stream_AabbVertex:
                 model->m_aabbVertices.resize(s.count);
                 if (s.count)
@@ -728,6 +1097,18 @@ namespace pe
                 if (s.count)
                     std::memcpy(model->m_indices.data(), p, s.byteLength);
                 break;
+            case Stream_MeshLod:
+                if (s.stride != sizeof(MeshLodRecord) || s.byteLength != s.count * sizeof(MeshLodRecord))
+                    break; // treated as unbaked below
+                lodRecords.resize(s.count);
+                if (s.count)
+                    std::memcpy(lodRecords.data(), p, s.byteLength);
+                break;
+            case Stream_LodIndexU32:
+                model->m_lodIndices.resize(s.count);
+                if (s.count)
+                    std::memcpy(model->m_lodIndices.data(), p, s.byteLength);
+                break;
             default:
                 break; // unknown stream: skip (already advanced cursor)
             }
@@ -761,6 +1142,42 @@ namespace pe
             meshMaterialIndices[i] = rec.materialIndex;
         }
 
+        // Baked LOD chains (cooks carrying Stream_MeshLod). Anything inconsistent drops them all and Scene simplifies at load.
+        if (!lodRecords.empty())
+        {
+            bool valid = lodRecords.size() == header.meshCount;
+            for (uint32_t i = 0; valid && i < header.meshCount; i++)
+            {
+                const MeshLodRecord &rec = lodRecords[i];
+                const MeshInfo &mi = model->m_meshInfos[i];
+                valid = rec.count >= 1 && rec.count <= MeshLods::kMaxLods &&
+                        rec.indexOffset[0] == mi.indexOffset && rec.indexCount[0] == mi.indicesCount;
+                for (uint32_t l = 1; valid && l < rec.count; l++)
+                    valid = static_cast<uint64_t>(rec.indexOffset[l]) + rec.indexCount[l] <= model->m_lodIndices.size();
+            }
+            if (valid)
+            {
+                for (uint32_t i = 0; i < header.meshCount; i++)
+                {
+                    const MeshLodRecord &rec = lodRecords[i];
+                    MeshLods &lods = model->m_meshInfos[i].lods;
+                    lods.count = rec.count;
+                    for (uint32_t l = 0; l < MeshLods::kMaxLods; l++)
+                    {
+                        lods.indexOffset[l] = rec.indexOffset[l];
+                        lods.indexCount[l] = rec.indexCount[l];
+                        lods.error[l] = rec.error[l];
+                    }
+                }
+                model->m_lodsBaked = true;
+            }
+            else
+            {
+                PE_WARN("[ModelAssetCooked] Ignoring inconsistent LOD table in %s", pathStr.c_str());
+                model->m_lodIndices.clear();
+            }
+        }
+
         // Node table (parents resolved in a second pass; children derived from parents).
         std::vector<int32_t> parents(header.nodeCount, -1);
         for (uint32_t i = 0; i < header.nodeCount; i++)
@@ -875,17 +1292,30 @@ namespace pe
         CommandBuffer *cmd = queue->AcquireCommandBuffer();
         cmd->Begin();
 
+        // Stored-compressed textures are pure copies and go to the transfer queue; decoded ones need
+        // the compute mip generation and stay on the main queue with the rest of the setup.
+        Queue *transferQueue = RHII.GetTransferQueue();
+        CommandBuffer *transferCmd = transferQueue != queue ? transferQueue->AcquireCommandBuffer() : nullptr;
+        if (transferCmd)
+            transferCmd->Begin();
+
         model->ResetResources(cmd);
         model->m_materials.clear();
         model->m_materials.reserve(header.materialCount);
 
-        std::unordered_map<std::string, ResourceHandle<Image>> loadedTextures;
-        for (const CookedMaterialRecord &record : materialRecords)
+        // The shared pass info parses on a worker while the textures read, decode and upload. The model
+        // depends on it and waits for the whole tree before it is handed out.
+        ResourceHandle<PassInfoAsset> passInfo =
+            ResourceManager::Get().LoadAsync<PassInfoAsset>(Path::RuntimeAssets + "PassInfo/standard_pbr.pass");
+        model->AddDependency(passInfo.GetShared());
+
+        // Resolve every texture slot first, so all the model's texture files are read in one batch
+        // instead of one blocking read per material slot.
+        std::vector<std::array<std::string, kTextureSlotCount>> textureKeys(materialRecords.size());
+        std::unordered_map<std::string, IoHandle> textureReads;
+        for (size_t m = 0; m < materialRecords.size(); m++)
         {
-            auto material = MakeDefaultMaterial(cmd);
-            material->name = record.name.empty() ? "Cooked" : record.name;
-            ApplyScalarRecord(*material, record.scalars);
-
+            const CookedMaterialRecord &record = materialRecords[m];
             for (int slot = 0; slot < kTextureSlotCount; slot++)
             {
                 const std::string &relPathString = record.texturePaths[slot];
@@ -896,20 +1326,58 @@ namespace pe
                 if (!IsPortableRelativePath(relPath))
                 {
                     PE_WARN("[ModelAssetCooked] Ignoring non-relative texture path for material '%s': %s",
-                            material->name.c_str(), relPathString.c_str());
+                            record.name.c_str(), relPathString.c_str());
                     continue;
                 }
 
-                const std::filesystem::path texturePath = (file.parent_path() / relPath).lexically_normal();
+                // Cooked textures resolve to the block format this GPU samples (BC, or the ASTC sibling)
+                const std::filesystem::path texturePath =
+                    CookedTexture::ResolveVariant((file.parent_path() / relPath).lexically_normal());
                 if (!AssetFileExists(texturePath))
                 {
                     PE_WARN("[ModelAssetCooked] Missing texture for material '%s': %s",
-                            material->name.c_str(), PathToUtf8String(texturePath).c_str());
+                            record.name.c_str(), PathToUtf8String(texturePath).c_str());
                     continue;
                 }
 
-                const std::filesystem::path textureKeyPath = NormalizeExistingPath(texturePath);
-                const std::string textureKey = PathToUtf8String(textureKeyPath);
+                textureKeys[m][slot] = PathToUtf8String(NormalizeExistingPath(texturePath));
+                textureReads.emplace(textureKeys[m][slot], nullptr);
+            }
+        }
+
+        // Textures decode in parallel on the read completions; only the uploads stay on this thread.
+        // The map is filled before any read starts, so completions only write their own entry.
+        auto decoded = std::make_shared<std::unordered_map<std::string, DecodedPixels>>();
+        std::vector<IoRead> reads;
+        for (auto &[key, request] : textureReads)
+        {
+            if (!ResourceManager::Get().Find<Image>(key))
+            {
+                reads.push_back({key});
+                decoded->emplace(key, DecodedPixels{});
+            }
+        }
+        auto decode = [decoded](IoRequest &request)
+        {
+            if (request.GetStatus() == IoStatus::Done)
+                decoded->find(request.GetRead().path)->second = Image::DecodeRGBA8(request.Bytes());
+        };
+        for (IoHandle &request : IoService::Get().ReadBatch(std::move(reads), IoPriority::High, decode))
+            textureReads[request->GetRead().path] = std::move(request);
+
+        std::unordered_map<std::string, ResourceHandle<Image>> loadedTextures;
+        for (size_t m = 0; m < materialRecords.size(); m++)
+        {
+            const CookedMaterialRecord &record = materialRecords[m];
+            auto material = MakeDefaultMaterial(cmd, passInfo);
+            material->name = record.name.empty() ? "Cooked" : record.name;
+            ApplyScalarRecord(*material, record.scalars);
+
+            for (int slot = 0; slot < kTextureSlotCount; slot++)
+            {
+                const std::string &textureKey = textureKeys[m][slot];
+                if (textureKey.empty())
+                    continue;
 
                 ResourceHandle<Image> image;
                 auto it = loadedTextures.find(textureKey);
@@ -919,7 +1387,19 @@ namespace pe
                 }
                 else
                 {
-                    image = model->LoadTexture(cmd, textureKeyPath);
+                    std::span<const uint8_t> fileData;
+                    const DecodedPixels *pixels = nullptr;
+                    if (const IoHandle &request = textureReads[textureKey])
+                    {
+                        request->Wait();
+                        if (request->GetStatus() == IoStatus::Done)
+                        {
+                            fileData = request->Bytes();
+                            pixels = &decoded->at(textureKey);
+                        }
+                    }
+                    CommandBuffer *uploadCmd = transferCmd && Image::IsStoredCompressed(fileData) ? transferCmd : cmd;
+                    image = model->LoadTexture(uploadCmd, PathFromUtf8String(textureKey), fileData, pixels);
                     loadedTextures[textureKey] = image;
                 }
 
@@ -933,10 +1413,32 @@ namespace pe
             model->m_materials.push_back(std::move(material));
         }
 
+        if (transferCmd)
+        {
+            transferCmd->End();
+            transferQueue->Submit(1, &transferCmd, nullptr, nullptr);
+            queue->WaitForQueue(transferQueue, transferQueue->GetSubmissionCount(),
+                                PE_STAGE_FRAGMENT_SHADER | PE_STAGE_COMPUTE_SHADER);
+        }
+
         cmd->End();
         queue->Submit(1, &cmd, nullptr, nullptr);
         cmd->Wait();
         cmd->Return();
+        if (transferCmd)
+        {
+            transferCmd->Wait();
+            transferCmd->Return();
+        }
+
+        // Fails the same way the synchronous pass info load did
+        model->Wait();
+        if (!model->IsReady())
+        {
+            std::exception_ptr error = passInfo->GetLoadError();
+            delete model;
+            std::rethrow_exception(error);
+        }
 
         for (uint32_t i = 0; i < header.meshCount; i++)
         {
@@ -1,5 +1,6 @@
 #pragma once
 #include <filesystem>
+#include <span>
 
 namespace pe
 {
@@ -7,15 +8,18 @@ namespace pe
 
     // Cooked-mesh (".pemesh") pipeline.
     //
-    // A ".pemesh" file stores a model's geometry in the *exact* byte layout the engine uploads to
-    // the GPU: meshopt-optimized vertex/index/aabb streams plus the per-mesh, per-node, and material
-    // tables. "Cooked" means there is no Assimp, meshoptimizer, tangent, or winding work at load
-    // time; textures are loaded from relative paths that were copied next to the cooked file. Assimp
+    // A ".pemesh" file stores a model's geometry ready for upload: meshopt-optimized vertex/index/aabb
+    // streams plus the per-mesh, per-node, and material tables. Vertices are usually quantized and
+    // codec-compressed on disk and expand to the engine's float layouts with one decode pass; that is
+    // on-disk compression only, the GPU still stores and fetches float vertices.
+    // "Cooked" means there is no Assimp, simplification, tangent, or winding work at load time; textures are loaded from relative paths to ".petex" block-compressed mip chains cooked
+    // next to the file (API/CookedTexture.h), uploaded without decoding or GPU mip generation. Assimp
     // is editor-only and is used solely to import source models (glTF/FBX/OBJ) and cook them to this
     // format; the player (desktop and Android) only ever loads ".pemesh".
     //
     // The format is stream based so new vertex layouts (PBR gbuffer, shadow/depth, GUI, ...) are just
-    // new stream ids; each stream is a raw, directly-uploadable byte blob with an explicit stride.
+    // new stream ids; each stream is a byte blob with an explicit stride, raw or (for the quantized
+    // vertex stream) meshopt-encoded.
     class ModelAssetCooked
     {
     public:
@@ -24,14 +28,22 @@ namespace pe
         // Player/editor: load a cooked ".pemesh" into a fresh ModelAsset (Assimp-free, GPU ready).
         // Returns nullptr on a missing/invalid/incompatible file.
         static ModelAsset *Load(const std::filesystem::path &file);
+        // Same, for a file already read into memory (e.g. by the IoService). `file` still anchors the
+        // relative texture paths.
+        static ModelAsset *LoadFromMemory(std::span<const uint8_t> bytes, const std::filesystem::path &file);
 
-        // Editor/cook side: serialize a ModelAsset's GPU-ready CPU data and referenced material
-        // textures to a ".pemesh" file. The ModelAsset may come from any producer
-        // (ModelAssetAssimp import, Primitives). Returns false on I/O failure. Skeleton and animation
-        // clips are cooked too (skinned meshes); embedded textures (.glb) are extracted and written
-        // next to the file as well (compressed PNG/JPG verbatim; raw embedded slots fall back to default).
-        static bool WriteToFile(const ModelAsset *model, const std::filesystem::path &file);
+        // Editor/cook side: serialize a ModelAsset's GPU-ready CPU data to a ".pemesh" file and cook
+        // its material textures next to it (BC and ASTC .petex; DDS and other files stb cannot decode
+        // are copied as is). The ModelAsset may come from any producer (ModelAssetAssimp import,
+        // Primitives). Returns false on I/O failure. Skeleton and animation clips are cooked too
+        // (skinned meshes); embedded textures (.glb) are extracted and cooked the same way (raw
+        // embedded slots fall back to default). `textureFiles`, when given, receives every texture file
+        // the cooked model references (both .petex variants, or the copied file).
+        static bool WriteToFile(const ModelAsset *model, const std::filesystem::path &file,
+                                std::vector<std::filesystem::path> *textureFiles = nullptr);
 
         static bool IsCookedPath(const std::filesystem::path &file);
+        // Format version WriteToFile emits (the cook cache keys on it)
+        static uint32_t GetFormatVersion();
     };
 } // namespace pe
@@ -1,5 +1,4 @@
 #include "Scene/Scene.h"
-#include <meshoptimizer.h> // meshopt_simplify for mesh LOD generation
 #include "Scene/Material.h"
 #include "Scene/ModelAsset.h"
 #include "Scene/SceneRuntimeHooks.h"
@@ -37,6 +36,21 @@ namespace pe
             key << std::setprecision(9) << ':' << p.x << ':' << p.y << ':' << p.z << ':' << p.w;
             return key.str();
         }
+
+        // The scene rebuilds only record copies, fills and barriers, so they go to the copy queue when
+        // there is one. The CPU waits either way; the main queue also waits on the batch's timeline value.
+        void SubmitSceneUpload(CommandBuffer *cmd)
+        {
+            Queue *queue = RHII.GetTransferQueue();
+            cmd->End();
+            queue->Submit(1, &cmd, nullptr, nullptr);
+            if (queue != RHII.GetMainQueue())
+                RHII.GetMainQueue()->WaitForQueue(queue, queue->GetSubmissionCount(),
+                                                  PE_STAGE_DRAW_INDIRECT | PE_STAGE_VERTEX_INPUT | PE_STAGE_VERTEX_SHADER |
+                                                      PE_STAGE_COMPUTE_SHADER);
+            cmd->Wait();
+            cmd->Return();
+        }
     } // namespace
 
     std::vector<uint32_t> Scene::s_aabbIndices = {
@@ -188,6 +202,15 @@ namespace pe
 
     Scene::Scene()
     {
+        PE_MEMORY_TAG(Scene);
+        m_memoryReporter = MemoryTracker::AddReporter(MemoryTag::Scene, [this]()
+                                                      { return static_cast<uint64_t>(
+                                                            m_vertexStore.capacity() * sizeof(Vertex) +
+                                                            m_positionUvStore.capacity() * sizeof(PositionUvVertex) +
+                                                            m_packedVertexStore.capacity() * sizeof(PackedVertex) +
+                                                            m_aabbVertexStore.capacity() * sizeof(AabbVertex) +
+                                                            m_indexStore.capacity() * sizeof(uint32_t)); });
+
         m_defaultSampler = Sampler::Create(Sampler::CreateInfoInit(), "defaultSampler");
 
         Camera *camera = new Camera();
@@ -231,6 +254,7 @@ namespace pe
 
     Scene::~Scene()
     {
+        MemoryTracker::RemoveReporter(m_memoryReporter);
         DestroyAllNodeEntities();
 
         // Free all NodeId allocations
@@ -659,39 +683,29 @@ namespace pe
 
     void Scene::UpdateGeometryBuffers()
     {
-        CommandBuffer *cmd = RHII.GetMainQueue()->AcquireCommandBuffer();
+        CommandBuffer *cmd = RHII.GetTransferQueue()->AcquireCommandBuffer();
         cmd->Begin();
         UploadBuffers(cmd);
-        cmd->End();
-        RHII.GetMainQueue()->Submit(1, &cmd, nullptr, nullptr);
-        cmd->Wait();
-        cmd->Return();
+        SubmitSceneUpload(cmd);
         // m_blasDirty is set inside UploadBuffers() when rtSupport is true
     }
 
     void Scene::UpdateRasterInstances()
     {
-        CommandBuffer *cmd = RHII.GetMainQueue()->AcquireCommandBuffer();
+        CommandBuffer *cmd = RHII.GetTransferQueue()->AcquireCommandBuffer();
         cmd->Begin();
         RebuildRasterInstances(cmd);
-        cmd->End();
-        RHII.GetMainQueue()->Submit(1, &cmd, nullptr, nullptr);
-        cmd->Wait();
-        cmd->Return();
+        SubmitSceneUpload(cmd);
     }
 
     void Scene::UpdateTextures()
     {
-        Queue *queue = RHII.GetMainQueue();
-        CommandBuffer *cmd = queue->AcquireCommandBuffer();
+        CommandBuffer *cmd = RHII.GetTransferQueue()->AcquireCommandBuffer();
         cmd->Begin();
         UpdateImageViews();
         CreateMaterialTable();
         CreateMeshConstants(cmd);
-        cmd->End();
-        queue->Submit(1, &cmd, nullptr, nullptr);
-        cmd->Wait();
-        queue->ReturnCommandBuffer(cmd);
+        SubmitSceneUpload(cmd);
     }
 
     MaterialInstance *Scene::CreateMaterialInstance(Mesh &mesh)
@@ -743,11 +757,42 @@ namespace pe
         const auto &srcAabbs = model->GetAabbVertices();
         const auto &srcIndices = model->GetIndices();
 
-        m_vertexStore.insert(m_vertexStore.end(), srcVerts.begin(), srcVerts.end());
-        m_positionUvStore.insert(m_positionUvStore.end(), srcPosUvs.begin(), srcPosUvs.end());
+        // Cooked models go to the packed stream (40 B per vertex, decoded by the depth, shadow and
+        // GBuffer VS) instead of the float Vertex + PositionUvVertex pair. Lines and sprite outlines are
+        // drawn from the float positions by LinesPass, so a model carrying them stays float.
+        bool packed = model->HasPackedVertices();
+        for (int i = 0; packed && i < model->GetMeshInfoCount(); i++)
+        {
+            const MeshInfo *mi = model->GetMeshInfo(i);
+            if (mi && (mi->renderType == RenderType::Lines || mi->renderType == RenderType::SpriteOutline))
+                packed = false;
+        }
+        const uint32_t packedBase = static_cast<uint32_t>(m_packedVertexStore.size());
+
+        if (packed)
+        {
+            const auto &srcPacked = model->GetPackedVertices();
+            m_packedVertexStore.insert(m_packedVertexStore.end(), srcPacked.begin(), srcPacked.end());
+        }
+        else
+        {
+            m_vertexStore.insert(m_vertexStore.end(), srcVerts.begin(), srcVerts.end());
+            m_positionUvStore.insert(m_positionUvStore.end(), srcPosUvs.begin(), srcPosUvs.end());
+        }
         m_aabbVertexStore.insert(m_aabbVertexStore.end(), srcAabbs.begin(), srcAabbs.end());
         m_indexStore.insert(m_indexStore.end(), srcIndices.begin(), srcIndices.end());
 
+        // Discrete LODs: cooked models carry their simplified levels; anything else (primitives, older
+        // .pemesh files) is simplified here. Either way the levels' indices follow the model's own.
+        const uint32_t wantLods = std::clamp(Settings::Get<SceneSettings>().lod_count, 1u, Mesh::kMaxLods);
+        std::vector<MeshLods> builtLods;
+        std::vector<uint32_t> builtLodIndices;
+        if (!model->HasBakedLods() && wantLods > 1)
+            model->BuildLods(wantLods, builtLods, builtLodIndices);
+        const std::vector<uint32_t> &srcLodIndices = model->HasBakedLods() ? model->GetLodIndices() : builtLodIndices;
+        const uint32_t lodIndexBase = static_cast<uint32_t>(m_indexStore.size());
+        m_indexStore.insert(m_indexStore.end(), srcLodIndices.begin(), srcLodIndices.end());
+
         for (const auto &img : model->GetImages())
             m_imageStore.push_back(img);
         for (auto *samp : model->GetSamplers())
@@ -762,11 +807,12 @@ namespace pe
                 continue;
 
             Mesh mesh{};
-            mesh.vertexOffset = mi->vertexOffset + vertexBase;
+            mesh.vertexOffset = mi->vertexOffset + (packed ? packedBase : vertexBase);
             mesh.vertexCount = mi->verticesCount;
             mesh.indexOffset = mi->indexOffset + indexBase;
             mesh.indexCount = mi->indicesCount;
-            mesh.positionsOffset = mi->vertexOffset + posUvBase;
+            mesh.positionsOffset = mi->vertexOffset + (packed ? packedBase : posUvBase);
+            mesh.packedVertices = packed;
             mesh.aabbVertexOffset = mi->aabbVertexOffset + aabbBase;
             mesh.aabbColor = mi->aabbColor;
             mesh.boundingBox = mi->boundingBox;
@@ -774,40 +820,21 @@ namespace pe
             mesh.material = mi->material;
             mesh.skinned = mi->skinned;
 
-            // Build discrete LODs: meshopt_simplify yields reduced index sets that index the SAME
-            // vertices (subset), so every level shares mesh.vertexOffset; we append each to the shared
-            // index store and record its range. lods[0] is the full-detail range. Skinned meshes are
-            // skipped (joint-weighted simplification would need attribute-aware collapse). Distance-based
-            // level pick + index-range swap happens on the GPU in CullingCS.
+            // lods[0] is the full-detail range; the simplified levels share mesh.vertexOffset. The
+            // GPU cull shader picks a level by projected error (or distance) and swaps the index range.
             mesh.lodIndexOffset[0] = mesh.indexOffset;
             mesh.lodIndexCount[0] = mesh.indexCount;
             mesh.lodCount = 1;
-            const uint32_t wantLods = std::clamp(Settings::Get<SceneSettings>().lod_count, 1u, Mesh::kMaxLods);
-            const uint32_t baseIdxCount = mesh.indexCount;
-            if (wantLods > 1 && baseIdxCount >= 256 && !mesh.skinned && mi->verticesCount > 0)
+            const MeshLods *lods = model->HasBakedLods() ? &mi->lods
+                                                         : (i < static_cast<int>(builtLods.size()) ? &builtLods[i] : nullptr);
+            if (lods)
             {
-                const uint32_t *baseIndices = srcIndices.data() + mi->indexOffset; // 0-based within this mesh
-                const float *positions = reinterpret_cast<const float *>(srcVerts.data() + mi->vertexOffset);
-                const size_t vtxCount = mi->verticesCount;
-                static constexpr float kRatios[Mesh::kMaxLods] = {1.0f, 0.5f, 0.25f, 0.12f};
-                std::vector<uint32_t> simplified(baseIdxCount);
-                uint32_t prevCount = baseIdxCount;
-                for (uint32_t lod = 1; lod < wantLods; ++lod)
+                mesh.lodCount = std::min(lods->count, wantLods);
+                for (uint32_t lod = 1; lod < mesh.lodCount; ++lod)
                 {
-                    size_t target = (static_cast<size_t>(baseIdxCount * kRatios[lod]) / 3) * 3; // whole tris
-                    if (target < 12)
-                        break;
-                    float err = 0.0f;
-                    size_t resCount = meshopt_simplify(simplified.data(), baseIndices, baseIdxCount, positions,
-                                                       vtxCount, sizeof(Vertex), target, 0.1f, 0, &err);
-                    if (resCount == 0 || resCount >= static_cast<size_t>(prevCount * 0.95f))
-                        break; // no meaningful reduction past this level
-                    uint32_t off = static_cast<uint32_t>(m_indexStore.size());
-                    m_indexStore.insert(m_indexStore.end(), simplified.begin(), simplified.begin() + resCount);
-                    mesh.lodIndexOffset[lod] = off;
-                    mesh.lodIndexCount[lod] = static_cast<uint32_t>(resCount);
-                    mesh.lodCount = lod + 1;
-                    prevCount = static_cast<uint32_t>(resCount);
+                    mesh.lodIndexOffset[lod] = lodIndexBase + lods->indexOffset[lod];
+                    mesh.lodIndexCount[lod] = lods->indexCount[lod];
+                    mesh.lodError[lod] = lods->error[lod];
                 }
             }
 
@@ -1296,6 +1323,11 @@ namespace pe
         LodUBOData ubo{};
         ubo.enabled = s.lod_enabled ? 1u : 0u;
         ubo.bias = s.lod_bias > 0.0f ? s.lod_bias : 1.0f;
+        // Error mode needs a perspective camera: errorScale folds half the viewport height, the focal
+        // length and the pixel threshold, so error * errorScale / distance is the error in threshold units
+        Camera *camera = m_cameras.empty() ? nullptr : m_cameras[0];
+        if (s.lod_error_pixels > 0.0f && camera && !camera->IsOrthographic())
+            ubo.errorScale = 0.5f * RHII.GetHeightf() * camera->GetProjectionNoJitter()[1][1] / s.lod_error_pixels;
         ubo.distances[0] = s.lod_distances[0];
         ubo.distances[1] = s.lod_distances[1];
         ubo.distances[2] = s.lod_distances[2];
@@ -324,6 +324,12 @@ namespace pe
         // Emit one coarse whole-buffer barrier per arena buffer. Add/RemoveArenaMesh skip their per-section
         // barriers on the streamed (externalCmd) path; the caller flushes once per frame after all uploads.
         void FlushArenaBarriers(CommandBuffer *cmd);
+        // Transfer-queue variant of the above, bracketing a streamed batch recorded on the dedicated copy
+        // queue. Begin drops the arena buffers' tracked graphics-stage state (a copy queue cannot name
+        // those stages in a barrier); End records the read state FlushArenaBarriers would have left without
+        // emitting anything, since the main queue's timeline wait on the batch already orders the reads.
+        void BeginArenaTransfer();
+        void EndArenaTransfer();
 
         // Arena layout, published by ReserveArenaCapacity for the GeometryArena's free lists (vertices
         // are a shared index across both vertex streams; index space is bytes into the tail).
@@ -360,8 +366,8 @@ namespace pe
         // rewritten the CPU stores inside the mesh's reserved ranges and updated the Mesh's live
         // indexCount / boundingBox / lod tables; this stages the first vertexCopyCount vertices (both
         // vertex streams), indexCopyCount indices and the 8 AABB corners to the GPU via `cmd` (the
-        // caller's frame command buffer — queue order lands the copies before this frame's draws, and
-        // frames already in flight keep reading the old bytes, so content never tears). Vulkan reads
+        // caller orders it after the frames already in flight and before this frame's draws, so content
+        // never tears; TerrainWorld does that with timeline waits around a copy-queue submit). Vulkan reads
         // Mesh_Constants host-mapped, so an in-flight cull may see a half-written struct for one
         // frame — transient cull wobble at worst, same acceptance as the arena path.
         bool UpdateStreamedMesh(NodeId *node, uint32_t refSlot, int meshIndex,
@@ -489,6 +495,13 @@ namespace pe
         Buffer *GetMeshInfoBuffer() { return m_meshInfoBuffer; }
         size_t GetVerticesOffset() const { return m_verticesOffset; }
         size_t GetPositionsOffset() const { return m_positionsOffset; }
+        size_t GetPackedVerticesOffset() const { return m_packedVerticesOffset; }
+        // Geometry-buffer byte offset of the mesh's first Vertex, or PackedVertex for packed meshes
+        size_t MeshVertexByteOffset(const Mesh &mesh) const
+        {
+            return mesh.packedVertices ? m_packedVerticesOffset + mesh.vertexOffset * sizeof(PackedVertex)
+                                       : m_verticesOffset + mesh.vertexOffset * sizeof(Vertex);
+        }
         size_t GetAabbVerticesOffset() const { return m_aabbVerticesOffset; }
         size_t GetAabbIndicesOffset() const { return m_aabbIndicesOffset; }
         Buffer *GetIndirectAll() const { return m_indirectAll; }
@@ -669,6 +682,7 @@ namespace pe
         // Data stores
         std::vector<Vertex> &GetVertexStore() { return m_vertexStore; }
         std::vector<PositionUvVertex> &GetPositionUvStore() { return m_positionUvStore; }
+        const std::vector<PackedVertex> &GetPackedVertexStore() const { return m_packedVertexStore; }
         std::vector<AabbVertex> &GetAabbVertexStore() { return m_aabbVertexStore; }
         std::vector<uint32_t> &GetIndexStore() { return m_indexStore; }
         std::vector<ResourceHandle<Image>> &GetImageStore() { return m_imageStore; }
@@ -805,14 +819,14 @@ namespace pe
         Buffer *m_indirectAll = nullptr;
 
         // LOD params UBO (one per swapchain image), bound at CullingCS binding 16. Byte-identical to the
-        // cbuffer LodUBO: enabled/bias + three world-unit switch distances; refilled each frame from
-        // SceneSettings in UpdateLodUniforms.
+        // cbuffer LodUBO (Common/MeshLod.hlsl): enabled/bias, the pixel-error scale (0 = distance mode) and
+        // three world-unit switch distances; refilled each frame from SceneSettings in UpdateLodUniforms.
         struct LodUBOData
         {
             uint32_t enabled = 0;
             uint32_t pad0 = 0;
             float bias = 1.0f;
-            float pad1 = 0.0f;
+            float errorScale = 0.0f;
             float distances[4] = {0.0f, 0.0f, 0.0f, 0.0f};
         };
         std::vector<Buffer *> m_lodUniforms;
@@ -834,6 +848,7 @@ namespace pe
 
         size_t m_verticesOffset = 0;
         size_t m_positionsOffset = 0;
+        size_t m_packedVerticesOffset = 0;
         size_t m_aabbVerticesOffset = 0;
         size_t m_aabbIndicesOffset = 0;
         uint32_t m_meshCount = 0;
@@ -847,6 +862,7 @@ namespace pe
         uint32_t m_indicesCount = 0;
         uint32_t m_verticesCount = 0;
         uint32_t m_positionsCount = 0;
+        uint32_t m_packedVerticesCount = 0;
         uint32_t m_aabbVerticesCount = 0;
 
         // Arena bookkeeping (Spike 0A). Vertices use a SHARED index across the Vertex and
@@ -948,10 +964,12 @@ namespace pe
         // Data stores
         std::vector<Vertex> m_vertexStore;
         std::vector<PositionUvVertex> m_positionUvStore;
+        std::vector<PackedVertex> m_packedVertexStore;
         std::vector<AabbVertex> m_aabbVertexStore;
         std::vector<uint32_t> m_indexStore;
         std::vector<ResourceHandle<Image>> m_imageStore;
         std::vector<Sampler *> m_samplerStore;
+        MemoryTracker::ReporterId m_memoryReporter = 0; // reports the geometry stores above
 
         bool m_nodesDirty = false;
         std::vector<NodeId *> m_nodesMoved;
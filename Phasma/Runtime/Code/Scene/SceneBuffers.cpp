@@ -146,6 +146,7 @@ namespace pe
 
     void Scene::UploadBuffers(CommandBuffer *cmd)
     {
+        PE_MEMORY_TAG(Scene);
         DestroyBuffers();
         CreateGeometryBuffer();
         CopyIndices(cmd);
@@ -191,12 +192,14 @@ namespace pe
         m_indicesCount = static_cast<uint32_t>(m_indexStore.size());
         m_verticesCount = static_cast<uint32_t>(m_vertexStore.size());
         m_positionsCount = static_cast<uint32_t>(m_positionUvStore.size());
+        m_packedVerticesCount = static_cast<uint32_t>(m_packedVertexStore.size());
         m_aabbVerticesCount = static_cast<uint32_t>(m_aabbVertexStore.size());
 
         m_aabbIndicesOffset = m_indicesCount * sizeof(uint32_t);
         m_verticesOffset = m_aabbIndicesOffset + s_aabbIndices.size() * sizeof(uint32_t);
         m_positionsOffset = m_verticesOffset + m_verticesCount * sizeof(Vertex);
-        m_aabbVerticesOffset = m_positionsOffset + m_positionsCount * sizeof(PositionUvVertex);
+        m_packedVerticesOffset = m_positionsOffset + m_positionsCount * sizeof(PositionUvVertex);
+        m_aabbVerticesOffset = m_packedVerticesOffset + m_packedVerticesCount * sizeof(PackedVertex);
 
         // TRANSFER_SRC: GeometryArena::ReserveArenaCapacity copies the existing geometry out of this
         // buffer into a larger one when it reserves arena headroom (SceneBuffers.cpp ReserveArenaCapacity).
@@ -212,6 +215,7 @@ namespace pe
             .usage = geometryUsage,
             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
             .name = "combined_Geometry_buffer",
+            .concurrentQueues = true,
         });
     }
 
@@ -259,7 +263,7 @@ namespace pe
         auto &progress = gSettings.loading.current;
         auto &total = gSettings.loading.total;
 
-        total = m_verticesCount + m_positionsCount + m_aabbVerticesCount;
+        total = m_verticesCount + m_positionsCount + m_packedVerticesCount + m_aabbVerticesCount;
         progress = 0;
         gSettings.loading.SetName("Uploading to GPU");
 
@@ -268,10 +272,11 @@ namespace pe
             cmd->CopyBufferStaged(m_buffer, m_vertexStore.data(), m_verticesCount * sizeof(Vertex), m_verticesOffset);
             progress += m_verticesCount;
 
+            // Fetched by the GBuffer VS from the storage view of the buffer (see Common/VertexFetch.hlsl)
             BufferBarrierInfo vertexBarrierInfo{};
             vertexBarrierInfo.buffer = m_buffer;
-            vertexBarrierInfo.stageMask = PE_STAGE_VERTEX_INPUT;
-            vertexBarrierInfo.accessMask = PE_ACCESS_VERTEX_ATTRIBUTE_READ;
+            vertexBarrierInfo.stageMask = PE_STAGE_VERTEX_SHADER;
+            vertexBarrierInfo.accessMask = PE_ACCESS_SHADER_STORAGE_READ;
             vertexBarrierInfo.size = m_verticesCount * sizeof(Vertex);
             vertexBarrierInfo.offset = m_verticesOffset;
             cmd->BufferBarrier(vertexBarrierInfo);
@@ -282,15 +287,30 @@ namespace pe
             cmd->CopyBufferStaged(m_buffer, m_positionUvStore.data(), m_positionsCount * sizeof(PositionUvVertex), m_positionsOffset);
             progress += m_positionsCount;
 
+            // Fetched by the depth/shadow VS, and still bound as vertex input by LinesPass
             BufferBarrierInfo posVertexBarrierInfo{};
             posVertexBarrierInfo.buffer = m_buffer;
-            posVertexBarrierInfo.stageMask = PE_STAGE_VERTEX_INPUT;
-            posVertexBarrierInfo.accessMask = PE_ACCESS_VERTEX_ATTRIBUTE_READ;
+            posVertexBarrierInfo.stageMask = PE_STAGE_VERTEX_INPUT | PE_STAGE_VERTEX_SHADER;
+            posVertexBarrierInfo.accessMask = PE_ACCESS_VERTEX_ATTRIBUTE_READ | PE_ACCESS_SHADER_STORAGE_READ;
             posVertexBarrierInfo.size = m_positionsCount * sizeof(PositionUvVertex);
             posVertexBarrierInfo.offset = m_positionsOffset;
             cmd->BufferBarrier(posVertexBarrierInfo);
         }
 
+        if (m_packedVerticesCount > 0)
+        {
+            cmd->CopyBufferStaged(m_buffer, m_packedVertexStore.data(), m_packedVerticesCount * sizeof(PackedVertex), m_packedVerticesOffset);
+            progress += m_packedVerticesCount;
+
+            BufferBarrierInfo packedVertexBarrierInfo{};
+            packedVertexBarrierInfo.buffer = m_buffer;
+            packedVertexBarrierInfo.stageMask = PE_STAGE_VERTEX_SHADER;
+            packedVertexBarrierInfo.accessMask = PE_ACCESS_SHADER_STORAGE_READ;
+            packedVertexBarrierInfo.size = m_packedVerticesCount * sizeof(PackedVertex);
+            packedVertexBarrierInfo.offset = m_packedVerticesOffset;
+            cmd->BufferBarrier(packedVertexBarrierInfo);
+        }
+
         if (m_aabbVerticesCount > 0)
         {
             cmd->CopyBufferStaged(m_buffer, m_aabbVertexStore.data(), m_aabbVerticesCount * sizeof(AabbVertex), m_aabbVerticesOffset);
@@ -376,6 +396,7 @@ namespace pe
                 // matrices (the DX12 CullingPass cost driver vs Vulkan, which already lands it in BAR).
                 .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU_PERSISTENT_DEVICE,
                 .name = "storage_Geometry_buffer_" + std::to_string(i),
+                .concurrentQueues = true,
             });
 
             if (useStorageDeviceMirror)
@@ -450,6 +471,7 @@ namespace pe
                      PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
             .name = "indirect_Geometry_buffer_all",
+            .concurrentQueues = true,
         });
         if (indirectCount > 0)
             cmd->CopyBufferStaged(m_indirectAll, indirectCommands.data(), indirectCommands.size() * PE_DRAW_INDEXED_INDIRECT_COMMAND_SIZE, 0);
@@ -475,6 +497,7 @@ namespace pe
                     .usage = PE_BUFFER_USAGE_INDIRECT_BUFFER | PE_BUFFER_USAGE_STORAGE_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST,
                     .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                     .name = name + std::to_string(i),
+                    .concurrentQueues = true,
                 });
             }
             return vec;
@@ -488,6 +511,7 @@ namespace pe
                 .usage = PE_BUFFER_USAGE_STORAGE_BUFFER | PE_BUFFER_USAGE_INDIRECT_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST,
                 .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                 .name = "culling_counters_" + std::to_string(i),
+                .concurrentQueues = true,
             });
         }
 
@@ -500,6 +524,7 @@ namespace pe
                 .usage = PE_BUFFER_USAGE_UNIFORM_BUFFER,
                 .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU,
                 .name = "lod_params_uniform_" + std::to_string(i),
+                .concurrentQueues = true,
             });
             m_lodUniforms[i]->Map();
             m_lodUniforms[i]->Zero();
@@ -540,6 +565,7 @@ namespace pe
                     .usage = PE_BUFFER_USAGE_STORAGE_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST,
                     .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                     .name = name + std::to_string(i),
+                    .concurrentQueues = true,
                 });
             }
             return vec;
@@ -581,6 +607,7 @@ namespace pe
             .usage = PE_BUFFER_USAGE_STORAGE_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
             .name = "occ_visibility",
+            .concurrentQueues = true,
         });
         cmd->FillBuffer(m_visibility, 0, m_indirectCapacity * sizeof(uint32_t), 1u);
         {
@@ -1136,6 +1163,7 @@ namespace pe
             // mirror instead, because uncached GPU_UPLOAD reads dominate the cull pass (~0.6 ms @ 50k).
             .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU_PERSISTENT_DEVICE,
             .name = "Scene_meshConstants",
+            .concurrentQueues = true,
         });
 
         if (useMeshConstantsMirror)
@@ -1483,12 +1511,14 @@ namespace pe
             .usage = PE_BUFFER_USAGE_VERTEX_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
             .name = "voxel_vertex_buffer",
+            .concurrentQueues = true,
         });
         m_voxelIndexBuf = Buffer::Create({
             .size = std::max<size_t>(idxStride, static_cast<size_t>(arenaIdxCap) * idxStride),
             .usage = PE_BUFFER_USAGE_INDEX_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
             .name = "voxel_index_buffer",
+            .concurrentQueues = true,
         });
 
         // Arena bookkeeping: offsets are base-0 into the dedicated voxel buffers.
@@ -1528,6 +1558,7 @@ namespace pe
                              PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
                     .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                     .name = "indirect_Geometry_buffer_all",
+                    .concurrentQueues = true,
                 });
                 if (m_indirectAll && m_meshCount > 0)
                 {
@@ -1561,6 +1592,7 @@ namespace pe
                             .usage = usage,
                             .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                             .name = name + std::to_string(i),
+                            .concurrentQueues = true,
                         });
                         RHII.AddToDeletionQueue(
                             [b = vec[i]]()
@@ -1625,6 +1657,7 @@ namespace pe
                         .usage = PE_BUFFER_USAGE_STORAGE_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST,
                         .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                         .name = "occ_visibility",
+                        .concurrentQueues = true,
                     });
                     CommandBuffer *c = q->AcquireCommandBuffer();
                     c->Begin();
@@ -1660,6 +1693,7 @@ namespace pe
                              (useMcMirror ? PE_BUFFER_USAGE_TRANSFER_SRC : PE_BUFFER_USAGE_NONE),
                     .memoryUsage = PE_MEMORY_USAGE_CPU_TO_GPU_PERSISTENT_DEVICE,
                     .name = "Scene_meshConstants",
+                    .concurrentQueues = true,
                 });
                 if (m_meshConstants && m_meshCount > 0)
                 {
@@ -1738,11 +1772,12 @@ namespace pe
             return false;
 
         // Grow without a GPU drain: the live-geometry copy is recorded into the caller's frame voxel cmd
-        // (submitted on the main queue before the cull dispatch, like the streamed AddArenaMesh copies).
-        // In-flight frames keep reading the OLD buffers — those stay alive and are freed fence-deferred via
-        // the deletion queue. The transfer->transfer barrier orders this copy before the same frame's
-        // section uploads, which may target reused holes inside the copied region; FlushArenaBarriers then
-        // makes the whole buffer visible to the vertex-input stage.
+        // (submitted on the transfer queue, or the main queue without one, and always ahead of the cull
+        // dispatch, like the streamed AddArenaMesh copies). In-flight frames keep reading the OLD buffers —
+        // those stay alive and are freed fence-deferred via the deletion queue. The transfer->transfer
+        // barrier orders this copy before the same frame's section uploads, which may target reused holes
+        // inside the copied region; FlushArenaBarriers (or the main queue's timeline wait on the transfer
+        // batch) then makes the whole buffer visible to the vertex-input stage.
         auto orderCopyBeforeUploads = [&](Buffer *nb, size_t bytes)
         {
             BufferBarrierInfo b{};
@@ -1762,6 +1797,7 @@ namespace pe
                 .usage = PE_BUFFER_USAGE_VERTEX_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
                 .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                 .name = "voxel_vertex_buffer",
+                .concurrentQueues = true,
             });
             if (oldBytes > 0)
             {
@@ -1781,6 +1817,7 @@ namespace pe
                 .usage = PE_BUFFER_USAGE_INDEX_BUFFER | PE_BUFFER_USAGE_TRANSFER_DST | PE_BUFFER_USAGE_TRANSFER_SRC,
                 .memoryUsage = PE_MEMORY_USAGE_GPU_ONLY_DEDICATED,
                 .name = "voxel_index_buffer",
+                .concurrentQueues = true,
             });
             if (oldBytes > 0)
             {
@@ -1879,11 +1916,12 @@ namespace pe
         drawCmd.firstInstance = static_cast<uint32_t>(idx);
 
         // Record the geometry/indirect/visibility GPU work. When externalCmd is supplied these copies
-        // ride the caller's frame upload buffer (submitted on the main queue BEFORE the cull dispatch),
-        // and per-section barriers are skipped in favour of one coarse whole-buffer barrier per frame
-        // (FlushArenaBarriers): the reads all happen later in the render passes, so a few whole-buffer
-        // barriers are equivalent to N per-copy ones and avoid the per-section barrier churn. The
-        // standalone path Submit+Waits each section, so it barriers inline.
+        // ride the caller's frame upload buffer (submitted BEFORE the cull dispatch, on the transfer queue
+        // when there is one), and per-section barriers are skipped in favour of one coarse whole-buffer
+        // barrier per frame (FlushArenaBarriers, or the main queue's timeline wait on the transfer batch):
+        // the reads all happen later in the render passes, so a few whole-buffer barriers are equivalent to
+        // N per-copy ones and avoid the per-section barrier churn. The standalone path Submit+Waits each
+        // section, so it barriers inline.
         const bool inlineBarriers = (externalCmd == nullptr);
         auto recordGeometry = [&](CommandBuffer *cmd)
         {
@@ -2208,6 +2246,39 @@ namespace pe
         }
     }
 
+    void Scene::BeginArenaTransfer()
+    {
+        // The batch overwrites only ranges no in-flight frame reads (holes and slots come back after the
+        // GeometryArena retire delay), and tombstone writes to a live slot are harmless if a frame still
+        // sees the old draw, so there is no read-to-write dependency to carry over from graphics.
+        for (Buffer *b : {m_voxelVertexBuf, m_voxelIndexBuf, m_indirectAll, m_visibility})
+        {
+            if (b)
+                b->GetTrackInfo() = BufferTrackInfo{};
+        }
+    }
+
+    void Scene::EndArenaTransfer()
+    {
+        auto publish = [](Buffer *b, uint32_t stage, uint32_t access)
+        {
+            if (!b)
+                return;
+            BufferTrackInfo &ti = b->GetTrackInfo();
+            ti = BufferTrackInfo{};
+            ti.buffer = b;
+            ti.stageMask = stage;
+            ti.accessMask = access;
+            ti.size = b->Size();
+        };
+        publish(m_voxelVertexBuf, PE_STAGE_VERTEX_INPUT, PE_ACCESS_VERTEX_ATTRIBUTE_READ);
+        publish(m_voxelIndexBuf, PE_STAGE_VERTEX_INPUT, PE_ACCESS_INDEX_READ);
+        publish(m_indirectAll, PE_STAGE_DRAW_INDIRECT | PE_STAGE_COMPUTE_SHADER,
+                PE_ACCESS_INDIRECT_COMMAND_READ | PE_ACCESS_SHADER_READ);
+        publish(m_visibility, PE_STAGE_COMPUTE_SHADER,
+                PE_ACCESS_SHADER_STORAGE_READ | PE_ACCESS_SHADER_STORAGE_WRITE);
+    }
+
     Mesh_Constants Scene::ComputeMeshConstants(uint32_t nodeIndex, int meshIndex) const
     {
         const Mesh &mesh = m_meshes[meshIndex];
@@ -2267,10 +2338,16 @@ namespace pe
         {
             constants.lodIndexOffset[l] = mesh.lodIndexOffset[l];
             constants.lodIndexCount[l] = mesh.lodIndexCount[l];
+            constants.lodError[l] = mesh.lodError[l];
         }
         constants.lodShift = mesh.lodShift;
         constants.lodMeshEnabled = mesh.lodEnabled ? 1u : 0u;
         constants.lodMeshBias = mesh.lodBias;
+
+        constants.vertexFormat = mesh.packedVertices ? 1u : 0u;
+        constants.vertexBase = mesh.vertexOffset;
+        constants.vertexStream = static_cast<uint32_t>(mesh.packedVertices ? m_packedVerticesOffset : m_verticesOffset);
+        constants.positionStream = static_cast<uint32_t>(mesh.packedVertices ? m_packedVerticesOffset : m_positionsOffset);
         return constants;
     }
 
@@ -2390,6 +2467,8 @@ namespace pe
         if (slot == UINT32_MAX || slot >= m_meshCount)
             return false;
         const Mesh &mesh = m_meshes[meshIndex];
+        if (mesh.packedVertices)
+            return false; // streamed meshes (terrain tiles) are written in the float stores
 
         // The mesh's reserved ranges must sit inside the GPU buffer laid out at the last rebuild —
         // store data appended after that rebuild has no GPU backing yet and can't be streamed into.
@@ -2404,18 +2483,19 @@ namespace pe
 
         BufferBarrierInfo b{};
         b.buffer = m_buffer;
-        b.stageMask = PE_STAGE_VERTEX_INPUT;
         if (vertexCopyCount > 0)
         {
             const size_t vOff = m_verticesOffset + static_cast<size_t>(mesh.vertexOffset) * sizeof(Vertex);
             cmd->CopyBufferStaged(m_buffer, m_vertexStore.data() + mesh.vertexOffset,
                                   static_cast<size_t>(vertexCopyCount) * sizeof(Vertex), vOff);
-            b.accessMask = PE_ACCESS_VERTEX_ATTRIBUTE_READ;
+            // Both streams are fetched by the vertex shaders (Common/VertexFetch.hlsl)
+            b.stageMask = PE_STAGE_VERTEX_SHADER;
+            b.accessMask = PE_ACCESS_SHADER_STORAGE_READ;
             b.offset = vOff;
             b.size = static_cast<size_t>(vertexCopyCount) * sizeof(Vertex);
             cmd->BufferBarrier(b);
 
-            // Depth-prepass/shadows bind the PositionUvVertex stream at the same vertex index.
+            // Depth-prepass/shadows fetch the PositionUvVertex stream at the same vertex index.
             const size_t pOff =
                 m_positionsOffset + static_cast<size_t>(mesh.positionsOffset) * sizeof(PositionUvVertex);
             cmd->CopyBufferStaged(m_buffer, m_positionUvStore.data() + mesh.positionsOffset,
@@ -2424,6 +2504,7 @@ namespace pe
             b.size = static_cast<size_t>(vertexCopyCount) * sizeof(PositionUvVertex);
             cmd->BufferBarrier(b);
         }
+        b.stageMask = PE_STAGE_VERTEX_INPUT;
         if (indexCopyCount > 0)
         {
             const size_t iOff = static_cast<size_t>(mesh.indexOffset) * sizeof(uint32_t);
@@ -1180,7 +1180,8 @@ namespace pe
         if (mesh.vertexCount == 0)
             return false;
 
-        if (mesh.vertexOffset + mesh.vertexCount > m_vertexStore.size() ||
+        // UV rects rewrite the float streams; packed (cooked) meshes have none
+        if (mesh.packedVertices || mesh.vertexOffset + mesh.vertexCount > m_vertexStore.size() ||
             mesh.positionsOffset + mesh.vertexCount > m_positionUvStore.size())
             return false;
 
@@ -1246,7 +1247,7 @@ namespace pe
                 continue;
 
             const Mesh &mesh = m_meshes[meshIndex];
-            if (mesh.vertexCount == 0 || mesh.vertexOffset + mesh.vertexCount > m_vertexStore.size() ||
+            if (mesh.vertexCount == 0 || mesh.packedVertices || mesh.vertexOffset + mesh.vertexCount > m_vertexStore.size() ||
                 mesh.positionsOffset + mesh.vertexCount > m_positionUvStore.size())
                 continue;
 
@@ -1272,10 +1273,10 @@ namespace pe
             for (const PendingCopy &copy : copies)
             {
                 std::memcpy(static_cast<uint8_t *>(staging.data) + srcOffset, copy.data, copy.size);
-                cmd->CopyBuffer(staging.buffer, m_buffer, copy.size, srcOffset, copy.dstOffset);
+                cmd->CopyBuffer(staging.buffer, m_buffer, copy.size, staging.offset + srcOffset, copy.dstOffset);
                 srcOffset += copy.size;
             }
-            staging.buffer->Flush(stagingBytes, 0);
+            staging.buffer->Flush(stagingBytes, staging.offset);
             cmd->AddAfterWaitCallback([staging = std::move(staging)]()
                                       { RHII.GetStagingManager()->SetUnused(staging); });
 
@@ -1306,7 +1307,7 @@ namespace pe
             return false;
 
         const Mesh &mesh = m_meshes[meshIndex];
-        if (mesh.vertexCount != 4 ||
+        if (mesh.vertexCount != 4 || mesh.packedVertices ||
             mesh.vertexOffset + mesh.vertexCount > m_vertexStore.size() ||
             mesh.positionsOffset + mesh.vertexCount > m_positionUvStore.size())
             return false;
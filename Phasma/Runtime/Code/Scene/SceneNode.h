@@ -63,14 +63,19 @@ namespace pe
 
         bool skinned = false;
         bool live = true;
+        // vertexOffset/positionsOffset index Scene's packed vertex store instead of the float
+        // Vertex/PositionUvVertex stores (cooked models, see Scene::AddModelGeometry)
+        bool packedVertices = false;
 
         // Discrete LODs: index ranges into the shared index buffer (all share this mesh's vertexOffset,
         // since meshopt produces a subset of the same vertices). lods[0] = full detail; lodCount==1 means
-        // no simplified levels. Built at load in AddModelGeometry via meshopt_simplify. The GPU cull shader
-        // picks a level by camera distance and overrides the draw's firstIndex/indexCount.
+        // no simplified levels. Baked by the cook (ModelAsset::BuildLods), or built in AddModelGeometry for
+        // models without baked levels. lodError is each level's object-space deviation; the GPU cull shader
+        // projects it to pixels (or falls back to camera distance) and overrides firstIndex/indexCount.
         static constexpr uint32_t kMaxLods = 4;
         uint32_t lodIndexOffset[kMaxLods] = {0, 0, 0, 0};
         uint32_t lodIndexCount[kMaxLods] = {0, 0, 0, 0};
+        float lodError[kMaxLods] = {0.0f, 0.0f, 0.0f, 0.0f};
         uint32_t lodCount = 1;
         // Per-mesh LOD controls (authored in the Mesh Component panel; gated by the global Scene Settings
         // Mesh LOD master switch). lodEnabled=false makes this mesh always full detail. lodShift is added to
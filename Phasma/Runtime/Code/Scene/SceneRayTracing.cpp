@@ -316,14 +316,16 @@ namespace pe
             const bool isTransparent = mesh.renderType == RenderType::AlphaCut ||
                                        mesh.renderType == RenderType::AlphaBlend ||
                                        mesh.renderType == RenderType::Transmission;
+            // Both vertex layouts start with a float3 position, so only the base and stride differ
+            const uint64_t vertexAddress = bufferAddress + MeshVertexByteOffset(mesh);
+            const uint32_t vertexStride = mesh.packedVertices ? sizeof(PackedVertex) : sizeof(Vertex);
 
             if (IsVulkanSceneRayTracing())
             {
                 req.geometry.geometryType = vk::GeometryTypeKHR::eTriangles;
                 req.geometry.geometry.triangles.vertexFormat = vk::Format::eR32G32B32Sfloat;
-                req.geometry.geometry.triangles.vertexData.deviceAddress =
-                    bufferAddress + m_verticesOffset + mesh.vertexOffset * sizeof(Vertex);
-                req.geometry.geometry.triangles.vertexStride = sizeof(Vertex);
+                req.geometry.geometry.triangles.vertexData.deviceAddress = vertexAddress;
+                req.geometry.geometry.triangles.vertexStride = vertexStride;
                 req.geometry.geometry.triangles.maxVertex = mesh.vertexCount ? mesh.vertexCount - 1 : 0;
                 req.geometry.geometry.triangles.indexType = vk::IndexType::eUint32;
                 req.geometry.geometry.triangles.indexData.deviceAddress =
@@ -351,9 +353,9 @@ namespace pe
 #if defined(PE_WIN32)
             if (IsDx12SceneRayTracing())
             {
-                req.dxGeometry.vertexAddress = bufferAddress + m_verticesOffset + mesh.vertexOffset * sizeof(Vertex);
+                req.dxGeometry.vertexAddress = vertexAddress;
                 req.dxGeometry.vertexCount = mesh.vertexCount;
-                req.dxGeometry.vertexStride = sizeof(Vertex);
+                req.dxGeometry.vertexStride = vertexStride;
                 req.dxGeometry.vertexFormat = PE_FORMAT_R32G32B32_SFLOAT;
                 req.dxGeometry.indexAddress = bufferAddress + mesh.indexOffset * sizeof(uint32_t);
                 req.dxGeometry.indexCount = mesh.indexCount;
@@ -575,6 +577,7 @@ namespace pe
             uint32_t renderType;
             uint32_t constantsIndex;
             int32_t textures[5];
+            uint32_t vertexFormat; // Mesh_Constants::vertexFormat
         };
 
         RHII.AddToDeletionQueue([b = m_meshInfoBuffer]()
@@ -598,15 +601,17 @@ namespace pe
             const MeshRuntime &meshRt = m_meshRuntimes[record.meshIndex];
 
             meshInfoGPU.indexOffset = mesh.indexOffset * 4;
-            meshInfoGPU.vertexOffset =
-                static_cast<uint32_t>(m_verticesOffset) + mesh.vertexOffset * sizeof(Vertex);
+            meshInfoGPU.vertexOffset = static_cast<uint32_t>(MeshVertexByteOffset(mesh));
             meshInfoGPU.positionsOffset =
-                static_cast<uint32_t>(m_positionsOffset) + mesh.positionsOffset * sizeof(PositionUvVertex);
+                mesh.packedVertices
+                    ? meshInfoGPU.vertexOffset
+                    : static_cast<uint32_t>(m_positionsOffset) + mesh.positionsOffset * sizeof(PositionUvVertex);
             meshInfoGPU.renderType = static_cast<uint32_t>(mesh.renderType);
             meshInfoGPU.constantsIndex = record.constantsIndex;
 
             for (int k = 0; k < 5; k++)
                 meshInfoGPU.textures[k] = static_cast<int32_t>(meshRt.imageViewIndices[k]);
+            meshInfoGPU.vertexFormat = mesh.packedVertices ? 1u : 0u;
         }
         m_meshInfoBuffer->Flush();
         m_meshInfoBuffer->Unmap();
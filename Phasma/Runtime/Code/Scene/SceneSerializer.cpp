@@ -1,6 +1,7 @@
 #include "Scene/Scene.h"
 #include "Scene/Material.h"
 #include "Scene/ModelAsset.h"
+#include "Scene/ModelAssetCooked.h"
 #include "Scene/Primitives.h"
 #include "Scene/SceneHost.h"
 #include "Scene/SceneRuntimeHooks.h"
@@ -248,6 +249,7 @@ namespace pe
             settings.AddMember("lod_enabled", gSettings.lod_enabled, allocator);
             settings.AddMember("lod_count", gSettings.lod_count, allocator);
             settings.AddMember("lod_bias", gSettings.lod_bias, allocator);
+            settings.AddMember("lod_error_pixels", gSettings.lod_error_pixels, allocator);
             {
                 rapidjson::Value lodDist(rapidjson::kArrayType);
                 lodDist.PushBack(gSettings.lod_distances[0], allocator);
@@ -420,6 +422,8 @@ namespace pe
                 gSettings.lod_count = settings["lod_count"].GetUint();
             if (settings.HasMember("lod_bias"))
                 gSettings.lod_bias = settings["lod_bias"].GetFloat();
+            if (settings.HasMember("lod_error_pixels"))
+                gSettings.lod_error_pixels = settings["lod_error_pixels"].GetFloat();
             if (settings.HasMember("lod_distances") && settings["lod_distances"].IsArray() &&
                 settings["lod_distances"].Size() == 3)
             {
@@ -1429,6 +1433,55 @@ namespace pe
                     material.textures[k] = img;
             }
         }
+
+        std::filesystem::path ResolveModelSourcePath(const rapidjson::Value &entry, const std::filesystem::path &sceneFile)
+        {
+            std::filesystem::path modelPath = entry["path"].GetString();
+            if (modelPath.is_relative())
+                modelPath = sceneFile.parent_path() / modelPath;
+            return modelPath.lexically_normal();
+        }
+
+        std::string ModelPathKey(const std::filesystem::path &path)
+        {
+            auto u8 = path.u8string();
+            return std::string(u8.begin(), u8.end());
+        }
+
+        // Starts reading every cooked model the scene lists in one batch, so the loads below overlap
+        // their disk latency instead of paying it one model at a time
+        std::unordered_map<std::string, IoHandle> PrefetchCookedModels(const rapidjson::Value &entries, const std::filesystem::path &sceneFile)
+        {
+            std::vector<IoRead> reads;
+            for (rapidjson::SizeType i = 0; i < entries.Size(); i++)
+            {
+                const auto &entry = entries[i];
+                if (entry.HasMember("primitive_type") || !entry.HasMember("path"))
+                    continue;
+                const std::filesystem::path modelPath = ResolveModelSourcePath(entry, sceneFile);
+                if (ModelAssetCooked::IsCookedPath(modelPath))
+                    reads.push_back({ModelPathKey(modelPath)});
+            }
+
+            std::unordered_map<std::string, IoHandle> prefetched;
+            for (IoHandle &request : IoService::Get().ReadBatch(std::move(reads), IoPriority::High))
+                prefetched.emplace(request->GetRead().path, std::move(request));
+            return prefetched;
+        }
+
+        ModelAsset *LoadPrefetchedModel(const std::filesystem::path &modelPath, std::unordered_map<std::string, IoHandle> &prefetched)
+        {
+            auto it = prefetched.find(ModelPathKey(modelPath));
+            if (it == prefetched.end())
+                return ModelAsset::Load(modelPath); // source models, and repeats of an already loaded path
+
+            IoHandle request = std::move(it->second);
+            prefetched.erase(it); // the bytes are dropped as soon as the model is built
+            request->Wait();
+            if (request->GetStatus() != IoStatus::Done)
+                return ModelAsset::Load(modelPath); // reports the missing/unreadable file
+            return ModelAssetCooked::LoadFromMemory(request->Bytes(), modelPath);
+        }
     } // namespace
 
     struct SceneSerializationHelper
@@ -2630,6 +2683,7 @@ namespace pe
         m_ownedMaterials.clear();
         m_vertexStore.clear();
         m_positionUvStore.clear();
+        m_packedVertexStore.clear();
         m_aabbVertexStore.clear();
         m_indexStore.clear();
         m_imageStore.clear();
@@ -2712,6 +2766,7 @@ namespace pe
         {
             const auto &sourcesVal = d["sources"];
             result.models.resize(sourcesVal.Size(), nullptr);
+            std::unordered_map<std::string, IoHandle> prefetched = PrefetchCookedModels(sourcesVal, file);
             for (rapidjson::SizeType si = 0; si < sourcesVal.Size(); si++)
             {
                 const auto &sv = sourcesVal[si];
@@ -2724,12 +2779,9 @@ namespace pe
                 }
                 else if (sv.HasMember("path"))
                 {
-                    std::filesystem::path modelPath = sv["path"].GetString();
-                    if (modelPath.is_relative())
-                        modelPath = file.parent_path() / modelPath;
-                    modelPath = modelPath.lexically_normal();
+                    const std::filesystem::path modelPath = ResolveModelSourcePath(sv, file);
                     if (!std::filesystem::is_directory(modelPath))
-                        model = ModelAsset::Load(modelPath);
+                        model = LoadPrefetchedModel(modelPath, prefetched);
                 }
                 result.models[si] = model;
                 loading.current.fetch_add(1, std::memory_order_relaxed);
@@ -2739,6 +2791,7 @@ namespace pe
         {
             const auto &modelsVal = d["models"];
             result.models.resize(modelsVal.Size(), nullptr);
+            std::unordered_map<std::string, IoHandle> prefetched = PrefetchCookedModels(modelsVal, file);
             for (rapidjson::SizeType i = 0; i < modelsVal.Size(); i++)
             {
                 const auto &modelVal = modelsVal[i];
@@ -2751,13 +2804,10 @@ namespace pe
                 }
                 else if (modelVal.HasMember("path"))
                 {
-                    std::filesystem::path modelPath = modelVal["path"].GetString();
-                    if (modelPath.is_relative())
-                        modelPath = file.parent_path() / modelPath;
-                    modelPath = modelPath.lexically_normal();
+                    const std::filesystem::path modelPath = ResolveModelSourcePath(modelVal, file);
                     if (std::filesystem::is_directory(modelPath))
                         continue;
-                    model = ModelAsset::Load(modelPath);
+                    model = LoadPrefetchedModel(modelPath, prefetched);
                 }
                 result.models[i] = model;
                 loading.current.fetch_add(1, std::memory_order_relaxed);
@@ -2835,6 +2885,7 @@ namespace pe
         m_ownedMaterials.clear();
         m_vertexStore.clear();
         m_positionUvStore.clear();
+        m_packedVertexStore.clear();
         m_aabbVertexStore.clear();
         m_indexStore.clear();
         m_imageStore.clear();
@@ -4597,6 +4648,7 @@ namespace pe
                 m_ownedMaterials.clear();
                 m_vertexStore.clear();
                 m_positionUvStore.clear();
+                m_packedVertexStore.clear();
                 m_aabbVertexStore.clear();
                 m_indexStore.clear();
                 m_imageStore.clear();
@@ -697,7 +697,7 @@ namespace pe
         }
 
         const int meshIndex = refs[meshSlot];
-        if (!IsValidMeshIndex(meshIndex) || m_meshes[meshIndex].vertexCount != 4 ||
+        if (!IsValidMeshIndex(meshIndex) || m_meshes[meshIndex].vertexCount != 4 || m_meshes[meshIndex].packedVertices ||
             static_cast<size_t>(m_meshes[meshIndex].vertexOffset) + 4 > m_vertexStore.size() ||
             static_cast<size_t>(m_meshes[meshIndex].positionsOffset) + 4 > m_positionUvStore.size())
         {
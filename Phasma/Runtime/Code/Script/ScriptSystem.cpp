@@ -1852,7 +1852,7 @@ namespace pe
         m_scripts.clear();
         // Script render passes capture sol functions; release them before the state.
         ClearScriptRenderPasses();
-        m_lua = sol::state();
+        m_lua = sol::state(sol::default_at_panic, &ScriptSystem::LuaAlloc);
         m_initialized = false;
     }
 
@@ -1874,6 +1874,26 @@ namespace pe
         return bindings;
     }
 
+    void *ScriptSystem::LuaAlloc(void *, void *ptr, size_t osize, size_t nsize)
+    {
+        // With ptr == nullptr, osize is the Lua object type being allocated, not a size
+        if (nsize == 0)
+        {
+            if (ptr)
+                MemoryTracker::RemoveCpu(MemoryTag::Script, osize);
+            std::free(ptr);
+            return nullptr;
+        }
+
+        void *block = std::realloc(ptr, nsize);
+        if (!block)
+            return nullptr; // Lua keeps the old block
+        if (ptr)
+            MemoryTracker::RemoveCpu(MemoryTag::Script, osize);
+        MemoryTracker::AddCpu(MemoryTag::Script, nsize);
+        return block;
+    }
+
     std::vector<std::string> ScriptSystem::ListLuaFunctions()
     {
         std::vector<std::string> functions;
@@ -204,6 +204,8 @@ namespace pe
         void CollectHooks(NodeScriptInstance &inst);
         void CollectExposedVars(NodeScriptInstance &inst);
         static std::vector<LuaBindingFunc> &GetBindings();
+        // lua_Alloc that charges the state's heap to MemoryTag::Script
+        static void *LuaAlloc(void *ud, void *ptr, size_t osize, size_t nsize);
 
         void ProcessSceneLoads();
         void RegisterUpdateCallback(const std::string &id, sol::function fn, const std::string &mode);
@@ -229,7 +231,7 @@ namespace pe
         bool NodeInstanceRunsInEditor(const NodeScriptInstance &inst) const;
         bool NodeInstanceRunsInPlayer(const NodeScriptInstance &inst) const;
 
-        sol::state m_lua{};
+        sol::state m_lua{sol::default_at_panic, &ScriptSystem::LuaAlloc};
         std::vector<ScriptEntry> m_scripts{};
         std::vector<NodeScriptInstance> m_nodeInstances{};
         std::vector<NodeScriptInstance> m_zoneScriptInstances{};        // zone Script-section scripts
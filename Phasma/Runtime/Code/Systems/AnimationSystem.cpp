@@ -304,17 +304,37 @@ namespace pe
                 }
             }
 
-            NodeRuntime &rt = scene->GetNodeRuntime(state.nodeId);
-            AnimationEvaluator::EvaluatePose(clip, skeleton, state.time, rt.jointMatrices);
-            if (scene->NodeUsesSkinnedStrip2D(state.nodeId))
-            {
-                const NodeSkinnedStrip2DComponent *stripState = scene->GetSkinnedStrip2DState(state.nodeId);
-                SmoothExistingStripJointMatrices(skeleton,
-                                                 rt.jointMatrices,
-                                                 stripState ? &stripState->widthScales : nullptr);
-            }
-            scene->MarkNodeDirty(state.nodeId);
+            PoseJob &job = m_poseJobs.emplace_back();
+            job.clip = &clip;
+            job.skeleton = &skeleton;
+            job.jointMatrices = &scene->GetNodeRuntime(state.nodeId).jointMatrices;
+            job.node = state.nodeId;
+            job.time = state.time;
+            job.strip = scene->NodeUsesSkinnedStrip2D(state.nodeId);
+            if (job.strip)
+                job.stripState = scene->GetSkinnedStrip2DState(state.nodeId);
         }
+
+        // Poses evaluate across the workers; a 2D strip smooths its joints once its own pose is done.
+        // Scene state is only read above and marked dirty below, on this thread.
+        for (PoseJob &job : m_poseJobs)
+        {
+            PoseJob *pose = &job;
+            TaskGraph::Task *evaluate = m_poseGraph.Add([pose]()
+                                                        { AnimationEvaluator::EvaluatePose(*pose->clip, *pose->skeleton, pose->time, *pose->jointMatrices); });
+            if (!pose->strip)
+                continue;
+            m_poseGraph.Then(evaluate, [pose]()
+                             { SmoothExistingStripJointMatrices(*pose->skeleton, *pose->jointMatrices,
+                                                                pose->stripState ? &pose->stripState->widthScales : nullptr); });
+        }
+        m_poseGraph.Run();
+        m_poseGraph.Wait();
+        m_poseGraph.Reset();
+
+        for (const PoseJob &job : m_poseJobs)
+            scene->MarkNodeDirty(job.node);
+        m_poseJobs.clear();
     }
 
     void AnimationSystem::Destroy()
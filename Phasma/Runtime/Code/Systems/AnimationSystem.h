@@ -5,6 +5,7 @@
 namespace pe
 {
     struct NodeId;
+    class NodeSkinnedStrip2DComponent;
     class Scene;
 
     struct AnimationNodeState
@@ -69,7 +70,21 @@ namespace pe
         void ClearAllAnimations();
 
     private:
+        // One node's pose work for this frame, filled on the main thread before the graph runs
+        struct PoseJob
+        {
+            const AnimationClip *clip = nullptr;
+            const Skeleton *skeleton = nullptr;
+            const NodeSkinnedStrip2DComponent *stripState = nullptr;
+            std::vector<mat4> *jointMatrices = nullptr;
+            NodeId *node = nullptr;
+            float time = 0.0f;
+            bool strip = false;
+        };
+
         std::unordered_map<const NodeId *, size_t> m_nodeToIndex;
         std::vector<AnimationNodeState> m_states;
+        std::vector<PoseJob> m_poseJobs;
+        TaskGraph m_poseGraph; // pose evaluation, then strip smoothing for 2D strips; rebuilt every frame
     };
 } // namespace pe
@@ -30,7 +30,8 @@
 #include <Jolt/Jolt.h>
 
 #include <Jolt/Core/Factory.h>
-#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Physics/Body/Body.h>
 #include <Jolt/Physics/Body/BodyActivationListener.h>
@@ -89,6 +90,20 @@ namespace pe
                    state.nodeId->revision == state.nodeRevision &&
                    (scene.GetComponentFlags(state.nodeId) & Component_Physics) != 0;
         }
+
+        // Object-space position of a mesh's i-th vertex from whichever store backs it, or nullptr
+        // past the end of that store
+        const float *MeshVertexPosition(Scene &scene, const Mesh &mesh, uint32_t i)
+        {
+            const size_t index = static_cast<size_t>(mesh.vertexOffset) + i;
+            if (mesh.packedVertices)
+            {
+                const auto &packedStore = scene.GetPackedVertexStore();
+                return index < packedStore.size() ? packedStore[index].position : nullptr;
+            }
+            const auto &vertexStore = scene.GetVertexStore();
+            return index < vertexStore.size() ? vertexStore[index].position : nullptr;
+        }
     } // namespace
 
     // --- Jolt layer definitions ---
@@ -194,6 +209,82 @@ namespace pe
         PhysicsSystem &m_owner;
     };
 
+    // Runs Jolt's jobs on the engine JobSystem instead of a private JobSystemThreadPool, so physics
+    // steps share (and steal from) the same workers as voxel meshing and render-graph updates.
+    class JoltJobSystemAdapter final : public JPH::JobSystemWithBarrier
+    {
+    public:
+        JoltJobSystemAdapter(uint32_t maxJobs, uint32_t maxBarriers)
+        {
+            JobSystemWithBarrier::Init(maxBarriers);
+            m_jobs.Init(maxJobs, maxJobs);
+        }
+
+        int GetMaxConcurrency() const override
+        {
+            // Workers plus the thread that calls PhysicsSystem::Update and helps from WaitForJobs
+            return static_cast<int>(pe::JobSystem::Get().GetWorkerCount()) + 1;
+        }
+
+        JPH::JobHandle CreateJob(const char *name, JPH::ColorArg color, const JobFunction &function,
+                                 JPH::uint32 numDependencies = 0) override
+        {
+            uint32_t index;
+            for (;;)
+            {
+                index = m_jobs.ConstructObject(name, color, this, function, numDependencies);
+                if (index != Slots::cInvalidObjectIndex)
+                    break;
+                std::this_thread::yield();
+            }
+
+            Slot *slot = &m_jobs.Get(index);
+            JPH::JobHandle handle(slot); // keeps a reference; the job may complete as soon as it is queued
+            if (numDependencies == 0)
+                QueueJob(slot);
+            return handle;
+        }
+
+    protected:
+        void QueueJob(Job *job) override
+        {
+            job->AddRef();
+            pe::JobSystem::Get().Submit(static_cast<Slot *>(job), JobPriority::High);
+        }
+
+        void QueueJobs(Job **jobs, JPH::uint numJobs) override
+        {
+            for (JPH::uint i = 0; i < numJobs; ++i)
+                QueueJob(jobs[i]);
+        }
+
+        void FreeJob(Job *job) override
+        {
+            m_jobs.DestroyObject(static_cast<Slot *>(job));
+        }
+
+    private:
+        struct Slot : Job, pe::Job
+        {
+            Slot(const char *name, JPH::ColorArg color, JPH::JobSystem *system, const JobFunction &function,
+                 JPH::uint32 numDependencies)
+                : JPH::JobSystem::Job(name, color, system, function, numDependencies)
+            {
+                execute = &Slot::Run;
+            }
+
+            static void Run(pe::Job *job)
+            {
+                Slot *slot = static_cast<Slot *>(job);
+                slot->Execute();
+                slot->Release();
+            }
+        };
+        using Slots = JPH::FixedSizeFreeList<Slot>;
+
+        Slots m_jobs;
+    };
+
     // --- PhysicsSystem implementation ---
 
     PhysicsSystem::~PhysicsSystem()
@@ -213,9 +304,7 @@ namespace pe
         JPH::RegisterTypes();
 
         m_tempAllocator = new JPH::TempAllocatorImpl(kTempAllocatorBytes);
-        m_jobSystem = new JPH::JobSystemThreadPool(
-            JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers,
-            static_cast<int>(std::max(1u, std::thread::hardware_concurrency() - 1)));
+        m_jobSystem = new JoltJobSystemAdapter(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
 
         constexpr uint32_t numBodyMutexes = 0; // auto
 
@@ -844,7 +933,6 @@ namespace pe
             case PhysicsShapeType::ConvexHull:
             {
                 const auto &refs = scene.GetNodeCache(state.nodeId).meshRefs->meshRefs;
-                const auto &vertexStore = scene.GetVertexStore();
                 JPH::Array<JPH::Vec3> points;
                 for (int meshRef : refs)
                 {
@@ -852,13 +940,15 @@ namespace pe
                         continue;
                     const Mesh &mesh = scene.GetMesh(meshRef);
                     points.reserve(points.size() + mesh.vertexCount);
-                    for (uint32_t i = 0; i < mesh.vertexCount && (mesh.vertexOffset + i) < vertexStore.size(); i++)
+                    for (uint32_t i = 0; i < mesh.vertexCount; i++)
                     {
-                        const auto &v = vertexStore[mesh.vertexOffset + i];
+                        const float *position = MeshVertexPosition(scene, mesh, i);
+                        if (!position)
+                            break;
                         points.push_back(JPH::Vec3(
-                            v.position[0] * worldScale.x,
-                            v.position[1] * worldScale.y,
-                            v.position[2] * worldScale.z));
+                            position[0] * worldScale.x,
+                            position[1] * worldScale.y,
+                            position[2] * worldScale.z));
                     }
                 }
                 if (!points.empty())
@@ -905,7 +995,6 @@ namespace pe
                 // host bakes world positions), so worldScale is 1 in practice, and each tile's LOD0
                 // indices are mesh-local (0-based) so no cross-tile base offset is needed.
                 const auto &refs = scene.GetNodeCache(state.nodeId).meshRefs->meshRefs;
-                const auto &vertexStore = scene.GetVertexStore();
                 const auto &indexStore = scene.GetIndexStore();
                 JPH::Array<JPH::Ref<JPH::Shape>> tileShapes;
                 for (int meshRef : refs)
@@ -916,11 +1005,13 @@ namespace pe
                     JPH::VertexList verts;
                     JPH::IndexedTriangleList tris;
                     verts.reserve(mesh.vertexCount);
-                    for (uint32_t i = 0; i < mesh.vertexCount && (mesh.vertexOffset + i) < vertexStore.size(); ++i)
+                    for (uint32_t i = 0; i < mesh.vertexCount; ++i)
                     {
-                        const auto &v = vertexStore[mesh.vertexOffset + i];
-                        verts.push_back(JPH::Float3(v.position[0] * worldScale.x, v.position[1] * worldScale.y,
-                                                    v.position[2] * worldScale.z));
+                        const float *position = MeshVertexPosition(scene, mesh, i);
+                        if (!position)
+                            break;
+                        verts.push_back(JPH::Float3(position[0] * worldScale.x, position[1] * worldScale.y,
+                                                    position[2] * worldScale.z));
                     }
                     const uint32_t io = mesh.indexOffset, ic = mesh.indexCount; // LOD0 index range
                     tris.reserve(ic / 3);
@@ -321,6 +321,20 @@ namespace pe::terrain
         std::vector<SculptOp> ops = std::move(m_ops);
         Destroy();
         m_ops = std::move(ops);
+
+        PE_MEMORY_TAG(Terrain);
+        m_memoryReporter = MemoryTracker::AddReporter(MemoryTag::Terrain, [this]()
+                                                      {
+            // Terrain-owned CPU state only; tile geometry lives in the Scene's stores and counts there
+            uint64_t bytes = m_tiles.capacity() * sizeof(Tile) + m_rings.capacity() * sizeof(Ring) +
+                             m_ops.capacity() * sizeof(SculptOp);
+            for (const voxel::MapImage *map : {m_cavesMap.get(), m_scatterMap.get()})
+            {
+                if (map)
+                    bytes += map->px.capacity() + map->pxf.capacity() * sizeof(float);
+            }
+            return bytes; });
+
         m_scene = scene;
         m_cfg = cfg;
         m_cfg.sizeXMeters = std::max(0, m_cfg.sizeXMeters);
@@ -1200,6 +1214,7 @@ namespace pe::terrain
             const float *positions = reinterpret_cast<const float *>(verts.data());
             static constexpr float kRatios[Mesh::kMaxLods] = {1.0f, 0.5f, 0.25f, 0.12f};
             std::vector<uint32_t> simplified(indices.size());
+            const float errorScale = meshopt_simplifyScale(positions, verts.size(), sizeof(Vertex));
             uint32_t prevCount = lod0Count;
             for (uint32_t lod = 1; lod < Mesh::kMaxLods; ++lod)
             {
@@ -1214,6 +1229,7 @@ namespace pe::terrain
                     indices.size() + resCount > job.indexBudget)
                     break;
                 out.lodIndexCount[lod] = static_cast<uint32_t>(resCount);
+                out.lodError[lod] = std::max(err * errorScale, out.lodError[lod - 1]);
                 out.lodCount = lod + 1;
                 indices.insert(indices.end(), simplified.begin(), simplified.begin() + resCount);
                 prevCount = static_cast<uint32_t>(resCount);
@@ -1257,6 +1273,7 @@ namespace pe::terrain
         {
             mesh.lodIndexOffset[lod] = off;
             mesh.lodIndexCount[lod] = m.lodIndexCount[lod];
+            mesh.lodError[lod] = m.lodError[lod];
             off += m.lodIndexCount[lod];
         }
 
@@ -1467,13 +1484,19 @@ namespace pe::terrain
             m_meshCv.notify_all();
         }
 
-        // 3. Upload the tiles committed above (staged, submitted-not-waited on the main queue).
+        // 3. Upload the tiles committed above (staged, submitted-not-waited on the copy queue when there
+        // is one). The tiles rewrite their ranges in place, so the copies wait for every frame already
+        // submitted, and the main queue waits for the copies before its next draws.
         if (uploaded.empty())
             return;
 
-        Queue *q = RHII.GetMainQueue();
-        if (!q)
+        Queue *mainQueue = RHII.GetMainQueue();
+        if (!mainQueue)
             return;
+        Queue *q = RHII.GetTransferQueue();
+        const bool asyncTransfer = q != mainQueue;
+        if (asyncTransfer)
+            q->WaitForQueue(mainQueue, mainQueue->GetSubmissionCount(), PE_STAGE_TRANSFER);
         CommandBuffer *cmd = q->AcquireCommandBuffer();
         cmd->Begin();
         for (int t : uploaded)
@@ -1485,6 +1508,10 @@ namespace pe::terrain
         cmd->End();
         q->Submit(1, &cmd, nullptr, nullptr);
         m_submittedCmds.push_back(cmd);
+        if (asyncTransfer)
+            mainQueue->WaitForQueue(q, q->GetSubmissionCount(),
+                                    PE_STAGE_DRAW_INDIRECT | PE_STAGE_VERTEX_INPUT | PE_STAGE_VERTEX_SHADER |
+                                        PE_STAGE_COMPUTE_SHADER);
     }
 
     // An overflow means the ring's shared budget estimate lost to this worldgen region — and slots are
@@ -1694,6 +1721,7 @@ namespace pe::terrain
         const bool recreate =
             !cur || static_cast<int>(cur->GetWidth()) != w || static_cast<int>(cur->GetHeight()) != h;
 
+        PE_MEMORY_TAG(Terrain);
         CommandBuffer *cmd = queue->AcquireCommandBuffer();
         cmd->Begin();
         Image *target = cur;
@@ -1906,6 +1934,7 @@ namespace pe::terrain
 
     bool TerrainWorld::BuildTerrainTextures()
     {
+        PE_MEMORY_TAG(Terrain);
         m_terrainTextures.clear();
         if (!m_scene)
             return false;
@@ -2000,6 +2029,8 @@ namespace pe::terrain
     void TerrainWorld::Destroy()
     {
         StopMeshWorker(); // join the mesher before any state it reads is freed
+        MemoryTracker::RemoveReporter(m_memoryReporter);
+        m_memoryReporter = 0;
         RetireSubmittedCommands(true);
         for (Tile &tile : m_tiles)
         {
@@ -218,6 +218,7 @@ namespace pe::terrain
             std::vector<Vertex> verts;
             std::vector<uint32_t> indices; // lod0 then simplified levels, contiguous
             uint32_t lodIndexCount[kTileLods] = {};
+            float lodError[kTileLods] = {}; // simplification error per level, mesh units
             uint32_t lodCount = 0;
             uint32_t lod0Count = 0;
             uint32_t collideEnd = 0;
@@ -307,6 +308,7 @@ namespace pe::terrain
         std::vector<Ring> m_rings;
         std::vector<Tile> m_tiles; // all rings, ring-major (Ring::firstTile indexes in here)
         std::vector<SculptOp> m_ops;
+        MemoryTracker::ReporterId m_memoryReporter = 0;
         // Background meshing. Dirty tiles are snapshotted into m_meshInput (main -> worker), meshed off
         // the main thread, and returned in m_meshOutput (worker -> main) for commit + upload. All three
         // + m_meshProcessing/m_meshStop are guarded by m_meshMutex. The mesher's other reads (generator,
@@ -37,17 +37,32 @@ namespace pe::voxel
             return static_cast<bool>(out);
         }
 
-        bool ReadSection(std::ifstream &in, ChunkSection &section)
+        bool ReadHeader(std::span<const uint8_t> bytes, ColumnHeader &hdr)
         {
-            BlockId buffer[kBlocksPerSection];
-            in.read(reinterpret_cast<char *>(buffer),
-                    static_cast<std::streamsize>(kBlocksPerSection * sizeof(BlockId)));
-            if (!in)
+            if (bytes.size() < sizeof(hdr))
                 return false;
+            std::memcpy(&hdr, bytes.data(), sizeof(hdr));
+            return std::memcmp(hdr.magic, ColumnChunkStore::kMagic, 4) == 0 && hdr.version == ColumnChunkStore::kVersion;
+        }
+
+        bool ReadSection(std::span<const uint8_t> bytes, size_t &offset, ChunkSection &section)
+        {
+            constexpr size_t kSectionBytes = kBlocksPerSection * sizeof(BlockId);
+            if (bytes.size() - offset < kSectionBytes)
+                return false;
+            BlockId buffer[kBlocksPerSection];
+            std::memcpy(buffer, bytes.data() + offset, kSectionBytes);
+            offset += kSectionBytes;
             section.Store().ReplaceAll(buffer, kBlocksPerSection);
             section.SetDirty(true);
             return true;
         }
+
+        std::string PathToUtf8(const std::filesystem::path &path)
+        {
+            const std::u8string utf8 = path.u8string();
+            return std::string(reinterpret_cast<const char *>(utf8.c_str()), utf8.size());
+        }
     } // namespace
 
     std::filesystem::path ColumnChunkStore::ResolveRoot(const std::string &configured)
@@ -73,34 +88,47 @@ namespace pe::voxel
             return false;
 
         const std::filesystem::path path = ColumnPath(root, column.Coord());
-        std::ifstream in(path, std::ios::binary);
-        if (!in)
+        const std::string source = PathToUtf8(path);
+        FileView file(source);
+        if (!file.IsOpen())
             return false;
+        return ApplyOverlay(file.Bytes(), column, source) != 0;
+    }
 
+    IoHandle ColumnChunkStore::RequestOverlay(const std::filesystem::path &root, ColumnCoord coord, IoPriority priority)
+    {
+        if (root.empty())
+            return nullptr;
+        return IoService::Get().Read({PathToUtf8(ColumnPath(root, coord))}, priority);
+    }
+
+    uint16_t ColumnChunkStore::ApplyOverlay(std::span<const uint8_t> bytes, ChunkColumn &column, const std::string &source)
+    {
         ColumnHeader hdr{};
-        if (!ReadHeader(in, hdr))
+        if (!ReadHeader(bytes, hdr))
         {
-            PE_WARN("[ColumnChunkStore] Invalid column file: %s", path.generic_string().c_str());
-            return false;
+            PE_WARN("[ColumnChunkStore] Invalid column file: %s", source.c_str());
+            return 0;
         }
 
         if (hdr.cx != column.Coord().cx || hdr.cz != column.Coord().cz)
         {
-            PE_WARN("[ColumnChunkStore] Column coord mismatch in %s", path.generic_string().c_str());
-            return false;
+            PE_WARN("[ColumnChunkStore] Column coord mismatch in %s", source.c_str());
+            return 0;
         }
 
+        size_t offset = sizeof(ColumnHeader);
         for (int si = 0; si < kSectionCount; ++si)
         {
             if ((hdr.sectionMask & (1u << si)) == 0)
                 continue;
-            if (!ReadSection(in, column.Section(si)))
+            if (!ReadSection(bytes, offset, column.Section(si)))
             {
-                PE_WARN("[ColumnChunkStore] Truncated column file: %s", path.generic_string().c_str());
-                return false;
+                PE_WARN("[ColumnChunkStore] Truncated column file: %s", source.c_str());
+                break; // the header still names the sections Save must keep
             }
         }
-        return true;
+        return hdr.sectionMask;
     }
 
     uint16_t ColumnChunkStore::PersistedSectionMask(const std::filesystem::path &root, ColumnCoord coord)
@@ -18,6 +18,12 @@ namespace pe::voxel
         // Overwrites sections present in the on-disk file; returns false when no file exists.
         static bool TryOverlay(const std::filesystem::path &root, ChunkColumn &column);
 
+        // Streaming form of TryOverlay: start the read here, hand its bytes to ApplyOverlay once done.
+        static IoHandle RequestOverlay(const std::filesystem::path &root, ColumnCoord coord, IoPriority priority);
+        // Overwrites the sections present in a column file's bytes; returns the file's section mask,
+        // or 0 when the bytes are not a valid file for this column.
+        static uint16_t ApplyOverlay(std::span<const uint8_t> bytes, ChunkColumn &column, const std::string &source);
+
         // Section mask from an existing column file, or 0 when absent/invalid.
         static uint16_t PersistedSectionMask(const std::filesystem::path &root, ColumnCoord coord);
 
@@ -10,6 +10,8 @@ namespace pe::voxel
         if (!m_scene)
             return;
 
+        PE_MEMORY_TAG(Voxel);
+
         // Single packed vertex stream now (8 B/vert). ReserveArenaCapacity sizes the dedicated voxel
         // vertex buffer from vtxHeadroomBytes / sizeof(VoxelVertex); the posUv headroom is unused.
         const uint32_t vtxHeadroomBytes = vtxCapVertices * static_cast<uint32_t>(sizeof(VoxelVertex));
@@ -177,6 +179,7 @@ namespace pe::voxel
         const uint32_t newVtxCap = vtxPressure ? vtxCap + vtxCap / 2u + 1u : vtxCap;
         const uint32_t newIdxCap = idxPressure ? idxCap + idxCap / 2u + 1u : idxCap;
 
+        PE_MEMORY_TAG(Voxel);
         if (m_scene->GrowArenaVoxelCapacity(cmd, newVtxCap, static_cast<size_t>(newIdxCap)))
         {
             if (vtxPressure)
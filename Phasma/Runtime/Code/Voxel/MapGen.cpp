@@ -50,8 +50,8 @@ namespace pe::voxel
         if (configured.empty())
             return false;
         const std::filesystem::path path = ColumnChunkStore::ResolveRoot(configured);
-        FileSystem file(path.string(), std::ios::in | std::ios::binary);
-        const std::vector<uint8_t> bytes = file.IsOpen() ? file.ReadAllBytes() : std::vector<uint8_t>{};
+        const FileView file(path.string());
+        const std::span<const uint8_t> bytes = file.Bytes(); // empty when missing
 
         if (signedFloat)
         {
@@ -122,11 +122,10 @@ namespace pe::voxel
                 int tileWidth = 0;
                 int tileHeight = 0;
                 int channels = 0;
-                FileSystem tileFile(tilePngPaths[layer], std::ios::in | std::ios::binary);
-                const std::vector<uint8_t> tileBytes = tileFile.IsOpen() ? tileFile.ReadAllBytes() : std::vector<uint8_t>{};
-                pixels[layer] = tileBytes.empty() ? nullptr
-                                                  : stbi_load_from_memory(tileBytes.data(), static_cast<int>(tileBytes.size()),
-                                                                          &tileWidth, &tileHeight, &channels, STBI_rgb_alpha);
+                const FileView tileFile(tilePngPaths[layer]);
+                pixels[layer] = tileFile.Size() == 0 ? nullptr
+                                                     : stbi_load_from_memory(tileFile.Data(), static_cast<int>(tileFile.Size()),
+                                                                             &tileWidth, &tileHeight, &channels, STBI_rgb_alpha);
                 if (!pixels[layer])
                 {
                     PE_WARN("[VoxelMaterial] Failed to load tile png: %s", tilePngPaths[layer].c_str());
@@ -392,6 +392,19 @@ namespace pe::voxel
         if (!scene)
             return;
 
+        PE_MEMORY_TAG(Voxel);
+        m_memoryReporter = MemoryTracker::AddReporter(MemoryTag::Voxel, [this]()
+                                                      {
+            // Node + bucket estimate for the column map, plus the fixed-size block data of loaded columns
+            uint64_t bytes = m_columns.bucket_count() * sizeof(void *) +
+                             m_columns.size() * (sizeof(std::pair<const uint64_t, ColumnState>) + 2 * sizeof(void *));
+            for (const auto &entry : m_columns)
+            {
+                if (entry.second.column)
+                    bytes += sizeof(ChunkColumn);
+            }
+            return bytes; });
+
         m_scene = scene;
         m_cfg = cfg;
         m_cfg.loadRadius = std::max(0, m_cfg.loadRadius);
@@ -539,6 +552,9 @@ namespace pe::voxel
         RetireSubmittedUpdateCommands(true);
         PersistAllTouchedColumns();
 
+        MemoryTracker::RemoveReporter(m_memoryReporter);
+        m_memoryReporter = 0;
+
         if (m_scene)
             m_scene->SetVoxelAtlasView(nullptr);
         m_voxelMaterial.reset();
@@ -688,6 +704,16 @@ namespace pe::voxel
         if (!queue)
             return;
 
+        // With a dedicated copy queue the streamed uploads run on the DMA engine beside the frame's
+        // graphics work, and the main queue waits on the batch's timeline value before it reads the arena.
+        Queue *transferQueue = RHII.GetTransferQueue();
+        const bool asyncTransfer = transferQueue != queue;
+        if (asyncTransfer)
+        {
+            queue = transferQueue;
+            m_scene->BeginArenaTransfer();
+        }
+
         CommandBuffer *cmd = queue->AcquireCommandBuffer();
         cmd->Begin();
         // Grow the voxel pool before this frame's removals/uploads so the grown buffer is live for them.
@@ -699,10 +725,16 @@ namespace pe::voxel
         // Remesh applies get their own equal per-frame allowance (separate from streaming uploads so
         // edits never starve while new terrain streams in). Bounds the previously-unbounded remesh burst.
         RemeshDirtySections(cmd, m_cfg.uploadBudgetPerFrame);
-        m_scene->FlushArenaBarriers(cmd);
+        if (asyncTransfer)
+            m_scene->EndArenaTransfer();
+        else
+            m_scene->FlushArenaBarriers(cmd);
         cmd->End();
         queue->Submit(1, &cmd, nullptr, nullptr);
         m_submittedUpdateCmds.push_back(cmd);
+        if (asyncTransfer)
+            RHII.GetMainQueue()->WaitForQueue(queue, queue->GetSubmissionCount(),
+                                              PE_STAGE_DRAW_INDIRECT | PE_STAGE_VERTEX_INPUT | PE_STAGE_COMPUTE_SHADER);
     }
 
     BlockRegistry &VoxelWorld::Registry()
@@ -890,23 +922,29 @@ namespace pe::voxel
         m_columns.emplace(ColumnKey(coord), std::move(state));
     }
 
-    std::shared_future<ChunkColumn> VoxelWorld::EnqueueGenerationJob(ColumnCoord coord, int genLod)
+    std::shared_future<VoxelWorld::GeneratedColumn> VoxelWorld::EnqueueGenerationJob(ColumnCoord coord, int genLod)
     {
         // Capture the generator by shared_ptr (not a raw VoxelWorld pointer): Destroy() drops the
         // generationFuture without waiting, so an in-flight job may outlive Destroy — the shared_ptr
         // keeps the generator alive until that last job returns. Generators must be thread-safe
         // (NoiseGen is stateless); workers run Generate() concurrently on distinct columns.
         std::shared_ptr<ITerrainGenerator> gen = m_generator;
-        const std::filesystem::path saveRoot = m_saveRoot;
+        // The save file read is issued now and lands while the terrain generates; full-detail columns
+        // are the ones around the player, so they jump the I/O queue.
+        IoHandle overlay = ColumnChunkStore::RequestOverlay(m_saveRoot, coord, genLod == 0 ? IoPriority::High : IoPriority::Normal);
         return ThreadPool::General.Enqueue(
-            [coord, gen, saveRoot, genLod]() -> ChunkColumn
+            [coord, gen, overlay, genLod]() -> GeneratedColumn
             {
-                ChunkColumn column(coord);
+                GeneratedColumn result{ChunkColumn(coord)};
                 if (gen)
-                    gen->Generate(column, genLod);
-                if (!saveRoot.empty())
-                    ColumnChunkStore::TryOverlay(saveRoot, column);
-                return column;
+                    gen->Generate(result.column, genLod);
+                if (overlay)
+                {
+                    overlay->Wait();
+                    if (overlay->GetStatus() == IoStatus::Done)
+                        result.persistedMask = ColumnChunkStore::ApplyOverlay(overlay->Bytes(), result.column, overlay->GetRead().path);
+                }
+                return result;
             });
     }
 
@@ -933,10 +971,10 @@ namespace pe::voxel
 
             if (state.state == ColumnLoadState::Generating)
             {
-                state.column = std::make_unique<ChunkColumn>(state.generationFuture.get());
-                state.generationFuture = std::shared_future<ChunkColumn>();
-                if (!m_saveRoot.empty())
-                    state.touchedSectionMask |= ColumnChunkStore::PersistedSectionMask(m_saveRoot, state.coord);
+                const GeneratedColumn &generated = state.generationFuture.get();
+                state.column = std::make_unique<ChunkColumn>(generated.column);
+                state.touchedSectionMask |= generated.persistedMask;
+                state.generationFuture = std::shared_future<GeneratedColumn>();
                 ApplyPendingEdits(key, *state.column);
                 state.state = ColumnLoadState::Generated;
                 TryStartColumnMeshing(state);
@@ -945,8 +983,8 @@ namespace pe::voxel
             {
                 // Finer-data regeneration finished: swap the column and remesh through the budgeted
                 // path (the old, coarser meshes stayed live until now — no visual hole).
-                state.column = std::make_unique<ChunkColumn>(state.generationFuture.get());
-                state.generationFuture = std::shared_future<ChunkColumn>();
+                state.column = std::make_unique<ChunkColumn>(state.generationFuture.get().column);
+                state.generationFuture = std::shared_future<GeneratedColumn>();
                 state.regenPending = false;
                 state.genLod = state.regenLod;
                 ApplyPendingEdits(key, *state.column);
@@ -1022,26 +1060,64 @@ namespace pe::voxel
         m_pendingEdits.erase(editsIt);
     }
 
+    void SectionMeshBatch::Start(const std::shared_ptr<SectionMeshBatch> &batch, std::span<const int> sections)
+    {
+        if (sections.empty())
+            return;
+
+        batch->m_self = batch;
+        batch->m_running.store(static_cast<int>(sections.size()), std::memory_order_relaxed);
+        for (int si : sections)
+        {
+            SectionJob &job = batch->jobs[si];
+            job.execute = &SectionMeshBatch::Execute;
+            job.batch = batch.get();
+            job.section = si;
+        }
+        for (int si : sections)
+            JobSystem::Get().Submit(&batch->jobs[si], JobPriority::Normal);
+    }
+
+    void SectionMeshBatch::Execute(Job *job)
+    {
+        SectionJob *sectionJob = static_cast<SectionJob *>(job);
+        SectionMeshBatch *batch = sectionJob->batch;
+        const int si = sectionJob->section;
+        batch->meshes[si] = MeshSectionCpu(*batch->column, *batch->registry, si, batch->coord, batch->neighbors, batch->lod);
+        batch->ready[si].store(true, std::memory_order_release);
+
+        if (batch->m_running.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            batch->column.reset();
+            batch->registry.reset();
+            batch->neighbors = ColumnNeighbors{};
+            std::shared_ptr<SectionMeshBatch> self = std::move(batch->m_self); // may destroy the batch
+        }
+    }
+
     void VoxelWorld::EnqueueColumnMeshing(ColumnState &state)
     {
         if (!state.column)
             return;
 
-        const ColumnCoord coord = state.coord;
-        const int lod = state.lod;
-        auto columnSnapshot = std::make_shared<ChunkColumn>(*state.column);
+        auto batch = std::make_shared<SectionMeshBatch>();
+        batch->column.emplace(*state.column);
         // lod > 0 caps section walls instead of reading across columns, so the (expensive, ~9-column
         // deep-copy) neighbor snapshot is only taken for full-detail meshing.
-        auto neighbors = std::make_shared<ColumnNeighbors>(lod == 0 ? GatherNeighborSnapshots(coord)
-                                                                    : ColumnNeighbors{});
-        auto registrySnapshot = std::make_shared<BlockRegistry>(m_registry);
+        if (state.lod == 0)
+            batch->neighbors = GatherNeighborSnapshots(state.coord);
+        batch->registry.emplace(m_registry);
+        batch->coord = state.coord;
+        batch->lod = state.lod;
+
+        std::array<int, kSectionCount> sections;
         for (int si = 0; si < kSectionCount; ++si)
         {
             state.sectionUploaded[si] = false;
-            state.meshFutures[si] = ThreadPool::General.Enqueue(
-                [columnSnapshot, neighbors, registrySnapshot, coord, si, lod]() -> MeshData
-                { return MeshSectionCpu(*columnSnapshot, *registrySnapshot, si, coord, *neighbors, lod); });
+            sections[si] = si;
         }
+        SectionMeshBatch::Start(batch, sections);
+        state.meshBatch = std::move(batch);
         state.state = ColumnLoadState::Meshing;
     }
 
@@ -1154,12 +1230,12 @@ namespace pe::voxel
             for (int oi = 0; oi < kSectionCount; ++oi)
             {
                 const int si = sectionOrder[oi];
-                if (state.sectionUploaded[si] || !FutureReady(state.meshFutures[si]))
+                if (state.sectionUploaded[si] || !state.meshBatch || !state.meshBatch->IsReady(si))
                     continue;
                 if (uploads >= budget)
                     return uploads;
 
-                const MeshData &mesh = state.meshFutures[si].get();
+                const MeshData &mesh = state.meshBatch->meshes[si];
                 if (!mesh.vertices.empty() || !mesh.transparentVertices.empty())
                 {
                     ArenaHandle opaqueH, transH;
@@ -1172,7 +1248,7 @@ namespace pe::voxel
                 }
                 state.sectionUploaded[si] = true;
                 state.sectionLod[si] = static_cast<uint8_t>(state.lod);
-                state.meshFutures[si] = std::shared_future<MeshData>();
+                state.meshBatch->ReleaseMesh(si);
             }
 
             bool allUploaded = true;
@@ -1180,6 +1256,7 @@ namespace pe::voxel
                 allUploaded = allUploaded && state.sectionUploaded[si];
             if (allUploaded)
             {
+                state.meshBatch.reset();
                 state.state = ColumnLoadState::Ready;
                 // The anchor may have crossed a lod band while this column was meshing — the
                 // transition sweep in RequestColumnsForAnchor only sees Ready columns, so re-check here.
@@ -1274,20 +1351,20 @@ namespace pe::voxel
         if (toMesh.empty())
             return;
 
-        auto columnSnapshot = std::make_shared<ChunkColumn>(*state.column);
-        auto neighbors = std::make_shared<ColumnNeighbors>(state.lod == 0 ? GatherNeighborSnapshots(state.coord)
-                                                                          : ColumnNeighbors{});
-        auto registrySnapshot = std::make_shared<BlockRegistry>(m_registry);
-        const ColumnCoord coord = state.coord;
-        const int lod = state.lod;
+        auto batch = std::make_shared<SectionMeshBatch>();
+        batch->column.emplace(*state.column);
+        if (state.lod == 0)
+            batch->neighbors = GatherNeighborSnapshots(state.coord);
+        batch->registry.emplace(m_registry);
+        batch->coord = state.coord;
+        batch->lod = state.lod;
         for (int si : toMesh)
         {
-            state.remeshFutures[si] = ThreadPool::General.Enqueue(
-                [columnSnapshot, neighbors, registrySnapshot, coord, si, lod]() -> MeshData
-                { return MeshSectionCpu(*columnSnapshot, *registrySnapshot, si, coord, *neighbors, lod); });
+            state.remeshBatches[si] = batch;
             state.remeshPending[si] = true;
-            state.remeshLod[si] = static_cast<uint8_t>(lod);
+            state.remeshLod[si] = static_cast<uint8_t>(state.lod);
         }
+        SectionMeshBatch::Start(batch, toMesh);
     }
 
     void VoxelWorld::ProcessDirtyRemeshResults(CommandBuffer *cmd, int applyBudget)
@@ -1302,11 +1379,11 @@ namespace pe::voxel
             for (int si = 0; si < kSectionCount; ++si)
             {
                 if (applied >= applyBudget)
-                    return; // budget spent — ready futures stay pending and apply next frame
-                if (!state.remeshPending[si] || !FutureReady(state.remeshFutures[si]))
+                    return; // budget spent — ready sections stay pending and apply next frame
+                if (!state.remeshPending[si] || !state.remeshBatches[si] || !state.remeshBatches[si]->IsReady(si))
                     continue;
 
-                const MeshData &mesh = state.remeshFutures[si].get();
+                const MeshData &mesh = state.remeshBatches[si]->meshes[si];
                 const bool sectionHasBlocks = state.column && !state.column->Section(si).IsEmpty();
                 const bool meshEmpty = mesh.vertices.empty() && mesh.transparentVertices.empty();
                 const bool hasAnyHandle = state.handles[si].valid || state.transparentHandles[si].valid;
@@ -1314,7 +1391,7 @@ namespace pe::voxel
                 // (e.g. coarse wall caps mesh to nothing at lod 0) and the old mesh must release below.
                 if (meshEmpty && sectionHasBlocks && hasAnyHandle && state.remeshLod[si] == state.sectionLod[si])
                 {
-                    state.remeshFutures[si] = std::shared_future<MeshData>();
+                    state.remeshBatches[si].reset();
                     state.remeshPending[si] = false;
                     if (state.dirtyAfterRemesh[si])
                     {
@@ -1355,7 +1432,8 @@ namespace pe::voxel
                 }
 
                 state.sectionLod[si] = state.remeshLod[si];
-                state.remeshFutures[si] = std::shared_future<MeshData>();
+                state.remeshBatches[si]->ReleaseMesh(si);
+                state.remeshBatches[si].reset();
                 state.remeshPending[si] = false;
 
                 if (state.dirtyAfterRemesh[si])
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <span>
+
 #include "Voxel/BlockRegistry.h"
 #include "Voxel/ChunkColumn.h"
 #include "Voxel/GeometryArena.h"
@@ -31,6 +33,40 @@ namespace pe::voxel
         std::shared_ptr<const ChunkColumn> posXposZ;
     };
 
+    // One column snapshot meshed as one job per requested section, results polled per section. A single
+    // allocation per batch instead of a packaged_task, std::function and shared_future per section.
+    struct SectionMeshBatch
+    {
+        struct SectionJob : Job
+        {
+            SectionMeshBatch *batch = nullptr;
+            int section = 0;
+        };
+
+        // Inputs; the last section job drops them so a half-uploaded batch only holds its results
+        std::optional<ChunkColumn> column;
+        ColumnNeighbors neighbors;
+        std::optional<BlockRegistry> registry;
+        ColumnCoord coord{};
+        int lod = 0;
+        std::array<SectionJob, kSectionCount> jobs{};
+        std::array<MeshData, kSectionCount> meshes;
+        std::array<std::atomic<bool>, kSectionCount> ready{};
+
+        // Submits one job per section; the batch keeps itself alive until the last of them finishes, so an
+        // in-flight batch may outlive the world that started it.
+        static void Start(const std::shared_ptr<SectionMeshBatch> &batch, std::span<const int> sections);
+        bool IsReady(int si) const { return ready[si].load(std::memory_order_acquire); }
+        // Frees a consumed section's mesh without waiting for the rest of the batch
+        void ReleaseMesh(int si) { meshes[si] = MeshData{}; }
+
+    private:
+        static void Execute(Job *job);
+
+        std::shared_ptr<SectionMeshBatch> m_self;
+        std::atomic<int> m_running{0};
+    };
+
     struct VoxelConfig
     {
         int loadRadius = 8;
@@ -140,14 +176,20 @@ namespace pe::voxel
             BlockId id = kAir;
         };
 
+        struct GeneratedColumn
+        {
+            ChunkColumn column;
+            uint16_t persistedMask = 0; // sections overlaid from the save file
+        };
+
         struct ColumnState
         {
             ColumnCoord coord{};
             ColumnLoadState state = ColumnLoadState::Empty;
-            std::shared_future<ChunkColumn> generationFuture;
+            std::shared_future<GeneratedColumn> generationFuture;
             std::unique_ptr<ChunkColumn> column;
-            std::array<std::shared_future<MeshData>, kSectionCount> meshFutures;
-            std::array<std::shared_future<MeshData>, kSectionCount> remeshFutures;
+            std::shared_ptr<SectionMeshBatch> meshBatch;                               // all sections
+            std::array<std::shared_ptr<SectionMeshBatch>, kSectionCount> remeshBatches; // shared per remesh
             std::array<ArenaHandle, kSectionCount> handles{};
             std::array<ArenaHandle, kSectionCount> transparentHandles{}; // water sub-mesh per section
             std::array<bool, kSectionCount> sectionUploaded{};
@@ -186,7 +228,7 @@ namespace pe::voxel
         void CreateHostMesh();
         void RequestColumnsForAnchor();
         void EnqueueColumnGeneration(ColumnCoord coord);
-        std::shared_future<ChunkColumn> EnqueueGenerationJob(ColumnCoord coord, int genLod);
+        std::shared_future<GeneratedColumn> EnqueueGenerationJob(ColumnCoord coord, int genLod);
         void ProcessGenerationResults();
         void ApplyPendingEdits(uint64_t key, ChunkColumn &column);
         void EnqueueColumnMeshing(ColumnState &state);
@@ -203,7 +245,7 @@ namespace pe::voxel
         void ReleaseColumn(ColumnState &state);
         void EnqueueSectionRemeshBatch(ColumnState &state, const std::vector<int> &sections);
         // applyBudget caps section uploads applied per frame so a burst of completed remeshes spreads
-        // over frames instead of spiking; remaining ready futures stay pending for the next frame.
+        // over frames instead of spiking; remaining ready sections stay pending for the next frame.
         void ProcessDirtyRemeshResults(CommandBuffer *cmd, int applyBudget);
         void RemeshDirtySections(CommandBuffer *cmd, int applyBudget);
         void MarkSectionDirty(ColumnCoord coord, int si);
@@ -226,6 +268,7 @@ namespace pe::voxel
         BlockRegistry m_registry;
         GeometryArena m_arena;
         std::unordered_map<uint64_t, ColumnState> m_columns;
+        MemoryTracker::ReporterId m_memoryReporter = 0;
         std::unordered_map<uint64_t, std::vector<PendingEdit>> m_pendingEdits;
         std::vector<std::pair<uint64_t, int>> m_dirtySections; // (ColumnKey, sectionIndex) pending remesh
         std::vector<CommandBuffer *> m_submittedUpdateCmds;
@@ -0,0 +1,45 @@
+#ifndef MESH_LOD_H_
+#define MESH_LOD_H_
+
+#include "Structures.hlsl"
+
+// LOD params (Scene::UpdateLodUniforms), shared by CullingCS and ShadowCullCS. Present in every cull
+// variant (push constants are full at 128B, so the global LOD knobs live here).
+// lodDistances.x/y/z are the world-unit switch points LOD0->1/1->2/2->3, used when lodErrorScale is 0.
+// lodErrorScale = viewport height * projection[1][1] / 2 / pixel threshold: a level whose world-space
+// error e satisfies e * lodErrorScale <= distance projects under the threshold.
+[[vk::binding(16, 0)]] cbuffer LodUBO
+{
+    uint lodEnabled;
+    uint lodPad0;
+    float lodBias;
+    float lodErrorScale;
+    float4 lodDistances;
+};
+
+// lodDist is the (biased) camera distance to the mesh. Error mode keeps the coarsest level whose
+// simplification error, scaled by the world matrix's largest axis, stays under the pixel threshold.
+uint PickMeshLod(Mesh_Constants constants, float4x4 worldMatrix, float lodDist)
+{
+    uint lod = 0u;
+    if (lodErrorScale > 0.0)
+    {
+        float worldScale = sqrt(max(dot(worldMatrix[0].xyz, worldMatrix[0].xyz),
+                                    max(dot(worldMatrix[1].xyz, worldMatrix[1].xyz),
+                                        dot(worldMatrix[2].xyz, worldMatrix[2].xyz))));
+        for (uint l = 1u; l < constants.lodCount; ++l)
+        {
+            if (constants.lodError[l] * worldScale * lodErrorScale <= lodDist)
+                lod = l;
+        }
+    }
+    else
+    {
+        if (lodDist > lodDistances.x) lod = 1u;
+        if (lodDist > lodDistances.y) lod = 2u;
+        if (lodDist > lodDistances.z) lod = 3u;
+    }
+    return min(lod + constants.lodShift, constants.lodCount - 1u); // per-mesh shift toward coarser
+}
+
+#endif
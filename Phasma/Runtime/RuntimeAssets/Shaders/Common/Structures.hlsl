@@ -137,6 +137,11 @@ struct Mesh_Constants
     uint lodShift;       // per-mesh additive LOD level offset (see Mesh::lodShift)
     uint lodMeshEnabled; // 0 = this mesh ignores LOD (always full detail)
     float lodMeshBias;   // per-mesh camera-distance multiplier (see Mesh::lodBias)
+    float lodError[4];   // per-level object-space error (see Mesh::lodError)
+    uint vertexFormat;   // 0 = Vertex / PositionUvVertex, 1 = PackedVertex (see VertexFetch.hlsl)
+    uint vertexBase;     // draw vertexOffset (D3D12 leaves it out of SV_VertexID)
+    uint vertexStream;   // byte offset of vertex 0 of the GBuffer stream
+    uint positionStream; // byte offset of vertex 0 of the depth/shadow stream
 };
 
 struct MaterialGpuData
@@ -171,15 +176,11 @@ struct VS_INPUT_Depth
 #endif
 };
 
-struct VS_INPUT_Gbuffer
+// Scene meshes in the depth, shadow and GBuffer passes: the vertex itself is pulled from the geometry
+// buffer (see VertexFetch.hlsl), so only the vertex and draw ids come in
+struct VS_INPUT_MeshVertex
 {
-    float3 position : POSITION;
-    float2 texCoord : TEXCOORD;
-    float3 normal : NORMAL;
-    float4 tangent : TANGENT;
-    float4 color : COLOR;
-    uint4 joints : BLENDINDICES;
-    float4 weights : BLENDWEIGHT;
+    uint vertexId : SV_VertexID;
 #if defined(PE_DX12)
     uint id : PE_DRAW_ID;
 #else
@@ -0,0 +1,152 @@
+#ifndef VERTEX_FETCH_H_
+#define VERTEX_FETCH_H_
+
+#include "Structures.hlsl"
+
+// Vertex pulling for the scene geometry buffer. The depth, shadow and GBuffer VS read their vertices
+// from the combined geometry buffer instead of vertex input, so float meshes and packed (cooked)
+// meshes go through the same pipelines and the same indirect draws. Mesh_Constants::vertexFormat picks
+// the layout; the byte layouts below MUST match Vertex, PositionUvVertex and PackedVertex in Vertex.h.
+//   Vertex (96 B):           position 0, uv 12, normal 20, tangent 32, color 48, joints 64, weights 80
+//   PositionUvVertex (52 B): position 0, uv 12, joints 20, weights 36
+//   PackedVertex (40 B):     position 0, uv 12 (half2), normal 16 / tangent 20 (oct snorm16x2),
+//                            color 24 (unorm8x4), joints 28 (u8x4), weights 32 (unorm16x4)
+
+static const uint VERTEX_FORMAT_FLOAT = 0u;
+static const uint VERTEX_FORMAT_PACKED = 1u;
+
+static const uint VERTEX_STRIDE = 96u;
+static const uint POSITION_UV_VERTEX_STRIDE = 52u;
+static const uint PACKED_VERTEX_STRIDE = 40u;
+
+struct GbufferVertex
+{
+    float3 position;
+    float2 uv;
+    float3 normal;
+    float4 tangent;
+    float4 color;
+    uint4 joints;
+    float4 weights;
+};
+
+struct DepthVertex
+{
+    float3 position;
+    float2 uv;
+    uint4 joints;
+    float4 weights;
+};
+
+// Vulkan folds the draw's vertexOffset into SV_VertexID; D3D12 does not
+uint VertexFetchIndex(Mesh_Constants mc, uint vertexId)
+{
+#if defined(PE_DX12)
+    return vertexId + mc.vertexBase;
+#else
+    return vertexId;
+#endif
+}
+
+// Matches OctDecode in ModelAssetCooked.cpp
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+int2 UnpackSnorm16x2(uint bits)
+{
+    return int2(int(bits << 16) >> 16, int(bits) >> 16);
+}
+
+float2 UnpackHalf2(uint bits)
+{
+    return float2(f16tof32(bits & 0xFFFFu), f16tof32(bits >> 16));
+}
+
+uint4 UnpackU8x4(uint bits)
+{
+    return uint4(bits & 0xFFu, (bits >> 8) & 0xFFu, (bits >> 16) & 0xFFu, bits >> 24);
+}
+
+float4 UnpackUnorm16x4(uint2 bits)
+{
+    return float4(bits.x & 0xFFFFu, bits.x >> 16, bits.y & 0xFFFFu, bits.y >> 16) / 65535.0;
+}
+
+// Bit 0 of the tangent's second component is the bitangent sign (1 = -1)
+float4 UnpackPackedTangent(uint bits)
+{
+    int2 q = UnpackSnorm16x2(bits);
+    float bitangentSign = (q.y & 1) ? -1.0 : 1.0;
+    q.y &= ~1;
+    return float4(OctDecode(q / 32767.0), bitangentSign);
+}
+
+GbufferVertex LoadPackedGbufferVertex(ByteAddressBuffer geometry, uint offset)
+{
+    uint4 a = geometry.Load4(offset + 0);  // position, uv
+    uint4 b = geometry.Load4(offset + 16); // normal, tangent, color, joints
+    uint2 w = geometry.Load2(offset + 32); // weights
+
+    GbufferVertex v;
+    v.position = asfloat(a.xyz);
+    v.uv = UnpackHalf2(a.w);
+    v.normal = OctDecode(UnpackSnorm16x2(b.x) / 32767.0);
+    v.tangent = UnpackPackedTangent(b.y);
+    v.color = UnpackU8x4(b.z) / 255.0;
+    v.joints = UnpackU8x4(b.w);
+    v.weights = UnpackUnorm16x4(w);
+    return v;
+}
+
+GbufferVertex LoadFloatGbufferVertex(ByteAddressBuffer geometry, uint offset)
+{
+    GbufferVertex v;
+    v.position = asfloat(geometry.Load3(offset + 0));
+    v.uv = asfloat(geometry.Load2(offset + 12));
+    v.normal = asfloat(geometry.Load3(offset + 20));
+    v.tangent = asfloat(geometry.Load4(offset + 32));
+    v.color = asfloat(geometry.Load4(offset + 48));
+    v.joints = geometry.Load4(offset + 64);
+    v.weights = asfloat(geometry.Load4(offset + 80));
+    return v;
+}
+
+GbufferVertex FetchGbufferVertex(ByteAddressBuffer geometry, Mesh_Constants mc, uint vertexId)
+{
+    uint index = VertexFetchIndex(mc, vertexId);
+    if (mc.vertexFormat == VERTEX_FORMAT_PACKED)
+        return LoadPackedGbufferVertex(geometry, mc.vertexStream + index * PACKED_VERTEX_STRIDE);
+    return LoadFloatGbufferVertex(geometry, mc.vertexStream + index * VERTEX_STRIDE);
+}
+
+DepthVertex FetchDepthVertex(ByteAddressBuffer geometry, Mesh_Constants mc, uint vertexId)
+{
+    uint index = VertexFetchIndex(mc, vertexId);
+    DepthVertex v;
+    if (mc.vertexFormat == VERTEX_FORMAT_PACKED)
+    {
+        uint offset = mc.positionStream + index * PACKED_VERTEX_STRIDE;
+        uint4 a = geometry.Load4(offset + 0);
+        v.position = asfloat(a.xyz);
+        v.uv = UnpackHalf2(a.w);
+        v.joints = UnpackU8x4(geometry.Load(offset + 28));
+        v.weights = UnpackUnorm16x4(geometry.Load2(offset + 32));
+    }
+    else
+    {
+        uint offset = mc.positionStream + index * POSITION_UV_VERTEX_STRIDE;
+        v.position = asfloat(geometry.Load3(offset + 0));
+        v.uv = asfloat(geometry.Load2(offset + 12));
+        v.joints = geometry.Load4(offset + 20);
+        v.weights = asfloat(geometry.Load4(offset + 36));
+    }
+    return v;
+}
+
+#endif
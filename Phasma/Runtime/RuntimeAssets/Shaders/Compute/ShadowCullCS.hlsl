@@ -1,4 +1,5 @@
 #include "../Common/Structures.hlsl"
+#include "../Common/MeshLod.hlsl"
 
 struct DrawIndexedIndirectCommand
 {
@@ -16,17 +17,6 @@ struct DrawIndexedIndirectCommand
 [[vk::binding(4, 0)]] RWStructuredBuffer<DrawIndexedIndirectCommand> IndirectVoxelsOut;
 [[vk::binding(12, 0)]] ByteAddressBuffer NodeData;
 
-// Same LOD params buffer the main CullingCS consumes (Scene::UpdateLodUniforms, binding 16). Lets the
-// shadow cull pick each caster's LOD by camera distance instead of always emitting LOD0.
-[[vk::binding(16, 0)]] cbuffer LodUBO
-{
-    uint lodEnabled;
-    uint lodPad0;
-    float lodBias;
-    float lodPad1;
-    float4 lodDistances;
-};
-
 struct PushConstants
 {
     uint maxDrawCount;
@@ -116,7 +106,7 @@ uint WaveAppend(uint counterIndex, bool emit)
     if (!AABBInFrustum(aabbMin, aabbMax))
         return;
 
-    // Discrete LOD: override this draw's index range by camera distance, exactly like CullingCS, so
+    // Discrete LOD: override this draw's index range exactly like CullingCS, so
     // shadow casters shed vertices with distance instead of transforming full-res geometry x4 cascades.
     // shadowLodBias>1 drops shadow detail sooner than the visible geometry (PCF-blurred silhouettes
     // tolerate it); shadowLodBias<=0 keeps full-res (baseline / A-B toggle).
@@ -124,11 +114,7 @@ uint WaveAppend(uint counterIndex, bool emit)
     {
         float3 lodCenter = (aabbMin + aabbMax) * 0.5;
         float lodDist = distance(pc.cameraPos, lodCenter) * lodBias * constants.lodMeshBias * pc.shadowLodBias;
-        uint lod = 0u;
-        if (lodDist > lodDistances.x) lod = 1u;
-        if (lodDist > lodDistances.y) lod = 2u;
-        if (lodDist > lodDistances.z) lod = 3u;
-        lod = min(lod + constants.lodShift, constants.lodCount - 1u);
+        uint lod = PickMeshLod(constants, worldMatrix, lodDist);
         cmd.firstIndex = constants.lodIndexOffset[lod];
         cmd.indexCount = constants.lodIndexCount[lod];
     }
@@ -1,5 +1,6 @@
 #include "../Common/Structures.hlsl"
 #include "../Common/Common.hlsl"
+#include "../Common/VertexFetch.hlsl"
 
 // --- ByteAddressBuffer data ---
 // PerFrameData                 -> 4 * sizeof(mat4)
@@ -11,6 +12,7 @@
 [[vk::push_constant]] PushConstants_DepthPass pc;
 [[vk::binding(0, 0)]] ByteAddressBuffer data;
 [[vk::binding(1, 0)]] StructuredBuffer<Mesh_Constants> constants;
+[[vk::binding(2, 0)]] ByteAddressBuffer geometry;
 
 static const uint MATRIX_SIZE = 64u;
 static const uint MESH_DATA_SIZE = MATRIX_SIZE * 2u + 16u; // +16B: NodeGpuData render-visible/flags tail
@@ -32,11 +34,12 @@ float4x4 GetViewProjection()                  { return LoadMatrix(0); }
 float4x4 GetMeshMatrix(uint id)               { return LoadMatrix(constants[id].meshDataOffset); }
 float4x4 GetJointMatrix(uint id, uint index)  { return LoadMatrix(constants[id].meshDataOffset + MESH_DATA_SIZE + index * MATRIX_SIZE); }
 
-VS_OUTPUT_Position_Uv_ID mainVS(VS_INPUT_Depth input)
+VS_OUTPUT_Position_Uv_ID mainVS(VS_INPUT_MeshVertex vertexInput)
 {
     VS_OUTPUT_Position_Uv_ID output;
 
-    const uint id = input.id;
+    const uint id = vertexInput.id;
+    const DepthVertex input = FetchDepthVertex(geometry, constants[id], vertexInput.vertexId);
     output.id = id;
     const bool spriteFrameBlend = input.joints.w == SPRITE_FRAME_BLEND_MARKER;
     output.nextUv = spriteFrameBlend ? float2(asfloat(input.joints.x), asfloat(input.joints.y)) : input.uv;
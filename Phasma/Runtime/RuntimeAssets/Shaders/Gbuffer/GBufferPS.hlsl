@@ -33,6 +33,13 @@ float4 GetNormal(uint id, float2 uv)             { return SampleArray(uv, consta
 float4 GetOcclusion(uint id, float2 uv)          { return SampleArray(uv, constants[id].meshImageIndex[3]); }
 float4 GetEmissive(uint id, float2 uv)           { return SampleArray(uv, constants[id].meshImageIndex[4]); }
 
+// Cooked normal maps keep XY only (BC5, or a flat Z for ASTC); Z is rebuilt for every normal map alike
+float3 GetTangentNormal(uint id, float2 uv)
+{
+    float2 xy = GetNormal(id, uv).xy * 2.0 - 1.0;
+    return float3(xy, sqrt(saturate(1.0 - dot(xy, xy))));
+}
+
 PS_OUTPUT_Gbuffer mainPS(PS_INPUT_Gbuffer input)
 {
     PS_OUTPUT_Gbuffer output;
@@ -61,12 +68,12 @@ PS_OUTPUT_Gbuffer mainPS(PS_INPUT_Gbuffer input)
     float3 normalWS = N;
     if (HasTexture(textureMask, TEX_NORMAL_BIT))
     {
-        float3 tangentNormal = GetNormal(id, uv).xyz;
+        float3 tangentNormal = GetTangentNormal(id, uv);
         float3 T = normalize(input.tangent.xyz);
         T = normalize(T - dot(T, N) * N);
         float3 B = cross(N, T) * input.tangent.w;
         float3x3 TBN = float3x3(T, B, N);
-        normalWS = normalize(mul(tangentNormal * 2.0 - 1.0, TBN));
+        normalWS = normalize(mul(tangentNormal, TBN));
     }
 
     float metallic = mat.pbrParams.x;
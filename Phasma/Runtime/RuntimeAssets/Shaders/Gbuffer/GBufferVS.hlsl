@@ -1,5 +1,6 @@
 #include "../Common/Structures.hlsl"
 #include "../Common/Common.hlsl"
+#include "../Common/VertexFetch.hlsl"
 
 // --- ByteAddressBuffer data ---
 // PerFrameData                 -> 4 * sizeof(mat4)
@@ -11,6 +12,7 @@
 [[vk::push_constant]] PushConstants_GBuffer pc;
 [[vk::binding(0, 0)]] ByteAddressBuffer data;
 [[vk::binding(1, 0)]] StructuredBuffer<Mesh_Constants> constants;
+[[vk::binding(2, 0)]] ByteAddressBuffer geometry;
 
 static const uint MATRIX_SIZE = 64u;
 static const uint MESH_DATA_SIZE = MATRIX_SIZE * 2u + 16u; // +16B: NodeGpuData render-visible/flags tail
@@ -34,15 +36,17 @@ float4x4 GetMeshMatrix(uint id)               { return LoadMatrix(constants[id].
 float4x4 GetMeshPreviousMatrix(uint id)       { return LoadMatrix(constants[id].meshDataOffset + MATRIX_SIZE); }
 float4x4 GetJointMatrix(uint id, uint index)  { return LoadMatrix(constants[id].meshDataOffset + MESH_DATA_SIZE + index * MATRIX_SIZE); }
 
-VS_OUTPUT_Gbuffer mainVS(VS_INPUT_Gbuffer input)
+VS_OUTPUT_Gbuffer mainVS(VS_INPUT_MeshVertex vertexInput)
 {
+    const uint id = vertexInput.id;
+    const GbufferVertex input = FetchGbufferVertex(geometry, constants[id], vertexInput.vertexId);
+
     VS_OUTPUT_Gbuffer output;
-    output.uv = input.texCoord.xy;
+    output.uv = input.uv;
     const bool spriteFrameBlend = input.joints.w == SPRITE_FRAME_BLEND_MARKER;
-    output.nextUv = spriteFrameBlend ? float2(asfloat(input.joints.x), asfloat(input.joints.y)) : input.texCoord.xy;
+    output.nextUv = spriteFrameBlend ? float2(asfloat(input.joints.x), asfloat(input.joints.y)) : input.uv;
     output.spriteBlend = spriteFrameBlend ? asfloat(input.joints.z) : 0.0f;
 
-    const uint id = input.id;
     output.id = id;
 
     float4x4 boneTransform = identity_mat;
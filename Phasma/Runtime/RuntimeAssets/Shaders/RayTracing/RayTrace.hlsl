@@ -1,6 +1,7 @@
 #include "../Common/Common.hlsl"
 #include "../Common/MaterialFlags.hlsl"
 #include "../Common/Structures.hlsl"
+#include "../Common/VertexFetch.hlsl"
 #include "../Gbuffer/PBR.hlsl"
 #include "../Common/IBL.hlsl"
 
@@ -12,6 +13,7 @@ struct MeshInfoGPU
     uint renderType;   // 1: Opaque, 2: AlphaCut, 3: AlphaBlend, 4: Transmission
     uint constantsIndex;
     int textures[5];
+    uint vertexFormat; // Mesh_Constants::vertexFormat; vertexOffset is the byte offset in that layout
 };
 
 struct HitPayload
@@ -26,17 +28,6 @@ struct HitPayload
     float  opaqueTMax;
 };
 
-struct Vertex
-{
-    float3 position;
-    float2 uv;
-    float3 normal;
-    float4 tangent;
-    float4 color;
-    uint4 joints;
-    float4 weights;
-};
-
 // --- ByteAddressBuffer data ---
 // PerFrameData                 -> 4 * sizeof(mat4)
 // Constant Buffer indices      -> num of draw calls * sizeof(uint)
@@ -196,6 +187,13 @@ float4 GetNormal(uint id, float2 uv)             { return SampleArray(uv, consta
 float4 GetOcclusion(uint id, float2 uv)          { return SampleArray(uv, constants[id].meshImageIndex[3]); }
 float4 GetEmissive(uint id, float2 uv)           { return SampleArray(uv, constants[id].meshImageIndex[4]); }
 
+// Cooked normal maps keep XY only (BC5, or a flat Z for ASTC); Z is rebuilt for every normal map alike
+float3 GetTangentNormal(uint id, float2 uv)
+{
+    float2 xy = GetNormal(id, uv).xy * 2.0 - 1.0;
+    return float3(xy, sqrt(saturate(1.0 - dot(xy, xy))));
+}
+
 
 
 uint3 GetIndices(uint meshId, uint primitiveId)
@@ -205,26 +203,17 @@ uint3 GetIndices(uint meshId, uint primitiveId)
     return geometry.Load3(offset);
 }
 
-Vertex GetVertex(uint meshId, uint vertexIndex)
+GbufferVertex GetVertex(uint meshId, uint vertexIndex)
 {
     uint vertexOffset = meshInfos[meshId].vertexOffset;
-    uint offset = vertexOffset + vertexIndex * 96;
-
-    Vertex v;
-    v.position = asfloat(geometry.Load3(offset + 0));
-    v.uv = asfloat(geometry.Load2(offset + 12));
-    v.normal = asfloat(geometry.Load3(offset + 20));
-    v.tangent = asfloat(geometry.Load4(offset + 32));
-    v.color = asfloat(geometry.Load4(offset + 48));
-    v.joints = geometry.Load4(offset + 64);
-    v.weights = asfloat(geometry.Load4(offset + 80));
-
-    return v;
+    if (meshInfos[meshId].vertexFormat == VERTEX_FORMAT_PACKED)
+        return LoadPackedGbufferVertex(geometry, vertexOffset + vertexIndex * PACKED_VERTEX_STRIDE);
+    return LoadFloatGbufferVertex(geometry, vertexOffset + vertexIndex * VERTEX_STRIDE);
 }
 
 // Apply skeletal skinning to a vertex using joint matrices from the storage buffer.
 // The meshId is used to look up per-node joint matrices via GetJointMatrix.
-Vertex SkinVertex(Vertex v, uint meshId)
+GbufferVertex SkinVertex(GbufferVertex v, uint meshId)
 {
     if (pc.jointsCount == 0)
         return v; // No skeleton in scene
@@ -707,9 +696,9 @@ void anyhit(inout HitPayload payload, in BuiltInTriangleIntersectionAttributes a
     uint primitiveId = PrimitiveIndex();
 
     uint3 indices = GetIndices(instanceId, primitiveId);
-    Vertex v0 = SkinVertex(GetVertex(instanceId, indices.x), constantsId);
-    Vertex v1 = SkinVertex(GetVertex(instanceId, indices.y), constantsId);
-    Vertex v2 = SkinVertex(GetVertex(instanceId, indices.z), constantsId);
+    GbufferVertex v0 = SkinVertex(GetVertex(instanceId, indices.x), constantsId);
+    GbufferVertex v1 = SkinVertex(GetVertex(instanceId, indices.y), constantsId);
+    GbufferVertex v2 = SkinVertex(GetVertex(instanceId, indices.z), constantsId);
 
     float3 barycentricCoords = float3(1.0f - attr.barycentrics.x - attr.barycentrics.y, attr.barycentrics.x, attr.barycentrics.y);
     float2 uv = v0.uv * barycentricCoords.x + v1.uv * barycentricCoords.y + v2.uv * barycentricCoords.z;
@@ -744,9 +733,9 @@ void closesthit(inout HitPayload payload, in BuiltInTriangleIntersectionAttribut
     uint3 indices = GetIndices(instanceId, primitiveId);
 
     // Interpolate vertex attributes (apply skinning if weighted)
-    Vertex v0 = SkinVertex(GetVertex(instanceId, indices.x), constantsId);
-    Vertex v1 = SkinVertex(GetVertex(instanceId, indices.y), constantsId);
-    Vertex v2 = SkinVertex(GetVertex(instanceId, indices.z), constantsId);
+    GbufferVertex v0 = SkinVertex(GetVertex(instanceId, indices.x), constantsId);
+    GbufferVertex v1 = SkinVertex(GetVertex(instanceId, indices.y), constantsId);
+    GbufferVertex v2 = SkinVertex(GetVertex(instanceId, indices.z), constantsId);
 
     float3 barycentricCoords = float3(1.0f - attr.barycentrics.x - attr.barycentrics.y, attr.barycentrics.x, attr.barycentrics.y);
 
@@ -816,11 +805,11 @@ void closesthit(inout HitPayload payload, in BuiltInTriangleIntersectionAttribut
     float3 N = normalWorld;
     if (HasTexture(textureMask, TEX_NORMAL_BIT))
     {
-        float3 tangentNormalSample = GetNormal(constantsId, uv).xyz;
+        float3 tangentNormal = GetTangentNormal(constantsId, uv);
         tangentWorld = normalize(tangentWorld - dot(tangentWorld, normalWorld) * normalWorld);
         float3 bitangentWorld = cross(normalWorld, tangentWorld) * tangentObj.w;
         float3x3 TBN = float3x3(tangentWorld, bitangentWorld, normalWorld);
-        N = normalize(mul(tangentNormalSample * 2.0 - 1.0, TBN));
+        N = normalize(mul(tangentNormal, TBN));
     }
 
     // 4. Lighting (IBL)
@@ -1,9 +1,11 @@
 #include "../Common/Structures.hlsl"
 #include "../Common/Common.hlsl"
+#include "../Common/VertexFetch.hlsl"
 
 [[vk::push_constant]] PushConstants_Shadows pc;
 [[vk::binding(0, 0)]] ByteAddressBuffer data;
 [[vk::binding(1, 0)]] StructuredBuffer<Mesh_Constants> constants;
+[[vk::binding(2, 0)]] ByteAddressBuffer geometry;
 
 static const uint MATRIX_SIZE = 64u;
 static const uint MESH_DATA_SIZE = MATRIX_SIZE * 2u + 16u; // +16B: NodeGpuData render-visible/flags tail
@@ -25,11 +27,12 @@ float4x4 GetMeshMatrix(uint id)               { return LoadMatrix(constants[id].
 float4x4 GetJointMatrix(uint id, uint index)  { return LoadMatrix(constants[id].meshDataOffset + MESH_DATA_SIZE + index * MATRIX_SIZE); }
 
 
-VS_OUTPUT_Position_Uv mainVS(VS_INPUT_Depth input)
+VS_OUTPUT_Position_Uv mainVS(VS_INPUT_MeshVertex vertexInput)
 {
     VS_OUTPUT_Position_Uv output;
 
-    const uint id = input.id;
+    const uint id = vertexInput.id;
+    const DepthVertex input = FetchDepthVertex(geometry, constants[id], vertexInput.vertexId);
     
     float4x4 jointTransform = identity_mat;
     if (pc.jointsCount > 0)
@@ -968,10 +968,10 @@ extern "C"
         if (stagingBytes > 0 && data)
             copyTightRows(static_cast<uint8_t *>(alloc.data));
         if (stagingBytes > 0)
-            alloc.buffer->Flush(stagingBytes, 0);
+            alloc.buffer->Flush(stagingBytes, alloc.offset);
 
         vk::BufferImageCopy2 region{};
-        region.bufferOffset = 0;
+        region.bufferOffset = alloc.offset;
         // bufferRowLength = 0 / bufferImageHeight = 0 means "tightly packed, derived from
         // imageExtent" — we pre-packed the staging buffer above to match exactly that.
         region.bufferRowLength = 0;
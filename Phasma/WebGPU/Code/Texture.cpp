@@ -240,7 +240,7 @@ namespace pwgpu
         // Vulkan forbids vkCmdClearColorImage on compressed images, so zeroing happens via
         // copyBufferToImage from a host-visible buffer of zeros. Sizing that buffer to the
         // sum of all touched subresources scales with the full mip chain. Allocate exactly
-        // the largest single subresource instead and replay it via bufferOffset=0 for every
+        // the largest single subresource instead and replay it from the allocation's offset for every
         // region — the GPU reads the same zero range N times. Worst-case host memory drops
         // from O(mip0 * 4/3) to O(mip0), and StagingManager::Allocate failure now affects
         // only the largest subresource's footprint.
@@ -257,7 +257,7 @@ namespace pwgpu
         pe::StagingAllocation alloc =
             pe::GetRHI().GetStagingManager()->Allocate(static_cast<size_t>(maxBytes));
         std::memset(alloc.data, 0, static_cast<size_t>(maxBytes));
-        alloc.buffer->Flush(static_cast<size_t>(maxBytes), 0);
+        alloc.buffer->Flush(static_cast<size_t>(maxBytes), alloc.offset);
 
         std::vector<vk::BufferImageCopy2> regions;
         regions.reserve(mipLayerPairs.size());
@@ -271,7 +271,7 @@ namespace pwgpu
                                       : 1u;
 
             vk::BufferImageCopy2 region{};
-            region.bufferOffset = 0;
+            region.bufferOffset = alloc.offset;
             region.bufferRowLength = 0;
             region.bufferImageHeight = 0;
             region.imageSubresource.aspectMask = vk::ImageAspectFlagBits::eColor;
@@ -10,7 +10,8 @@ asset the Assimp-less, runtime-compiler-less device consumes.
 Steps:
   1. (optional) Build the desktop PhasmaCook tool with --build.
   2. Run "PhasmaCook <source> <out.pemesh>" to import <source> via Assimp and write <name>.pemesh
-     plus referenced textures in a self-contained layout.
+     plus its textures, cooked to block-compressed .petex mip chains (BC and ASTC), in a
+     self-contained layout.
 
 Cooked assets are build artifacts and never live under Phasma/Editor/EditorAssets (the source tree).
 
@@ -88,7 +89,7 @@ def main() -> int:
         return 1
 
     size_kb = out_pemesh.stat().st_size / 1024.0
-    print(f"[cook] cooked {out_pemesh} ({size_kb:.1f} KB); referenced textures copied by the cook host")
+    print(f"[cook] cooked {out_pemesh} ({size_kb:.1f} KB); referenced textures cooked to .petex by the cook host")
     print(f"[cook] done: {args.out_dir}/{name}/ is self-contained ({name}.pemesh + textures).")
     return 0
 
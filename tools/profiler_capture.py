@@ -37,6 +37,7 @@ def compact_snapshot(frame, scope_threshold_ms):
         "frame_history": frame.get("frame_history", []),
         "cpu": {
             "total_ms": cpu.get("total_ms", 0.0),
+            "threads": cpu.get("threads", []),
             "scopes": [
                 scope
                 for scope in cpu.get("scopes", [])